@@ -0,0 +1,840 @@
+// hide from doxygen
+#ifndef IN_DOXYGEN
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
+
+#include <json/json.h>
+
+#include <arcanecore/base/Exceptions.hpp>
+#include <arcanecore/base/str/Atom.hpp>
+#include <arcanecore/base/str/StringConstants.hpp>
+#include <arcanecore/base/str/StringOperations.hpp>
+#include <arcanecore/base/str/UTF16Decoder.hpp>
+#include <arcanecore/io/sys/FileWriter.hpp>
+
+#include <arcanecore/log/Shared.hpp>
+#include <arcanecore/log/outputs/StdOutput.hpp>
+
+
+//------------------------------------------------------------------------------
+//                                   CONSTANTS
+//------------------------------------------------------------------------------
+
+static const arc::str::UTF8String APP_NAME("ArcaneCore::StrBenchmark");
+//----------------------------COMMAND LINE ARGUMENTS----------------------------
+// shows the help and exits
+static const arc::str::UTF8String ARG_HELP("--help");
+// defines the path the JSON results are written to
+static const arc::str::UTF8String ARG_OUTPUT("--output");
+// defines the size in bytes of the UTF-8 text that is transcoded
+static const arc::str::UTF8String ARG_TEXT_SIZE("--text_size");
+// defines the number of times each benchmark is run
+static const arc::str::UTF8String ARG_ITERATIONS("--iterations");
+
+//------------------------------------------------------------------------------
+//                                    GLOBALS
+//------------------------------------------------------------------------------
+
+// logging
+arc::log::Input* g_logger = nullptr;
+arc::log::StdOutput* g_std_output = nullptr;
+// where results are written, or empty for stdout
+arc::io::sys::Path g_output;
+// the size of the text that is transcoded
+arc::uint64 g_text_size = 16777216U;
+// the number of times each benchmark is run
+arc::uint64 g_iterations = 3;
+// prevents benchmarked work from being optimised away
+volatile std::size_t g_sink = 0;
+
+//------------------------------------------------------------------------------
+//                                   PROTOTYPES
+//------------------------------------------------------------------------------
+
+/*!
+ * \brief Parses the command line arguments.
+ */
+int parse_args(int argc, char* argv[]);
+
+/*!
+ * \brief Runs all benchmarks and writes the results.
+ */
+int execute();
+
+/*!
+ * \brief Measures transcoding the given text between UTF-8 and UTF-16 with the
+ *        current and previous implementations.
+ */
+void benchmark_transcode(
+        const char* text_name,
+        const arc::str::UTF8String& text,
+        Json::Value& results);
+
+/*!
+ * \brief Measures formatting numbers into a UTF8String and parsing them back
+ *        with the current and previous implementations.
+ */
+void benchmark_numbers(Json::Value& results);
+
+/*!
+ * \brief Measures looking up UTF8String keys in a std::unordered_map with the
+ *        current and previous hash functions, and looking up the same keys as
+ *        interned Atoms.
+ */
+void benchmark_hash(Json::Value& results);
+
+/*!
+ * \brief cleans up memory before exiting.
+ */
+void cleanup();
+
+/*!
+ * \brief Shows the help print out for this tool.
+ */
+void show_help();
+
+//------------------------------------------------------------------------------
+//                                 MAIN FUNCTION
+//------------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    // set up logging, results may be written to stdout so only errors are
+    // reported
+    g_logger = arc::log::shared_handler.vend_input(arc::log::Profile(APP_NAME));
+    g_std_output = new arc::log::StdOutput(arc::log::VERBOSITY_WARNING);
+    arc::log::shared_handler.add_output(g_std_output);
+
+    // parse arguments
+    int ret_code = parse_args(argc, argv);
+    if(ret_code != 0)
+    {
+        cleanup();
+        return ret_code;
+    }
+
+    ret_code = execute();
+
+    cleanup();
+    return ret_code;
+}
+
+//------------------------------------------------------------------------------
+//                                   FUNCTIONS
+//------------------------------------------------------------------------------
+
+/*!
+ * \brief Reads the unsigned integer value following the argument at the given
+ *        index.
+ */
+static bool parse_uint_arg(
+        int argc,
+        char* argv[],
+        std::size_t& i,
+        arc::uint64& value)
+{
+    arc::str::UTF8String arg(argv[i]);
+    if(i >= static_cast<std::size_t>(argc) - 1)
+    {
+        g_logger->critical << "Incorrect usage of argument \"" << arg
+                           << "\". It must be followed by an unsigned "
+                           << "integral number." << std::endl;
+        return false;
+    }
+
+    arc::str::UTF8String value_s(argv[++i]);
+    if(!value_s.is_uint())
+    {
+        g_logger->critical << "Incorrect usage of argument \"" << arg
+                           << "\". The provided value must be an unsigned "
+                           << "integral number, whereas \"" << value_s
+                           << "\" was given." << std::endl;
+        return false;
+    }
+    value = value_s.to_uint64();
+    return true;
+}
+
+int parse_args(int argc, char* argv[])
+{
+    std::size_t arg_count = static_cast<std::size_t>(argc);
+    for(std::size_t i = 1; i < arg_count; ++i)
+    {
+        arc::str::UTF8String arg(argv[i]);
+
+        // output
+        if(arg == ARG_OUTPUT)
+        {
+            // check there is another argument
+            if(i >= arg_count - 1)
+            {
+                g_logger->critical << "Incorrect usage of argument \"" << arg
+                                   << "\". It must be followed by a path."
+                                   << std::endl;
+                return -1;
+            }
+            g_output = arc::io::sys::Path(arc::str::UTF8String(argv[++i]));
+        }
+        // sizes
+        else if(arg == ARG_TEXT_SIZE)
+        {
+            if(!parse_uint_arg(argc, argv, i, g_text_size))
+            {
+                return -1;
+            }
+        }
+        else if(arg == ARG_ITERATIONS)
+        {
+            if(!parse_uint_arg(argc, argv, i, g_iterations))
+            {
+                return -1;
+            }
+            if(g_iterations == 0)
+            {
+                g_iterations = 1;
+            }
+        }
+        // help
+        else if(arg == ARG_HELP)
+        {
+            show_help();
+            return 1;
+        }
+        else
+        {
+            g_logger->critical << "Unrecognised argument: \"" << arg << "\""
+                               << std::endl;
+            show_help();
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+/*!
+ * \brief The implementation of arc::str::utf8_to_utf16 that encoded one
+ *        symbol at a time into a growing vector, kept for comparison.
+ */
+static char* previous_utf8_to_utf16(
+        const arc::str::UTF8String& data,
+        std::size_t& r_length,
+        arc::data::Endianness endianness)
+{
+    std::vector<unsigned char> v_str;
+    for(std::size_t i = 0; i < data.get_length(); ++i)
+    {
+        arc::uint32 code_point = data.get_code_point(i);
+        bool is_surrogate_pair = false;
+        if(code_point > arc::str::UTF16_MAX_2BYTE)
+        {
+            is_surrogate_pair = true;
+            code_point -= arc::str::UTF16_4BYTE_OFFSET;
+            arc::uint32 high_surrogate =
+                arc::str::UTF16_HIGH_SURROGATE_MIN +
+                ((code_point >> 10) & 0x3FF);
+            arc::uint32 low_surrogate =
+                arc::str::UTF16_LOW_SURROGATE_MIN + (code_point & 0x3FF);
+            code_point = (high_surrogate << 16) | low_surrogate;
+        }
+
+        if(endianness == arc::data::ENDIAN_LITTLE)
+        {
+            if(is_surrogate_pair)
+            {
+                v_str.push_back(code_point >> 16);
+                v_str.push_back(code_point >> 24);
+            }
+            v_str.push_back(code_point);
+            v_str.push_back(code_point >> 8);
+        }
+        else
+        {
+            if(is_surrogate_pair)
+            {
+                v_str.push_back(code_point >> 24);
+                v_str.push_back(code_point >> 16);
+            }
+            v_str.push_back(code_point >> 8);
+            v_str.push_back(code_point);
+        }
+    }
+    v_str.push_back(0x00);
+    v_str.push_back(0x00);
+
+    r_length = v_str.size();
+    char* s = new char[r_length];
+    for(std::size_t i = 0; i < v_str.size(); ++i)
+    {
+        s[i] = static_cast<char>(v_str[i]);
+    }
+    return s;
+}
+
+/*!
+ * \brief The implementation of arc::str::utf16_to_utf8 that decoded into an
+ *        initialised vector, kept for comparison.
+ */
+static arc::str::UTF8String previous_utf16_to_utf8(
+        const char* data,
+        std::size_t byte_length,
+        arc::data::Endianness endianness)
+{
+    arc::str::UTF16Decoder decoder(endianness);
+    std::size_t capacity =
+        arc::str::UTF16Decoder::get_max_output_length(byte_length) +
+        arc::str::UTF16Decoder::MAX_FINISH_LENGTH;
+    std::vector<char> utf8(capacity);
+    std::size_t length = decoder.decode(data, byte_length, &utf8[0]);
+    length += decoder.finish(&utf8[length]);
+
+    return arc::str::UTF8String(&utf8[0], length);
+}
+
+/*!
+ * \brief The implementation of the UTF8String numeric stream operators that
+ *        formatted through a std::stringstream, kept for comparison.
+ */
+template<typename T_type>
+static void previous_append_number(arc::str::UTF8String& s, T_type value)
+{
+    std::stringstream ss;
+    ss << value;
+    s.concatenate(arc::str::UTF8String(ss.str().c_str()));
+}
+
+/*!
+ * \brief The implementation of arc::str::UTF8String::to_int64 that checked
+ *        each symbol and then parsed with strtol, kept for comparison.
+ */
+static arc::int64 previous_to_int64(const arc::str::UTF8String& s)
+{
+    for(std::size_t i = 0; i < s.get_length(); ++i)
+    {
+        arc::uint32 code_point = s.get_code_point(i);
+        if(!(i == 0 && s.get_symbol(i) == "-") &&
+           !arc::str::is_digit(code_point))
+        {
+            throw arc::ex::ConversionDataError("Invalid integer.");
+        }
+    }
+    return static_cast<arc::int64>(std::strtol(s.get_raw(), NULL, 0));
+}
+
+/*!
+ * \brief The implementation of std::hash<arc::str::UTF8String> that hashed a
+ *        std::string copy of the data, kept for comparison.
+ */
+struct PreviousHash
+{
+    std::size_t operator()(const arc::str::UTF8String& value) const
+    {
+        std::hash<std::string> hasher;
+        return hasher(value.to_std_string());
+    }
+};
+
+/*!
+ * \brief Returns the number of seconds since the given time.
+ */
+static double get_elapsed_seconds(
+        const std::chrono::steady_clock::time_point& start)
+{
+    return std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start).count();
+}
+
+/*!
+ * \brief Runs the given function once per iteration and returns the number of
+ *        seconds taken by the fastest run.
+ */
+template<typename Function>
+static double measure(Function function)
+{
+    double best = -1.0;
+    for(arc::uint64 i = 0; i < g_iterations; ++i)
+    {
+        std::chrono::steady_clock::time_point start =
+            std::chrono::steady_clock::now();
+        function();
+        double seconds = get_elapsed_seconds(start);
+
+        if(best < 0.0 || seconds < best)
+        {
+            best = seconds;
+        }
+    }
+    return best;
+}
+
+/*!
+ * \brief Builds the JSON result of a benchmark.
+ *
+ * \param name The name of the benchmark.
+ * \param parameters The parameters that distinguish this result from others
+ *                   of the same benchmark.
+ * \param seconds The time taken by the fastest run of the benchmark.
+ * \param bytes The number of bytes of UTF-8 text processed by a single run.
+ */
+static Json::Value make_result(
+        const char* name,
+        const Json::Value& parameters,
+        double seconds,
+        arc::uint64 bytes)
+{
+    Json::Value result(Json::objectValue);
+    result["name"] = name;
+    result["parameters"] = parameters;
+    result["seconds"] = seconds;
+    result["bytes"] = static_cast<Json::UInt64>(bytes);
+
+    // guard against timer resolution
+    if(seconds <= 0.0)
+    {
+        seconds = 1e-9;
+    }
+    result["megabytes_per_second"] =
+        (static_cast<double>(bytes) / 1048576.0) / seconds;
+
+    return result;
+}
+
+int execute()
+{
+    // the repeated sample of each text, from plain ASCII to symbols that are
+    // surrogate pairs in UTF-16
+    const char* text_names[] = {"ascii", "mixed", "greek", "cjk", "emoji"};
+    const char* samples[] = {
+        "The quick brown fox jumps over the lazy dog. ",
+        "The quick brown fox jumps over the lazy dog - Ünïcödé ✓ ",
+        "Γειά σου Κόσμε, η γρήγορη καφέ αλεπού. ",
+        "敏捷的棕色狐狸跳过了懒狗。",
+        "Smile 😀 wave 👋 "
+    };
+
+    Json::Value root(Json::objectValue);
+    Json::Value results(Json::arrayValue);
+    try
+    {
+        for(std::size_t t = 0; t < 5; ++t)
+        {
+            arc::str::UTF8String sample(samples[t]);
+            arc::str::UTF8String text;
+            text.reserve(static_cast<std::size_t>(g_text_size));
+            while(text.get_byte_length() + sample.get_byte_length() <=
+                  g_text_size)
+            {
+                text << sample;
+            }
+            benchmark_transcode(text_names[t], text, results);
+        }
+        benchmark_numbers(results);
+        benchmark_hash(results);
+    }
+    catch(const arc::ex::ArcException& e)
+    {
+        g_logger->critical << "Benchmark failed with " << e.get_type() << ": "
+                           << e.what() << std::endl;
+        return -1;
+    }
+
+    Json::Value parameters(Json::objectValue);
+    parameters["text_size"] = static_cast<Json::UInt64>(g_text_size);
+    parameters["iterations"] = static_cast<Json::UInt64>(g_iterations);
+#ifdef ARC_STR_DISABLE_SSE
+    parameters["sse"] = false;
+#else
+    parameters["sse"] = true;
+#endif
+
+    root["benchmark"] = "str";
+    root["parameters"] = parameters;
+    root["results"] = results;
+
+    Json::StyledWriter json_writer;
+    std::string json(json_writer.write(root));
+    if(g_output.is_empty())
+    {
+        std::cout << json;
+    }
+    else
+    {
+        arc::io::sys::FileWriter writer(g_output);
+        writer.write(json.c_str(), json.length());
+        writer.close();
+    }
+
+    return 0;
+}
+
+void benchmark_transcode(
+        const char* text_name,
+        const arc::str::UTF8String& text,
+        Json::Value& results)
+{
+    const arc::data::Endianness endiannesses[] = {
+        arc::data::ENDIAN_LITTLE,
+        arc::data::ENDIAN_BIG
+    };
+    const char* endianness_names[] = {"little", "big"};
+    const arc::uint64 bytes = text.get_byte_length() - 1;
+
+    for(std::size_t e = 0; e < 2; ++e)
+    {
+        const arc::data::Endianness endianness = endiannesses[e];
+        Json::Value parameters(Json::objectValue);
+        parameters["text"] = text_name;
+        parameters["endianness"] = endianness_names[e];
+
+        // the implementations must agree before they are compared
+        std::size_t length = 0;
+        std::size_t previous_length = 0;
+        char* utf16 = arc::str::utf8_to_utf16(text, length, endianness);
+        char* previous_utf16 =
+            previous_utf8_to_utf16(text, previous_length, endianness);
+        bool utf16_matches =
+            length == previous_length &&
+            memcmp(utf16, previous_utf16, length) == 0;
+        delete[] previous_utf16;
+        if(!utf16_matches ||
+           arc::str::utf16_to_utf8(utf16, length - 2, endianness) != text)
+        {
+            delete[] utf16;
+            arc::str::UTF8String error_message;
+            error_message << "Transcoding the \"" << text_name << "\" text "
+                          << "does not match the previous implementation.";
+            throw arc::ex::ValueError(error_message);
+        }
+
+        double seconds = measure(
+            [&]()
+            {
+                std::size_t l = 0;
+                char* u = arc::str::utf8_to_utf16(text, l, endianness);
+                g_sink = g_sink + l;
+                delete[] u;
+            }
+        );
+        results.append(
+            make_result("utf8_to_utf16", parameters, seconds, bytes)
+        );
+
+        seconds = measure(
+            [&]()
+            {
+                std::size_t l = 0;
+                char* u = previous_utf8_to_utf16(text, l, endianness);
+                g_sink = g_sink + l;
+                delete[] u;
+            }
+        );
+        results.append(
+            make_result("previous_utf8_to_utf16", parameters, seconds, bytes)
+        );
+
+        seconds = measure(
+            [&]()
+            {
+                g_sink = g_sink + arc::str::utf16_to_utf8(
+                    utf16,
+                    length - 2,
+                    endianness
+                ).get_byte_length();
+            }
+        );
+        results.append(
+            make_result("utf16_to_utf8", parameters, seconds, bytes)
+        );
+
+        seconds = measure(
+            [&]()
+            {
+                g_sink = g_sink + previous_utf16_to_utf8(
+                    utf16,
+                    length - 2,
+                    endianness
+                ).get_byte_length();
+            }
+        );
+        results.append(
+            make_result("previous_utf16_to_utf8", parameters, seconds, bytes)
+        );
+
+        delete[] utf16;
+    }
+}
+
+void benchmark_numbers(Json::Value& results)
+{
+    // a spread of magnitudes and signs, as found in logs and tables of contents
+    const std::size_t count = static_cast<std::size_t>(g_text_size / 16);
+    std::vector<arc::int64> integers;
+    std::vector<double> doubles;
+    integers.reserve(count);
+    doubles.reserve(count);
+    arc::uint64 state = 88172645463325252ULL;
+    for(std::size_t i = 0; i < count; ++i)
+    {
+        // xorshift
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        arc::int64 value =
+            static_cast<arc::int64>(state >> ((state % 60) + 1));
+        integers.push_back((i % 2 == 0) ? value : -value);
+        doubles.push_back(static_cast<double>(value) / 1048576.0);
+    }
+
+    // the integer output of the implementations must agree
+    arc::str::UTF8String formatted;
+    arc::str::UTF8String previous_formatted;
+    for(std::size_t i = 0; i < count; ++i)
+    {
+        formatted << integers[i] << ",";
+        previous_append_number(previous_formatted, integers[i]);
+        previous_formatted << ",";
+    }
+    if(formatted != previous_formatted)
+    {
+        throw arc::ex::ValueError(
+            "Formatting integers does not match the previous implementation.");
+    }
+    const arc::uint64 bytes = formatted.get_byte_length() - 1;
+
+    Json::Value parameters(Json::objectValue);
+    parameters["count"] = static_cast<Json::UInt64>(count);
+
+    double seconds = measure(
+        [&]()
+        {
+            arc::str::UTF8String s;
+            for(std::size_t i = 0; i < count; ++i)
+            {
+                s << integers[i];
+            }
+            g_sink = g_sink + s.get_byte_length();
+        }
+    );
+    results.append(make_result("format_int64", parameters, seconds, bytes));
+
+    seconds = measure(
+        [&]()
+        {
+            arc::str::UTF8String s;
+            for(std::size_t i = 0; i < count; ++i)
+            {
+                previous_append_number(s, integers[i]);
+            }
+            g_sink = g_sink + s.get_byte_length();
+        }
+    );
+    results.append(
+        make_result("previous_format_int64", parameters, seconds, bytes)
+    );
+
+    seconds = measure(
+        [&]()
+        {
+            arc::str::UTF8String s;
+            for(std::size_t i = 0; i < count; ++i)
+            {
+                s << doubles[i];
+            }
+            g_sink = g_sink + s.get_byte_length();
+        }
+    );
+    results.append(make_result("format_double", parameters, seconds, bytes));
+
+    seconds = measure(
+        [&]()
+        {
+            arc::str::UTF8String s;
+            for(std::size_t i = 0; i < count; ++i)
+            {
+                previous_append_number(s, doubles[i]);
+            }
+            g_sink = g_sink + s.get_byte_length();
+        }
+    );
+    results.append(
+        make_result("previous_format_double", parameters, seconds, bytes)
+    );
+
+    // parse each of the formatted integers back
+    std::vector<arc::str::UTF8String> elements(formatted.split(","));
+    elements.pop_back();
+    for(std::size_t i = 0; i < count; ++i)
+    {
+        if(elements[i].to_int64() != integers[i])
+        {
+            throw arc::ex::ValueError(
+                "Parsing integers does not return the formatted value.");
+        }
+    }
+
+    seconds = measure(
+        [&]()
+        {
+            arc::int64 sum = 0;
+            for(std::size_t i = 0; i < count; ++i)
+            {
+                arc::int64 value = 0;
+                if(elements[i].try_to_int64(value))
+                {
+                    sum += value;
+                }
+            }
+            g_sink = g_sink + static_cast<std::size_t>(sum);
+        }
+    );
+    results.append(make_result("parse_int64", parameters, seconds, bytes));
+
+    seconds = measure(
+        [&]()
+        {
+            arc::int64 sum = 0;
+            for(std::size_t i = 0; i < count; ++i)
+            {
+                sum += previous_to_int64(elements[i]);
+            }
+            g_sink = g_sink + static_cast<std::size_t>(sum);
+        }
+    );
+    results.append(
+        make_result("previous_parse_int64", parameters, seconds, bytes)
+    );
+}
+
+void benchmark_hash(Json::Value& results)
+{
+    // identifiers of the sort used as config keys and resource names
+    const std::size_t count = static_cast<std::size_t>(g_text_size / 64);
+    std::vector<arc::str::UTF8String> keys;
+    keys.reserve(count);
+    arc::uint64 bytes = 0;
+    for(std::size_t i = 0; i < count; ++i)
+    {
+        arc::str::UTF8String key("arcanecore.resource.");
+        key << static_cast<arc::uint64>(i * 2654435761ULL) << ".name";
+        bytes += key.get_byte_length() - 1;
+        keys.push_back(key);
+    }
+
+    std::unordered_map<arc::str::UTF8String, std::size_t> map;
+    std::unordered_map<arc::str::UTF8String, std::size_t, PreviousHash>
+        previous_map;
+    for(std::size_t i = 0; i < count; ++i)
+    {
+        map[keys[i]] = i;
+        previous_map[keys[i]] = i;
+    }
+
+    Json::Value parameters(Json::objectValue);
+    parameters["count"] = static_cast<Json::UInt64>(count);
+
+    // the same key objects are looked up repeatedly, as with identifiers that
+    // are held and reused
+    double seconds = measure(
+        [&]()
+        {
+            std::size_t sum = 0;
+            for(std::size_t i = 0; i < count; ++i)
+            {
+                sum += map.find(keys[i])->second;
+            }
+            g_sink = g_sink + sum;
+        }
+    );
+    results.append(make_result("hash_lookup", parameters, seconds, bytes));
+
+    seconds = measure(
+        [&]()
+        {
+            std::size_t sum = 0;
+            for(std::size_t i = 0; i < count; ++i)
+            {
+                sum += previous_map.find(keys[i])->second;
+            }
+            g_sink = g_sink + sum;
+        }
+    );
+    results.append(
+        make_result("previous_hash_lookup", parameters, seconds, bytes)
+    );
+
+    std::vector<arc::str::Atom> atoms;
+    atoms.reserve(count);
+    std::unordered_map<arc::str::Atom, std::size_t> atom_map;
+    for(std::size_t i = 0; i < count; ++i)
+    {
+        atoms.push_back(arc::str::Atom(keys[i]));
+        atom_map[atoms.back()] = i;
+    }
+
+    seconds = measure(
+        [&]()
+        {
+            std::size_t sum = 0;
+            for(std::size_t i = 0; i < count; ++i)
+            {
+                sum += atom_map.find(atoms[i])->second;
+            }
+            g_sink = g_sink + sum;
+        }
+    );
+    results.append(make_result("atom_lookup", parameters, seconds, bytes));
+
+    // interning text that is already in the pool, as when identifiers are
+    // read from a file or command
+    seconds = measure(
+        [&]()
+        {
+            std::size_t sum = 0;
+            for(std::size_t i = 0; i < count; ++i)
+            {
+                sum += arc::str::Atom(keys[i]).get_id();
+            }
+            g_sink = g_sink + sum;
+        }
+    );
+    results.append(make_result("atom_intern", parameters, seconds, bytes));
+}
+
+void cleanup()
+{
+    arc::log::shared_handler.remove_output(g_std_output);
+    arc::log::shared_handler.remove_input(g_logger);
+}
+
+void show_help()
+{
+    arc::str::UTF8String divider("=");
+    divider *= 80;
+
+    std::cout << divider << std::endl;
+    std::cout << APP_NAME << std::endl;
+    std::cout << divider << std::endl;
+    std::cout << "Arguments:" << std::endl;
+    std::cout << "----------\n" << std::endl;
+    std::cout << ARG_HELP << ": Displays this help and exits.\n" << std::endl;
+    std::cout << ARG_OUTPUT << ": The path to write the JSON results to. "
+              << "Defaults to writing the\n          results to stdout.\n"
+              << std::endl;
+    std::cout << ARG_TEXT_SIZE << ": The size in bytes of each UTF-8 text that "
+              << "is transcoded, one\n             number is formatted and "
+              << "parsed per 16 bytes and one map\n             key is looked up per 64 "
+              << "bytes. Defaults to 16777216.\n"
+              << std::endl;
+    std::cout << ARG_ITERATIONS << ": The number of times each benchmark is "
+              << "run, the fastest run\n              is reported. Defaults to "
+              << "3." << std::endl;
+}
+
+#endif
+// IN_DOXYGEN
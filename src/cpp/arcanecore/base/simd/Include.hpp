@@ -35,5 +35,10 @@
 #include <pmmintrin.h>
 #include <xmmintrin.h>
 
+// AVX2 is only used when the compiler is targeting it
+#ifdef __AVX2__
+    #include <immintrin.h>
+#endif
+
 
 #endif
@@ -0,0 +1,273 @@
+#include "arcanecore/base/str/Atom.hpp"
+
+#include <atomic>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "arcanecore/base/str/StringOperations.hpp"
+
+namespace arc
+{
+namespace str
+{
+
+//------------------------------------------------------------------------------
+//                                    OBJECTS
+//------------------------------------------------------------------------------
+
+/*!
+ * \brief An open addressing hash table of pointers to interned entries.
+ *
+ * Slots are only ever written while the pool is locked, and are written once
+ * the entry they point to is complete, so they can be read without locking.
+ */
+struct AtomTable
+{
+    //----------------------------PUBLIC ATTRIBUTES-----------------------------
+    // the number of slots minus one, the number of slots is a power of two
+    std::size_t mask;
+    std::unique_ptr<std::atomic<const Atom::Entry*>[]> slots;
+    //-------------------------------CONSTRUCTOR--------------------------------
+    explicit AtomTable(std::size_t capacity)
+        :
+        mask (capacity - 1),
+        slots(new std::atomic<const Atom::Entry*>[capacity])
+    {
+        for(std::size_t i = 0; i < capacity; ++i)
+        {
+            slots[i].store(nullptr, std::memory_order_relaxed);
+        }
+    }
+};
+
+/*!
+ * \brief The process wide pool of interned strings.
+ */
+class AtomPool
+{
+public:
+
+    //----------------------------PUBLIC ATTRIBUTES-----------------------------
+
+    // locked while adding entries
+    std::mutex mutex;
+    // a deque is used so that references to the entries remain valid as the
+    // pool grows
+    std::deque<Atom::Entry> entries;
+    // the table that lookups are performed in
+    std::atomic<AtomTable*> table;
+    // every table that has been used, tables that have been replaced by a
+    // larger table are kept since lookups may still be reading them
+    std::vector<std::unique_ptr<AtomTable>> tables;
+    // the entry of the empty string
+    const Atom::Entry* empty;
+
+    //-------------------------------CONSTRUCTOR--------------------------------
+
+    AtomPool()
+    {
+        tables.emplace_back(new AtomTable(256));
+        table.store(tables.back().get(), std::memory_order_relaxed);
+        // the empty string always has the id 0
+        empty = add(UTF8StringView());
+    }
+
+    //-------------------------PUBLIC MEMBER FUNCTIONS--------------------------
+
+    /*!
+     * \brief Returns the entry of the given text in the given table, or null
+     *        if the table does not contain it.
+     *
+     * This does not require the pool to be locked.
+     */
+    static const Atom::Entry* lookup(
+            const AtomTable* t,
+            const UTF8StringView& text,
+            std::size_t hash)
+    {
+        for(std::size_t i = hash & t->mask;; i = (i + 1) & t->mask)
+        {
+            const Atom::Entry* entry =
+                t->slots[i].load(std::memory_order_acquire);
+            if(entry == nullptr)
+            {
+                return nullptr;
+            }
+            // the hash is compared first since it is cached by the entry
+            if(entry->string.get_hash() == hash &&
+               entry->string.get_byte_length() - 1 == text.get_byte_length() &&
+               memcmp(
+                   entry->string.get_raw(),
+                   text.get_raw(),
+                   text.get_byte_length()
+               ) == 0)
+            {
+                return entry;
+            }
+        }
+    }
+
+    /*!
+     * \brief Adds the given text, which must not already be in the pool, and
+     *        returns its entry.
+     *
+     * The pool must be locked.
+     */
+    const Atom::Entry* add(const UTF8StringView& text)
+    {
+        entries.emplace_back(text, entries.size());
+        const Atom::Entry* entry = &entries.back();
+
+        // keep the table at most half full so probe sequences stay short
+        AtomTable* t = table.load(std::memory_order_relaxed);
+        if(entries.size() * 2 > t->mask + 1)
+        {
+            tables.emplace_back(new AtomTable((t->mask + 1) * 2));
+            t = tables.back().get();
+            for(std::size_t i = 0; i < entries.size() - 1; ++i)
+            {
+                insert(t, &entries[i]);
+            }
+            insert(t, entry);
+            // publish the complete table
+            table.store(t, std::memory_order_release);
+        }
+        else
+        {
+            insert(t, entry);
+        }
+        return entry;
+    }
+
+private:
+
+    //-------------------------PRIVATE MEMBER FUNCTIONS-------------------------
+
+    /*!
+     * \brief Stores the given entry in the first free slot of its probe
+     *        sequence in the given table.
+     */
+    static void insert(AtomTable* t, const Atom::Entry* entry)
+    {
+        std::size_t i = entry->string.get_hash() & t->mask;
+        while(t->slots[i].load(std::memory_order_relaxed) != nullptr)
+        {
+            i = (i + 1) & t->mask;
+        }
+        // release so that lookups which see the entry see all of its data
+        t->slots[i].store(entry, std::memory_order_release);
+    }
+};
+
+//------------------------------------------------------------------------------
+//                                STATIC FUNCTIONS
+//------------------------------------------------------------------------------
+
+/*!
+ * \brief Returns the pool of interned strings.
+ */
+static AtomPool& get_pool()
+{
+    static AtomPool pool;
+    return pool;
+}
+
+//------------------------------------------------------------------------------
+//                                  CONSTRUCTORS
+//------------------------------------------------------------------------------
+
+Atom::Atom()
+    :
+    m_entry(get_pool().empty)
+{
+}
+
+Atom::Atom(const arc::str::UTF8StringView& text)
+{
+    AtomPool& pool = get_pool();
+    std::size_t hash = text.get_hash();
+
+    // most text has already been interned so check without locking first
+    m_entry = AtomPool::lookup(
+        pool.table.load(std::memory_order_acquire),
+        text,
+        hash
+    );
+    if(m_entry != nullptr)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(pool.mutex);
+    // the text may have been added since the table was checked
+    m_entry = AtomPool::lookup(
+        pool.table.load(std::memory_order_relaxed),
+        text,
+        hash
+    );
+    if(m_entry == nullptr)
+    {
+        m_entry = pool.add(text);
+    }
+}
+
+//------------------------------------------------------------------------------
+//                            PUBLIC STATIC FUNCTIONS
+//------------------------------------------------------------------------------
+
+bool Atom::find(const arc::str::UTF8StringView& text, Atom& atom)
+{
+    const Entry* entry = AtomPool::lookup(
+        get_pool().table.load(std::memory_order_acquire),
+        text,
+        text.get_hash()
+    );
+    if(entry == nullptr)
+    {
+        return false;
+    }
+    atom.m_entry = entry;
+    return true;
+}
+
+std::size_t Atom::get_pool_size()
+{
+    AtomPool& pool = get_pool();
+    std::lock_guard<std::mutex> lock(pool.mutex);
+    return pool.entries.size();
+}
+
+//------------------------------------------------------------------------------
+//                              PRIVATE CONSTRUCTORS
+//------------------------------------------------------------------------------
+
+Atom::Entry::Entry(const arc::str::UTF8StringView& text, std::size_t _id)
+    :
+    string(text.to_string()),
+    id    (_id)
+{
+    // compute the cached hash now, since lookups compare it
+    string.get_hash();
+}
+
+//------------------------------------------------------------------------------
+//                               EXTERNAL OPERATORS
+//------------------------------------------------------------------------------
+
+arc::str::UTF8String& operator<<(arc::str::UTF8String& s, const Atom& atom)
+{
+    s << atom.get_string();
+    return s;
+}
+
+std::ostream& operator<<(std::ostream& stream, const Atom& atom)
+{
+    stream << atom.get_string();
+    return stream;
+}
+
+} // namespace str
+} // namespace arc
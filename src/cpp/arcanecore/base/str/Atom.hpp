@@ -0,0 +1,233 @@
+/*!
+ * \file
+ * \author David Saxon
+ */
+#ifndef ARCANECORE_BASE_STR_ATOM_HPP_
+#define ARCANECORE_BASE_STR_ATOM_HPP_
+
+#include <cstddef>
+#include <ostream>
+
+#include "arcanecore/base/str/UTF8String.hpp"
+#include "arcanecore/base/str/UTF8StringView.hpp"
+
+namespace arc
+{
+namespace str
+{
+
+/*!
+ * \brief An interned UTF-8 string that is represented by a single pointer.
+ *
+ * Every distinct string that an Atom is constructed from is stored once in a
+ * process wide pool, and each Atom only holds a pointer to the pooled string.
+ * Two Atoms are equal if and only if they were constructed from equal text, so
+ * comparing, hashing, and copying Atoms takes constant time regardless of the
+ * length of the text. This makes Atoms suitable for identifiers that are
+ * compared or used as map keys frequently, such as names and keys.
+ *
+ * Looking up text that has already been interned does not lock the pool, so
+ * threads constructing Atoms for existing identifiers do not contend with
+ * each other. Only interning new text takes a lock.
+ *
+ * \note Strings are never removed from the pool once interned so Atoms should
+ *       not be constructed from unbounded sets of text.
+ *
+ * \par Example Usage
+ *
+ * \code
+ * arc::str::Atom a("resource.name");
+ * arc::str::Atom b(arc::str::UTF8String("resource.") + "name");
+ * // a == b
+ * // a.get_string() == "resource.name"
+ * \endcode
+ */
+class Atom
+{
+private:
+
+    //--------------------------------------------------------------------------
+    //                               PRIVATE STRUCTS
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief An interned string, which is never modified or destroyed once it
+     *        has been added to the pool.
+     */
+    struct Entry
+    {
+        // the interned string, its hash is computed before the entry is shared
+        const arc::str::UTF8String string;
+        // the order the entry was interned in
+        const std::size_t id;
+
+        Entry(const arc::str::UTF8StringView& text, std::size_t _id);
+    };
+
+    friend class AtomPool;
+    friend struct AtomTable;
+
+public:
+
+    //--------------------------------------------------------------------------
+    //                                CONSTRUCTORS
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief Creates a new Atom for the empty string.
+     *
+     * The empty string always has the id ```0```.
+     */
+    Atom();
+
+    /*!
+     * \brief Creates a new Atom for the given text.
+     *
+     * If the text has not yet been interned it is added to the pool.
+     */
+    explicit Atom(const arc::str::UTF8StringView& text);
+
+    //--------------------------------------------------------------------------
+    //                          PUBLIC STATIC FUNCTIONS
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief Returns the Atom for the given text if it has already been
+     *        interned.
+     *
+     * Unlike the constructor this never adds the text to the pool, and never
+     * locks the pool.
+     *
+     * \param text The text to look up.
+     * \param atom Returns the Atom for the text if it exists.
+     *
+     * \return Whether the text has been interned.
+     */
+    static bool find(const arc::str::UTF8StringView& text, Atom& atom);
+
+    /*!
+     * \brief Returns the number of distinct strings that have been interned,
+     *        including the empty string.
+     */
+    static std::size_t get_pool_size();
+
+    //--------------------------------------------------------------------------
+    //                                 OPERATORS
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief Returns whether this Atom refers to the same text as the other
+     *        given Atom.
+     */
+    bool operator==(const Atom& other) const
+    {
+        return m_entry == other.m_entry;
+    }
+
+    /*!
+     * \brief Returns whether this Atom refers to different text to the other
+     *        given Atom.
+     */
+    bool operator!=(const Atom& other) const
+    {
+        return m_entry != other.m_entry;
+    }
+
+    /*!
+     * \brief Orders Atoms by their ids.
+     *
+     * \note This is the order strings were interned in, not the order of the
+     *       strings themselves.
+     */
+    bool operator<(const Atom& other) const
+    {
+        return m_entry->id < other.m_entry->id;
+    }
+
+    //--------------------------------------------------------------------------
+    //                          PUBLIC MEMBER FUNCTIONS
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief Returns the id of this Atom.
+     *
+     * Ids are only stable for the lifetime of the process.
+     */
+    std::size_t get_id() const
+    {
+        return m_entry->id;
+    }
+
+    /*!
+     * \brief Returns the hash of the text of this Atom.
+     *
+     * This is the same as UTF8String::get_hash() of the text.
+     */
+    std::size_t get_hash() const
+    {
+        return m_entry->string.get_hash();
+    }
+
+    /*!
+     * \brief Returns whether this Atom refers to the empty string.
+     */
+    bool is_empty() const
+    {
+        return m_entry->id == 0;
+    }
+
+    /*!
+     * \brief Returns the interned text of this Atom.
+     *
+     * The returned reference remains valid for the lifetime of the process.
+     */
+    const arc::str::UTF8String& get_string() const
+    {
+        return m_entry->string;
+    }
+
+private:
+
+    //--------------------------------------------------------------------------
+    //                             PRIVATE ATTRIBUTES
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief The entry of the text in the pool.
+     */
+    const Entry* m_entry;
+};
+
+//------------------------------------------------------------------------------
+//                               EXTERNAL OPERATORS
+//------------------------------------------------------------------------------
+
+arc::str::UTF8String& operator<<(arc::str::UTF8String& s, const Atom& atom);
+
+std::ostream& operator<<(std::ostream& stream, const Atom& atom);
+
+} // namespace str
+} // namespace arc
+
+//------------------------------------------------------------------------------
+//                                      HASH
+//------------------------------------------------------------------------------
+
+namespace std
+{
+
+template<>
+struct hash<arc::str::Atom>
+{
+    typedef arc::str::Atom argument_type;
+    typedef std::size_t result_type;
+
+    std::size_t operator()(const arc::str::Atom& value) const
+    {
+        return value.get_hash();
+    }
+};
+
+} // namespace std
+
+#endif
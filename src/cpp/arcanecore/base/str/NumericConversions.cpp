@@ -0,0 +1,804 @@
+#include "arcanecore/base/str/NumericConversions.hpp"
+
+#include <cstring>
+
+namespace arc
+{
+namespace str
+{
+
+//------------------------------------------------------------------------------
+//                                   VARIABLES
+//------------------------------------------------------------------------------
+
+const std::size_t MAX_INTEGER_FORMAT_LENGTH = 20;
+const std::size_t MAX_FLOAT_FORMAT_LENGTH = 32;
+
+//------------------------------------------------------------------------------
+//                               INTEGER FORMATTING
+//------------------------------------------------------------------------------
+
+// the two digit decimal representation of every number from 0 to 99
+static const char DIGIT_PAIRS[] =
+    "0001020304050607080910111213141516171819"
+    "2021222324252627282930313233343536373839"
+    "4041424344454647484950515253545556575859"
+    "6061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+/*!
+ * Returns the number of decimal digits in the given value.
+ */
+static inline std::size_t count_digits(arc::uint64 value)
+{
+    std::size_t digits = 1;
+    while(true)
+    {
+        if(value < 10)
+        {
+            return digits;
+        }
+        if(value < 100)
+        {
+            return digits + 1;
+        }
+        if(value < 1000)
+        {
+            return digits + 2;
+        }
+        if(value < 10000)
+        {
+            return digits + 3;
+        }
+        value /= 10000;
+        digits += 4;
+    }
+}
+
+//------------------------------------------------------------------------------
+//                                FLOAT FORMATTING
+//------------------------------------------------------------------------------
+
+/*!
+ * A floating point value with a 64-bit significand and a binary exponent,
+ * f * 2^e, used by the Grisu2 algorithm.
+ */
+struct DiyFp
+{
+    arc::uint64 f;
+    int e;
+
+    DiyFp(arc::uint64 f_, int e_)
+        :
+        f(f_),
+        e(e_)
+    {
+    }
+};
+
+/*!
+ * A normalised power of ten, f * 2^e which approximates 10^k.
+ */
+struct CachedPower
+{
+    arc::uint64 f;
+    int e;
+    int k;
+};
+
+// the range the binary exponent of the scaled value is kept within so that
+// the integral part of the value fits in 32-bits
+static const int GRISU_ALPHA = -60;
+static const int GRISU_GAMMA = -32;
+
+// the decimal exponent of the first cached power and the step between them
+static const int CACHED_POWERS_MIN_DEC_EXP = -300;
+static const int CACHED_POWERS_DEC_STEP = 8;
+
+// normalised powers of ten from 10^-300 to 10^324 in steps of 10^8, this
+// covers the range of both float and double values
+static const CachedPower CACHED_POWERS[] =
+{
+    {0xAB70FE17C79AC6CAULL, -1060, -300},
+    {0xFF77B1FCBEBCDC4FULL, -1034, -292},
+    {0xBE5691EF416BD60CULL, -1007, -284},
+    {0x8DD01FAD907FFC3CULL,  -980, -276},
+    {0xD3515C2831559A83ULL,  -954, -268},
+    {0x9D71AC8FADA6C9B5ULL,  -927, -260},
+    {0xEA9C227723EE8BCBULL,  -901, -252},
+    {0xAECC49914078536DULL,  -874, -244},
+    {0x823C12795DB6CE57ULL,  -847, -236},
+    {0xC21094364DFB5637ULL,  -821, -228},
+    {0x9096EA6F3848984FULL,  -794, -220},
+    {0xD77485CB25823AC7ULL,  -768, -212},
+    {0xA086CFCD97BF97F4ULL,  -741, -204},
+    {0xEF340A98172AACE5ULL,  -715, -196},
+    {0xB23867FB2A35B28EULL,  -688, -188},
+    {0x84C8D4DFD2C63F3BULL,  -661, -180},
+    {0xC5DD44271AD3CDBAULL,  -635, -172},
+    {0x936B9FCEBB25C996ULL,  -608, -164},
+    {0xDBAC6C247D62A584ULL,  -582, -156},
+    {0xA3AB66580D5FDAF6ULL,  -555, -148},
+    {0xF3E2F893DEC3F126ULL,  -529, -140},
+    {0xB5B5ADA8AAFF80B8ULL,  -502, -132},
+    {0x87625F056C7C4A8BULL,  -475, -124},
+    {0xC9BCFF6034C13053ULL,  -449, -116},
+    {0x964E858C91BA2655ULL,  -422, -108},
+    {0xDFF9772470297EBDULL,  -396, -100},
+    {0xA6DFBD9FB8E5B88FULL,  -369,  -92},
+    {0xF8A95FCF88747D94ULL,  -343,  -84},
+    {0xB94470938FA89BCFULL,  -316,  -76},
+    {0x8A08F0F8BF0F156BULL,  -289,  -68},
+    {0xCDB02555653131B6ULL,  -263,  -60},
+    {0x993FE2C6D07B7FACULL,  -236,  -52},
+    {0xE45C10C42A2B3B06ULL,  -210,  -44},
+    {0xAA242499697392D3ULL,  -183,  -36},
+    {0xFD87B5F28300CA0EULL,  -157,  -28},
+    {0xBCE5086492111AEBULL,  -130,  -20},
+    {0x8CBCCC096F5088CCULL,  -103,  -12},
+    {0xD1B71758E219652CULL,   -77,   -4},
+    {0x9C40000000000000ULL,   -50,    4},
+    {0xE8D4A51000000000ULL,   -24,   12},
+    {0xAD78EBC5AC620000ULL,     3,   20},
+    {0x813F3978F8940984ULL,    30,   28},
+    {0xC097CE7BC90715B3ULL,    56,   36},
+    {0x8F7E32CE7BEA5C70ULL,    83,   44},
+    {0xD5D238A4ABE98068ULL,   109,   52},
+    {0x9F4F2726179A2245ULL,   136,   60},
+    {0xED63A231D4C4FB27ULL,   162,   68},
+    {0xB0DE65388CC8ADA8ULL,   189,   76},
+    {0x83C7088E1AAB65DBULL,   216,   84},
+    {0xC45D1DF942711D9AULL,   242,   92},
+    {0x924D692CA61BE758ULL,   269,  100},
+    {0xDA01EE641A708DEAULL,   295,  108},
+    {0xA26DA3999AEF774AULL,   322,  116},
+    {0xF209787BB47D6B85ULL,   348,  124},
+    {0xB454E4A179DD1877ULL,   375,  132},
+    {0x865B86925B9BC5C2ULL,   402,  140},
+    {0xC83553C5C8965D3DULL,   428,  148},
+    {0x952AB45CFA97A0B3ULL,   455,  156},
+    {0xDE469FBD99A05FE3ULL,   481,  164},
+    {0xA59BC234DB398C25ULL,   508,  172},
+    {0xF6C69A72A3989F5CULL,   534,  180},
+    {0xB7DCBF5354E9BECEULL,   561,  188},
+    {0x88FCF317F22241E2ULL,   588,  196},
+    {0xCC20CE9BD35C78A5ULL,   614,  204},
+    {0x98165AF37B2153DFULL,   641,  212},
+    {0xE2A0B5DC971F303AULL,   667,  220},
+    {0xA8D9D1535CE3B396ULL,   694,  228},
+    {0xFB9B7CD9A4A7443CULL,   720,  236},
+    {0xBB764C4CA7A44410ULL,   747,  244},
+    {0x8BAB8EEFB6409C1AULL,   774,  252},
+    {0xD01FEF10A657842CULL,   800,  260},
+    {0x9B10A4E5E9913129ULL,   827,  268},
+    {0xE7109BFBA19C0C9DULL,   853,  276},
+    {0xAC2820D9623BF429ULL,   880,  284},
+    {0x80444B5E7AA7CF85ULL,   907,  292},
+    {0xBF21E44003ACDD2DULL,   933,  300},
+    {0x8E679C2F5E44FF8FULL,   960,  308},
+    {0xD433179D9C8CB841ULL,   986,  316},
+    {0x9E19DB92B4E31BA9ULL,  1013,  324}
+};
+
+/*!
+ * Returns x - y, where both values have the same exponent and x >= y.
+ */
+static inline DiyFp diy_sub(const DiyFp& x, const DiyFp& y)
+{
+    return DiyFp(x.f - y.f, x.e);
+}
+
+/*!
+ * Returns x * y rounded to the upper 64 bits of the product.
+ */
+static inline DiyFp diy_mul(const DiyFp& x, const DiyFp& y)
+{
+    const arc::uint64 x_lo = x.f & 0xFFFFFFFFULL;
+    const arc::uint64 x_hi = x.f >> 32;
+    const arc::uint64 y_lo = y.f & 0xFFFFFFFFULL;
+    const arc::uint64 y_hi = y.f >> 32;
+
+    const arc::uint64 p0 = x_lo * y_lo;
+    const arc::uint64 p1 = x_lo * y_hi;
+    const arc::uint64 p2 = x_hi * y_lo;
+    const arc::uint64 p3 = x_hi * y_hi;
+
+    // the middle 32 bits of the product, plus half of the lower 64 bits of
+    // the product so the result is rounded
+    arc::uint64 middle =
+        (p0 >> 32) + (p1 & 0xFFFFFFFFULL) + (p2 & 0xFFFFFFFFULL);
+    middle += 1ULL << 31;
+
+    return DiyFp(
+        p3 + (p2 >> 32) + (p1 >> 32) + (middle >> 32),
+        x.e + y.e + 64
+    );
+}
+
+/*!
+ * Returns the given value shifted so that the highest bit of its significand
+ * is set.
+ */
+static inline DiyFp diy_normalize(DiyFp x)
+{
+    while((x.f >> 63) == 0)
+    {
+        x.f <<= 1;
+        --x.e;
+    }
+    return x;
+}
+
+/*!
+ * Computes the normalised value of the floating point number with the given
+ * bits, along with the normalised boundaries of the interval of values that
+ * round to the number, which share the exponent of the upper boundary.
+ *
+ * \param bits The bits of the floating point number, which must be positive.
+ * \param precision The number of bits in the significand including the hidden
+ *                  bit.
+ * \param max_exponent The maximum exponent of the floating point type, as in
+ *                     std::numeric_limits::max_exponent.
+ */
+static void compute_boundaries(
+        arc::uint64 bits,
+        int precision,
+        int max_exponent,
+        DiyFp& r_w,
+        DiyFp& r_minus,
+        DiyFp& r_plus)
+{
+    const int bias = max_exponent - 1 + (precision - 1);
+    const int min_exponent = 1 - bias;
+    const arc::uint64 hidden_bit = 1ULL << (precision - 1);
+
+    const arc::uint64 exponent_bits = bits >> (precision - 1);
+    const arc::uint64 significand_bits = bits & (hidden_bit - 1);
+
+    DiyFp v(significand_bits, min_exponent);
+    if(exponent_bits != 0)
+    {
+        v = DiyFp(
+            significand_bits + hidden_bit,
+            static_cast<int>(exponent_bits) - bias
+        );
+    }
+
+    // the boundaries are half way between this value and its neighbours, the
+    // lower neighbour is closer when the significand is a power of two
+    const bool lower_is_closer = significand_bits == 0 && exponent_bits > 1;
+    const DiyFp m_plus(4 * v.f + 2, v.e - 2);
+    const DiyFp m_minus = lower_is_closer ?
+        DiyFp(4 * v.f - 1, v.e - 2) :
+        DiyFp(4 * v.f - 2, v.e - 2);
+
+    r_plus = diy_normalize(m_plus);
+    r_minus = DiyFp(m_minus.f << (m_minus.e - r_plus.e), r_plus.e);
+    r_w = diy_normalize(v);
+}
+
+/*!
+ * Returns the cached power of ten c = f * 2^e such that the binary exponent
+ * of c * 2^binary_exponent is within [GRISU_ALPHA, GRISU_GAMMA].
+ */
+static inline const CachedPower& get_cached_power(int binary_exponent)
+{
+    // ceil(log10(2^(GRISU_ALPHA - binary_exponent - 1)))
+    const int f = GRISU_ALPHA - binary_exponent - 1;
+    const int k = ((f * 78913) / (1 << 18)) + static_cast<int>(f > 0);
+    const int index =
+        (-CACHED_POWERS_MIN_DEC_EXP + k + (CACHED_POWERS_DEC_STEP - 1)) /
+        CACHED_POWERS_DEC_STEP;
+    return CACHED_POWERS[index];
+}
+
+/*!
+ * Returns the number of decimal digits in the given value, which must be
+ * less than 10^10, and the largest power of ten not greater than the value
+ * through r_pow10.
+ */
+static inline int find_largest_pow10(arc::uint32 value, arc::uint32& r_pow10)
+{
+    r_pow10 = 1000000000;
+    int digits = 10;
+    while(digits > 1 && value < r_pow10)
+    {
+        r_pow10 /= 10;
+        --digits;
+    }
+    return digits;
+}
+
+/*!
+ * Moves the last generated digit towards the exact value while it stays
+ * within the rounding interval.
+ */
+static inline void grisu2_round(
+        char* buffer,
+        int length,
+        arc::uint64 dist,
+        arc::uint64 delta,
+        arc::uint64 rest,
+        arc::uint64 ten_k)
+{
+    while(rest < dist && delta - rest >= ten_k &&
+          (rest + ten_k < dist || dist - rest > rest + ten_k - dist))
+    {
+        --buffer[length - 1];
+        rest += ten_k;
+    }
+}
+
+/*!
+ * Generates the shortest digits of the scaled value w within the interval
+ * (m_minus, m_plus), writing them to the buffer and returning the number of
+ * digits. The value is the digits multiplied by 10^r_decimal_exponent.
+ */
+static int grisu2_digit_gen(
+        char* buffer,
+        int& r_decimal_exponent,
+        const DiyFp& m_minus,
+        const DiyFp& w,
+        const DiyFp& m_plus)
+{
+    arc::uint64 delta = diy_sub(m_plus, m_minus).f;
+    arc::uint64 dist = diy_sub(m_plus, w).f;
+
+    // split m_plus into its integral and fractional parts
+    const DiyFp one(1ULL << -m_plus.e, m_plus.e);
+    arc::uint32 p1 = static_cast<arc::uint32>(m_plus.f >> -one.e);
+    arc::uint64 p2 = m_plus.f & (one.f - 1);
+
+    int length = 0;
+
+    // generate the digits of the integral part
+    arc::uint32 pow10 = 0;
+    int n = find_largest_pow10(p1, pow10);
+    while(n > 0)
+    {
+        const arc::uint32 digit = p1 / pow10;
+        p1 %= pow10;
+        buffer[length++] = static_cast<char>('0' + digit);
+        --n;
+
+        // stop once the remainder is within the interval
+        const arc::uint64 rest = (static_cast<arc::uint64>(p1) << -one.e) + p2;
+        if(rest <= delta)
+        {
+            r_decimal_exponent += n;
+            grisu2_round(
+                buffer,
+                length,
+                dist,
+                delta,
+                rest,
+                static_cast<arc::uint64>(pow10) << -one.e
+            );
+            return length;
+        }
+        pow10 /= 10;
+    }
+
+    // generate the digits of the fractional part
+    int m = 0;
+    while(true)
+    {
+        p2 *= 10;
+        const arc::uint64 digit = p2 >> -one.e;
+        p2 &= one.f - 1;
+        buffer[length++] = static_cast<char>('0' + digit);
+        ++m;
+
+        delta *= 10;
+        dist *= 10;
+        if(p2 <= delta)
+        {
+            break;
+        }
+    }
+    r_decimal_exponent -= m;
+    grisu2_round(buffer, length, dist, delta, p2, one.f);
+    return length;
+}
+
+/*!
+ * Writes the digits of the given number in positional or exponential
+ * notation, where buffer already contains the given number of digits, and
+ * the number is the digits multiplied by 10^decimal_exponent. Returns the
+ * number of bytes written.
+ */
+static std::size_t format_digits(
+        char* buffer,
+        int length,
+        int decimal_exponent)
+{
+    // the position of the decimal point relative to the first digit
+    const int point = length + decimal_exponent;
+
+    if(length <= point && point <= 21)
+    {
+        // an integer, followed by trailing zeros
+        memset(buffer + length, '0', point - length);
+        return static_cast<std::size_t>(point);
+    }
+    if(0 < point && point <= 21)
+    {
+        // the decimal point is within the digits
+        memmove(buffer + point + 1, buffer + point, length - point);
+        buffer[point] = '.';
+        return static_cast<std::size_t>(length + 1);
+    }
+    if(-6 < point && point <= 0)
+    {
+        // the decimal point is before the digits
+        memmove(buffer + 2 - point, buffer, length);
+        buffer[0] = '0';
+        buffer[1] = '.';
+        memset(buffer + 2, '0', -point);
+        return static_cast<std::size_t>(2 - point + length);
+    }
+
+    // exponential notation with a single digit before the decimal point
+    std::size_t written = 1;
+    if(length > 1)
+    {
+        memmove(buffer + 2, buffer + 1, length - 1);
+        buffer[1] = '.';
+        written = static_cast<std::size_t>(length + 1);
+    }
+    buffer[written++] = 'e';
+    int exponent = point - 1;
+    if(exponent < 0)
+    {
+        buffer[written++] = '-';
+        exponent = -exponent;
+    }
+    else
+    {
+        buffer[written++] = '+';
+    }
+    return written + format_uint64(
+        static_cast<arc::uint64>(exponent),
+        buffer + written
+    );
+}
+
+/*!
+ * Writes the shortest representation of the floating point number with the
+ * given bits, where bit_width is the number of bits in the floating point
+ * type, see compute_boundaries() for the meaning of precision and
+ * max_exponent.
+ */
+static std::size_t format_floating_point(
+        arc::uint64 bits,
+        int bit_width,
+        int precision,
+        int max_exponent,
+        char* r_buffer)
+{
+    const arc::uint64 sign_bit = 1ULL << (bit_width - 1);
+    const arc::uint64 exponent_mask =
+        ((1ULL << (bit_width - precision)) - 1) << (precision - 1);
+    const arc::uint64 significand_mask = (1ULL << (precision - 1)) - 1;
+
+    std::size_t written = 0;
+    if((bits & exponent_mask) == exponent_mask)
+    {
+        if(bits & significand_mask)
+        {
+            memcpy(r_buffer, "nan", 3);
+            return 3;
+        }
+        if(bits & sign_bit)
+        {
+            r_buffer[written++] = '-';
+        }
+        memcpy(r_buffer + written, "inf", 3);
+        return written + 3;
+    }
+    if(bits & sign_bit)
+    {
+        r_buffer[written++] = '-';
+        bits &= ~sign_bit;
+    }
+    if(bits == 0)
+    {
+        r_buffer[written++] = '0';
+        return written;
+    }
+
+    DiyFp w(0, 0);
+    DiyFp m_minus(0, 0);
+    DiyFp m_plus(0, 0);
+    compute_boundaries(bits, precision, max_exponent, w, m_minus, m_plus);
+
+    // scale the value and its boundaries so that the binary exponent is
+    // within [GRISU_ALPHA, GRISU_GAMMA]
+    const CachedPower& cached = get_cached_power(m_plus.e);
+    const DiyFp c_minus_k(cached.f, cached.e);
+    const DiyFp scaled_w = diy_mul(w, c_minus_k);
+    const DiyFp scaled_minus = diy_mul(m_minus, c_minus_k);
+    const DiyFp scaled_plus = diy_mul(m_plus, c_minus_k);
+
+    // the multiplications may round so narrow the interval by one unit on
+    // either side to ensure every value within it rounds to this number
+    int decimal_exponent = -cached.k;
+    const int length = grisu2_digit_gen(
+        r_buffer + written,
+        decimal_exponent,
+        DiyFp(scaled_minus.f + 1, scaled_minus.e),
+        scaled_w,
+        DiyFp(scaled_plus.f - 1, scaled_plus.e)
+    );
+
+    return written + format_digits(
+        r_buffer + written,
+        length,
+        decimal_exponent
+    );
+}
+
+//------------------------------------------------------------------------------
+//                                    PARSING
+//------------------------------------------------------------------------------
+
+/*!
+ * Returns whether the given byte is an ASCII digit.
+ */
+static inline bool is_digit_byte(char c)
+{
+    return static_cast<arc::uint32>(static_cast<unsigned char>(c) - '0') < 10;
+}
+
+/*!
+ * Returns the given 8 bytes as an integer with the first byte in the lowest
+ * bits, regardless of the endianness of the system.
+ */
+static inline arc::uint64 load_eight_bytes(const char* data)
+{
+    arc::uint64 block = 0;
+    for(std::size_t i = 0; i < 8; ++i)
+    {
+        block |= static_cast<arc::uint64>(
+            static_cast<unsigned char>(data[i])) << (i * 8);
+    }
+    return block;
+}
+
+/*!
+ * Returns whether every byte of the given block (see load_eight_bytes()) is
+ * an ASCII digit.
+ */
+static inline bool is_eight_digits(arc::uint64 block)
+{
+    // the high nibble of every byte must be 3, and adding 6 to the low nibble
+    // of every byte must not carry into the high nibble
+    return ((block & 0xF0F0F0F0F0F0F0F0ULL) |
+            (((block + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)
+           ) == 0x3333333333333333ULL;
+}
+
+/*!
+ * Returns the value of the 8 digits in the given block (see
+ * load_eight_bytes()), which must have been checked with is_eight_digits().
+ */
+static inline arc::uint32 parse_eight_digits(arc::uint64 block)
+{
+    block -= 0x3030303030303030ULL;
+    // combine each pair of digits into a byte
+    block = (block * 10) + (block >> 8);
+    // combine the pairs into two 4 digit values, and those into the result
+    block = (((block & 0x000000FF000000FFULL) * 0x000F424000000064ULL) +
+             (((block >> 16) & 0x000000FF000000FFULL) * 0x0000271000000001ULL)
+            ) >> 32;
+    return static_cast<arc::uint32>(block);
+}
+
+//------------------------------------------------------------------------------
+//                                   FUNCTIONS
+//------------------------------------------------------------------------------
+
+std::size_t format_uint64(arc::uint64 value, char* r_buffer)
+{
+    const std::size_t length = count_digits(value);
+
+    // write the digits from the end, two at a time
+    char* position = r_buffer + length;
+    while(value >= 100)
+    {
+        const std::size_t pair = static_cast<std::size_t>(value % 100) * 2;
+        value /= 100;
+        *--position = DIGIT_PAIRS[pair + 1];
+        *--position = DIGIT_PAIRS[pair];
+    }
+    if(value >= 10)
+    {
+        const std::size_t pair = static_cast<std::size_t>(value) * 2;
+        *--position = DIGIT_PAIRS[pair + 1];
+        *--position = DIGIT_PAIRS[pair];
+    }
+    else
+    {
+        *--position = static_cast<char>('0' + value);
+    }
+    return length;
+}
+
+std::size_t format_int64(arc::int64 value, char* r_buffer)
+{
+    if(value < 0)
+    {
+        r_buffer[0] = '-';
+        // negate as unsigned so that the minimum value doesn't overflow
+        return 1 + format_uint64(
+            0 - static_cast<arc::uint64>(value),
+            r_buffer + 1
+        );
+    }
+    return format_uint64(static_cast<arc::uint64>(value), r_buffer);
+}
+
+std::size_t format_double(double value, char* r_buffer)
+{
+    arc::uint64 bits = 0;
+    memcpy(&bits, &value, sizeof(value));
+    return format_floating_point(bits, 64, 53, 1024, r_buffer);
+}
+
+std::size_t format_float(float value, char* r_buffer)
+{
+    arc::uint32 bits = 0;
+    memcpy(&bits, &value, sizeof(value));
+    return format_floating_point(bits, 32, 24, 128, r_buffer);
+}
+
+bool is_int(const char* data, std::size_t length)
+{
+    // the first symbol is allowed to be '-'
+    if(length > 0 && data[0] == '-')
+    {
+        return is_uint(data + 1, length - 1);
+    }
+    return is_uint(data, length);
+}
+
+bool is_uint(const char* data, std::size_t length)
+{
+    if(length == 0)
+    {
+        return false;
+    }
+    // any byte of a multi-byte symbol is not a digit so the bytes can be
+    // checked directly
+    std::size_t i = 0;
+    for(; i + 8 <= length; i += 8)
+    {
+        if(!is_eight_digits(load_eight_bytes(data + i)))
+        {
+            return false;
+        }
+    }
+    for(; i < length; ++i)
+    {
+        if(!is_digit_byte(data[i]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool is_float(const char* data, std::size_t length)
+{
+    std::size_t i = 0;
+    // the first symbol is allowed to be '-'
+    if(length > 0 && data[0] == '-')
+    {
+        ++i;
+    }
+    std::size_t digits = 0;
+    bool point_found = false;
+    for(; i < length; ++i)
+    {
+        if(is_digit_byte(data[i]))
+        {
+            ++digits;
+        }
+        else if(data[i] == '.' && !point_found)
+        {
+            point_found = true;
+        }
+        else
+        {
+            return false;
+        }
+    }
+    return digits > 0;
+}
+
+bool parse_uint64(const char* data, std::size_t length, arc::uint64& r_value)
+{
+    if(length == 0)
+    {
+        return false;
+    }
+
+    // skip leading zeros since they don't affect the value or its range
+    std::size_t i = 0;
+    while(i < length && data[i] == '0')
+    {
+        ++i;
+    }
+    // the maximum value has 20 digits
+    const std::size_t digits = length - i;
+    if(digits > 20)
+    {
+        return false;
+    }
+    // the first 19 digits can't overflow
+    const std::size_t safe_end = digits == 20 ? length - 1 : length;
+
+    arc::uint64 value = 0;
+    for(; i + 8 <= safe_end; i += 8)
+    {
+        const arc::uint64 block = load_eight_bytes(data + i);
+        if(!is_eight_digits(block))
+        {
+            return false;
+        }
+        value = (value * 100000000ULL) + parse_eight_digits(block);
+    }
+    for(; i < safe_end; ++i)
+    {
+        if(!is_digit_byte(data[i]))
+        {
+            return false;
+        }
+        value = (value * 10) + static_cast<arc::uint64>(data[i] - '0');
+    }
+    if(safe_end != length)
+    {
+        // the final digit of a 20 digit value must be range checked
+        if(!is_digit_byte(data[safe_end]))
+        {
+            return false;
+        }
+        const arc::uint64 digit =
+            static_cast<arc::uint64>(data[safe_end] - '0');
+        if(value > (0xFFFFFFFFFFFFFFFFULL - digit) / 10)
+        {
+            return false;
+        }
+        value = (value * 10) + digit;
+    }
+
+    r_value = value;
+    return true;
+}
+
+bool parse_int64(const char* data, std::size_t length, arc::int64& r_value)
+{
+    const bool negative = length > 0 && data[0] == '-';
+    arc::uint64 magnitude = 0;
+    if(negative)
+    {
+        if(!parse_uint64(data + 1, length - 1, magnitude) ||
+           magnitude > 0x8000000000000000ULL)
+        {
+            return false;
+        }
+        // negate as unsigned so that the minimum value doesn't overflow
+        r_value = static_cast<arc::int64>(0 - magnitude);
+        return true;
+    }
+    if(!parse_uint64(data, length, magnitude) ||
+       magnitude > 0x7FFFFFFFFFFFFFFFULL)
+    {
+        return false;
+    }
+    r_value = static_cast<arc::int64>(magnitude);
+    return true;
+}
+
+} // namespace str
+} // namespace arc
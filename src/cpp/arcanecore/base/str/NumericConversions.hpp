@@ -0,0 +1,203 @@
+/*!
+ * \file
+ * \brief Locale independent conversions between numbers and their decimal
+ *        string representations.
+ * \author David Saxon
+ */
+#ifndef ARCANECORE_BASE_STR_NUMERICCONVERSIONS_HPP_
+#define ARCANECORE_BASE_STR_NUMERICCONVERSIONS_HPP_
+
+#include <cstddef>
+
+#include "arcanecore/base/Types.hpp"
+
+namespace arc
+{
+namespace str
+{
+
+//------------------------------------------------------------------------------
+//                                   VARIABLES
+//------------------------------------------------------------------------------
+
+/*!
+ * \brief The maximum number of bytes written by format_int64() and
+ *        format_uint64().
+ */
+extern const std::size_t MAX_INTEGER_FORMAT_LENGTH;
+
+/*!
+ * \brief The maximum number of bytes written by format_double() and
+ *        format_float().
+ */
+extern const std::size_t MAX_FLOAT_FORMAT_LENGTH;
+
+//------------------------------------------------------------------------------
+//                                   FUNCTIONS
+//------------------------------------------------------------------------------
+
+/*!
+ * \brief Writes the decimal digits of the given value to the given buffer.
+ *
+ * The digits are written two at a time from a table of digit pairs.
+ *
+ * Example usage:
+ *
+ * \code
+ * char buffer[20];
+ * arc::str::format_uint64(1024, buffer); // returns: 4, buffer: "1024"
+ * \endcode
+ *
+ * \note The output is not NULL terminated.
+ *
+ * \param value The value to format.
+ * \param r_buffer The buffer to write to, which must have room for at least
+ *                 arc::str::MAX_INTEGER_FORMAT_LENGTH bytes.
+ *
+ * \return The number of bytes written.
+ */
+std::size_t format_uint64(arc::uint64 value, char* r_buffer);
+
+/*!
+ * \brief Writes the decimal digits of the given value to the given buffer,
+ *        preceded by '-' if the value is negative.
+ *
+ * \note The output is not NULL terminated.
+ *
+ * \param value The value to format.
+ * \param r_buffer The buffer to write to, which must have room for at least
+ *                 arc::str::MAX_INTEGER_FORMAT_LENGTH bytes.
+ *
+ * \return The number of bytes written.
+ */
+std::size_t format_int64(arc::int64 value, char* r_buffer);
+
+/*!
+ * \brief Writes the shortest decimal representation of the given value that
+ *        converts back to the same value to the given buffer.
+ *
+ * The digits are generated using the Grisu2 algorithm, which always produces
+ * digits that convert back to the same value and in almost every case
+ * produces the fewest digits possible.
+ *
+ * Values are written in positional notation when the decimal point falls
+ * within 21 digits of the first digit and otherwise in exponential notation,
+ * matching the number to string conversion of ECMAScript.
+ *
+ * Example usage:
+ *
+ * \code
+ * char buffer[32];
+ * arc::str::format_double(0.1, buffer);    // buffer: "0.1"
+ * arc::str::format_double(-1024.0, buffer); // buffer: "-1024"
+ * arc::str::format_double(1.5e-9, buffer); // buffer: "1.5e-9"
+ * arc::str::format_double(2.0e30, buffer); // buffer: "2e+30"
+ * \endcode
+ *
+ * Infinities are written as "inf" or "-inf" and NaN is written as "nan".
+ *
+ * \note The output is not NULL terminated.
+ *
+ * \param value The value to format.
+ * \param r_buffer The buffer to write to, which must have room for at least
+ *                 arc::str::MAX_FLOAT_FORMAT_LENGTH bytes.
+ *
+ * \return The number of bytes written.
+ */
+std::size_t format_double(double value, char* r_buffer);
+
+/*!
+ * \brief Writes the shortest decimal representation of the given value that
+ *        converts back to the same single precision value to the given
+ *        buffer.
+ *
+ * See format_double() for details of the output.
+ *
+ * Example usage:
+ *
+ * \code
+ * char buffer[32];
+ * arc::str::format_float(3.14F, buffer); // buffer: "3.14"
+ * \endcode
+ *
+ * \note The output is not NULL terminated.
+ *
+ * \param value The value to format.
+ * \param r_buffer The buffer to write to, which must have room for at least
+ *                 arc::str::MAX_FLOAT_FORMAT_LENGTH bytes.
+ *
+ * \return The number of bytes written.
+ */
+std::size_t format_float(float value, char* r_buffer);
+
+/*!
+ * \brief Returns whether the given data is an integer, that is only digits
+ *        and optionally a leading '-'.
+ *
+ * The data is checked 8 bytes at a time.
+ *
+ * \param data The data to check.
+ * \param length The number of bytes in the data.
+ */
+bool is_int(const char* data, std::size_t length);
+
+/*!
+ * \brief Returns whether the given data is an unsigned integer, that is only
+ *        digits.
+ *
+ * The data is checked 8 bytes at a time.
+ *
+ * \param data The data to check.
+ * \param length The number of bytes in the data.
+ */
+bool is_uint(const char* data, std::size_t length);
+
+/*!
+ * \brief Returns whether the given data is a floating point number, that is
+ *        at least one digit, optionally a leading '-', and at most one '.'.
+ *
+ * \param data The data to check.
+ * \param length The number of bytes in the data.
+ */
+bool is_float(const char* data, std::size_t length);
+
+/*!
+ * \brief Parses the given data as a decimal unsigned integer.
+ *
+ * Digits are validated and accumulated 8 bytes at a time.
+ *
+ * Example usage:
+ *
+ * \code
+ * arc::uint64 value = 0;
+ * arc::str::parse_uint64("0042", 4, value); // returns: true, value: 42
+ * arc::str::parse_uint64("-42", 3, value);  // returns: false
+ * \endcode
+ *
+ * \param data The data to parse.
+ * \param length The number of bytes in the data.
+ * \param r_value Returns the parsed value, this is only modified if the data
+ *                is valid.
+ *
+ * \return Whether the data is an unsigned integer (see is_uint()) that is
+ *         within the range of arc::uint64.
+ */
+bool parse_uint64(const char* data, std::size_t length, arc::uint64& r_value);
+
+/*!
+ * \brief Parses the given data as a decimal integer.
+ *
+ * \param data The data to parse.
+ * \param length The number of bytes in the data.
+ * \param r_value Returns the parsed value, this is only modified if the data
+ *                is valid.
+ *
+ * \return Whether the data is an integer (see is_int()) that is within the
+ *         range of arc::int64.
+ */
+bool parse_int64(const char* data, std::size_t length, arc::int64& r_value);
+
+} // namespace str
+} // namespace arc
+
+#endif
@@ -1,126 +1,305 @@
+#include <algorithm>
+#include <cstring>
+#include <memory>
+
 #include "arcanecore/base/Exceptions.hpp"
 #include "arcanecore/base/str/StringOperations.hpp"
+#include "arcanecore/base/str/UTF16Decoder.hpp"
+
+#ifndef ARC_STR_DISABLE_SSE
+    #include "arcanecore/base/simd/Include.hpp"
+#endif
 
 namespace arc
 {
 namespace str
 {
 
-bool is_digit(arc::uint32 code_point)
+#ifndef ARC_STR_DISABLE_SSE
+
+/*!
+ * \brief Returns a bit mask of which of the 16 positions starting at the
+ *        given data match both the first and last byte of the pattern.
+ */
+static inline int candidate_mask(
+        const char* data,
+        std::size_t pattern_length,
+        const __m128i& first,
+        const __m128i& last)
 {
-    return code_point >= 48 && code_point <= 57;
+    __m128i block_first =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+    __m128i block_last = _mm_loadu_si128(
+        reinterpret_cast<const __m128i*>(data + pattern_length - 1)
+    );
+    return _mm_movemask_epi8(_mm_and_si128(
+        _mm_cmpeq_epi8(block_first, first),
+        _mm_cmpeq_epi8(block_last, last)
+    ));
 }
 
-arc::str::UTF8String utf16_to_utf8(
+/*!
+ * \brief Checks the structure of the 16 bytes of UTF-8 data starting at the
+ *        given data.
+ *
+ * Each primary byte marks the bytes that should follow it, and the block is
+ * valid if the marked bytes are exactly the following bytes of the block.
+ * Marks that extend past the end of the block are returned through r_carry,
+ * which should hold the marks from the previous block when called.
+ */
+static inline bool check_utf8_block(const char* data, arc::uint64& r_carry)
+{
+    __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+    arc::uint64 high = static_cast<arc::uint32>(_mm_movemask_epi8(block));
+    // ASCII blocks are only valid if no following bytes are expected
+    if(high == 0)
+    {
+        return r_carry == 0;
+    }
+
+    // as signed values following bytes are less than -64, two byte primary
+    // bytes and above are negative and not following bytes, three byte and
+    // above are greater than -33, four byte greater than -17, and any byte
+    // greater than -9 is invalid
+    arc::uint64 following = static_cast<arc::uint32>(_mm_movemask_epi8(
+        _mm_cmplt_epi8(block, _mm_set1_epi8(-64))
+    ));
+    arc::uint64 two_byte = high & ~following;
+    arc::uint64 three_byte = high & static_cast<arc::uint32>(_mm_movemask_epi8(
+        _mm_cmpgt_epi8(block, _mm_set1_epi8(-33))
+    ));
+    arc::uint64 four_byte = high & static_cast<arc::uint32>(_mm_movemask_epi8(
+        _mm_cmpgt_epi8(block, _mm_set1_epi8(-17))
+    ));
+    arc::uint64 invalid = high & static_cast<arc::uint32>(_mm_movemask_epi8(
+        _mm_cmpgt_epi8(block, _mm_set1_epi8(-9))
+    ));
+
+    arc::uint64 expected =
+        r_carry | (two_byte << 1) | (three_byte << 2) | (four_byte << 3);
+    r_carry = expected >> 16;
+    return invalid == 0 && (expected & 0xFFFF) == following;
+}
+
+#ifdef __AVX2__
+
+/*!
+ * \brief As check_utf8_block but checks 32 bytes of data.
+ */
+static inline bool check_utf8_block_avx2(
         const char* data,
-        std::size_t byte_length,
-        arc::data::Endianness endianness)
+        arc::uint64& r_carry)
+{
+    __m256i block =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+    arc::uint64 high = static_cast<arc::uint32>(_mm256_movemask_epi8(block));
+    if(high == 0)
+    {
+        return r_carry == 0;
+    }
+
+    arc::uint64 following = static_cast<arc::uint32>(_mm256_movemask_epi8(
+        _mm256_cmpgt_epi8(_mm256_set1_epi8(-64), block)
+    ));
+    arc::uint64 two_byte = high & ~following;
+    arc::uint64 three_byte =
+        high & static_cast<arc::uint32>(_mm256_movemask_epi8(
+            _mm256_cmpgt_epi8(block, _mm256_set1_epi8(-33))
+        ));
+    arc::uint64 four_byte =
+        high & static_cast<arc::uint32>(_mm256_movemask_epi8(
+            _mm256_cmpgt_epi8(block, _mm256_set1_epi8(-17))
+        ));
+    arc::uint64 invalid =
+        high & static_cast<arc::uint32>(_mm256_movemask_epi8(
+            _mm256_cmpgt_epi8(block, _mm256_set1_epi8(-9))
+        ));
+
+    arc::uint64 expected =
+        r_carry | (two_byte << 1) | (three_byte << 2) | (four_byte << 3);
+    r_carry = expected >> 32;
+    return invalid == 0 && (expected & 0xFFFFFFFF) == following;
+}
+
+#endif
+// __AVX2__
+
+#endif
+// ARC_STR_DISABLE_SSE
+
+/*!
+ * \brief Returns the number of bytes in the given UTF-8 data that start four
+ *        byte symbols, which are encoded as surrogate pairs in UTF-16.
+ */
+static std::size_t count_four_byte_symbols(
+        const char* data,
+        std::size_t length)
 {
-    // ensure data is unsigned
-    const unsigned char* d = reinterpret_cast<const unsigned char*>(data);
+    std::size_t count = 0;
+    std::size_t i = 0;
+
+#ifndef ARC_STR_DISABLE_SSE
 
-    std::vector<unsigned char> utf8;
-    // iterate over each character
-    for(size_t i = 0;
-        byte_length == arc::str::npos || i < byte_length;
-        i += 2)
+    // as signed values these bytes are in the range -16 to -1, see
+    // count_symbols for how the lanes are counted
+    const __m128i lower = _mm_set1_epi8(-17);
+    const __m128i zero = _mm_setzero_si128();
+    while(i + 16 <= length)
     {
-        arc::uint32 code_point = 0;
-        if(endianness == arc::data::ENDIAN_BIG)
+        std::size_t blocks = std::min<std::size_t>((length - i) / 16, 255);
+        __m128i counts = zero;
+        for(std::size_t b = 0; b < blocks; ++b, i += 16)
         {
-            code_point = (static_cast<arc::uint32>(d[i]) << 8) |
-                          static_cast<arc::uint32>(d[i + 1]);
-        }
-        else
-        {
-            code_point = static_cast<arc::uint32>(d[i]) |
-                         (static_cast<arc::uint32>(d[i + 1] << 8));
+            __m128i block =
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+            counts = _mm_sub_epi8(counts, _mm_and_si128(
+                _mm_cmpgt_epi8(block, lower),
+                _mm_cmplt_epi8(block, zero)
+            ));
         }
+        __m128i sums = _mm_sad_epu8(counts, zero);
+        count += static_cast<std::size_t>(
+            _mm_cvtsi128_si32(sums) +
+            _mm_cvtsi128_si32(_mm_srli_si128(sums, 8))
+        );
+    }
 
-        // is this actually a 4-byte UTF-16 symbol, if so decode the code point
-        if(code_point >= arc::str::UTF16_HIGH_SURROGATE_MIN &&
-           code_point <= arc::str::UTF16_HIGH_SURROGATE_MAX    )
-        {
-            arc::uint32 high_surrogate = code_point;
-            arc::uint32 low_surrogate = 0;
-            if(endianness == arc::data::ENDIAN_BIG)
-            {
-                low_surrogate = (static_cast<arc::uint32>(d[i + 2]) << 8) |
-                                 static_cast<arc::uint32>(d[i + 3]);
-            }
-            else
-            {
-                low_surrogate = static_cast<arc::uint32>(d[i + 2]) |
-                               (static_cast<arc::uint32>(d[i + 3] << 8));
-            }
-            // decompose the surrogates
-            high_surrogate -= arc::str::UTF16_HIGH_SURROGATE_MIN;
-            low_surrogate  -= arc::str::UTF16_LOW_SURROGATE_MIN;
-            code_point = (high_surrogate << 10) | low_surrogate;
-            code_point += arc::str::UTF16_4BYTE_OFFSET;
-            // we passed an extra two bytes
-            i += 2;
-        }
+#endif
+// ARC_STR_DISABLE_SSE
 
-        // null?
-        if(code_point == 0 && byte_length == arc::str::npos)
-        {
-            break;
-        }
-        // one byte UTF-8 character
-        else if(code_point < 0x80)
-        {
-            utf8.push_back(static_cast<unsigned char>(code_point));
-        }
-        // two byte UTF-8 character
-        else if(code_point < 0x800)
-        {
-            utf8.push_back(static_cast<unsigned char>(
-                0xC0 + (code_point >> 6))
-            );
-            utf8.push_back(static_cast<unsigned char>(
-                0x80 + (code_point & 0x3F))
-            );
-        }
-        // three byte UTF-8 character
-        else if(code_point < 0x10000)
+    for(; i < length; ++i)
+    {
+        if((static_cast<unsigned char>(data[i]) & 0xF0) == 0xF0)
         {
-            utf8.push_back(static_cast<unsigned char>(
-                0xE0 + (code_point >> 12))
-            );
-            utf8.push_back(static_cast<unsigned char>(
-                0x80 + ((code_point >> 6) & 0x3F))
-            );
-            utf8.push_back(static_cast<unsigned char>(
-                0x80 + (code_point & 0x3F))
-            );
+            ++count;
         }
-        // four byte UTF-8 character
-        else
+    }
+    return count;
+}
+
+/*!
+ * \brief Writes the given UTF-16 code unit in the given byte order and
+ *        advances the output.
+ */
+static inline void write_utf16_unit(
+        arc::uint32 unit,
+        arc::data::Endianness endianness,
+        char*& output)
+{
+    if(endianness == arc::data::ENDIAN_LITTLE)
+    {
+        *output++ = static_cast<char>(unit);
+        *output++ = static_cast<char>(unit >> 8);
+    }
+    else
+    {
+        *output++ = static_cast<char>(unit >> 8);
+        *output++ = static_cast<char>(unit);
+    }
+}
+
+/*!
+ * \brief Encodes the UTF-8 symbol at the given byte index of the data as UTF-16
+ *        and advances the byte index to the next symbol.
+ *
+ * Every byte that is not a following byte produces one code unit, or two if
+ * it starts a four byte symbol, so the output never exceeds the length
+ * calculated from count_symbols() and count_four_byte_symbols() even if the
+ * data is not valid.
+ */
+static inline void encode_utf16_symbol(
+        const unsigned char* data,
+        std::size_t length,
+        std::size_t& i,
+        arc::data::Endianness endianness,
+        char*& output)
+{
+    arc::uint32 primary = data[i++];
+    // skip following bytes that don't belong to a symbol
+    if((primary & 0xC0) == 0x80)
+    {
+        return;
+    }
+
+    std::size_t following_bytes = 0;
+    arc::uint32 code_point = primary;
+    if(primary >= 0xF0)
+    {
+        following_bytes = 3;
+        code_point = primary & 0x07;
+    }
+    else if(primary >= 0xE0)
+    {
+        following_bytes = 2;
+        code_point = primary & 0x0F;
+    }
+    else if(primary >= 0xC0)
+    {
+        following_bytes = 1;
+        code_point = primary & 0x1F;
+    }
+    for(; following_bytes > 0 && i < length && (data[i] & 0xC0) == 0x80;
+        --following_bytes, ++i)
+    {
+        code_point = (code_point << 6) | (data[i] & 0x3F);
+    }
+
+    // four byte symbols are encoded as a surrogate pair
+    if(primary >= 0xF0)
+    {
+        code_point -= arc::str::UTF16_4BYTE_OFFSET;
+        write_utf16_unit(
+            arc::str::UTF16_HIGH_SURROGATE_MIN + ((code_point >> 10) & 0x3FF),
+            endianness,
+            output
+        );
+        write_utf16_unit(
+            arc::str::UTF16_LOW_SURROGATE_MIN + (code_point & 0x3FF),
+            endianness,
+            output
+        );
+        return;
+    }
+    write_utf16_unit(code_point, endianness, output);
+}
+
+bool is_digit(arc::uint32 code_point)
+{
+    return code_point >= 48 && code_point <= 57;
+}
+
+arc::str::UTF8String utf16_to_utf8(
+        const char* data,
+        std::size_t byte_length,
+        arc::data::Endianness endianness)
+{
+    // find the null terminator?
+    if(byte_length == arc::str::npos)
+    {
+        byte_length = 0;
+        while(data[byte_length] != '\0' || data[byte_length + 1] != '\0')
         {
-            // TODO: could check the value is less than the max... utf16
-            utf8.push_back(static_cast<unsigned char>(
-                0xF0 + ((code_point >> 18) & 0x0F))
-            );
-            utf8.push_back(static_cast<unsigned char>(
-                0x80 + ((code_point >> 12) & 0x3F))
-            );
-            utf8.push_back(static_cast<unsigned char>(
-                0x80 + ((code_point >> 6) & 0x3F))
-            );
-            utf8.push_back(static_cast<unsigned char>(
-                0x80 + (code_point & 0x3F))
-            );
+            byte_length += 2;
         }
     }
 
     // no data? return the empty string
-    if(utf8.empty())
+    if(byte_length == 0)
     {
         return arc::str::UTF8String();
     }
 
-    return arc::str::UTF8String((const char*) &utf8[0], utf8.size());
+    // decode straight into a buffer large enough for the worst case, which
+    // doesn't need to be initialised
+    arc::str::UTF16Decoder decoder(endianness);
+    std::size_t capacity =
+        arc::str::UTF16Decoder::get_max_output_length(byte_length) +
+        arc::str::UTF16Decoder::MAX_FINISH_LENGTH;
+    std::unique_ptr<char[]> utf8(new char[capacity]);
+    std::size_t length = decoder.decode(data, byte_length, utf8.get());
+    length += decoder.finish(utf8.get() + length);
+
+    return arc::str::UTF8String(utf8.get(), length);
 }
 
 char* utf8_to_utf16(
@@ -129,79 +308,150 @@ char* utf8_to_utf16(
         arc::data::Endianness endianness,
         bool null_terminated)
 {
-    std::vector<unsigned char> v_str;
-    // convert
-    for(std::size_t i = 0; i < data.get_length(); ++i)
-    {
-        arc::uint32 code_point = data.get_code_point(i);
-        // if this is a 4 byte character apply the surrogate to the code point
-        bool is_surrogate_pair = false;
-        if(code_point > arc::str::UTF16_MAX_2BYTE)
-        {
-            // StringOperations
-            is_surrogate_pair = true;
-            code_point -= arc::str::UTF16_4BYTE_OFFSET;
-            arc::uint32 high_surrogate =
-                arc::str::UTF16_HIGH_SURROGATE_MIN +
-                ((code_point >> 10) & 0x3FF);
-            arc::uint32 low_surrogate =
-                arc::str::UTF16_LOW_SURROGATE_MIN + (code_point & 0x3FF);
-            code_point = (high_surrogate << 16) | low_surrogate;
-        }
+    const unsigned char* d =
+        reinterpret_cast<const unsigned char*>(data.get_raw());
+    std::size_t byte_length = data.get_byte_length() - 1;
+
+    // size the output in a first pass, every symbol is a single code unit
+    // apart from four byte symbols which are surrogate pairs
+    std::size_t units = arc::str::count_symbols(data.get_raw(), byte_length);
+    if(units != byte_length)
+    {
+        units += count_four_byte_symbols(data.get_raw(), byte_length);
+    }
+    char* s = new char[(units + 1) * 2];
+    char* o = s;
+
+    std::size_t i = 0;
 
-        if(endianness == arc::data::ENDIAN_LITTLE)
+#ifndef ARC_STR_DISABLE_SSE
+
+    const __m128i zero = _mm_setzero_si128();
+    // as 16-bit little endian values, the bits that identify a two byte
+    // symbol and the values they must have
+    const __m128i two_byte_mask = _mm_set1_epi16(static_cast<short>(0xC0E0));
+    const __m128i two_byte_bits = _mm_set1_epi16(static_cast<short>(0x80C0));
+    const __m128i primary_bits = _mm_set1_epi16(0x1F);
+    const __m128i following_bits = _mm_set1_epi16(0x3F);
+
+    // encode 16 bytes at a time
+    while(i + 16 <= byte_length)
+    {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(d + i));
+
+        // all ASCII? then each byte is widened to a code unit
+        if(_mm_movemask_epi8(block) == 0)
         {
-            if(is_surrogate_pair)
+            __m128i low = _mm_unpacklo_epi8(block, zero);
+            __m128i high = _mm_unpackhi_epi8(block, zero);
+            if(endianness == arc::data::ENDIAN_BIG)
             {
-                v_str.push_back(code_point >> 16);
-                v_str.push_back(code_point >> 24);
+                low = _mm_unpacklo_epi8(zero, block);
+                high = _mm_unpackhi_epi8(zero, block);
             }
-            v_str.push_back(code_point);
-            v_str.push_back(code_point >> 8);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(o), low);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(o + 16), high);
+            o += 32;
+            i += 16;
+            continue;
         }
-        else
+
+        // all two byte symbols? then each pair of bytes is a code unit
+        __m128i two_byte = _mm_cmpeq_epi16(
+            _mm_and_si128(block, two_byte_mask),
+            two_byte_bits
+        );
+        if(_mm_movemask_epi8(two_byte) == 0xFFFF)
         {
-            if(is_surrogate_pair)
+            __m128i result = _mm_or_si128(
+                _mm_slli_epi16(_mm_and_si128(block, primary_bits), 6),
+                _mm_and_si128(_mm_srli_epi16(block, 8), following_bits)
+            );
+            if(endianness == arc::data::ENDIAN_BIG)
             {
-                v_str.push_back(code_point >> 24);
-                v_str.push_back(code_point >> 16);
+                result = _mm_or_si128(
+                    _mm_slli_epi16(result, 8),
+                    _mm_srli_epi16(result, 8)
+                );
             }
-            v_str.push_back(code_point >> 8);
-            v_str.push_back(code_point);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(o), result);
+            o += 16;
+            i += 16;
+            continue;
+        }
+
+        // otherwise the symbols of this block are encoded one at a time
+        std::size_t block_end = i + 16;
+        while(i < block_end)
+        {
+            encode_utf16_symbol(d, byte_length, i, endianness, o);
         }
     }
-    // add the NULL terminator
-    if(null_terminated)
+
+#endif
+// ARC_STR_DISABLE_SSE
+
+    while(i < byte_length)
     {
-        v_str.push_back(0x00);
-        v_str.push_back(0x00);
+        encode_utf16_symbol(d, byte_length, i, endianness, o);
     }
 
-    r_length = v_str.size();
-    // allocate to array and copy
-    char* s = new char[r_length];
-    for(std::size_t i = 0; i < v_str.size(); ++i)
+    // add the NULL terminator
+    if(null_terminated)
     {
-        s[i] = static_cast<char>(v_str[i]);
+        *o++ = 0x00;
+        *o++ = 0x00;
     }
 
+    r_length = static_cast<std::size_t>(o - s);
     return s;
 }
 
 bool is_utf8(const char* data, std::size_t length)
 {
+    // check for null terminator
+    if(length == arc::str::npos)
+    {
+        length = strlen(data);
+    }
+
     // marks the number of bytes after a primary byte that are required to start
     // with 10xxxxxx
     arc::uint8 following_bytes = 0;
-    // iterate over the data
-    for(std::size_t i = 0; i < length; ++i)
+    std::size_t i = 0;
+
+#ifndef ARC_STR_DISABLE_SSE
+
+    // the following bytes expected at the start of the next block
+    arc::uint64 carry = 0;
+#ifdef __AVX2__
+    for(; i + 32 <= length; i += 32)
+    {
+        if(!check_utf8_block_avx2(data + i, carry))
+        {
+            return false;
+        }
+    }
+#endif
+    for(; i + 16 <= length; i += 16)
     {
-        // check for null terminator
-        if(length == arc::str::npos && data[i] == '\0')
+        if(!check_utf8_block(data + i, carry))
         {
-            return true;
+            return false;
         }
+    }
+    // the expected following bytes are marked contiguously
+    for(; carry != 0; carry >>= 1)
+    {
+        ++following_bytes;
+    }
+
+#endif
+// ARC_STR_DISABLE_SSE
 
+    // iterate over the remaining data
+    for(; i < length; ++i)
+    {
         // is this a following byte we need to check
         if(following_bytes > 0)
         {
@@ -253,6 +503,226 @@ bool is_utf8(const char* data, std::size_t length)
     return true;
 }
 
+std::size_t count_symbols(const char* data, std::size_t length)
+{
+    std::size_t count = 0;
+    std::size_t i = 0;
+
+#ifndef ARC_STR_DISABLE_SSE
+
+    // bytes that are not following bytes are greater than -65 as signed
+    // values, and the comparison sets their lanes to -1 so subtracting the
+    // comparison counts them in each lane. The lanes are summed before they
+    // can overflow.
+#ifdef __AVX2__
+    const __m256i threshold_avx2 = _mm256_set1_epi8(-65);
+    while(i + 32 <= length)
+    {
+        std::size_t blocks = std::min<std::size_t>((length - i) / 32, 255);
+        __m256i counts = _mm256_setzero_si256();
+        for(std::size_t b = 0; b < blocks; ++b, i += 32)
+        {
+            __m256i block =
+                _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+            counts = _mm256_sub_epi8(
+                counts,
+                _mm256_cmpgt_epi8(block, threshold_avx2)
+            );
+        }
+        __m256i sums = _mm256_sad_epu8(counts, _mm256_setzero_si256());
+        count += static_cast<std::size_t>(
+            _mm256_extract_epi64(sums, 0) + _mm256_extract_epi64(sums, 1) +
+            _mm256_extract_epi64(sums, 2) + _mm256_extract_epi64(sums, 3)
+        );
+    }
+#endif
+    const __m128i threshold = _mm_set1_epi8(-65);
+    while(i + 16 <= length)
+    {
+        std::size_t blocks = std::min<std::size_t>((length - i) / 16, 255);
+        __m128i counts = _mm_setzero_si128();
+        for(std::size_t b = 0; b < blocks; ++b, i += 16)
+        {
+            __m128i block =
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+            counts = _mm_sub_epi8(counts, _mm_cmpgt_epi8(block, threshold));
+        }
+        __m128i sums = _mm_sad_epu8(counts, _mm_setzero_si128());
+        count += static_cast<std::size_t>(
+            _mm_cvtsi128_si32(sums) +
+            _mm_cvtsi128_si32(_mm_srli_si128(sums, 8))
+        );
+    }
+
+#endif
+// ARC_STR_DISABLE_SSE
+
+    // every byte that is not a following byte starts a symbol
+    for(; i < length; ++i)
+    {
+        if((data[i] & 0xC0) != 0x80)
+        {
+            ++count;
+        }
+    }
+    return count;
+}
+
+std::size_t find_bytes(
+        const char* data,
+        std::size_t length,
+        const char* pattern,
+        std::size_t pattern_length)
+{
+    if(pattern_length == 0)
+    {
+        return 0;
+    }
+    if(pattern_length > length)
+    {
+        return arc::str::npos;
+    }
+
+    // one past the last offset the pattern could start at
+    std::size_t end = length - pattern_length + 1;
+    std::size_t i = 0;
+
+#ifndef ARC_STR_DISABLE_SSE
+
+    // filter 16 offsets at a time by the first and last byte of the pattern,
+    // and only compare the whole pattern at offsets where both match
+    const __m128i first = _mm_set1_epi8(pattern[0]);
+    const __m128i last = _mm_set1_epi8(pattern[pattern_length - 1]);
+    for(; i + 16 <= end; i += 16)
+    {
+        int mask = candidate_mask(data + i, pattern_length, first, last);
+        for(std::size_t offset = 0; mask != 0; ++offset, mask >>= 1)
+        {
+            if((mask & 1) &&
+               memcmp(data + i + offset, pattern, pattern_length) == 0)
+            {
+                return i + offset;
+            }
+        }
+    }
+
+#endif
+// ARC_STR_DISABLE_SSE
+
+    while(i < end)
+    {
+        // skip to the next occurrence of the first byte
+        const char* found = static_cast<const char*>(
+            memchr(data + i, pattern[0], end - i)
+        );
+        if(found == nullptr)
+        {
+            break;
+        }
+        i = static_cast<std::size_t>(found - data);
+        if(memcmp(found, pattern, pattern_length) == 0)
+        {
+            return i;
+        }
+        ++i;
+    }
+
+    return arc::str::npos;
+}
+
+std::size_t find_last_bytes(
+        const char* data,
+        std::size_t length,
+        const char* pattern,
+        std::size_t pattern_length)
+{
+    if(pattern_length == 0)
+    {
+        return length;
+    }
+    if(pattern_length > length)
+    {
+        return arc::str::npos;
+    }
+
+    // one past the last offset the pattern could start at
+    std::size_t end = length - pattern_length + 1;
+
+#ifndef ARC_STR_DISABLE_SSE
+
+    // as find_bytes but working backwards from the end of the data
+    const __m128i first = _mm_set1_epi8(pattern[0]);
+    const __m128i last = _mm_set1_epi8(pattern[pattern_length - 1]);
+    for(; end >= 16; end -= 16)
+    {
+        std::size_t i = end - 16;
+        int mask = candidate_mask(data + i, pattern_length, first, last);
+        for(std::size_t offset = 16; mask != 0 && offset > 0; --offset)
+        {
+            if((mask & (1 << (offset - 1))) &&
+               memcmp(data + i + offset - 1, pattern, pattern_length) == 0)
+            {
+                return i + offset - 1;
+            }
+        }
+    }
+
+#endif
+// ARC_STR_DISABLE_SSE
+
+    while(end > 0)
+    {
+        --end;
+        if(data[end] == pattern[0] &&
+           memcmp(data + end, pattern, pattern_length) == 0)
+        {
+            return end;
+        }
+    }
+
+    return arc::str::npos;
+}
+
+std::size_t hash_bytes(const char* data, std::size_t length)
+{
+    static const arc::uint64 PRIME = 0x100000001B3ULL;
+
+    // fold the data into the hash 8 bytes at a time, each step is a bijection
+    // of the hash so blocks that differ always produce different states
+    arc::uint64 hash = 0xCBF29CE484222325ULL ^ (length * PRIME);
+    std::size_t i = 0;
+    for(; i + 8 <= length; i += 8)
+    {
+        arc::uint64 block;
+        memcpy(&block, data + i, 8);
+        hash = (hash ^ block) * PRIME;
+        hash ^= hash >> 29;
+    }
+    // fold in the remaining bytes
+    if(i < length)
+    {
+        arc::uint64 block = 0;
+        memcpy(&block, data + i, length - i);
+        hash = (hash ^ block) * PRIME;
+        hash ^= hash >> 29;
+    }
+
+    // avalanche so that every bit of the data affects the low bits that hash
+    // tables use to select buckets
+    hash ^= hash >> 33;
+    hash *= 0xFF51AFD7ED558CCDULL;
+    hash ^= hash >> 33;
+    hash *= 0xC4CEB9FE1A85EC53ULL;
+    hash ^= hash >> 33;
+
+    // 0 is reserved so that callers can use it to mark an uncomputed hash
+    if(static_cast<std::size_t>(hash) == 0)
+    {
+        return 1;
+    }
+    return static_cast<std::size_t>(hash);
+}
+
 arc::str::UTF8String join(
         const std::vector<arc::str::UTF8String>& components,
         const arc::str::UTF8String& seperator)
@@ -52,6 +52,10 @@ arc::str::UTF8String utf16_to_utf8(
  *
  * The resulting UTF-16 data will be null terminated with `0x00`, `0x00`.
  *
+ * The length of the output is calculated before it is allocated, and then
+ * 16 bytes of ASCII data, or 8 two byte symbols, are encoded at a time. Other
+ * symbols are encoded one at a time.
+ *
  * \warning This operation allocates a new char array that must be deleted.
  *
  * \param data UTF8String object to convert to a c style string of UTF-16
@@ -80,6 +84,9 @@ char* utf8_to_utf16(
  * - Three byte symbol: `1110xxxx 10xxxxxx 10xxxxxx`
  * - Four byte symbol: `11110xxx 10xxxxxx 10xxxxxx 10xxxxxx`
  *
+ * The data is checked 16 bytes at a time (or 32 when AVX2 is available), and
+ * blocks of ASCII data only need to be tested for set high bits.
+ *
  * \param length The length of that data provided, if set to arc::str::npos
  *        (default) it will be assumed that the character data ends with a null
  *        terminator.
@@ -88,6 +95,94 @@ char* utf8_to_utf16(
  */
 bool is_utf8(const char* data, std::size_t length = arc::str::npos);
 
+/*!
+ * \brief Returns the number of UTF-8 symbols in the given data.
+ *
+ * Every byte that is not a following byte (`10xxxxxx`) starts a symbol, so
+ * the symbols are counted by counting these bytes 16 at a time (or 32 when
+ * AVX2 is available).
+ *
+ * \note The data is not validated, see is_utf8().
+ *
+ * \param data The UTF-8 data to count the symbols of.
+ * \param length The number of bytes in the data.
+ */
+std::size_t count_symbols(const char* data, std::size_t length);
+
+/*!
+ * \brief Returns the byte offset of the first occurrence of the given pattern
+ *        in the given data.
+ *
+ * The data is compared byte by byte, since UTF-8 is self-synchronising any
+ * match of valid UTF-8 encoded data begins at the start of a symbol.
+ *
+ * Example usage:
+ *
+ * \code
+ * arc::str::find_bytes("a£b£", 6, "£", 2); // returns: 1
+ * \endcode
+ *
+ * \param data The data to search.
+ * \param length The number of bytes in the data to search.
+ * \param pattern The bytes to search for.
+ * \param pattern_length The number of bytes in the pattern.
+ *
+ * \return The byte offset of the match, or arc::str::npos if the pattern does
+ *         not occur in the data. An empty pattern matches at offset ```0```.
+ */
+std::size_t find_bytes(
+        const char* data,
+        std::size_t length,
+        const char* pattern,
+        std::size_t pattern_length);
+
+/*!
+ * \brief Returns the byte offset of the last occurrence of the given pattern
+ *        in the given data.
+ *
+ * Example usage:
+ *
+ * \code
+ * arc::str::find_last_bytes("a£b£", 6, "£", 2); // returns: 4
+ * \endcode
+ *
+ * \param data The data to search.
+ * \param length The number of bytes in the data to search.
+ * \param pattern The bytes to search for.
+ * \param pattern_length The number of bytes in the pattern.
+ *
+ * \return The byte offset of the match, or arc::str::npos if the pattern does
+ *         not occur in the data. An empty pattern matches at offset
+ *         ```length```.
+ */
+std::size_t find_last_bytes(
+        const char* data,
+        std::size_t length,
+        const char* pattern,
+        std::size_t pattern_length);
+
+/*!
+ * \brief Returns a hash of the given bytes.
+ *
+ * The data is folded into the hash 8 bytes at a time using the FNV-1a prime
+ * and then finalised with the MurmurHash3 avalanche, so hashing short keys
+ * takes only a few multiplications. This is intended for hash tables, for
+ * stable or cryptographic hashes see the arc::crypt::hash module.
+ *
+ * This is the hash used for UTF8String and UTF8StringView, so text hashes to
+ * the same value regardless of which type holds it.
+ *
+ * \note Blocks are read in the native byte order so hashes differ between
+ *       big and little endian systems.
+ *
+ * \return The hash of the data, which is never ```0``` so that 0 can be used
+ *         to mark a hash that has not been computed.
+ *
+ * \param data The bytes to hash.
+ * \param length The number of bytes in the data.
+ */
+std::size_t hash_bytes(const char* data, std::size_t length);
+
 /*!
  * \brief Joins the given vector into a single arc::str::UTF8String.
  *
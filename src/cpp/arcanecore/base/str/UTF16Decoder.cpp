@@ -0,0 +1,264 @@
+#include "arcanecore/base/str/UTF16Decoder.hpp"
+
+#include "arcanecore/base/str/StringConstants.hpp"
+
+#ifndef ARC_STR_DISABLE_SSE
+    #include "arcanecore/base/simd/Include.hpp"
+#endif
+
+namespace arc
+{
+namespace str
+{
+
+//------------------------------------------------------------------------------
+//                            PUBLIC STATIC ATTRIBUTES
+//------------------------------------------------------------------------------
+
+const std::size_t UTF16Decoder::MAX_FINISH_LENGTH = 3;
+
+//------------------------------------------------------------------------------
+//                                STATIC FUNCTIONS
+//------------------------------------------------------------------------------
+
+/*!
+ * \brief Writes the given code point as UTF-8 and advances the output.
+ */
+static inline void write_code_point(arc::uint32 code_point, char*& output)
+{
+    // one byte UTF-8 character
+    if(code_point < 0x80)
+    {
+        *output++ = static_cast<char>(code_point);
+    }
+    // two byte UTF-8 character
+    else if(code_point < 0x800)
+    {
+        *output++ = static_cast<char>(0xC0 | (code_point >> 6));
+        *output++ = static_cast<char>(0x80 | (code_point & 0x3F));
+    }
+    // three byte UTF-8 character
+    else if(code_point < 0x10000)
+    {
+        *output++ = static_cast<char>(0xE0 | (code_point >> 12));
+        *output++ = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+        *output++ = static_cast<char>(0x80 | (code_point & 0x3F));
+    }
+    // four byte UTF-8 character
+    else
+    {
+        *output++ = static_cast<char>(0xF0 | ((code_point >> 18) & 0x07));
+        *output++ = static_cast<char>(0x80 | ((code_point >> 12) & 0x3F));
+        *output++ = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+        *output++ = static_cast<char>(0x80 | (code_point & 0x3F));
+    }
+}
+
+/*!
+ * \brief Decodes a single UTF-16 code unit, combining surrogate pairs.
+ */
+static inline void decode_unit(
+        arc::uint32 unit,
+        arc::uint32& high_surrogate,
+        char*& output)
+{
+    if(high_surrogate != 0)
+    {
+        // complete the surrogate pair?
+        if(unit >= arc::str::UTF16_LOW_SURROGATE_MIN && unit <= 0xDFFF)
+        {
+            arc::uint32 code_point =
+                ((high_surrogate - arc::str::UTF16_HIGH_SURROGATE_MIN) << 10) |
+                (unit - arc::str::UTF16_LOW_SURROGATE_MIN);
+            write_code_point(
+                code_point + arc::str::UTF16_4BYTE_OFFSET,
+                output
+            );
+            high_surrogate = 0;
+            return;
+        }
+        // unpaired
+        write_code_point(high_surrogate, output);
+        high_surrogate = 0;
+    }
+
+    if(unit >= arc::str::UTF16_HIGH_SURROGATE_MIN &&
+       unit <= arc::str::UTF16_HIGH_SURROGATE_MAX    )
+    {
+        high_surrogate = unit;
+        return;
+    }
+    write_code_point(unit, output);
+}
+
+/*!
+ * \brief Reads the code unit at the given data in the given byte order.
+ */
+static inline arc::uint32 read_unit(
+        const unsigned char* data,
+        arc::data::Endianness endianness)
+{
+    if(endianness == arc::data::ENDIAN_BIG)
+    {
+        return (static_cast<arc::uint32>(data[0]) << 8) |
+                static_cast<arc::uint32>(data[1]);
+    }
+    return  static_cast<arc::uint32>(data[0]) |
+           (static_cast<arc::uint32>(data[1]) << 8);
+}
+
+//------------------------------------------------------------------------------
+//                                  CONSTRUCTORS
+//------------------------------------------------------------------------------
+
+UTF16Decoder::UTF16Decoder(arc::data::Endianness endianness)
+    :
+    m_endianness    (endianness),
+    m_has_odd_byte  (false),
+    m_odd_byte      (0),
+    m_high_surrogate(0)
+{
+}
+
+//------------------------------------------------------------------------------
+//                            PUBLIC STATIC FUNCTIONS
+//------------------------------------------------------------------------------
+
+std::size_t UTF16Decoder::get_max_output_length(std::size_t byte_length)
+{
+    // every code unit produces at most 3 bytes, plus a pending high surrogate
+    // from the previous chunk may be written as unpaired
+    return ((byte_length / 2) + 1) * 3 + MAX_FINISH_LENGTH;
+}
+
+//------------------------------------------------------------------------------
+//                            PUBLIC MEMBER FUNCTIONS
+//------------------------------------------------------------------------------
+
+arc::data::Endianness UTF16Decoder::get_endianness() const
+{
+    return m_endianness;
+}
+
+std::size_t UTF16Decoder::decode(
+        const char* data,
+        std::size_t byte_length,
+        char* output)
+{
+    const unsigned char* d = reinterpret_cast<const unsigned char*>(data);
+    char* o = output;
+
+    // complete a code unit split by the last chunk
+    if(m_has_odd_byte && byte_length > 0)
+    {
+        unsigned char unit_bytes[2] = {m_odd_byte, d[0]};
+        decode_unit(read_unit(unit_bytes, m_endianness), m_high_surrogate, o);
+        m_has_odd_byte = false;
+        ++d;
+        --byte_length;
+    }
+
+    std::size_t i = 0;
+
+#ifndef ARC_STR_DISABLE_SSE
+
+    const __m128i zero           = _mm_setzero_si128();
+    const __m128i ascii_mask     = _mm_set1_epi16(static_cast<short>(0xFF80));
+    const __m128i surrogate_mask = _mm_set1_epi16(static_cast<short>(0xF800));
+    const __m128i surrogate_bits = _mm_set1_epi16(static_cast<short>(0xD800));
+
+    // decode 8 code units at a time
+    while(byte_length - i >= 16)
+    {
+        // a pending high surrogate must be paired using the scalar path
+        if(m_high_surrogate != 0)
+        {
+            decode_unit(read_unit(d + i, m_endianness), m_high_surrogate, o);
+            i += 2;
+            continue;
+        }
+
+        __m128i units =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(d + i));
+        if(m_endianness == arc::data::ENDIAN_BIG)
+        {
+            units = _mm_or_si128(
+                _mm_slli_epi16(units, 8),
+                _mm_srli_epi16(units, 8)
+            );
+        }
+
+        // all ASCII?
+        __m128i high_bits = _mm_and_si128(units, ascii_mask);
+        if(_mm_movemask_epi8(_mm_cmpeq_epi16(high_bits, zero)) == 0xFFFF)
+        {
+            _mm_storel_epi64(
+                reinterpret_cast<__m128i*>(o),
+                _mm_packus_epi16(units, units)
+            );
+            o += 8;
+            i += 16;
+            continue;
+        }
+
+        // no surrogates?
+        __m128i surrogates = _mm_cmpeq_epi16(
+            _mm_and_si128(units, surrogate_mask),
+            surrogate_bits
+        );
+        if(_mm_movemask_epi8(surrogates) == 0)
+        {
+            arc::uint16 unpacked[8];
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(unpacked), units);
+            for(std::size_t j = 0; j < 8; ++j)
+            {
+                write_code_point(unpacked[j], o);
+            }
+            i += 16;
+            continue;
+        }
+
+        // surrogates are handled one unit at a time
+        for(std::size_t j = 0; j < 8; ++j, i += 2)
+        {
+            decode_unit(read_unit(d + i, m_endianness), m_high_surrogate, o);
+        }
+    }
+
+#endif
+
+    for(; i + 1 < byte_length; i += 2)
+    {
+        decode_unit(read_unit(d + i, m_endianness), m_high_surrogate, o);
+    }
+
+    // keep a trailing byte for the next chunk
+    if(i < byte_length)
+    {
+        m_has_odd_byte = true;
+        m_odd_byte = d[i];
+    }
+
+    return static_cast<std::size_t>(o - output);
+}
+
+std::size_t UTF16Decoder::finish(char* output)
+{
+    char* o = output;
+    if(m_high_surrogate != 0)
+    {
+        write_code_point(m_high_surrogate, o);
+    }
+    reset();
+    return static_cast<std::size_t>(o - output);
+}
+
+void UTF16Decoder::reset()
+{
+    m_has_odd_byte   = false;
+    m_odd_byte       = 0;
+    m_high_surrogate = 0;
+}
+
+} // namespace str
+} // namespace arc
@@ -0,0 +1,150 @@
+/*!
+ * \file
+ * \author David Saxon
+ */
+#ifndef ARCANECORE_BASE_STR_UTF16DECODER_HPP_
+#define ARCANECORE_BASE_STR_UTF16DECODER_HPP_
+
+#include "arcanecore/base/Types.hpp"
+#include "arcanecore/base/data/BinaryOperations.hpp"
+
+namespace arc
+{
+namespace str
+{
+
+/*!
+ * \brief Incrementally decodes UTF-16 encoded data to UTF-8.
+ *
+ * UTF-16 data can be passed to decode() in chunks of any size, the decoder
+ * keeps track of any code unit or surrogate pair that is split across the
+ * boundary of two chunks. Decoded UTF-8 data is written directly into a buffer
+ * provided by the caller, the size of which can be determined up front using
+ * get_max_output_length().
+ *
+ * Runs of code units that are not surrogates are decoded using SSE unless
+ * ```ARC_STR_DISABLE_SSE``` is defined.
+ *
+ * \note Unpaired surrogates are not treated as errors, they are encoded as if
+ *       they were code points.
+ *
+ * \par Example Usage
+ *
+ * \code
+ * arc::str::UTF16Decoder decoder(arc::data::ENDIAN_LITTLE);
+ *
+ * std::vector<char> output(
+ *     arc::str::UTF16Decoder::get_max_output_length(chunk_size));
+ * while(read_chunk(chunk, chunk_size))
+ * {
+ *     std::size_t length = decoder.decode(chunk, chunk_size, &output[0]);
+ *     // use the first length bytes of output...
+ * }
+ * std::size_t length = decoder.finish(&output[0]);
+ * \endcode
+ */
+class UTF16Decoder
+{
+public:
+
+    //--------------------------------------------------------------------------
+    //                          PUBLIC STATIC ATTRIBUTES
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief The maximum number of bytes that will be written by finish().
+     */
+    static const std::size_t MAX_FINISH_LENGTH;
+
+    //--------------------------------------------------------------------------
+    //                                CONSTRUCTORS
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief Creates a new UTF16Decoder.
+     *
+     * \param endianness The byte order of the UTF-16 data that will be decoded.
+     */
+    UTF16Decoder(arc::data::Endianness endianness = arc::data::ENDIAN_LITTLE);
+
+    //--------------------------------------------------------------------------
+    //                          PUBLIC STATIC FUNCTIONS
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief Returns the maximum number of bytes a single call to decode() can
+     *        write for the given number of input bytes.
+     */
+    static std::size_t get_max_output_length(std::size_t byte_length);
+
+    //--------------------------------------------------------------------------
+    //                          PUBLIC MEMBER FUNCTIONS
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief Returns the byte order of the UTF-16 data this decoder expects.
+     */
+    arc::data::Endianness get_endianness() const;
+
+    /*!
+     * \brief Decodes the next chunk of UTF-16 data.
+     *
+     * \param data The UTF-16 data to decode.
+     * \param byte_length The number of bytes in the data, this does not need to
+     *                    be a multiple of two.
+     * \param output The buffer to write the UTF-8 data to. This must be at
+     *               least get_max_output_length() bytes long.
+     *
+     * \return The number of bytes written to the output.
+     */
+    std::size_t decode(
+            const char* data,
+            std::size_t byte_length,
+            char* output);
+
+    /*!
+     * \brief Completes decoding and resets this decoder.
+     *
+     * If the last chunk of data ended with a high surrogate it is written as an
+     * unpaired surrogate, while a trailing odd byte is discarded.
+     *
+     * \param output The buffer to write the UTF-8 data to. This must be at
+     *               least MAX_FINISH_LENGTH bytes long.
+     *
+     * \return The number of bytes written to the output.
+     */
+    std::size_t finish(char* output);
+
+    /*!
+     * \brief Discards any partially decoded data.
+     */
+    void reset();
+
+private:
+
+    //--------------------------------------------------------------------------
+    //                             PRIVATE ATTRIBUTES
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief The byte order of the data being decoded.
+     */
+    arc::data::Endianness m_endianness;
+    /*!
+     * \brief Whether the last chunk ended part way through a code unit.
+     */
+    bool m_has_odd_byte;
+    /*!
+     * \brief The first byte of a code unit split across two chunks.
+     */
+    arc::uint8 m_odd_byte;
+    /*!
+     * \brief A high surrogate waiting for its low surrogate, or ```0```.
+     */
+    arc::uint32 m_high_surrogate;
+};
+
+} // namespace str
+} // namespace arc
+
+#endif
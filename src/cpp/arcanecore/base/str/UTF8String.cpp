@@ -1,11 +1,13 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstring>
-#include <sstream>
+#include <iterator>
 
 #include "arcanecore/base/Exceptions.hpp"
 #include "arcanecore/base/data/ByteOperations.hpp"
+#include "arcanecore/base/str/NumericConversions.hpp"
 #include "arcanecore/base/str/UTF8String.hpp"
+#include "arcanecore/base/str/UTF8StringView.hpp"
 #include "arcanecore/base/str/StringOperations.hpp"
 
 namespace arc
@@ -19,6 +21,13 @@ namespace str
 
 UTF8String::Opt UTF8String::default_opt(UTF8String::Opt::NONE);
 
+//------------------------------------------------------------------------------
+//                           PRIVATE STATIC ATTRIBUTES
+//------------------------------------------------------------------------------
+
+const std::size_t UTF8String::CHECKPOINT_INTERVAL = 32;
+const std::size_t UTF8String::LOCAL_CAPACITY;
+
 //------------------------------------------------------------------------------
 //                                  CONSTRUCTORS
 //------------------------------------------------------------------------------
@@ -28,8 +37,22 @@ UTF8String::UTF8String(Opt optimisations)
     m_opt        (optimisations),
     m_data       (nullptr),
     m_data_length(0),
-    m_length     (0)
-{
+    m_capacity   (0),
+    m_length     (0),
+    m_ascii      (true),
+    m_hash       (0)
+{
+    // UTF8Strings are held by value in large numbers (e.g. path components
+    // and map keys) so guard against the object growing: beyond the local
+    // buffer and the optimisation parameters it should only need a word for
+    // each of the data pointer, the three lengths, the checkpoint table, the
+    // hash and the (padded) ASCII flag
+    static_assert(
+        sizeof(UTF8String) <=
+            sizeof(Opt) + LOCAL_CAPACITY + 7 * sizeof(std::size_t),
+        "Unexpected growth in the size of UTF8String"
+    );
+
     // assign the empty string
     try
     {
@@ -37,11 +60,7 @@ UTF8String::UTF8String(Opt optimisations)
     }
     catch(...)
     {
-        if(m_data)
-        {
-            delete[] m_data;
-            m_data = nullptr;
-        }
+        release_data();
         throw;
     }
 }
@@ -51,7 +70,10 @@ UTF8String::UTF8String(const char* data, Opt optimisations)
     m_opt        (optimisations),
     m_data       (nullptr),
     m_data_length(0),
-    m_length     (0)
+    m_capacity   (0),
+    m_length     (0),
+    m_ascii      (true),
+    m_hash       (0)
 {
     // assign the data
     try
@@ -60,11 +82,7 @@ UTF8String::UTF8String(const char* data, Opt optimisations)
     }
     catch(...)
     {
-        if(m_data)
-        {
-            delete[] m_data;
-            m_data = nullptr;
-        }
+        release_data();
         throw;
     }
 }
@@ -77,7 +95,10 @@ UTF8String::UTF8String(
     m_opt        (optimisations),
     m_data       (nullptr),
     m_data_length(0),
-    m_length     (0)
+    m_capacity   (0),
+    m_length     (0),
+    m_ascii      (true),
+    m_hash       (0)
 {
     // assign the data
     try
@@ -86,11 +107,7 @@ UTF8String::UTF8String(
     }
     catch(...)
     {
-        if(m_data)
-        {
-            delete[] m_data;
-            m_data = nullptr;
-        }
+        release_data();
         throw;
     }
 }
@@ -100,7 +117,10 @@ UTF8String::UTF8String(const UTF8String& other)
     m_opt        (other.m_opt),
     m_data       (nullptr),
     m_data_length(0),
-    m_length     (0)
+    m_capacity   (0),
+    m_length     (0),
+    m_ascii      (true),
+    m_hash       (0)
 {
     // assign the data
     try
@@ -110,11 +130,7 @@ UTF8String::UTF8String(const UTF8String& other)
     }
     catch(...)
     {
-        if(m_data)
-        {
-            delete[] m_data;
-            m_data = nullptr;
-        }
+        release_data();
         throw;
     }
 }
@@ -124,13 +140,29 @@ UTF8String::UTF8String(UTF8String&& other)
     m_opt        (other.m_opt),
     m_data       (other.m_data),
     m_data_length(other.m_data_length),
-    m_length     (other.m_length)
-{
-    // reset the other's resources
+    m_capacity   (other.m_capacity),
+    m_length     (other.m_length),
+    m_ascii      (other.m_ascii),
+    m_checkpoints(std::move(other.m_checkpoints)),
+    m_hash       (other.m_hash.load(std::memory_order_relaxed))
+{
+    // short strings can't be taken so must be copied
+    if ( other.is_local() )
+    {
+        memcpy( m_local, other.m_local, other.m_data_length );
+        m_data = m_local;
+    }
+
+    // reset the other to the empty string
     other.m_opt = default_opt;
-    other.m_data = nullptr;
-    other.m_data_length = 0;
+    other.m_local[ 0 ] = '\0';
+    other.m_data = other.m_local;
+    other.m_data_length = 1;
+    other.m_capacity = LOCAL_CAPACITY;
     other.m_length = 0;
+    other.m_ascii = true;
+    other.m_checkpoints.reset();
+    other.m_hash.store( 0, std::memory_order_relaxed );
 }
 
 //------------------------------------------------------------------------------
@@ -140,10 +172,7 @@ UTF8String::UTF8String(UTF8String&& other)
 UTF8String::~UTF8String()
 {
     // ensure we delete the internal data buffer
-    if(m_data)
-    {
-        delete[] m_data;
-    }
+    release_data();
 }
 
 //------------------------------------------------------------------------------
@@ -160,23 +189,42 @@ const UTF8String& UTF8String::operator=(const UTF8String& other)
 
 UTF8String& UTF8String::operator=(UTF8String&& other)
 {
-    // delete the current data
-    if(m_data)
+    if ( &other == this )
     {
-        delete[] m_data;
+        return *this;
     }
 
-    // move resources
+    // delete the current data
+    release_data();
+
+    // move resources, short strings can't be taken so must be copied
     m_opt = other.m_opt;
     m_data = other.m_data;
+    if ( other.is_local() )
+    {
+        memcpy( m_local, other.m_local, other.m_data_length );
+        m_data = m_local;
+    }
     m_data_length = other.m_data_length;
+    m_capacity = other.m_capacity;
     m_length = other.m_length;
+    m_ascii = other.m_ascii;
+    m_checkpoints = std::move( other.m_checkpoints );
+    m_hash.store(
+        other.m_hash.load( std::memory_order_relaxed ),
+        std::memory_order_relaxed
+    );
 
-    // reset other resources
+    // reset the other to the empty string
     other.m_opt = default_opt;
-    other.m_data = nullptr;
-    other.m_data_length = 0;
+    other.m_local[ 0 ] = '\0';
+    other.m_data = other.m_local;
+    other.m_data_length = 1;
+    other.m_capacity = LOCAL_CAPACITY;
     other.m_length = 0;
+    other.m_ascii = true;
+    other.m_checkpoints.reset();
+    other.m_hash.store( 0, std::memory_order_relaxed );
 
     return *this;
 }
@@ -256,29 +304,24 @@ UTF8String& UTF8String::operator<<( const std::string& other )
 
 UTF8String& UTF8String::operator<<( bool other )
 {
-    // TODO: implement correctly
-    std::stringstream ss;
-    ss << other;
-    return this->concatenate( UTF8String( ss.str().c_str() ) );
+    *prepare_append( 1 ) = other ? '1' : '0';
+    return commit_append( 1 );
 }
 
 UTF8String& UTF8String::operator<<( char other )
 {
     // TODO: if over 128 cast to int to avoid encoding errors
-    // TODO: implement correctly
-    std::stringstream ss;
-    ss << other;
-    return this->concatenate( UTF8String( ss.str().c_str() ) );
+    return this->concatenate( UTF8String( &other, 1 ) );
 }
 
 #ifdef ARC_OS_WINDOWS
 
 UTF8String& UTF8String::operator<<( unsigned long other )
 {
-    // TODO: implement correctly
-    std::stringstream ss;
-    ss << other;
-    return this->concatenate( UTF8String( ss.str().c_str() ) );
+    return commit_append( arc::str::format_uint64(
+            other,
+            prepare_append( arc::str::MAX_INTEGER_FORMAT_LENGTH )
+    ) );
 }
 
 #endif
@@ -287,83 +330,79 @@ UTF8String& UTF8String::operator<<( unsigned long other )
 UTF8String& UTF8String::operator<<( arc::int8 other )
 {
     // TODO: if over 128 cast to int to avoid encoding errors?
-    // TODO: implement correctly
-    std::stringstream ss;
-    ss << other;
-    return this->concatenate( UTF8String( ss.str().c_str() ) );
+    const char c = static_cast< char >( other );
+    return this->concatenate( UTF8String( &c, 1 ) );
 }
 
 UTF8String& UTF8String::operator<<( arc::uint8 other )
 {
     // TODO: if over 128 cast to int to avoid encoding errors?
-    // TODO: implement correctly
-    std::stringstream ss;
-    ss << other;
-    return this->concatenate( UTF8String( ss.str().c_str() ) );
+    const char c = static_cast< char >( other );
+    return this->concatenate( UTF8String( &c, 1 ) );
 }
 
 UTF8String& UTF8String::operator<<( arc::int16 other )
 {
-    // TODO: implement correctly
-    std::stringstream ss;
-    ss << other;
-    return this->concatenate( UTF8String( ss.str().c_str() ) );
+    return commit_append( arc::str::format_int64(
+            other,
+            prepare_append( arc::str::MAX_INTEGER_FORMAT_LENGTH )
+    ) );
 }
 
 UTF8String& UTF8String::operator<<( arc::uint16 other )
 {
-    // TODO: implement correctly
-    std::stringstream ss;
-    ss << other;
-    return this->concatenate( UTF8String( ss.str().c_str() ) );
+    return commit_append( arc::str::format_uint64(
+            other,
+            prepare_append( arc::str::MAX_INTEGER_FORMAT_LENGTH )
+    ) );
 }
 
 UTF8String& UTF8String::operator<<( arc::int32 other )
 {
-    // TODO: implement correctly
-    std::stringstream ss;
-    ss << other;
-    return this->concatenate( UTF8String( ss.str().c_str() ) );
+    return commit_append( arc::str::format_int64(
+            other,
+            prepare_append( arc::str::MAX_INTEGER_FORMAT_LENGTH )
+    ) );
 }
 
 UTF8String& UTF8String::operator<<( arc::uint32 other )
 {
-    // TODO: implement correctly
-    std::stringstream ss;
-    ss << other;
-    return this->concatenate( UTF8String( ss.str().c_str() ) );
+    return commit_append( arc::str::format_uint64(
+            other,
+            prepare_append( arc::str::MAX_INTEGER_FORMAT_LENGTH )
+    ) );
 }
 
 UTF8String& UTF8String::operator<<( arc::int64 other )
 {
-    // TODO: implement correctly
-    std::stringstream ss;
-    ss << other;
-    return this->concatenate( UTF8String( ss.str().c_str() ) );
+    return commit_append( arc::str::format_int64(
+            other,
+            prepare_append( arc::str::MAX_INTEGER_FORMAT_LENGTH )
+    ) );
 }
 
 UTF8String& UTF8String::operator<<( arc::uint64 other )
 {
-    // TODO: implement correctly
-    std::stringstream ss;
-    ss << other;
-    return this->concatenate( UTF8String( ss.str().c_str() ) );
+    return commit_append( arc::str::format_uint64(
+            other,
+            prepare_append( arc::str::MAX_INTEGER_FORMAT_LENGTH )
+    ) );
 }
 
 UTF8String& UTF8String::operator<<( float other )
 {
-    // TODO: implement correctly
-    std::stringstream ss;
-    ss << other;
-    return this->concatenate( UTF8String( ss.str().c_str() ) );
+    return commit_append( arc::str::format_float(
+            other,
+            prepare_append( arc::str::MAX_FLOAT_FORMAT_LENGTH )
+    ) );
 }
 
 UTF8String& UTF8String::operator<<(double other)
 {
-    // TODO: implement correctly
-    std::stringstream ss;
-    ss << other;
-    return this->concatenate(UTF8String(ss.str().c_str()));
+    return commit_append( arc::str::format_double(
+            other,
+            prepare_append( arc::str::MAX_FLOAT_FORMAT_LENGTH )
+    ) );
 }
 
 //------------------------------------------------------------------------------
@@ -401,16 +440,11 @@ void UTF8String::assign(const UTF8String& other)
 
 void UTF8String::claim(char* data)
 {
-    // delete the current data
-    if(m_data)
-    {
-        delete[] m_data;
-    }
-
-    // reassign
-    m_data = data;
     // get number of bytes in the data
-    m_data_length = strlen(data) + 1;
+    std::size_t data_length = strlen( data ) + 1;
+    // delete the current data and reassign
+    replace_data( data, data_length );
+    m_data_length = data_length;
 
     // process the raw data
     process_raw();
@@ -420,20 +454,28 @@ UTF8String& UTF8String::concatenate(const UTF8String& other)
 {
     // calculate the new size of the data (but remove the first string's NULL
     // terminator)
-    std::size_t new_length = (m_data_length - 1) + other.m_data_length;
-    // allocate a new array to hold the increase data size, ignoring one of the
-    // NULL terminators
-    char* new_data = new char[ new_length ];
-    // copy over the data from the strings
-    memcpy(new_data, m_data, m_data_length - 1);
-    memcpy(
-        new_data + (m_data_length - 1),
-        other.m_data,
-        other.m_data_length
-    );
-    // finally assign and return
-    claim(new_data);
-    // assign_internal( new_data, new_length );
+    std::size_t old_length = m_data_length - 1;
+    std::size_t new_length = old_length + other.m_data_length;
+    if ( new_length > m_capacity )
+    {
+        // grow geometrically so that repeated appends take linear time
+        std::size_t capacity = std::max( new_length, m_capacity * 2 );
+        char* new_data = new char[ capacity ];
+        // copy over the data from the strings, before the current data is
+        // released since the other string may be this string
+        memcpy( new_data, m_data, old_length );
+        memcpy( new_data + old_length, other.m_data, other.m_data_length );
+        replace_data( new_data, capacity );
+    }
+    else
+    {
+        // append in place, the other string may be this string
+        memmove( m_data + old_length, other.m_data, other.m_data_length );
+    }
+    m_data_length = new_length;
+
+    // only the appended data needs to be processed
+    process_raw( old_length );
     return *this;
 }
 
@@ -442,10 +484,16 @@ UTF8String& UTF8String::repeat(arc::uint32 count)
     std::size_t c_length = m_data_length - 1;
     // calculate the new length
     std::size_t new_length = (c_length * count) + 1;
-    // allocate a new block of data
-    char* new_data = new char[new_length];
+    // use the current data if it's large enough, in which case the first
+    // repetition is already in place
+    std::size_t capacity = m_capacity;
+    char* new_data = m_data;
+    if ( new_length > m_capacity )
+    {
+        new_data = allocate_data( new_length, capacity );
+    }
     // write new data
-    for(std::size_t i = 0; i < count; ++i)
+    for ( std::size_t i = ( new_data == m_data ) ? 1 : 0; i < count; ++i )
     {
         memcpy(
                 new_data + (c_length * i),
@@ -456,114 +504,87 @@ UTF8String& UTF8String::repeat(arc::uint32 count)
     // add the null terminator
     new_data[new_length - 1] = '\0';
     // finally assign and return
-    assign_internal(new_data, new_length);
-    // clean up
-    delete[] new_data;
+    replace_data( new_data, capacity );
+    m_data_length = new_length;
+    // the first repetition has already been processed
+    process_raw( count > 0 ? c_length : 0 );
     return *this;
 }
 
+void UTF8String::reserve( std::size_t byte_length )
+{
+    if ( byte_length + 1 <= m_capacity )
+    {
+        return;
+    }
+    std::size_t capacity = 0;
+    char* new_data = allocate_data( byte_length + 1, capacity );
+    memcpy( new_data, m_data, m_data_length );
+    replace_data( new_data, capacity );
+}
+
 bool UTF8String::starts_with( const UTF8String& substring ) const
 {
     // the substring must be shorter than the actual string
-    if ( substring.m_length > m_length )
+    if ( substring.m_data_length > m_data_length )
     {
         return false;
     }
-    // check until we find a mismatch
-    for ( std::size_t i = 0; i < substring.m_length; ++i )
-    {
-        if ( substring.get_symbol( i ) != get_symbol( i ) )
-        {
-            return false;
-        }
-    }
-
-    // no mismatch
-    return true;
+    // UTF-8 is self-synchronising so comparing the bytes is enough
+    return memcmp( m_data, substring.m_data, substring.m_data_length - 1 ) == 0;
 }
 
 bool UTF8String::ends_with( const UTF8String& substring ) const
 {
     // the substring must be shorter than the actual string
-    if ( substring.m_length > m_length )
+    if ( substring.m_data_length > m_data_length )
     {
         return false;
     }
-    // check until we find a mismatch
-    std::size_t diff = m_length - substring.m_length;
-    for ( std::size_t i = substring.m_length; i > 0; --i )
-    {
-        if ( substring.get_symbol( i - 1 ) != get_symbol( diff + ( i - 1 ) ) )
-        {
-            return false;
-        }
-    }
-
-    // no mismatch
-    return true;
+    return memcmp(
+        m_data + ( m_data_length - substring.m_data_length ),
+        substring.m_data,
+        substring.m_data_length - 1
+    ) == 0;
 }
 
 std::size_t UTF8String::find_first( const UTF8String& substring ) const
 {
-    // the substring must be shorter than the actual string
-    if ( substring.m_length > m_length )
+    std::size_t byte_index = find_byte_index( substring, 0 );
+    if ( byte_index == arc::str::npos )
     {
         return arc::str::npos;
     }
-    // check against each character
-    for( std::size_t i = 0; i < m_length - ( substring.m_length - 1 ); ++i )
-    {
-        // check that each symbol matches
-        bool match = true;
-        for ( std::size_t j = 0; j < substring.m_length; ++j )
-        {
-            if ( substring.get_symbol_value( j ) != get_symbol_value( i + j ) )
-            {
-
-                match = false;
-                break;
-            }
-        }
-        if ( match )
-        {
-            return i;
-        }
-    }
-    return arc::str::npos;
+    return get_symbol_index_for_match( byte_index );
 }
 
 std::size_t UTF8String::find_last( const UTF8String& substring ) const
 {
-    // the substring must be shorter than the actual string
-    if ( substring.m_length > m_length )
-    {
-        return arc::str::npos;
-    }
-    // check against each character
-    for( std::size_t i = m_length - substring.m_length;
-         i != arc::str::npos;
-         --i )
+    // search backwards until a match that starts on a symbol boundary is
+    // found, which is only a concern for fixed width strings
+    std::size_t length = m_data_length - 1;
+    while ( true )
     {
-        // check that each symbol matches
-        bool match = true;
-        for ( std::size_t j = 0; j < substring.m_length; ++j )
+        std::size_t byte_index = arc::str::find_last_bytes(
+            m_data,
+            length,
+            substring.m_data,
+            substring.m_data_length - 1
+        );
+        if ( byte_index == arc::str::npos )
         {
-            if ( substring.get_symbol( j ) != get_symbol( i + j ) )
-            {
-                match = false;
-                break;
-            }
+            return arc::str::npos;
         }
-        if ( match )
+        if ( is_symbol_boundary( byte_index ) )
         {
-            return i;
+            return get_symbol_index_for_match( byte_index );
         }
+        // search again excluding this match
+        length = byte_index + substring.m_data_length - 2;
     }
-    return arc::str::npos;
 }
 
-std::vector< UTF8String > UTF8String::split(
-        const UTF8String& delimiter ) const
+std::vector<UTF8String> UTF8String::split( const UTF8String& delimiter ) const
 {
     // check the delimiter
     if ( delimiter.is_empty() )
@@ -572,30 +593,22 @@ std::vector< UTF8String > UTF8String::split(
     }
 
     // create the vector to return
-    std::vector< UTF8String > elements;
+    std::vector<UTF8String> elements;
 
-    UTF8String element;
-    for( std::size_t i = 0; i < m_length; )
+    // add the data between each occurrence of the delimiter
+    std::size_t start = 0;
+    std::size_t byte_index = find_byte_index( delimiter, start );
+    while ( byte_index != arc::str::npos )
     {
-        // are we looking at the delimiter
-        if ( substring( i, delimiter.get_length() ) == delimiter )
-        {
-            // add what we have so far
-            elements.push_back( element );
-            // clear element
-            element = "";
-            // increment past the delimiter
-            i += delimiter.get_length();
-        }
-        else
-        {
-            element += get_symbol( i );
-            ++i;
-        }
+        elements.push_back( UTF8String( m_data + start, byte_index - start ) );
+        // move past the delimiter
+        start = byte_index + ( delimiter.m_data_length - 1 );
+        byte_index = find_byte_index( delimiter, start );
     }
     // add the final element
-    elements.push_back( element );
-
+    elements.push_back(
+        UTF8String( m_data + start, ( m_data_length - 1 ) - start )
+    );
 
     return elements;
 }
@@ -644,66 +657,19 @@ void UTF8String::remove_duplicates( const UTF8String& substring )
 
 bool UTF8String::is_int() const
 {
-    // iterate over each code point and ensure that it's a digit
-    for ( std::size_t i = 0; i < m_length; ++i )
-    {
-        arc::uint32 code_point = get_code_point( i );
-
-        // the first symbol is allowed to be '-'
-        if ( i == 0                                  &&
-            get_symbol( i ) != "-"                   &&
-            !arc::str::is_digit( code_point )    )
-        {
-            return false;
-        }
-        // every other character must be a digit
-        else if ( i != 0 && !arc::str::is_digit( code_point ) )
-        {
-            return false;
-        }
-    }
-    // valid int
-    return !is_empty();
+    // any byte of a multi-byte symbol is not a digit so the bytes can be
+    // checked directly
+    return arc::str::is_int( m_data, m_data_length - 1 );
 }
 
 bool UTF8String::is_uint() const
 {
-    // iterate of each code point and ensure that it's a digit
-    for ( std::size_t i = 0; i < m_length; ++i )
-    {
-        if ( !arc::str::is_digit( get_symbol_value( i ) ) )
-        {
-            // not a digit
-            return false;
-        }
-    }
-    // valid unsigned int
-    return !is_empty();
+    return arc::str::is_uint( m_data, m_data_length - 1 );
 }
 
 bool UTF8String::is_float() const
 {
-    bool point_found = false;
-    // iterate of each code point
-    for ( std::size_t i = 0; i < m_length; ++i )
-    {
-        arc::uint32 code_point = get_symbol_value( i );
-
-        if ( !arc::str::is_digit( code_point ) )
-        {
-            if ( i == 0 && get_symbol( i ) == "-" )
-            {
-                continue;
-            }
-            if ( get_symbol( i ) == "." && !point_found )
-            {
-                point_found = true;
-                continue;
-            }
-            return false;
-        }
-    }
-    return !is_empty();
+    return arc::str::is_float( m_data, m_data_length - 1 );
 }
 
 UTF8String UTF8String::substring( std::size_t start, std::size_t end ) const
@@ -717,17 +683,15 @@ UTF8String UTF8String::substring( std::size_t start, std::size_t end ) const
     // is the index valid
     check_symbol_index( start );
 
-    // TODO: can this be optimised to copy raw data array?
-
-    UTF8String result;
-    for ( std::size_t i = start;
-          i < std::min( get_length(),  start + end );
-          ++i )
+    // copy the bytes between the first and last symbol directly
+    std::size_t start_byte = get_byte_index_for_symbol_index( start );
+    std::size_t end_byte = m_data_length - 1;
+    if ( end < get_length() - start )
     {
-        result += get_symbol( i );
+        end_byte = get_byte_index_for_symbol_index( start + end );
     }
 
-    return result;
+    return UTF8String( m_data + start_byte, end_byte - start_byte );
 }
 
 std::string UTF8String::to_std_string() const
@@ -749,9 +713,9 @@ bool UTF8String::to_bool() const
         throw arc::ex::ConversionDataError( error_message );
     }
     // do conversion and return
-    for ( std::size_t i = 0; i < get_length(); ++i )
+    for ( std::size_t i = 0; i < m_data_length - 1; ++i )
     {
-        if ( get_symbol( i ) != "0" )
+        if ( m_data[ i ] != '0' )
         {
             return true;
         }
@@ -761,59 +725,78 @@ bool UTF8String::to_bool() const
 
 arc::int32 UTF8String::to_int32() const
 {
+    arc::int32 value = 0;
     // is the conversion valid?
-    if ( !is_int() )
+    if ( !try_to_int32( value ) )
     {
         UTF8String error_message;
         error_message << "Cannot convert: \'" << *this << " to int32 as it is "
                       << "not valid.";
         throw arc::ex::ConversionDataError( error_message );
     }
-    // do and return conversion
-    return static_cast< arc::int32 >( std::strtol( get_raw(), NULL, 0 ) );
+    return value;
 }
 
 arc::uint32 UTF8String::to_uint32() const
 {
+    arc::uint32 value = 0;
     // is the conversion valid?
-    if ( !is_uint() )
+    if ( !try_to_uint32( value ) )
     {
         UTF8String error_message;
         error_message << "Cannot convert: \'" << *this << " to uint32 as it is "
                       << "not valid.";
         throw arc::ex::ConversionDataError( error_message );
     }
-    // do and return conversion
-    return static_cast< arc::uint32 >( strtoul( get_raw(), NULL, 0 ) );
+    return value;
 }
 
 arc::int64 UTF8String::to_int64() const
 {
+    arc::int64 value = 0;
     // is the conversion valid?
-    if ( !is_int() )
+    if ( !try_to_int64( value ) )
     {
         UTF8String error_message;
         error_message << "Cannot convert: \'" << *this << " to int64 as it is "
                       << "not valid.";
         throw arc::ex::ConversionDataError( error_message );
     }
-    // do and return conversion
-    return static_cast< arc::int64 >( std::strtol( get_raw(), NULL, 0 ) );
+    return value;
 }
 
-arc::int64 UTF8String::to_uint64() const
+arc::uint64 UTF8String::to_uint64() const
 {
+    arc::uint64 value = 0;
     // is the conversion valid?
-    if ( !is_uint() )
+    if ( !try_to_uint64( value ) )
     {
         UTF8String error_message;
         error_message << "Cannot convert: \'" << *this << " to uint64 as it is "
                       << "not valid.";
         throw arc::ex::ConversionDataError( error_message );
     }
-    // do and return conversion
-    return static_cast< arc::uint64 >(
-            std::strtoul( get_raw(), NULL, 0 ) );
+    return value;
+}
+
+bool UTF8String::try_to_int32( arc::int32& r_value ) const
+{
+    return UTF8StringView( *this ).try_to_int32( r_value );
+}
+
+bool UTF8String::try_to_uint32( arc::uint32& r_value ) const
+{
+    return UTF8StringView( *this ).try_to_uint32( r_value );
+}
+
+bool UTF8String::try_to_int64( arc::int64& r_value ) const
+{
+    return UTF8StringView( *this ).try_to_int64( r_value );
+}
+
+bool UTF8String::try_to_uint64( arc::uint64& r_value ) const
+{
+    return UTF8StringView( *this ).try_to_uint64( r_value );
 }
 
 //----------------------------------ACCESSORS-----------------------------------
@@ -898,9 +881,25 @@ std::size_t UTF8String::get_byte_index_for_symbol_index(
         // we can just calculate based on fixed width
         return symbol_index * m_opt.fixed_width_size;
     }
+    if ( m_ascii )
+    {
+        // every symbol is a single byte
+        return symbol_index;
+    }
 
+    // start from the closest checkpoint before the symbol
     std::size_t current_index = 0;
-    for(std::size_t i = 0; i < m_data_length - 1;)
+    std::size_t i = 0;
+    std::size_t checkpoint = symbol_index / CHECKPOINT_INTERVAL;
+    if ( checkpoint > 0  &&
+         m_checkpoints   &&
+         checkpoint <= m_checkpoints->size() )
+    {
+        current_index = checkpoint * CHECKPOINT_INTERVAL;
+        i = ( *m_checkpoints )[ checkpoint - 1 ];
+    }
+
+    for ( ; i < m_data_length - 1; )
     {
         if (current_index == symbol_index)
         {
@@ -926,6 +925,10 @@ std::size_t UTF8String::get_symbol_width(std::size_t index) const
         // return from optimisation parameters
         return m_opt.fixed_width_size;
     }
+    if ( m_ascii )
+    {
+        return 1;
+    }
 
     std::size_t byte_index = get_byte_index_for_symbol_index(index);
     return get_byte_width(byte_index);
@@ -941,6 +944,11 @@ std::size_t UTF8String::get_byte_length() const
     return m_data_length;
 }
 
+std::size_t UTF8String::get_capacity() const
+{
+    return m_capacity - 1;
+}
+
 std::size_t UTF8String::get_symbol_index_for_byte_index(
         std::size_t byte_index) const
 {
@@ -952,9 +960,39 @@ std::size_t UTF8String::get_symbol_index_for_byte_index(
         // we can just calculate based on fixed width
         return byte_index / m_opt.fixed_width_size;
     }
+    if ( m_ascii )
+    {
+        // every symbol is a single byte, but the NULL terminator is not part
+        // of any symbol
+        if ( byte_index < m_data_length - 1 )
+        {
+            return byte_index;
+        }
+        return arc::str::npos;
+    }
 
+    // start from the last checkpoint at or before the byte
     std::size_t current_index = 0;
-    for (std::size_t i = 0; i < m_data_length - 1;)
+    std::size_t i = 0;
+    if ( m_checkpoints )
+    {
+        const std::vector<std::size_t>& checkpoints = *m_checkpoints;
+        std::vector<std::size_t>::const_iterator checkpoint = std::upper_bound(
+            checkpoints.begin(),
+            checkpoints.end(),
+            byte_index
+        );
+        if ( checkpoint != checkpoints.begin() )
+        {
+            --checkpoint;
+            current_index =
+                ( std::distance( checkpoints.begin(), checkpoint ) + 1 ) *
+                CHECKPOINT_INTERVAL;
+            i = *checkpoint;
+        }
+    }
+
+    for ( ; i < m_data_length - 1; )
     {
         std::size_t next = i + get_byte_width(i);
 
@@ -982,6 +1020,10 @@ std::size_t UTF8String::get_byte_width(std::size_t byte_index) const
         // return from optimisation parameters
         return m_opt.fixed_width_size;
     }
+    if ( m_ascii )
+    {
+        return 1;
+    }
 
     // TODO: function for single byte width?
     if((m_data[byte_index] & 0x80) == 0)
@@ -1018,6 +1060,23 @@ const UTF8String::Opt& UTF8String::get_optimisations() const
     return m_opt;
 }
 
+bool UTF8String::is_ascii() const
+{
+    return m_ascii;
+}
+
+std::size_t UTF8String::get_hash() const
+{
+    std::size_t hash = m_hash.load( std::memory_order_relaxed );
+    if ( hash == 0 )
+    {
+        // hash_bytes() never returns 0 so it can mark an uncomputed hash
+        hash = arc::str::hash_bytes( m_data, m_data_length - 1 );
+        m_hash.store( hash, std::memory_order_relaxed );
+    }
+    return hash;
+}
+
 //------------------------------------------------------------------------------
 //                            PRIVATE MEMBER FUNCTIONS
 //------------------------------------------------------------------------------
@@ -1027,52 +1086,167 @@ void UTF8String::assign_internal(
         std::size_t existing_length )
 {
     // if we are assigning from the same object we don't need to do anything
-    if(data == m_data)
+    if ( data != nullptr && data == m_data )
     {
         return;
     }
 
-    // if there is existing data delete it
-    if(m_data)
-    {
-        delete[] m_data;
-    }
-
     // get number of bytes in the data
     bool is_null_terminated = true;
+    std::size_t new_length = 0;
     if ( existing_length == arc::str::npos )
     {
         // the length includes the NULL terminator
         existing_length = strlen( data ) + 1;
-        m_data_length = existing_length;
+        new_length = existing_length;
     }
     else if ( existing_length > 0 && data[ existing_length - 1 ] == '\0' )
     {
         // the length includes a NULL terminator
         is_null_terminated = true;
-        m_data_length = existing_length;
+        new_length = existing_length;
     }
     else
     {
         // the length doesn't include a NULL terminator
         is_null_terminated = false;
-        m_data_length = existing_length + 1;
+        new_length = existing_length + 1;
     }
 
-    // allocate storage for the internal data buffer
-    m_data = new char[m_data_length];
+    // reuse the existing buffer if it's large enough, otherwise allocate
+    // storage for the internal data buffer. The input data may be part of
+    // the existing buffer so it is replaced only after copying
+    std::size_t capacity = m_capacity;
+    char* new_data = m_data;
+    if ( m_data == nullptr || new_length > m_capacity )
+    {
+        new_data = allocate_data( new_length, capacity );
+    }
     // copy data to internal array
-    memcpy(m_data, data, existing_length);
+    memmove( new_data, data, existing_length );
     // should a NULL terminator be added to the end?
     if ( !is_null_terminated )
     {
-        m_data[m_data_length - 1] = '\0';
+        new_data[ new_length - 1 ] = '\0';
     }
+    replace_data( new_data, capacity );
+    m_data_length = new_length;
 
     // process the raw data
     process_raw();
 }
 
+char* UTF8String::prepare_append( std::size_t max_length )
+{
+    std::size_t old_length = m_data_length - 1;
+    if ( old_length + max_length + 1 > m_capacity )
+    {
+        // grow geometrically so that repeated appends take linear time
+        std::size_t capacity =
+            std::max( old_length + max_length + 1, m_capacity * 2 );
+        char* new_data = new char[ capacity ];
+        memcpy( new_data, m_data, m_data_length );
+        replace_data( new_data, capacity );
+    }
+    return m_data + old_length;
+}
+
+UTF8String& UTF8String::commit_append( std::size_t length )
+{
+    std::size_t old_length = m_data_length - 1;
+    m_data_length += length;
+    m_data[ m_data_length - 1 ] = '\0';
+    // only the appended data needs to be processed
+    process_raw( old_length );
+    return *this;
+}
+
+std::size_t UTF8String::find_byte_index(
+        const UTF8String& substring,
+        std::size_t start ) const
+{
+    std::size_t length = m_data_length - 1;
+    while ( start <= length )
+    {
+        std::size_t byte_index = arc::str::find_bytes(
+            m_data + start,
+            length - start,
+            substring.m_data,
+            substring.m_data_length - 1
+        );
+        if ( byte_index == arc::str::npos )
+        {
+            break;
+        }
+        byte_index += start;
+        if ( is_symbol_boundary( byte_index ) )
+        {
+            return byte_index;
+        }
+        // search again after this match
+        start = byte_index + 1;
+    }
+    return arc::str::npos;
+}
+
+bool UTF8String::is_symbol_boundary( std::size_t byte_index ) const
+{
+    // any match of valid UTF-8 data starts a symbol, but fixed width data may
+    // match part way through a symbol
+    if ( m_opt.flags & Opt::FIXED_WIDTH )
+    {
+        return byte_index % m_opt.fixed_width_size == 0;
+    }
+    return true;
+}
+
+std::size_t UTF8String::get_symbol_index_for_match(
+        std::size_t byte_index ) const
+{
+    // an empty match may be at the end of the string
+    if ( byte_index >= m_data_length - 1 )
+    {
+        return m_length;
+    }
+    return get_symbol_index_for_byte_index( byte_index );
+}
+
+bool UTF8String::is_local() const
+{
+    return m_data == m_local;
+}
+
+char* UTF8String::allocate_data( std::size_t length, std::size_t& r_capacity )
+{
+    if ( length <= LOCAL_CAPACITY )
+    {
+        r_capacity = LOCAL_CAPACITY;
+        return m_local;
+    }
+    r_capacity = length;
+    return new char[ length ];
+}
+
+void UTF8String::replace_data( char* data, std::size_t capacity )
+{
+    if ( data != m_data )
+    {
+        release_data();
+        m_data = data;
+    }
+    m_capacity = capacity;
+}
+
+void UTF8String::release_data()
+{
+    if ( m_data != nullptr && !is_local() )
+    {
+        delete[] m_data;
+    }
+    m_data = nullptr;
+    m_capacity = 0;
+}
+
 void UTF8String::check_symbol_index( std::size_t index ) const
 {
     if ( index >= m_length )
@@ -1096,13 +1270,24 @@ void UTF8String::check_byte_index( std::size_t index ) const
     }
 }
 
-void UTF8String::process_raw()
+void UTF8String::process_raw( std::size_t start_byte )
 {
     // the number of bytes, not including the null terminator
     std::size_t char_count = m_data_length - 1;
 
-    // clear length
-    m_length = 0;
+    // the data has changed so the cached hash is no longer valid
+    m_hash.store( 0, std::memory_order_relaxed );
+
+    // clear length and indexing tables unless we're continuing from
+    // previously processed data
+    if ( start_byte == 0 )
+    {
+        m_length = 0;
+        m_ascii = true;
+        m_checkpoints.reset();
+    }
+    // the number of symbols that have already been processed
+    std::size_t processed_length = m_length;
 
     if(m_opt.flags & Opt::FIXED_WIDTH)
     {
@@ -1113,22 +1298,60 @@ void UTF8String::process_raw()
         // we don't need to check data validity so skip over
         if(m_opt.flags & Opt::SKIP_VALID_CHECK)
         {
+            // the data is not inspected so we can't know if it is ASCII
+            m_ascii = char_count == 0;
             return;
         }
     }
 
+    // validate and count the new data using the vectorised functions, the
+    // data is only checked a byte at a time below to report where invalid
+    // data is, or to count data that is not validated
+    const char* new_data = m_data + start_byte;
+    std::size_t new_bytes = char_count - start_byte;
+    if ( !( m_opt.flags & Opt::SKIP_VALID_CHECK ) &&
+         arc::str::is_utf8( new_data, new_bytes ) )
+    {
+        std::size_t new_symbols =
+            arc::str::count_symbols( new_data, new_bytes );
+        if ( !( m_opt.flags & Opt::FIXED_WIDTH ) )
+        {
+            m_length += new_symbols;
+        }
+        // valid data is ASCII if every byte is a symbol
+        if ( m_ascii && new_symbols != new_bytes )
+        {
+            // fill in the checkpoints of the preceding ASCII data
+            m_ascii = false;
+            if ( !( m_opt.flags & Opt::FIXED_WIDTH ) )
+            {
+                for ( std::size_t s = CHECKPOINT_INTERVAL;
+                      s < processed_length;
+                      s += CHECKPOINT_INTERVAL )
+                {
+                    push_checkpoint( s );
+                }
+            }
+        }
+        if ( !m_ascii && !( m_opt.flags & Opt::FIXED_WIDTH ) )
+        {
+            add_checkpoints( start_byte, processed_length );
+        }
+        return;
+    }
+
     // to calculate the number of utf-8 symbols in the string and check
     // the validity of the string
     // the current byte and symbol that are being checked
-    std::size_t last_byte = 0;
-    std::size_t last_symbol = 0;
+    std::size_t last_byte = start_byte;
+    std::size_t last_symbol = processed_length;
     // the number of bytes in the current symbol
     arc::uint16 current_width = 0;
     // marks the number of bytes after a primary byte that are required to start
     // with 10xxxxxx, needed for checking validity
     arc::uint8 following_bytes = 0;
     // iterate over each bytes
-    for(std::size_t i = 0; i < char_count; ++i)
+    for ( std::size_t i = start_byte; i < char_count; ++i )
     {
         // is this a following byte we need to check that it matches the
         // pattern: 10xxxxxx
@@ -1155,6 +1378,31 @@ void UTF8String::process_raw()
         // update the current byte
         last_byte = i;
 
+        // record the checkpoints used for symbol indexing, fixed width
+        // strings can be indexed without them
+        if ( ( m_data[ i ] & 0x80 ) != 0 && m_ascii )
+        {
+            // every symbol so far has been a single byte, so fill in the
+            // preceding checkpoints
+            m_ascii = false;
+            if ( !( m_opt.flags & Opt::FIXED_WIDTH ) )
+            {
+                for ( std::size_t s = CHECKPOINT_INTERVAL;
+                      s < last_symbol;
+                      s += CHECKPOINT_INTERVAL )
+                {
+                    push_checkpoint( s );
+                }
+            }
+        }
+        if ( !m_ascii                                &&
+             !( m_opt.flags & Opt::FIXED_WIDTH )     &&
+             last_symbol > 0                         &&
+             last_symbol % CHECKPOINT_INTERVAL == 0 )
+        {
+            push_checkpoint( i );
+        }
+
         // since this is not a following byte check against valid primary bytes
         if((m_data[i] & 0x80) == 0)
         {
@@ -1214,6 +1462,56 @@ void UTF8String::process_raw()
     }
 }
 
+void UTF8String::add_checkpoints(
+        std::size_t start_byte,
+        std::size_t start_symbol )
+{
+    std::size_t char_count = m_data_length - 1;
+    if ( start_symbol > 0                         &&
+         start_symbol % CHECKPOINT_INTERVAL == 0 &&
+         start_byte < char_count )
+    {
+        push_checkpoint( start_byte );
+    }
+
+    std::size_t byte = start_byte;
+    // the number of symbols that start before the current byte
+    std::size_t symbol = start_symbol;
+    while ( true )
+    {
+        // every symbol is at least one byte, so the symbols can be counted
+        // over the number of bytes remaining until the next checkpoint
+        // without passing it
+        std::size_t next = ( ( symbol / CHECKPOINT_INTERVAL ) + 1 ) *
+                           CHECKPOINT_INTERVAL;
+        while ( symbol < next && byte < char_count )
+        {
+            std::size_t span = std::min( next - symbol, char_count - byte );
+            symbol += arc::str::count_symbols( m_data + byte, span );
+            byte += span;
+        }
+        // skip the following bytes of the last symbol counted
+        while ( byte < char_count && ( m_data[ byte ] & 0xC0 ) == 0x80 )
+        {
+            ++byte;
+        }
+        if ( byte >= char_count )
+        {
+            break;
+        }
+        push_checkpoint( byte );
+    }
+}
+
+void UTF8String::push_checkpoint( std::size_t byte_index )
+{
+    if ( !m_checkpoints )
+    {
+        m_checkpoints.reset( new std::vector<std::size_t>() );
+    }
+    m_checkpoints->push_back( byte_index );
+}
+
 //------------------------------------------------------------------------------
 //                               EXTERNAL OPERATORS
 //------------------------------------------------------------------------------
@@ -5,6 +5,8 @@
 #ifndef ARCANECORE_BASE_STR_UTF8STRING_HPP_
 #define ARCANECORE_BASE_STR_UTF8STRING_HPP_
 
+#include <atomic>
+#include <memory>
 #include <ostream>
 #include <string>
 #include <vector>
@@ -125,6 +127,21 @@ namespace str
  * `to_raw`, `to_std_string`, etc.
  * \endcode
  *
+ * \par Short Strings
+ *
+ * Strings of up to 23 bytes are stored in a buffer inside the UTF8String
+ * object itself rather than being allocated on the heap. This means the
+ * pointer returned by get_raw() may change when a UTF8String is moved.
+ *
+ * \par Symbol Indexing
+ *
+ * While processing its data a UTF8String records whether every symbol is a
+ * single byte ASCII character, in which case symbol indices map directly to
+ * byte indices and symbol indexed functions are constant time. Otherwise the
+ * byte index of every 32nd symbol is recorded, so that locating a symbol only
+ * requires walking forward from the nearest of these checkpoints rather than
+ * from the start of the string.
+ *
  * TODO: optimisations
  */
 class UTF8String
@@ -499,6 +516,9 @@ public:
      * \brief Stream operator.
      *
      * Extends this UTF8String with the given int16.
+     *
+     * Integers are written in decimal directly into the data of this string,
+     * see arc::str::format_int64().
      */
     UTF8String& operator<<(arc::int16 other);
 
@@ -541,6 +561,10 @@ public:
      * \brief Stream operator.
      *
      * Extends this UTF8String with the given float.
+     *
+     * The shortest decimal representation that converts back to the same
+     * value is written directly into the data of this string, see
+     * arc::str::format_float().
      */
     UTF8String& operator<<(float other);
 
@@ -548,6 +572,8 @@ public:
      * \brief Stream operator.
      *
      * Extends this UTF8String with the given double.
+     *
+     * See arc::str::format_double().
      */
     UTF8String& operator<<(double other);
 
@@ -613,12 +639,16 @@ public:
      */
     void claim(char* data);
 
-    // TODO: encoding error, check only second
     /*!
      * \brief Concatenates another UTF8String on to the end of this string.
      *
      * \note This operation modifies this UTF8String.
      *
+     * When this string does not have the capacity for the other string its
+     * capacity is at least doubled, so building a string from many pieces
+     * takes time linear in its final length. Only the appended data is
+     * validated and counted.
+     *
      * Example usage:
      *
      * \code
@@ -635,7 +665,6 @@ public:
      */
     UTF8String& concatenate(const UTF8String& other);
 
-    // TODO: encoding error, check only second
     /*!
      * \brief Extends this string with a copy of itself the given number of
      *  times.
@@ -656,6 +685,29 @@ public:
      */
     UTF8String& repeat(arc::uint32 count);
 
+    /*!
+     * \brief Ensures this string can hold at least the given number of bytes
+     *        without reallocating.
+     *
+     * This can be used to avoid reallocations when the final size of a string
+     * that is being built by concatenation is known in advance.
+     *
+     * Example usage:
+     *
+     * \code
+     * arc::str::UTF8String s;
+     * s.reserve(1024);
+     * for(std::size_t i = 0; i < 256; ++i)
+     * {
+     *     s << "abc,";
+     * }
+     * \endcode
+     *
+     * \param byte_length The number of bytes, not including the NULL
+     *                    terminator.
+     */
+    void reserve(std::size_t byte_length);
+
     /*!
      * \brief Checks whether this UTF8String starts with the given substring.
      *
@@ -863,6 +915,10 @@ public:
     /*!
      * \brief Returns this UTF8String as an int32 type.
      *
+     * The data is always read as decimal: leading zeros do not denote an octal
+     * value (```"010"``` converts to ```10```) and hexadecimal prefixes are not
+     * accepted.
+     *
      * \throws arc::ex::ConversionDataError If the data of the string is not a
      *                                        valid int32.
      */
@@ -871,6 +927,10 @@ public:
     /*!
      * \brief Returns this UTF8String as an uint32 type.
      *
+     * The data is always read as decimal: leading zeros do not denote an octal
+     * value (```"010"``` converts to ```10```) and hexadecimal prefixes are not
+     * accepted.
+     *
      * \throws arc::ex::ConversionDataError If the data of the string is not a
      *                                        valid uint32.
      */
@@ -879,6 +939,10 @@ public:
     /*!
      * \brief Returns this UTF8String as an int64 type.
      *
+     * The data is always read as decimal: leading zeros do not denote an octal
+     * value (```"010"``` converts to ```10```) and hexadecimal prefixes are not
+     * accepted.
+     *
      * \throws arc::ex::ConversionDataError If the data of the string is not a
      *                                        valid int64.
      */
@@ -887,10 +951,65 @@ public:
     /*!
      * \brief Returns this UTF8String as an uint64 type.
      *
+     * The data is always read as decimal: leading zeros do not denote an octal
+     * value (```"010"``` converts to ```10```) and hexadecimal prefixes are not
+     * accepted.
+     *
      * \throws arc::ex::ConversionDataError If the data of the string is not a
      *                                        valid uint64.
      */
-    arc::int64 to_uint64() const;
+    arc::uint64 to_uint64() const;
+
+    /*!
+     * \brief Converts this UTF8String to an int32 if it is a valid int32.
+     *
+     * This validates and parses the data in a single pass, replacing a call
+     * to is_int() followed by to_int32().
+     *
+     * Example usage:
+     *
+     * \code
+     * arc::int32 value = 0;
+     * arc::str::UTF8String("-34").try_to_int32(value);        // returns: true
+     * arc::str::UTF8String("3000000000").try_to_int32(value); // returns: false
+     * \endcode
+     *
+     * \param r_value Returns the converted value, this is only modified if the
+     *                conversion succeeds.
+     * \return Whether the data of this string is an integer within the range
+     *         of int32.
+     */
+    bool try_to_int32(arc::int32& r_value) const;
+
+    /*!
+     * \brief Converts this UTF8String to a uint32 if it is a valid uint32.
+     *
+     * \param r_value Returns the converted value, this is only modified if the
+     *                conversion succeeds.
+     * \return Whether the data of this string is an unsigned integer within
+     *         the range of uint32.
+     */
+    bool try_to_uint32(arc::uint32& r_value) const;
+
+    /*!
+     * \brief Converts this UTF8String to an int64 if it is a valid int64.
+     *
+     * \param r_value Returns the converted value, this is only modified if the
+     *                conversion succeeds.
+     * \return Whether the data of this string is an integer within the range
+     *         of int64.
+     */
+    bool try_to_int64(arc::int64& r_value) const;
+
+    /*!
+     * \brief Converts this UTF8String to a uint64 if it is a valid uint64.
+     *
+     * \param r_value Returns the converted value, this is only modified if the
+     *                conversion succeeds.
+     * \return Whether the data of this string is an unsigned integer within
+     *         the range of uint64.
+     */
+    bool try_to_uint64(arc::uint64& r_value) const;
 
 
     //--------------------------------ACCESSORS---------------------------------
@@ -1045,6 +1164,12 @@ public:
      */
     std::size_t get_byte_length() const;
 
+    /*!
+     * \brief Returns the number of bytes (not including the NULL terminator)
+     *        this string can hold without reallocating.
+     */
+    std::size_t get_capacity() const;
+
     /*!
      * \brief Returns the index of the symbol that the byte at the given index
      *        is part of.
@@ -1098,8 +1223,39 @@ public:
      */
     const Opt& get_optimisations() const;
 
+    /*!
+     * \brief Returns whether every symbol in this string is a single byte
+     *        ASCII character.
+     *
+     * \note If both the Opt::FIXED_WIDTH and Opt::SKIP_VALID_CHECK
+     *       optimisations are being used the data is never inspected so this
+     *       will only return true if the string is empty.
+     */
+    bool is_ascii() const;
+
+    /*!
+     * \brief Returns a hash of the bytes of this string.
+     *
+     * The hash is computed with arc::str::hash_bytes() the first time it is
+     * requested and is then cached until this string is modified, so
+     * repeatedly hashing the same string (e.g. as a key of a
+     * std::unordered_map) only reads its data once.
+     */
+    std::size_t get_hash() const;
+
 private:
 
+    //--------------------------------------------------------------------------
+    //                          PRIVATE STATIC ATTRIBUTES
+    //--------------------------------------------------------------------------
+
+    // the number of symbols between each entry in the checkpoint table
+    static const std::size_t CHECKPOINT_INTERVAL;
+    // the number of bytes (including the NULL terminator) that can be stored
+    // in the local buffer, this is sized to hold typical path components,
+    // identifiers and formatted numbers (up to 20 bytes) without allocating
+    static const std::size_t LOCAL_CAPACITY = 24;
+
     //--------------------------------------------------------------------------
     //                             PRIVATE ATTRIBUTES
     //--------------------------------------------------------------------------
@@ -1107,18 +1263,64 @@ private:
     // Optimization parameters being used by this UTF8String.
     Opt m_opt;
 
-    // the array containing the data stored as consecutive bytes
+    // the array containing the data stored as consecutive bytes, this points
+    // to m_local for short strings
     char* m_data;
     // the length of the data int bytes (not the length of the string)
     std::size_t m_data_length;
+    // the number of bytes that can be stored in the data array
+    std::size_t m_capacity;
 
     // the number of utf-8 symbols in this string
     std::size_t m_length;
 
+    // buffer that short strings are stored in to avoid heap allocation
+    char m_local[LOCAL_CAPACITY];
+
+    // whether every symbol in this string is a single byte
+    bool m_ascii;
+    // the byte index of every CHECKPOINT_INTERVAL-th symbol (starting from
+    // the symbol at CHECKPOINT_INTERVAL), this is only allocated for strings
+    // that contain multi-byte symbols and are long enough to need it, so it
+    // costs a single pointer for all other strings
+    std::unique_ptr<std::vector<std::size_t>> m_checkpoints;
+
+    // the cached hash of the data, or 0 if it has not been computed since the
+    // data was last modified. This is atomic so that const strings can be
+    // hashed from multiple threads
+    mutable std::atomic<std::size_t> m_hash;
+
     //--------------------------------------------------------------------------
     //                          PRIVATE MEMBER FUNCTIONS
     //--------------------------------------------------------------------------
 
+    /*!
+     * Internal function that returns whether the data of this string is
+     * stored in the local buffer.
+     */
+    bool is_local() const;
+
+    /*!
+     * Internal function that returns a buffer of at least the given number of
+     * bytes. This is the local buffer if the length fits within it, otherwise
+     * a new heap allocated array. The number of bytes the buffer can hold is
+     * returned through r_capacity.
+     */
+    char* allocate_data(std::size_t length, std::size_t& r_capacity);
+
+    /*!
+     * Internal function that replaces the internal data with the given
+     * buffer of the given capacity (as returned by allocate_data) deleting
+     * the existing internal data if it was heap allocated.
+     */
+    void replace_data(char* data, std::size_t capacity);
+
+    /*!
+     * Internal function that deletes the internal data if it was heap
+     * allocated and sets the internal data to null.
+     */
+    void release_data();
+
     /*!
      * Internal function used for assigning raw data to this UTF8String. The
      * input data is expect to be 1-byte aligned and been utf-8 encoded. This
@@ -1136,6 +1338,41 @@ private:
             const char*  data,
             std::size_t existing_length = arc::str::npos);
 
+    /*!
+     * Internal function that ensures there is room for the given number of
+     * bytes after the current data of this string and returns a pointer to
+     * where they should be written. The written bytes are added to the string
+     * by commit_append().
+     */
+    char* prepare_append(std::size_t max_length);
+
+    /*!
+     * Internal function that adds the given number of bytes written to the
+     * pointer returned by prepare_append() to this string.
+     */
+    UTF8String& commit_append(std::size_t length);
+
+    /*!
+     * Internal function that returns the byte index of the first occurrence
+     * of the given substring that starts at or after the given byte index and
+     * on a symbol boundary, or arc::str::npos if there is no such occurrence.
+     */
+    std::size_t find_byte_index(
+            const UTF8String& substring,
+            std::size_t start) const;
+
+    /*!
+     * Internal function that returns whether a match found at the given byte
+     * index starts on a symbol boundary.
+     */
+    bool is_symbol_boundary(std::size_t byte_index) const;
+
+    /*!
+     * Internal function that returns the symbol index of a match found at the
+     * given byte index, which may be the end of the string.
+     */
+    std::size_t get_symbol_index_for_match(std::size_t byte_index) const;
+
     /*!
      * Internal function used to check if a given index is within the symbol
      * length (get_length) of the string. If it is not an IndexOutOfBoundsError
@@ -1151,11 +1388,29 @@ private:
     void check_byte_index(std::size_t index) const;
 
     /*!
-     * Internal function used to calculate and set the symbol length and check
-     * the UTF-8 validity of the internal data (m_data).
+     * Internal function used to calculate and set the symbol length, check
+     * the UTF-8 validity of the internal data (m_data), and build the tables
+     * used for symbol indexing.
      * Actions dependent on the optimisation parameters.
+     *
+     * \param start_byte If not 0 the data before this byte index is assumed
+     *                   to have already been processed and only the
+     *                   following data is processed and counted.
+     */
+    void process_raw(std::size_t start_byte = 0);
+
+    /*!
+     * Internal function that adds the symbol indexing checkpoints for the data
+     * from the given byte index, which is the start of the symbol at the given
+     * symbol index.
+     */
+    void add_checkpoints(std::size_t start_byte, std::size_t start_symbol);
+
+    /*!
+     * Internal function that appends the given byte index to the checkpoint
+     * table, allocating the table if this is the first checkpoint.
      */
-    void process_raw();
+    void push_checkpoint(std::size_t byte_index);
 };
 
 //------------------------------------------------------------------------------
@@ -1180,14 +1435,14 @@ namespace std
 {
 
 template<>
-struct hash<arc::str::UTF8String> :
-    public unary_function<arc::str::UTF8String, std::size_t>
+struct hash<arc::str::UTF8String>
 {
+    typedef arc::str::UTF8String argument_type;
+    typedef std::size_t result_type;
+
     std::size_t operator()(const arc::str::UTF8String& value) const
     {
-        // TODO: could use custom hash here
-        std::hash<std::string> hasher;
-        return hasher(value.to_std_string());
+        return value.get_hash();
     }
 };
 
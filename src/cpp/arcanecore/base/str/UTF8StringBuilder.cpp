@@ -0,0 +1,283 @@
+#include "arcanecore/base/str/UTF8StringBuilder.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include "arcanecore/base/str/NumericConversions.hpp"
+
+namespace arc
+{
+namespace str
+{
+
+//------------------------------------------------------------------------------
+//                                  CONSTRUCTORS
+//------------------------------------------------------------------------------
+
+UTF8StringBuilder::UTF8StringBuilder()
+    :
+    m_byte_length(0),
+    m_capacity   (0)
+{
+}
+
+UTF8StringBuilder::UTF8StringBuilder(UTF8StringBuilder&& other)
+    :
+    m_data       (std::move(other.m_data)),
+    m_byte_length(other.m_byte_length),
+    m_capacity   (other.m_capacity)
+{
+    other.m_byte_length = 0;
+    other.m_capacity = 0;
+}
+
+//------------------------------------------------------------------------------
+//                                   OPERATORS
+//------------------------------------------------------------------------------
+
+UTF8StringBuilder& UTF8StringBuilder::operator=(UTF8StringBuilder&& other)
+{
+    if(&other == this)
+    {
+        return *this;
+    }
+
+    m_data = std::move(other.m_data);
+    m_byte_length = other.m_byte_length;
+    m_capacity = other.m_capacity;
+    other.m_byte_length = 0;
+    other.m_capacity = 0;
+    return *this;
+}
+
+UTF8StringBuilder& UTF8StringBuilder::operator<<(const UTF8String& other)
+{
+    append(other.get_raw(), other.get_byte_length() - 1);
+    return *this;
+}
+
+UTF8StringBuilder& UTF8StringBuilder::operator<<(const UTF8StringView& other)
+{
+    append(other.get_raw(), other.get_byte_length());
+    return *this;
+}
+
+UTF8StringBuilder& UTF8StringBuilder::operator<<(const char* other)
+{
+    append(other, strlen(other));
+    return *this;
+}
+
+UTF8StringBuilder& UTF8StringBuilder::operator<<(const std::string& other)
+{
+    append(other.c_str(), other.length());
+    return *this;
+}
+
+UTF8StringBuilder& UTF8StringBuilder::operator<<(bool other)
+{
+    *prepare_append(1) = other ? '1' : '0';
+    return commit_append(1);
+}
+
+UTF8StringBuilder& UTF8StringBuilder::operator<<(char other)
+{
+    *prepare_append(1) = other;
+    return commit_append(1);
+}
+
+#ifdef ARC_OS_WINDOWS
+
+UTF8StringBuilder& UTF8StringBuilder::operator<<(unsigned long other)
+{
+    return commit_append(arc::str::format_uint64(
+        other,
+        prepare_append(arc::str::MAX_INTEGER_FORMAT_LENGTH)
+    ));
+}
+
+#endif
+// ARC_OS_WINDOWS
+
+UTF8StringBuilder& UTF8StringBuilder::operator<<(arc::int8 other)
+{
+    *prepare_append(1) = static_cast<char>(other);
+    return commit_append(1);
+}
+
+UTF8StringBuilder& UTF8StringBuilder::operator<<(arc::uint8 other)
+{
+    *prepare_append(1) = static_cast<char>(other);
+    return commit_append(1);
+}
+
+UTF8StringBuilder& UTF8StringBuilder::operator<<(arc::int16 other)
+{
+    return commit_append(arc::str::format_int64(
+        other,
+        prepare_append(arc::str::MAX_INTEGER_FORMAT_LENGTH)
+    ));
+}
+
+UTF8StringBuilder& UTF8StringBuilder::operator<<(arc::uint16 other)
+{
+    return commit_append(arc::str::format_uint64(
+        other,
+        prepare_append(arc::str::MAX_INTEGER_FORMAT_LENGTH)
+    ));
+}
+
+UTF8StringBuilder& UTF8StringBuilder::operator<<(arc::int32 other)
+{
+    return commit_append(arc::str::format_int64(
+        other,
+        prepare_append(arc::str::MAX_INTEGER_FORMAT_LENGTH)
+    ));
+}
+
+UTF8StringBuilder& UTF8StringBuilder::operator<<(arc::uint32 other)
+{
+    return commit_append(arc::str::format_uint64(
+        other,
+        prepare_append(arc::str::MAX_INTEGER_FORMAT_LENGTH)
+    ));
+}
+
+UTF8StringBuilder& UTF8StringBuilder::operator<<(arc::int64 other)
+{
+    return commit_append(arc::str::format_int64(
+        other,
+        prepare_append(arc::str::MAX_INTEGER_FORMAT_LENGTH)
+    ));
+}
+
+UTF8StringBuilder& UTF8StringBuilder::operator<<(arc::uint64 other)
+{
+    return commit_append(arc::str::format_uint64(
+        other,
+        prepare_append(arc::str::MAX_INTEGER_FORMAT_LENGTH)
+    ));
+}
+
+UTF8StringBuilder& UTF8StringBuilder::operator<<(float other)
+{
+    return commit_append(arc::str::format_float(
+        other,
+        prepare_append(arc::str::MAX_FLOAT_FORMAT_LENGTH)
+    ));
+}
+
+UTF8StringBuilder& UTF8StringBuilder::operator<<(double other)
+{
+    return commit_append(arc::str::format_double(
+        other,
+        prepare_append(arc::str::MAX_FLOAT_FORMAT_LENGTH)
+    ));
+}
+
+//------------------------------------------------------------------------------
+//                            PUBLIC MEMBER FUNCTIONS
+//------------------------------------------------------------------------------
+
+void UTF8StringBuilder::append(const char* data, std::size_t byte_length)
+{
+    if(byte_length == 0)
+    {
+        return;
+    }
+    memcpy(prepare_append(byte_length), data, byte_length);
+    commit_append(byte_length);
+}
+
+void UTF8StringBuilder::clear()
+{
+    m_byte_length = 0;
+}
+
+void UTF8StringBuilder::reserve(std::size_t byte_length)
+{
+    if(byte_length <= m_capacity)
+    {
+        return;
+    }
+    std::unique_ptr<char[]> new_data(new char[byte_length]);
+    if(m_byte_length > 0)
+    {
+        memcpy(new_data.get(), m_data.get(), m_byte_length);
+    }
+    m_data = std::move(new_data);
+    m_capacity = byte_length;
+}
+
+UTF8String UTF8StringBuilder::to_string() const
+{
+    // the string validates and counts the text in a single pass
+    return UTF8String(get_raw(), m_byte_length);
+}
+
+UTF8StringView UTF8StringBuilder::to_view() const
+{
+    return UTF8StringView(get_raw(), m_byte_length);
+}
+
+//----------------------------------ACCESSORS-----------------------------------
+
+bool UTF8StringBuilder::is_empty() const
+{
+    return m_byte_length == 0;
+}
+
+const char* UTF8StringBuilder::get_raw() const
+{
+    if(!m_data)
+    {
+        return "";
+    }
+    return m_data.get();
+}
+
+std::size_t UTF8StringBuilder::get_byte_length() const
+{
+    return m_byte_length;
+}
+
+std::size_t UTF8StringBuilder::get_capacity() const
+{
+    return m_capacity;
+}
+
+//------------------------------------------------------------------------------
+//                            PRIVATE MEMBER FUNCTIONS
+//------------------------------------------------------------------------------
+
+char* UTF8StringBuilder::prepare_append(std::size_t max_length)
+{
+    if(m_byte_length + max_length > m_capacity)
+    {
+        // grow geometrically so that repeated appends take linear time
+        reserve(std::max(
+            m_byte_length + max_length,
+            std::max(m_capacity * 2, static_cast<std::size_t>(64))
+        ));
+    }
+    return m_data.get() + m_byte_length;
+}
+
+UTF8StringBuilder& UTF8StringBuilder::commit_append(std::size_t length)
+{
+    m_byte_length += length;
+    return *this;
+}
+
+//------------------------------------------------------------------------------
+//                               EXTERNAL OPERATORS
+//------------------------------------------------------------------------------
+
+std::ostream& operator<<(std::ostream& stream, const UTF8StringBuilder& b)
+{
+    stream.write(b.get_raw(), b.get_byte_length());
+    return stream;
+}
+
+} // namespace str
+} // namespace arc
@@ -0,0 +1,292 @@
+/*!
+ * \file
+ * \author David Saxon
+ */
+#ifndef ARCANECORE_BASE_STR_UTF8STRINGBUILDER_HPP_
+#define ARCANECORE_BASE_STR_UTF8STRINGBUILDER_HPP_
+
+#include <memory>
+#include <ostream>
+#include <string>
+
+#include "arcanecore/base/Preproc.hpp"
+#include "arcanecore/base/Types.hpp"
+#include "arcanecore/base/str/UTF8String.hpp"
+#include "arcanecore/base/str/UTF8StringView.hpp"
+
+namespace arc
+{
+namespace str
+{
+
+/*!
+ * \brief A growable buffer for building UTF-8 text from many parts.
+ *
+ * Appending to a UTF8String validates and counts the symbols of each appended
+ * part, and building text with the + operator creates a temporary string for
+ * each part. A UTF8StringBuilder instead only copies the bytes of each part
+ * into its buffer, and the text is validated once in a single pass when it is
+ * converted to a UTF8String or UTF8StringView.
+ *
+ * Clearing a builder keeps its buffer, so a builder that is reused (e.g. one
+ * held as a member, or a ```thread_local``` in a function that is called
+ * from multiple threads) stops allocating once its buffer has grown to fit
+ * the text being built.
+ *
+ * \par Example Usage
+ *
+ * \code
+ * static thread_local arc::str::UTF8StringBuilder builder;
+ * builder.clear();
+ * builder << "{" << app_name << "} - [" << level << "]: " << message;
+ * arc::str::UTF8String formatted(builder.to_string());
+ * \endcode
+ */
+class UTF8StringBuilder
+{
+private:
+
+    ARC_DISALLOW_COPY_AND_ASSIGN(UTF8StringBuilder);
+
+public:
+
+    //--------------------------------------------------------------------------
+    //                                CONSTRUCTORS
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief Creates a new empty builder, which does not allocate until text
+     *        is appended.
+     */
+    UTF8StringBuilder();
+
+    /*!
+     * \brief Moves the buffer of the given builder to a new builder.
+     *
+     * The other builder is left empty.
+     */
+    UTF8StringBuilder(UTF8StringBuilder&& other);
+
+    //--------------------------------------------------------------------------
+    //                                 OPERATORS
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief Moves the buffer of the given builder to this builder.
+     *
+     * The other builder is left empty.
+     */
+    UTF8StringBuilder& operator=(UTF8StringBuilder&& other);
+
+    /*!
+     * \brief Appends the given UTF8String.
+     */
+    UTF8StringBuilder& operator<<(const UTF8String& other);
+
+    /*!
+     * \brief Appends the given UTF8StringView.
+     */
+    UTF8StringBuilder& operator<<(const UTF8StringView& other);
+
+    /*!
+     * \brief Appends the given C style string.
+     *
+     * \note The input data is expected to be UTF-8 encoded and NULL terminated.
+     *       It is validated when this builder is converted to a UTF8String or
+     *       UTF8StringView.
+     */
+    UTF8StringBuilder& operator<<(const char* other);
+
+    /*!
+     * \brief Appends the given std string.
+     *
+     * \note The input data is expected to be UTF-8 encoded. It is validated
+     *       when this builder is converted to a UTF8String or UTF8StringView.
+     */
+    UTF8StringBuilder& operator<<(const std::string& other);
+
+    /*!
+     * \brief Appends the given boolean (where false = 0 and true = 1).
+     */
+    UTF8StringBuilder& operator<<(bool other);
+
+    /*!
+     * \brief Appends the given char.
+     */
+    UTF8StringBuilder& operator<<(char other);
+
+#ifdef ARC_OS_WINDOWS
+
+    /*!
+     * \brief Appends the decimal digits of the given unsigned long.
+     */
+    UTF8StringBuilder& operator<<(unsigned long other);
+
+#endif
+// ARC_OS_WINDOWS
+
+    /*!
+     * \brief Appends the given int8 as a single byte, matching
+     *        UTF8String::operator<<(arc::int8).
+     */
+    UTF8StringBuilder& operator<<(arc::int8 other);
+
+    /*!
+     * \brief Appends the given uint8 as a single byte, matching
+     *        UTF8String::operator<<(arc::uint8).
+     */
+    UTF8StringBuilder& operator<<(arc::uint8 other);
+
+    /*!
+     * \brief Appends the decimal digits of the given int16.
+     */
+    UTF8StringBuilder& operator<<(arc::int16 other);
+
+    /*!
+     * \brief Appends the decimal digits of the given uint16.
+     */
+    UTF8StringBuilder& operator<<(arc::uint16 other);
+
+    /*!
+     * \brief Appends the decimal digits of the given int32.
+     */
+    UTF8StringBuilder& operator<<(arc::int32 other);
+
+    /*!
+     * \brief Appends the decimal digits of the given uint32.
+     */
+    UTF8StringBuilder& operator<<(arc::uint32 other);
+
+    /*!
+     * \brief Appends the decimal digits of the given int64.
+     */
+    UTF8StringBuilder& operator<<(arc::int64 other);
+
+    /*!
+     * \brief Appends the decimal digits of the given uint64.
+     */
+    UTF8StringBuilder& operator<<(arc::uint64 other);
+
+    /*!
+     * \brief Appends the shortest decimal representation of the given float,
+     *        see arc::str::format_float().
+     */
+    UTF8StringBuilder& operator<<(float other);
+
+    /*!
+     * \brief Appends the shortest decimal representation of the given double,
+     *        see arc::str::format_double().
+     */
+    UTF8StringBuilder& operator<<(double other);
+
+    //--------------------------------------------------------------------------
+    //                          PUBLIC MEMBER FUNCTIONS
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief Appends the given number of bytes of UTF-8 data.
+     *
+     * \note The data is validated when this builder is converted to a
+     *       UTF8String or UTF8StringView.
+     */
+    void append(const char* data, std::size_t byte_length);
+
+    /*!
+     * \brief Removes the text of this builder, keeping its buffer for reuse.
+     */
+    void clear();
+
+    /*!
+     * \brief Ensures this builder can hold at least the given number of bytes
+     *        without reallocating.
+     */
+    void reserve(std::size_t byte_length);
+
+    /*!
+     * \brief Returns a new UTF8String containing the text of this builder.
+     *
+     * \throws arc::ex::EncodingError If the text is not valid UTF-8.
+     */
+    UTF8String to_string() const;
+
+    /*!
+     * \brief Returns a view of the text of this builder.
+     *
+     * \warning The view is invalidated when this builder is next modified.
+     *
+     * \throws arc::ex::EncodingError If the text is not valid UTF-8.
+     */
+    UTF8StringView to_view() const;
+
+    //--------------------------------ACCESSORS---------------------------------
+
+    /*!
+     * \brief Returns whether this builder contains no text.
+     */
+    bool is_empty() const;
+
+    /*!
+     * \brief Returns the pointer to the first byte of the text of this builder.
+     *
+     * \warning This data is not NULL terminated and has not been validated,
+     *          get_byte_length() bytes may be read from it.
+     */
+    const char* get_raw() const;
+
+    /*!
+     * \brief Returns the number of bytes in this builder.
+     */
+    std::size_t get_byte_length() const;
+
+    /*!
+     * \brief Returns the number of bytes this builder can hold without
+     *        reallocating.
+     */
+    std::size_t get_capacity() const;
+
+private:
+
+    //--------------------------------------------------------------------------
+    //                             PRIVATE ATTRIBUTES
+    //--------------------------------------------------------------------------
+
+    // the buffer the text is built in, this is null until text is appended
+    std::unique_ptr<char[]> m_data;
+    // the number of bytes of text in the buffer
+    std::size_t m_byte_length;
+    // the number of bytes that can be stored in the buffer
+    std::size_t m_capacity;
+
+    //--------------------------------------------------------------------------
+    //                          PRIVATE MEMBER FUNCTIONS
+    //--------------------------------------------------------------------------
+
+    /*!
+     * Internal function that ensures the buffer can hold the given number of
+     * bytes after the current text and returns the position to write them.
+     * The bytes written are then added to the text with commit_append().
+     */
+    char* prepare_append(std::size_t max_length);
+
+    /*!
+     * Internal function that adds the given number of bytes written after a
+     * call to prepare_append() to the text.
+     */
+    UTF8StringBuilder& commit_append(std::size_t length);
+};
+
+//------------------------------------------------------------------------------
+//                               EXTERNAL OPERATORS
+//------------------------------------------------------------------------------
+
+/*!
+ * \brief Writes the bytes of the given builder to the given stream.
+ *
+ * The text is written as is, without being validated.
+ */
+std::ostream& operator<<(std::ostream& stream, const UTF8StringBuilder& b);
+
+} // namespace str
+} // namespace arc
+
+#endif
@@ -0,0 +1,473 @@
+#include "arcanecore/base/str/UTF8StringView.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include "arcanecore/base/Exceptions.hpp"
+#include "arcanecore/base/str/NumericConversions.hpp"
+#include "arcanecore/base/str/StringOperations.hpp"
+
+namespace arc
+{
+namespace str
+{
+
+//------------------------------------------------------------------------------
+//                                  CONSTRUCTORS
+//------------------------------------------------------------------------------
+
+UTF8StringView::UTF8StringView()
+    :
+    m_data       (""),
+    m_byte_length(0),
+    m_length     (0)
+{
+}
+
+UTF8StringView::UTF8StringView(const UTF8String& s)
+    :
+    m_data       (s.get_raw()),
+    m_byte_length(s.get_byte_length() - 1),
+    m_length     (s.get_length())
+{
+}
+
+UTF8StringView::UTF8StringView(const char* data)
+    :
+    m_data       (data),
+    m_byte_length(strlen(data)),
+    m_length     (0)
+{
+    if(!arc::str::is_utf8(m_data, m_byte_length))
+    {
+        throw arc::ex::EncodingError(
+            "Data provided to UTF8StringView is not valid UTF-8.");
+    }
+    m_length = arc::str::count_symbols(m_data, m_byte_length);
+}
+
+UTF8StringView::UTF8StringView(const char* data, std::size_t byte_length)
+    :
+    m_data       (data),
+    m_byte_length(byte_length),
+    m_length     (0)
+{
+    if(!arc::str::is_utf8(m_data, m_byte_length))
+    {
+        throw arc::ex::EncodingError(
+            "Data provided to UTF8StringView is not valid UTF-8.");
+    }
+    m_length = arc::str::count_symbols(m_data, m_byte_length);
+}
+
+//------------------------------------------------------------------------------
+//                                   OPERATORS
+//------------------------------------------------------------------------------
+
+bool UTF8StringView::operator==(const UTF8StringView& other) const
+{
+    return m_byte_length == other.m_byte_length &&
+           memcmp(m_data, other.m_data, m_byte_length) == 0;
+}
+
+bool UTF8StringView::operator!=(const UTF8StringView& other) const
+{
+    return !((*this) == other);
+}
+
+bool UTF8StringView::operator<(const UTF8StringView& other) const
+{
+    // the byte order of UTF-8 data is the same as its code point order
+    int result = memcmp(
+        m_data,
+        other.m_data,
+        std::min(m_byte_length, other.m_byte_length)
+    );
+    if(result != 0)
+    {
+        return result < 0;
+    }
+    return m_byte_length < other.m_byte_length;
+}
+
+//------------------------------------------------------------------------------
+//                            PUBLIC MEMBER FUNCTIONS
+//------------------------------------------------------------------------------
+
+bool UTF8StringView::starts_with(const UTF8StringView& substring) const
+{
+    return substring.m_byte_length <= m_byte_length &&
+           memcmp(m_data, substring.m_data, substring.m_byte_length) == 0;
+}
+
+bool UTF8StringView::ends_with(const UTF8StringView& substring) const
+{
+    return substring.m_byte_length <= m_byte_length &&
+           memcmp(
+               m_data + (m_byte_length - substring.m_byte_length),
+               substring.m_data,
+               substring.m_byte_length
+           ) == 0;
+}
+
+std::size_t UTF8StringView::find_first(const UTF8StringView& substring) const
+{
+    std::size_t byte_index = arc::str::find_bytes(
+        m_data,
+        m_byte_length,
+        substring.m_data,
+        substring.m_byte_length
+    );
+    if(byte_index == arc::str::npos)
+    {
+        return arc::str::npos;
+    }
+    return get_symbol_index_for_byte_index(byte_index);
+}
+
+std::size_t UTF8StringView::find_last(const UTF8StringView& substring) const
+{
+    std::size_t byte_index = arc::str::find_last_bytes(
+        m_data,
+        m_byte_length,
+        substring.m_data,
+        substring.m_byte_length
+    );
+    if(byte_index == arc::str::npos)
+    {
+        return arc::str::npos;
+    }
+    return get_symbol_index_for_byte_index(byte_index);
+}
+
+std::vector<UTF8StringView> UTF8StringView::split(
+        const UTF8StringView& delimiter) const
+{
+    // check the delimiter
+    if(delimiter.is_empty())
+    {
+        throw arc::ex::ValueError("Provided delimiter is empty.");
+    }
+
+    std::vector<UTF8StringView> elements;
+
+    // add the data between each occurrence of the delimiter
+    std::size_t start = 0;
+    while(true)
+    {
+        std::size_t byte_index = arc::str::find_bytes(
+            m_data + start,
+            m_byte_length - start,
+            delimiter.m_data,
+            delimiter.m_byte_length
+        );
+        if(byte_index == arc::str::npos)
+        {
+            break;
+        }
+        elements.push_back(byte_slice(start, start + byte_index));
+        start += byte_index + delimiter.m_byte_length;
+    }
+    // add the final element
+    elements.push_back(byte_slice(start, m_byte_length));
+
+    return elements;
+}
+
+UTF8StringView UTF8StringView::substring(
+        std::size_t start,
+        std::size_t length) const
+{
+    std::size_t start_byte = get_byte_index_for_symbol_index(start);
+    // clamp the length to the end of this view
+    length = std::min(length, m_length - start);
+
+    std::size_t end_byte = start_byte + length;
+    if(!is_ascii())
+    {
+        // walk forward from the start rather than from the beginning
+        end_byte = start_byte;
+        for(std::size_t i = 0; i < length; ++i)
+        {
+            ++end_byte;
+            while(end_byte < m_byte_length &&
+                  (m_data[end_byte] & 0xC0) == 0x80)
+            {
+                ++end_byte;
+            }
+        }
+    }
+    return UTF8StringView(m_data + start_byte, end_byte - start_byte, length);
+}
+
+bool UTF8StringView::is_int() const
+{
+    // any byte of a multi-byte symbol is not a digit so the bytes can be
+    // checked directly
+    return arc::str::is_int(m_data, m_byte_length);
+}
+
+bool UTF8StringView::is_uint() const
+{
+    return arc::str::is_uint(m_data, m_byte_length);
+}
+
+bool UTF8StringView::is_float() const
+{
+    return arc::str::is_float(m_data, m_byte_length);
+}
+
+bool UTF8StringView::to_bool() const
+{
+    if(!is_int())
+    {
+        throw_conversion_error("bool");
+    }
+    for(std::size_t i = 0; i < m_byte_length; ++i)
+    {
+        if(m_data[i] != '0')
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+arc::int32 UTF8StringView::to_int32() const
+{
+    arc::int32 value = 0;
+    if(!try_to_int32(value))
+    {
+        throw_conversion_error("int32");
+    }
+    return value;
+}
+
+arc::uint32 UTF8StringView::to_uint32() const
+{
+    arc::uint32 value = 0;
+    if(!try_to_uint32(value))
+    {
+        throw_conversion_error("uint32");
+    }
+    return value;
+}
+
+arc::int64 UTF8StringView::to_int64() const
+{
+    arc::int64 value = 0;
+    if(!try_to_int64(value))
+    {
+        throw_conversion_error("int64");
+    }
+    return value;
+}
+
+arc::uint64 UTF8StringView::to_uint64() const
+{
+    arc::uint64 value = 0;
+    if(!try_to_uint64(value))
+    {
+        throw_conversion_error("uint64");
+    }
+    return value;
+}
+
+bool UTF8StringView::try_to_int32(arc::int32& r_value) const
+{
+    arc::int64 value = 0;
+    if(!arc::str::parse_int64(m_data, m_byte_length, value) ||
+       value < -2147483647LL - 1                              ||
+       value > 2147483647LL)
+    {
+        return false;
+    }
+    r_value = static_cast<arc::int32>(value);
+    return true;
+}
+
+bool UTF8StringView::try_to_uint32(arc::uint32& r_value) const
+{
+    arc::uint64 value = 0;
+    if(!arc::str::parse_uint64(m_data, m_byte_length, value) ||
+       value > 0xFFFFFFFFULL)
+    {
+        return false;
+    }
+    r_value = static_cast<arc::uint32>(value);
+    return true;
+}
+
+bool UTF8StringView::try_to_int64(arc::int64& r_value) const
+{
+    return arc::str::parse_int64(m_data, m_byte_length, r_value);
+}
+
+bool UTF8StringView::try_to_uint64(arc::uint64& r_value) const
+{
+    return arc::str::parse_uint64(m_data, m_byte_length, r_value);
+}
+
+UTF8String UTF8StringView::to_string() const
+{
+    return UTF8String(m_data, m_byte_length);
+}
+
+std::string UTF8StringView::to_std_string() const
+{
+    return std::string(m_data, m_byte_length);
+}
+
+//----------------------------------ACCESSORS-----------------------------------
+
+std::size_t UTF8StringView::get_length() const
+{
+    return m_length;
+}
+
+bool UTF8StringView::is_empty() const
+{
+    return m_byte_length == 0;
+}
+
+bool UTF8StringView::is_ascii() const
+{
+    return m_length == m_byte_length;
+}
+
+const char* UTF8StringView::get_raw() const
+{
+    return m_data;
+}
+
+std::size_t UTF8StringView::get_byte_length() const
+{
+    return m_byte_length;
+}
+
+std::size_t UTF8StringView::get_hash() const
+{
+    return arc::str::hash_bytes(m_data, m_byte_length);
+}
+
+std::size_t UTF8StringView::get_byte_index_for_symbol_index(
+        std::size_t symbol_index) const
+{
+    if(symbol_index > m_length)
+    {
+        UTF8String error_message;
+        error_message << "Provided index: " << symbol_index << " is greater "
+                      << "than the number of symbols in the view: "
+                      << m_length;
+        throw arc::ex::IndexOutOfBoundsError(error_message);
+    }
+
+    if(is_ascii())
+    {
+        // every symbol is a single byte
+        return symbol_index;
+    }
+
+    // count the primary bytes until the symbol is reached
+    std::size_t current_index = 0;
+    for(std::size_t i = 0; i < m_byte_length; ++i)
+    {
+        if((m_data[i] & 0xC0) != 0x80)
+        {
+            if(current_index == symbol_index)
+            {
+                return i;
+            }
+            ++current_index;
+        }
+    }
+    return m_byte_length;
+}
+
+//------------------------------------------------------------------------------
+//                              PRIVATE CONSTRUCTORS
+//------------------------------------------------------------------------------
+
+UTF8StringView::UTF8StringView(
+        const char* data,
+        std::size_t byte_length,
+        std::size_t length)
+    :
+    m_data       (data),
+    m_byte_length(byte_length),
+    m_length     (length)
+{
+}
+
+//------------------------------------------------------------------------------
+//                            PRIVATE MEMBER FUNCTIONS
+//------------------------------------------------------------------------------
+
+UTF8StringView UTF8StringView::byte_slice(
+        std::size_t start,
+        std::size_t end) const
+{
+    // the slice is ASCII if this view is, otherwise count its symbols
+    std::size_t length = end - start;
+    if(!is_ascii())
+    {
+        length = arc::str::count_symbols(m_data + start, end - start);
+    }
+    return UTF8StringView(m_data + start, end - start, length);
+}
+
+std::size_t UTF8StringView::get_symbol_index_for_byte_index(
+        std::size_t byte_index) const
+{
+    if(is_ascii())
+    {
+        return byte_index;
+    }
+    return arc::str::count_symbols(m_data, byte_index);
+}
+
+void UTF8StringView::throw_conversion_error(const char* type_name) const
+{
+    UTF8String error_message;
+    error_message << "Cannot convert: \'" << *this << "\' to " << type_name
+                  << " as it is not valid.";
+    throw arc::ex::ConversionDataError(error_message);
+}
+
+//------------------------------------------------------------------------------
+//                               EXTERNAL OPERATORS
+//------------------------------------------------------------------------------
+
+std::ostream& operator<<(std::ostream& stream, const UTF8StringView& s)
+{
+    stream.write(s.get_raw(), s.get_byte_length());
+    return stream;
+}
+
+UTF8String& operator<<(UTF8String& s, const UTF8StringView& view)
+{
+    return s.concatenate(view.to_string());
+}
+
+//------------------------------------------------------------------------------
+//                                     HASHER
+//------------------------------------------------------------------------------
+
+std::size_t UTF8StringHash::operator()(const UTF8String& value) const
+{
+    // use the cached hash of the string
+    return value.get_hash();
+}
+
+std::size_t UTF8StringHash::operator()(const UTF8StringView& value) const
+{
+    return value.get_hash();
+}
+
+std::size_t UTF8StringHash::operator()(const char* value) const
+{
+    return arc::str::hash_bytes(value, strlen(value));
+}
+
+} // namespace str
+} // namespace arc
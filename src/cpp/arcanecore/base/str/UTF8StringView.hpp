@@ -0,0 +1,419 @@
+/*!
+ * \file
+ * \author David Saxon
+ */
+#ifndef ARCANECORE_BASE_STR_UTF8STRINGVIEW_HPP_
+#define ARCANECORE_BASE_STR_UTF8STRINGVIEW_HPP_
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "arcanecore/base/Types.hpp"
+#include "arcanecore/base/str/StringConstants.hpp"
+#include "arcanecore/base/str/UTF8String.hpp"
+
+namespace arc
+{
+namespace str
+{
+
+/*!
+ * \brief A read-only view of UTF-8 encoded text that is owned elsewhere.
+ *
+ * A UTF8StringView only holds a pointer to the data it views along with the
+ * byte and symbol length of the data, so creating, copying, splitting, and
+ * taking substrings of views never allocates or copies the viewed text.
+ *
+ * UTF8String objects implicitly convert to views, so functions that only need
+ * to inspect text can accept a UTF8StringView and be passed either type.
+ *
+ * \warning A view does not own its data, so the data must outlive the view.
+ *          Views of a UTF8String are invalidated when the string is modified
+ *          or destroyed.
+ *
+ * \note Unlike UTF8String the viewed data is not NULL terminated.
+ *
+ * \par Example Usage
+ *
+ * \code
+ * arc::str::UTF8String line("resource,base,0,12,1024");
+ * std::vector<arc::str::UTF8StringView> elements(
+ *     arc::str::UTF8StringView(line).split(","));
+ *
+ * if(elements[3].is_int())
+ * {
+ *     arc::int64 offset = elements[3].to_int64();
+ * }
+ * \endcode
+ */
+class UTF8StringView
+{
+public:
+
+    //--------------------------------------------------------------------------
+    //                                CONSTRUCTORS
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief Creates a view of the empty string.
+     */
+    UTF8StringView();
+
+    /*!
+     * \brief Creates a view of the data of the given UTF8String.
+     *
+     * This is constant time since the symbol length of the string is already
+     * known.
+     */
+    UTF8StringView(const UTF8String& s);
+
+    /*!
+     * \brief Creates a view of the given NULL terminated UTF-8 data.
+     *
+     * \throws arc::ex::EncodingError If the data is not valid UTF-8.
+     */
+    UTF8StringView(const char* data);
+
+    /*!
+     * \brief Creates a view of the given number of bytes of UTF-8 data.
+     *
+     * \throws arc::ex::EncodingError If the data is not valid UTF-8.
+     */
+    UTF8StringView(const char* data, std::size_t byte_length);
+
+    //--------------------------------------------------------------------------
+    //                                 OPERATORS
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief Returns whether this view and the given view contain the same
+     *        text.
+     */
+    bool operator==(const UTF8StringView& other) const;
+
+    /*!
+     * \brief Returns whether this view and the given view contain different
+     *        text.
+     */
+    bool operator!=(const UTF8StringView& other) const;
+
+    /*!
+     * \brief Returns whether the text of this view is ordered before the text
+     *        of the given view, comparing by code point.
+     */
+    bool operator<(const UTF8StringView& other) const;
+
+    //--------------------------------------------------------------------------
+    //                          PUBLIC MEMBER FUNCTIONS
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief Returns whether this view starts with the given substring.
+     */
+    bool starts_with(const UTF8StringView& substring) const;
+
+    /*!
+     * \brief Returns whether this view ends with the given substring.
+     */
+    bool ends_with(const UTF8StringView& substring) const;
+
+    /*!
+     * \brief Returns the symbol index of the first occurrence of the given
+     *        substring in this view, or arc::str::npos if there is none.
+     */
+    std::size_t find_first(const UTF8StringView& substring) const;
+
+    /*!
+     * \brief Returns the symbol index of the last occurrence of the given
+     *        substring in this view, or arc::str::npos if there is none.
+     */
+    std::size_t find_last(const UTF8StringView& substring) const;
+
+    /*!
+     * \brief Splits this view by the given delimiter into views of the text
+     *        between each occurrence of the delimiter.
+     *
+     * Example usage:
+     *
+     * \code
+     * arc::str::UTF8StringView("a.b..c").split(".");
+     * // returns: ["a", "b", "", "c"]
+     * \endcode
+     *
+     * \throws arc::ex::ValueError If the delimiter is empty.
+     */
+    std::vector<UTF8StringView> split(const UTF8StringView& delimiter) const;
+
+    /*!
+     * \brief Returns a view of the given number of symbols from the given
+     *        symbol index of this view.
+     *
+     * If the length extends past the end of this view the returned view ends
+     * at the end of this view.
+     *
+     * \throws arc::ex::IndexOutOfBoundsError If the start index is greater
+     *                                        than the length of this view.
+     */
+    UTF8StringView substring(std::size_t start, std::size_t length) const;
+
+    /*!
+     * \brief Returns whether this view contains an integer, that is only
+     *        digits and optionally a leading '-'.
+     */
+    bool is_int() const;
+
+    /*!
+     * \brief Returns whether this view contains an unsigned integer, that is
+     *        only digits.
+     */
+    bool is_uint() const;
+
+    /*!
+     * \brief Returns whether this view contains a floating point number, that
+     *        is at least one digit, optionally a leading '-', and at most one
+     *        '.'.
+     */
+    bool is_float() const;
+
+    /*!
+     * \brief Returns the boolean value of this view, which is false if the
+     *        view only contains zeros.
+     *
+     * \throws arc::ex::ConversionDataError If this view is not an integer.
+     */
+    bool to_bool() const;
+
+    /*!
+     * \brief Returns the decimal integer value of this view.
+     *
+     * \throws arc::ex::ConversionDataError If this view is not an integer
+     *                                      within the range of int32.
+     */
+    arc::int32 to_int32() const;
+
+    /*!
+     * \brief Returns the decimal unsigned integer value of this view.
+     *
+     * \throws arc::ex::ConversionDataError If this view is not an unsigned
+     *                                      integer within the range of uint32.
+     */
+    arc::uint32 to_uint32() const;
+
+    /*!
+     * \brief Returns the decimal integer value of this view.
+     *
+     * \throws arc::ex::ConversionDataError If this view is not an integer
+     *                                      within the range of int64.
+     */
+    arc::int64 to_int64() const;
+
+    /*!
+     * \brief Returns the decimal unsigned integer value of this view.
+     *
+     * \throws arc::ex::ConversionDataError If this view is not an unsigned
+     *                                      integer within the range of uint64.
+     */
+    arc::uint64 to_uint64() const;
+
+    /*!
+     * \brief Converts this view to an int32 if it is a valid int32, returning
+     *        whether the conversion succeeded.
+     *
+     * This validates and parses the text in a single pass. r_value is only
+     * modified if the conversion succeeds.
+     */
+    bool try_to_int32(arc::int32& r_value) const;
+
+    /*!
+     * \brief Converts this view to a uint32 if it is a valid uint32, returning
+     *        whether the conversion succeeded.
+     */
+    bool try_to_uint32(arc::uint32& r_value) const;
+
+    /*!
+     * \brief Converts this view to an int64 if it is a valid int64, returning
+     *        whether the conversion succeeded.
+     */
+    bool try_to_int64(arc::int64& r_value) const;
+
+    /*!
+     * \brief Converts this view to a uint64 if it is a valid uint64, returning
+     *        whether the conversion succeeded.
+     */
+    bool try_to_uint64(arc::uint64& r_value) const;
+
+    /*!
+     * \brief Returns a new UTF8String containing a copy of the viewed text.
+     */
+    UTF8String to_string() const;
+
+    /*!
+     * \brief Returns a new std::string containing a copy of the viewed text.
+     */
+    std::string to_std_string() const;
+
+    //--------------------------------ACCESSORS---------------------------------
+
+    /*!
+     * \brief Returns the number of UTF-8 symbols in this view.
+     */
+    std::size_t get_length() const;
+
+    /*!
+     * \brief Returns whether this view contains no text.
+     */
+    bool is_empty() const;
+
+    /*!
+     * \brief Returns whether every symbol in this view is a single byte ASCII
+     *        character.
+     */
+    bool is_ascii() const;
+
+    /*!
+     * \brief Returns the pointer to the first byte of the viewed data.
+     *
+     * \warning This data is not NULL terminated, get_byte_length() bytes may
+     *          be read from it.
+     */
+    const char* get_raw() const;
+
+    /*!
+     * \brief Returns the number of bytes in this view.
+     *
+     * \note Unlike UTF8String::get_byte_length() this does not include a NULL
+     *       terminator.
+     */
+    std::size_t get_byte_length() const;
+
+    /*!
+     * \brief Returns a hash of the bytes of this view.
+     *
+     * This is the same as the hash of a UTF8String containing the same text,
+     * see UTF8String::get_hash().
+     */
+    std::size_t get_hash() const;
+
+    /*!
+     * \brief Returns the byte index of the symbol at the given symbol index.
+     *
+     * The length of this view is accepted as an index, and returns the byte
+     * length of this view.
+     *
+     * \throws arc::ex::IndexOutOfBoundsError If the provided index is greater
+     *                                        than the length of this view.
+     */
+    std::size_t get_byte_index_for_symbol_index(
+            std::size_t symbol_index) const;
+
+private:
+
+    //--------------------------------------------------------------------------
+    //                             PRIVATE ATTRIBUTES
+    //--------------------------------------------------------------------------
+
+    // the first byte of the viewed data
+    const char* m_data;
+    // the number of bytes being viewed
+    std::size_t m_byte_length;
+    // the number of utf-8 symbols being viewed
+    std::size_t m_length;
+
+    //--------------------------------------------------------------------------
+    //                         PRIVATE CONSTRUCTORS
+    //--------------------------------------------------------------------------
+
+    /*!
+     * Internal constructor for views of data that is already known to be
+     * valid and whose symbol length is already known.
+     */
+    UTF8StringView(
+            const char* data,
+            std::size_t byte_length,
+            std::size_t length);
+
+    //--------------------------------------------------------------------------
+    //                          PRIVATE MEMBER FUNCTIONS
+    //--------------------------------------------------------------------------
+
+    /*!
+     * Internal function that returns a view of the given bytes of this view.
+     */
+    UTF8StringView byte_slice(std::size_t start, std::size_t end) const;
+
+    /*!
+     * Internal function that returns the index of the symbol starting at the
+     * given byte index of this view.
+     */
+    std::size_t get_symbol_index_for_byte_index(std::size_t byte_index) const;
+
+    /*!
+     * Internal function that throws the error for a failed conversion to the
+     * given type.
+     */
+    void throw_conversion_error(const char* type_name) const;
+};
+
+//------------------------------------------------------------------------------
+//                               EXTERNAL OPERATORS
+//------------------------------------------------------------------------------
+
+std::ostream& operator<<(std::ostream& stream, const UTF8StringView& s);
+
+UTF8String& operator<<(UTF8String& s, const UTF8StringView& view);
+
+//------------------------------------------------------------------------------
+//                                     HASHER
+//------------------------------------------------------------------------------
+
+/*!
+ * \brief Hash function object that gives the same hash for a UTF8String, a
+ *        UTF8StringView, and NULL terminated data containing the same text.
+ *
+ * This allows a hash of text to be computed from whichever representation is
+ * at hand without first constructing a UTF8String. For example a
+ * std::unordered_map keyed by UTF8StringView can be probed with views of
+ * NULL terminated data or of part of a larger string without allocating.
+ *
+ * \par Example Usage
+ *
+ * \code
+ * arc::str::UTF8StringHash hasher;
+ * hasher(arc::str::UTF8String("key")) == hasher("key"); // true
+ * \endcode
+ */
+struct UTF8StringHash
+{
+    std::size_t operator()(const UTF8String& value) const;
+
+    std::size_t operator()(const UTF8StringView& value) const;
+
+    std::size_t operator()(const char* value) const;
+};
+
+} // namespace str
+} // namespace arc
+
+//------------------------------------------------------------------------------
+//                                      HASH
+//------------------------------------------------------------------------------
+
+namespace std
+{
+
+template<>
+struct hash<arc::str::UTF8StringView>
+{
+    typedef arc::str::UTF8StringView argument_type;
+    typedef std::size_t result_type;
+
+    std::size_t operator()(const arc::str::UTF8StringView& value) const
+    {
+        return value.get_hash();
+    }
+};
+
+} // namespace std
+
+#endif
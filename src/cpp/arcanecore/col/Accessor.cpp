@@ -1,9 +1,13 @@
 #include "arcanecore/col/Accessor.hpp"
 
+#include <algorithm>
+
 #include <arcanecore/base/Exceptions.hpp>
 #include <arcanecore/base/str/StringOperations.hpp>
+#include <arcanecore/base/str/UTF8StringView.hpp>
 #include <arcanecore/io/sys/FileReader.hpp>
 #include <arcanecore/io/sys/FileSystemOperations.hpp>
+#include <arcanecore/io/sys/Watcher.hpp>
 
 #include <arcanecore/log/Input.hpp>
 #include <arcanecore/log/LogHandler.hpp>
@@ -26,7 +30,10 @@ std::unique_ptr<arc::log::Input> Accessor::logger;
 
 Accessor::Accessor(const arc::io::sys::Path& table_of_contents)
     :
-    m_table_of_contents(table_of_contents)
+    m_table_of_contents(table_of_contents),
+    m_watcher          (nullptr),
+    m_watch_id         (0),
+    m_changed          (false)
 {
     reload();
 }
@@ -34,7 +41,10 @@ Accessor::Accessor(const arc::io::sys::Path& table_of_contents)
 Accessor::Accessor(const Accessor& other)
     :
     m_table_of_contents(other.m_table_of_contents),
-    m_resources        (other.m_resources)
+    m_resources        (other.m_resources),
+    m_watcher          (nullptr),
+    m_watch_id         (0),
+    m_changed          (false)
 {
 }
 
@@ -44,6 +54,7 @@ Accessor::Accessor(const Accessor& other)
 
 Accessor::~Accessor()
 {
+    unwatch();
 }
 
 //------------------------------------------------------------------------------
@@ -104,9 +115,10 @@ void Accessor::reload()
         arc::str::UTF8String::Opt::SKIP_VALID_CHECK);
 
     // read each line of the file
+    arc::str::UTF8String line;
+    std::vector<arc::str::UTF8StringView> line_elements;
     while(!reader.eof())
     {
-        arc::str::UTF8String line;
         reader.read_line(line);
 
         // skip any empty lines
@@ -115,8 +127,9 @@ void Accessor::reload()
             continue;
         }
 
-        // split the line by commas
-        std::vector<arc::str::UTF8String> line_elements(line.split(","));
+        // split the line by commas, the elements are views of the line so
+        // nothing is copied
+        line_elements = arc::str::UTF8StringView(line).split(",");
         // check that there are the correct number of components
         if(line_elements.size() != 5)
         {
@@ -132,15 +145,18 @@ void Accessor::reload()
         }
 
         // get the resource path
-        arc::io::sys::Path resource =
-            arc::io::sys::Path::from_unix_string(line_elements[0]);
+        arc::io::sys::PathAtom resource(
+            arc::io::sys::Path::from_unix_string(line_elements[0].to_string())
+        );
 
         // create a new resource location to load the entry into
         ResourceLocation location;
-        location.base_path =
-            arc::io::sys::Path::from_unix_string(line_elements[1]);
+        location.base_path = arc::io::sys::Path::from_unix_string(
+            line_elements[1].to_string()
+        );
         // get and check page index is valid
-        if(!line_elements[2].is_uint())
+        arc::uint32 page_index = 0;
+        if(!line_elements[2].try_to_uint32(page_index))
         {
             // warn if logging is enabled
             if(logger)
@@ -154,9 +170,9 @@ void Accessor::reload()
             }
             continue;
         }
-        location.page_index = line_elements[2].to_uint32();
+        location.page_index = page_index;
         // get and check offset is valid
-        if(!line_elements[3].is_int())
+        if(!line_elements[3].try_to_int64(location.offset))
         {
             // warn if logging is enabled
             if(logger)
@@ -170,9 +186,8 @@ void Accessor::reload()
             }
             continue;
         }
-        location.offset = line_elements[3].to_int64();
         // get and check size is valid
-        if(!line_elements[4].is_int())
+        if(!line_elements[4].try_to_int64(location.size))
         {
             // warn if logging is enabled
             if(logger)
@@ -185,7 +200,6 @@ void Accessor::reload()
             }
             continue;
         }
-        location.size = line_elements[4].to_int64();
 
         // warn if the are multiple entries
         if(m_resources.find(resource) != m_resources.end() && logger)
@@ -201,6 +215,41 @@ void Accessor::reload()
     }
 }
 
+void Accessor::watch(arc::io::sys::Watcher& watcher)
+{
+    unwatch();
+    std::atomic<bool>* changed = &m_changed;
+    m_watch_id = watcher.watch_file(
+        m_table_of_contents,
+        [changed](const arc::io::sys::Watcher::Event&)
+        {
+            *changed = true;
+        }
+    );
+    m_watcher = &watcher;
+}
+
+void Accessor::unwatch()
+{
+    if(m_watcher != nullptr)
+    {
+        m_watcher->unwatch(m_watch_id);
+        m_watcher = nullptr;
+        m_watch_id = 0;
+    }
+    m_changed = false;
+}
+
+bool Accessor::reload_if_changed()
+{
+    if(!m_changed.exchange(false))
+    {
+        return false;
+    }
+    reload();
+    return true;
+}
+
 const arc::io::sys::Path& Accessor::get_table_of_contents_path() const
 {
     return m_table_of_contents;
@@ -209,10 +258,27 @@ const arc::io::sys::Path& Accessor::get_table_of_contents_path() const
 void Accessor::set_table_of_contents_path(const arc::io::sys::Path& path)
 {
     m_table_of_contents = path;
+
+    // follow the new table of contents
+    if(m_watcher != nullptr)
+    {
+        watch(*m_watcher);
+    }
     reload();
 }
 
 bool Accessor::has_resource(const arc::io::sys::Path& resource_path) const
+{
+    // paths that have never been interned can't be resources
+    arc::io::sys::PathAtom atom;
+    if(!arc::io::sys::PathAtom::find(resource_path, atom))
+    {
+        return false;
+    }
+    return has_resource(atom);
+}
+
+bool Accessor::has_resource(const arc::io::sys::PathAtom& resource_path) const
 {
     return m_resources.find(resource_path) != m_resources.end();
 }
@@ -223,10 +289,29 @@ void Accessor::get_resource(
         std::size_t& page_index,
         arc::int64& offset,
         arc::int64& size) const
+{
+    // paths that have never been interned can't be resources
+    arc::io::sys::PathAtom atom;
+    if(!arc::io::sys::PathAtom::find(resource_path, atom))
+    {
+        arc::str::UTF8String error_message;
+        error_message << "No resource in Accessor for \"" << resource_path
+                      << "\".";
+        throw arc::ex::KeyError(error_message);
+    }
+    get_resource(atom, base_path, page_index, offset, size);
+}
+
+void Accessor::get_resource(
+        const arc::io::sys::PathAtom& resource_path,
+        arc::io::sys::Path& base_path,
+        std::size_t& page_index,
+        arc::int64& offset,
+        arc::int64& size) const
 {
     // check that the resource is in the map
-    std::map<arc::io::sys::Path, ResourceLocation>::const_iterator r_find =
-        m_resources.find(resource_path);
+    std::unordered_map<arc::io::sys::PathAtom, ResourceLocation>::
+        const_iterator r_find = m_resources.find(resource_path);
     if(r_find == m_resources.end())
     {
         arc::str::UTF8String error_message;
@@ -253,10 +338,11 @@ std::vector<arc::io::sys::Path> Accessor::list(const arc::io::sys::Path& path)
     std::vector<arc::io::sys::Path> ret;
 
     // iterate over the resources in this accessor
-    std::map<arc::io::sys::Path, ResourceLocation>::const_iterator it;
+    std::unordered_map<arc::io::sys::PathAtom, ResourceLocation>::
+        const_iterator it;
     for(it = m_resources.begin(); it != m_resources.end(); ++it)
     {
-        const arc::io::sys::Path& l_path = it->first;
+        const arc::io::sys::Path& l_path = it->first.get_path();
         // look for resources that are exactly 1 component longer than this
         // path
         if((path.get_length() + 1) == l_path.get_length())
@@ -265,7 +351,8 @@ std::vector<arc::io::sys::Path> Accessor::list(const arc::io::sys::Path& path)
             bool match = true;
             for(std::size_t i = 0; i < path.get_length(); ++i)
             {
-                if(path[i] != l_path[i])
+                if(path.get_component_view(i) !=
+                   l_path.get_component_view(i))
                 {
                     match = false;
                     break;
@@ -279,6 +366,8 @@ std::vector<arc::io::sys::Path> Accessor::list(const arc::io::sys::Path& path)
         }
     }
 
+    // the resources are unordered so sort to give a consistent order
+    std::sort(ret.begin(), ret.end());
     return ret;
 }
 
@@ -294,10 +383,11 @@ std::vector< arc::io::sys::Path> Accessor::list_rec(
     std::vector<arc::io::sys::Path> ret;
 
     // iterate over the resources in this accessor
-    std::map<arc::io::sys::Path, ResourceLocation>::const_iterator it;
+    std::unordered_map<arc::io::sys::PathAtom, ResourceLocation>::
+        const_iterator it;
     for(it = m_resources.begin(); it != m_resources.end(); ++it)
     {
-        const arc::io::sys::Path& l_path = it->first;
+        const arc::io::sys::Path& l_path = it->first.get_path();
         // look for resources that are at least 1 component longer than this
         // path
         if(path.get_length() < l_path.get_length())
@@ -306,7 +396,8 @@ std::vector< arc::io::sys::Path> Accessor::list_rec(
             bool match = true;
             for(std::size_t i = 0; i < path.get_length(); ++i)
             {
-                if(path[i] != l_path[i])
+                if(path.get_component_view(i) !=
+                   l_path.get_component_view(i))
                 {
                     match = false;
                     break;
@@ -320,6 +411,8 @@ std::vector< arc::io::sys::Path> Accessor::list_rec(
         }
     }
 
+    // the resources are unordered so sort to give a consistent order
+    std::sort(ret.begin(), ret.end());
     return ret;
 }
 
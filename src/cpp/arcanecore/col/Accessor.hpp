@@ -5,10 +5,12 @@
 #ifndef ARCANECORE_COL_ACCESSOR_HPP_
 #define ARCANECORE_COL_ACCESSOR_HPP_
 
-#include <map>
+#include <atomic>
 #include <memory>
+#include <unordered_map>
 
 #include <arcanecore/io/sys/Path.hpp>
+#include <arcanecore/io/sys/PathAtom.hpp>
 
 
 namespace arc
@@ -18,6 +20,14 @@ namespace arc
 //                              FORWARD DECLARATIONS
 //------------------------------------------------------------------------------
 
+namespace io
+{
+namespace sys
+{
+class Watcher;
+} // namespace sys
+} // namespace io
+
 namespace log
 {
 class Input;
@@ -67,6 +77,8 @@ public:
     /*!
      * \brief Copy constructor.
      *
+     * \note The new Accessor is not watched, even if the other Accessor is.
+     *
      * \param other The Accessor to copy from.
      */
     Accessor(const Accessor& other);
@@ -84,6 +96,8 @@ public:
     /*!
      * \brief Copies values from the given Accessor.
      *
+     * \note Whether this Accessor is being watched is not changed.
+     *
      * \param other Accessor to copy from.
      */
     Accessor& operator=(const Accessor& other);
@@ -123,6 +137,39 @@ public:
      */
     void reload();
 
+    /*!
+     * \brief Uses the given Watcher to track changes to the table of contents
+     *        file of this Accessor.
+     *
+     * Changes are not applied immediately, instead reload_if_changed() should
+     * be called at a convenient time to reload the resource locations if the
+     * table of contents has changed. The watch follows the table of contents
+     * if it is changed with set_table_of_contents_path().
+     *
+     * \note The Watcher must outlive this Accessor, or unwatch() must be
+     *       called before the Watcher is destroyed.
+     *
+     * \throws arc::ex::IOError If the table of contents cannot be watched.
+     */
+    void watch(arc::io::sys::Watcher& watcher);
+
+    /*!
+     * \brief Stops tracking changes to the table of contents file.
+     */
+    void unwatch();
+
+    /*!
+     * \brief Reloads the resource location information if the Watcher passed
+     *        to watch() has reported a change to the table of contents since
+     *        it was last loaded.
+     *
+     * \return Whether the resource location information was reloaded.
+     *
+     * \throws arc::ex::IOError If the table of contents file cannot be
+     *                          accessed.
+     */
+    bool reload_if_changed();
+
     /*!
      * \brief Returns the path to the table of contents this Accessor is using.
      */
@@ -146,6 +193,15 @@ public:
      */
     bool has_resource(const arc::io::sys::Path& resource_path) const;
 
+    /*!
+     * \brief Whether the given resource was found when loading from the table
+     *        of contents.
+     *
+     * This is faster than looking up the resource by arc::io::sys::Path and
+     * should be preferred when the same resources are looked up repeatedly.
+     */
+    bool has_resource(const arc::io::sys::PathAtom& resource_path) const;
+
     /*!
      * \brief Returns information about where to find the given resource file
      *        in collated documents.
@@ -174,6 +230,25 @@ public:
             arc::int64& offset,
             arc::int64& size) const;
 
+    /*!
+     * \brief Returns information about where to find the given resource file
+     *        in collated documents.
+     *
+     * This is faster than looking up the resource by arc::io::sys::Path and
+     * should be preferred when the same resources are looked up repeatedly.
+     * See the arc::io::sys::Path overload of this function for details of the
+     * parameters.
+     *
+     * \throws arc::ex::KeyError If the resource is not in the table of
+     *                           contents.
+     */
+    void get_resource(
+            const arc::io::sys::PathAtom& resource_path,
+            arc::io::sys::Path& base_path,
+            std::size_t& page_index,
+            arc::int64& offset,
+            arc::int64& size) const;
+
     /*!
      * \brief Lists the file system paths that are in the given path that are
      *        listed in the table of contents of this accessor.
@@ -251,9 +326,25 @@ private:
     arc::io::sys::Path m_table_of_contents;
 
     /*!
-     * \brief Mapping from resource paths to their location information.
+     * \brief Mapping from interned resource paths to their location
+     *        information.
+     */
+    std::unordered_map<arc::io::sys::PathAtom, ResourceLocation> m_resources;
+
+    /*!
+     * \brief The Watcher tracking changes to the table of contents (null if
+     *        not being watched).
+     */
+    arc::io::sys::Watcher* m_watcher;
+    /*!
+     * \brief The id of the watch on the table of contents.
+     */
+    arc::uint64 m_watch_id;
+    /*!
+     * \brief Whether a change to the table of contents has been reported since
+     *        it was last loaded.
      */
-    std::map<arc::io::sys::Path, ResourceLocation> m_resources;
+    std::atomic<bool> m_changed;
 };
 
 } // namespace col
@@ -1,7 +1,7 @@
 #include "arcanecore/col/Reader.hpp"
 
 #include <cassert>
-#include <fstream>
+#include <fcntl.h>
 
 #include <arcanecore/base/str/StringOperations.hpp>
 #include <arcanecore/base/Exceptions.hpp>
@@ -28,9 +28,7 @@ Reader::Reader(
     m_offset                (0),
     m_current_page          (0),
     m_current_offset        (0),
-    m_current_size          (0),
-    m_position              (0),
-    m_eof                   (false)
+    m_current_size          (0)
 {
 }
 
@@ -47,9 +45,7 @@ Reader::Reader(
     m_offset                (0),
     m_current_page          (0),
     m_current_offset        (0),
-    m_current_size          (0),
-    m_position              (0),
-    m_eof                   (false)
+    m_current_size          (0)
 {
     // set and open the file
     set_path(resource);
@@ -66,9 +62,7 @@ Reader::Reader(Reader&& other)
     m_offset                (other.m_offset),
     m_current_page          (other.m_current_page),
     m_current_offset        (other.m_current_offset),
-    m_current_size          (other.m_current_size),
-    m_position              (other.m_position),
-    m_eof                   (other.m_eof)
+    m_current_size          (other.m_current_size)
 {
     // reset other resources
     other.m_accessor = nullptr;
@@ -78,8 +72,6 @@ Reader::Reader(Reader&& other)
     other.m_current_page = 0;
     other.m_current_offset = 0;
     other.m_current_size = 0;
-    other.m_position = 0;
-    other.m_eof = false;
 }
 
 //------------------------------------------------------------------------------
@@ -98,8 +90,6 @@ Reader& Reader::operator=(Reader&& other)
     m_current_page = other.m_current_page;
     m_current_offset = other.m_current_offset;
     m_current_size = other.m_current_size;
-    m_position = other.m_position;
-    other.m_eof = other.m_eof;
 
     // reset
     other.m_accessor = nullptr;
@@ -109,8 +99,6 @@ Reader& Reader::operator=(Reader&& other)
     other.m_current_page = 0;
     other.m_current_offset = 0;
     other.m_current_size = 0;
-    other.m_position = 0;
-    other.m_eof = false;
 
     return *this;
 }
@@ -189,10 +177,11 @@ void Reader::open()
     // file reader is open
     m_open = true;
     m_newline_checker_valid = false;
+    m_position = 0;
     m_eof = false;
 
     // seek to the beginning of the resource
-    m_stream->seekg(m_offset, std::ios_base::beg);
+    descriptor_seek(m_offset);
 
     // detect the encoding if needed
     if(m_encoding == ENCODING_DETECT)
@@ -257,7 +246,7 @@ void Reader::seek(arc::int64 index)
     if(seek_distance > 0)
     {
         // get the remaining bytes in this file
-        arc::int64 remaing_size = m_current_size - m_stream->tellg();
+        arc::int64 remaing_size = m_current_size - descriptor_tell();
         assert(remaing_size >= 0);
 
         // loop until we're not seeking into the next collated file
@@ -271,13 +260,13 @@ void Reader::seek(arc::int64 index)
         }
 
         // seek in this file
-        m_stream->seekg(m_current_offset + seek_distance, std::ios_base::beg);
+        descriptor_seek(m_current_offset + seek_distance);
     }
     // backwards seek
     else if(seek_distance < 0)
     {
         // get the remaining bytes in this file
-        arc::int64 remaing_size = m_stream->tellg();
+        arc::int64 remaing_size = descriptor_tell();
         assert(remaing_size >= 0);
 
         // loop until we're not seeking into the next collated file
@@ -292,7 +281,7 @@ void Reader::seek(arc::int64 index)
         }
 
         // seek in this file
-        m_stream->seekg(remaing_size + seek_distance, std::ios_base::beg);
+        descriptor_seek(remaing_size + seek_distance);
     }
 
     // update position
@@ -329,10 +318,10 @@ void Reader::read(char* data, arc::int64 length)
         return;
     }
 
-    // if the length is -1 modify to the length of the file
-    if(length < 0)
+    // don't read past the end of the resource
+    if(length < 0 || length > m_size - m_position)
     {
-        length = m_size;
+        length = m_size - m_position;
     }
 
     // stores the remaining number of bytes to read
@@ -341,7 +330,7 @@ void Reader::read(char* data, arc::int64 length)
     while(remaining_read > 0)
     {
         // get the remaining bytes in this file
-        arc::int64 remaing_size = m_current_size - m_stream->tellg();
+        arc::int64 remaing_size = m_current_size - descriptor_tell();
         assert(remaing_size >= 0);
 
         // get the amount of data we will read from the current file
@@ -353,7 +342,7 @@ void Reader::read(char* data, arc::int64 length)
 
 
         // read the data
-        m_stream->read(data + (length - remaining_read), current_read);
+        descriptor_read(data + (length - remaining_read), current_read);
 
         // subtract the amount of data we've read
         remaining_read -= current_read;
@@ -382,6 +371,23 @@ void Reader::read(arc::str::UTF8String& data, arc::int64 length)
     FileReader::read(data, length);
 }
 
+arc::int64 Reader::read_at(
+        char* data,
+        arc::int64 length,
+        arc::int64 offset) const
+{
+    // default to standard behavior
+    if(!m_open || !m_from_collated)
+    {
+        return FileReader::read_at(data, length, offset);
+    }
+
+    throw arc::ex::NotImplementedError(
+        "Positional reads are not supported for resources being read from a "
+        "collated file."
+    );
+}
+
 //------------------------------------------------------------------------------
 //                            PRIVATE MEMBER FUNCTIONS
 //------------------------------------------------------------------------------
@@ -389,11 +395,9 @@ void Reader::read(arc::str::UTF8String& data, arc::int64 length)
 arc::io::sys::Path Reader::get_collated_path() const
 {
     arc::io::sys::Path collated_path(m_base_path);
-    arc::str::UTF8String filename(collated_path.get_back());
-    collated_path.remove(collated_path.get_length() - 1);
-
-    filename << "." << m_current_page;
-    collated_path << filename;
+    arc::str::UTF8String suffix(".");
+    suffix << m_current_page;
+    collated_path[collated_path.get_length() - 1] += suffix;
 
     return collated_path;
 }
@@ -403,45 +407,15 @@ void Reader::open_stream()
     // build the initial file name to read from
     arc::io::sys::Path read_path(get_collated_path());
 
-    // ensure we clean up the existing stream
-    if(m_stream)
-    {
-        delete m_stream;
-    }
+    // close the existing descriptor
+    close_descriptor();
 
-    // create a new stream
-    #ifdef ARC_OS_WINDOWS
-
-        // utf-16 path
-        std::size_t length = 0;
-        const char* p = arc::str::utf8_to_utf16(
-            read_path.to_windows(),
-            length,
-            arc::data::ENDIAN_LITTLE
-        );
-
-        m_stream = new std::ifstream(
-            (const wchar_t*) p,
-            std::ios_base::in | std::ios_base::binary
-        );
-
-        delete[] p;
-
-    #else
-
-        m_stream = new std::ifstream(
-            read_path.to_native().get_raw(),
-            std::ios_base::in | std::ios_base::binary
-        );
-
-    #endif
+    // open the new descriptor
+    m_descriptor = open_descriptor(read_path, O_RDONLY);
 
     // did opening fail?
-    if(!m_stream->good())
+    if(m_descriptor < 0)
     {
-        // clean up
-        delete m_stream;
-
         // throw exception
         arc::str::UTF8String error_message;
         error_message << "Failed to open Reader to path: \'"
@@ -459,9 +433,7 @@ void Reader::open_stream()
         m_current_offset = m_offset;
     }
     // set the current size
-    m_stream->seekg(0, std::ios_base::end);
-    m_current_size = m_stream->tellg();
-    m_stream->seekg(0, std::ios_base::beg);
+    m_current_size = descriptor_size();
 }
 
 } // namespace col
@@ -177,6 +177,20 @@ public:
     // override
     virtual void read(arc::str::UTF8String& data, arc::int64 length = -1);
 
+    /*!
+     * \brief Reads a block of data from the given byte offset of the resource
+     *        without using or moving the file position indicator.
+     *
+     * \throws arc::ex::NotImplementedError If the resource is being read from
+     *                                        a collated file.
+     *
+     * See arc::io::sys::FileReader::read_at().
+     */
+    virtual arc::int64 read_at(
+            char* data,
+            arc::int64 length,
+            arc::int64 offset) const;
+
 private:
 
     //--------------------------------------------------------------------------
@@ -220,16 +234,6 @@ private:
      */
     arc::int64 m_current_size;
 
-    /*!
-     * \brief The current position index in regards to the size of the resource.
-     */
-    arc::int64 m_position;
-
-    /*!
-     * \brief Stores whether the end of the file has been reached or not.
-     */
-    bool m_eof;
-
     //--------------------------------------------------------------------------
     //                          PRIVATE MEMBER FUNCTIONS
     //--------------------------------------------------------------------------
@@ -241,8 +245,8 @@ private:
     arc::io::sys::Path get_collated_path() const;
 
     /*!
-     * \brief Deletes the current stream, and opens a new stream to the current
-     *        collated path (determined from m_base_path and m_current_page).
+     * \brief Closes the current descriptor, and opens a new descriptor to the
+     *        current collated path (determined from m_base_path and m_current_page).
      */
     void open_stream();
 };
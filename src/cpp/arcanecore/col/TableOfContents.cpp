@@ -66,12 +66,19 @@ void TableOfContents::write()
     // iterate over the resources and write their data
     for(const std::unique_ptr<ResourceEntry>& entry : m_entries)
     {
-        // build the line and write
-        arc::str::UTF8String line;
-        line << entry->resource_path.to_unix() << ","
-             << entry->base_path.to_unix() << "," << entry->page_index << ","
-             << entry->offset << "," << entry->size;
-        writer.write_line(line, false);
+        // write the line in parts rather than building it first
+        arc::str::UTF8String location;
+        location << "," << entry->page_index << "," << entry->offset << ","
+                 << entry->size << "\n";
+        writer.writev(
+            {
+                entry->resource_path.to_unix(),
+                ",",
+                entry->base_path.to_unix(),
+                location
+            },
+            false
+        );
     }
 
     // done!
@@ -1,7 +1,9 @@
 #include "arcanecore/config/Document.hpp"
 
 #include <arcanecore/base/Exceptions.hpp>
+#include <arcanecore/base/str/UTF8StringView.hpp>
 #include <arcanecore/io/sys/FileReader.hpp>
+#include <arcanecore/io/sys/Watcher.hpp>
 
 #include <json/json.h>
 
@@ -30,7 +32,10 @@ Document::Document(
     m_mem_root  (nullptr),
     m_file_path (file_path),
     m_using_path(true),
-    m_memory    (nullptr)
+    m_memory    (nullptr),
+    m_watcher   (nullptr),
+    m_watch_id  (0),
+    m_changed   (false)
 {
     if(load_immediately)
     {
@@ -45,7 +50,10 @@ Document::Document(
     m_file_root (nullptr),
     m_mem_root  (nullptr),
     m_using_path(false),
-    m_memory    (memory)
+    m_memory    (memory),
+    m_watcher   (nullptr),
+    m_watch_id  (0),
+    m_changed   (false)
 {
     if(load_immediately)
     {
@@ -62,7 +70,10 @@ Document::Document(
     m_mem_root  (nullptr),
     m_file_path (file_path),
     m_using_path(true),
-    m_memory    (memory)
+    m_memory    (memory),
+    m_watcher   (nullptr),
+    m_watch_id  (0),
+    m_changed   (false)
 {
     if(load_immediately)
     {
@@ -76,6 +87,7 @@ Document::Document(
 
 Document::~Document()
 {
+    unwatch();
 }
 
 //------------------------------------------------------------------------------
@@ -228,6 +240,47 @@ void Document::reload()
     }
 }
 
+void Document::watch(arc::io::sys::Watcher& watcher)
+{
+    if(!m_using_path)
+    {
+        throw arc::ex::StateError(
+            "Cannot watch a Document that is not loaded from a file path.");
+    }
+
+    unwatch();
+    std::atomic<bool>* changed = &m_changed;
+    m_watch_id = watcher.watch_file(
+        m_file_path,
+        [changed](const arc::io::sys::Watcher::Event&)
+        {
+            *changed = true;
+        }
+    );
+    m_watcher = &watcher;
+}
+
+void Document::unwatch()
+{
+    if(m_watcher != nullptr)
+    {
+        m_watcher->unwatch(m_watch_id);
+        m_watcher = nullptr;
+        m_watch_id = 0;
+    }
+    m_changed = false;
+}
+
+bool Document::reload_if_changed()
+{
+    if(!m_changed.exchange(false))
+    {
+        return false;
+    }
+    reload();
+    return true;
+}
+
 //------------------------------------------------------------------------------
 //                            PRIVATE MEMBER FUNCTIONS
 //------------------------------------------------------------------------------
@@ -399,23 +452,30 @@ const Json::Value* Document::get_value(
 {
     // the value to be returned
     const Json::Value* value = root;
-    // split the hierarchy of the key
-    std::vector<arc::str::UTF8String> key_elements(key.split("."));
-    arc::str::UTF8String key_so_far;
+    // split the hierarchy of the key into views of the key
+    std::vector<arc::str::UTF8StringView> key_elements(
+        arc::str::UTF8StringView(key).split("."));
     ARC_CONST_FOR_EACH(it, key_elements)
     {
-        key_so_far += *it;
         // get the value associated with this key in the hierarchy
-        value = &(*value)[it->get_raw()];
+        value = value->find(
+            it->get_raw(),
+            it->get_raw() + it->get_byte_length()
+        );
         // did we get back a valid value?
-        if(value->isNull())
+        if(value == nullptr || value->isNull())
         {
+            // the key up to and including this element
+            arc::str::UTF8StringView key_so_far(
+                key.get_raw(),
+                (it->get_raw() - key.get_raw()) + it->get_byte_length()
+            );
+
             arc::str::UTF8String error_message;
             error_message << "No value exists with the key \"" << key_so_far
                           << "\".";
             throw arc::ex::KeyError(error_message);
         }
-        key_so_far += ".";
     }
 
     return value;
@@ -5,6 +5,7 @@
 #ifndef ARCANECORE_CONFIG_DOCUMENT_HPP_
 #define ARCANECORE_CONFIG_DOCUMENT_HPP_
 
+#include <atomic>
 #include <cassert>
 #include <memory>
 
@@ -25,6 +26,17 @@ namespace Json
 class Value;
 } // namespace Json
 
+namespace arc
+{
+namespace io
+{
+namespace sys
+{
+class Watcher;
+} // namespace sys
+} // namespace io
+} // namespace arc
+
 
 namespace arc
 {
@@ -227,6 +239,41 @@ public:
      */
     virtual void reload();
 
+    /*!
+     * \brief Uses the given Watcher to track changes to the file this Document
+     *        loads from.
+     *
+     * Changes are not applied immediately, since the Document may be in use,
+     * instead reload_if_changed() should be called at a convenient time to
+     * reload the Document if its file has changed. This replaces polling the
+     * file system for changes.
+     *
+     * If this Document is already being watched the previous watch is removed.
+     *
+     * \note The Watcher must outlive this Document, or unwatch() must be
+     *       called before the Watcher is destroyed.
+     *
+     * \throws arc::ex::StateError If this Document is not using a file path.
+     * \throws arc::ex::IOError If the file cannot be watched.
+     */
+    void watch(arc::io::sys::Watcher& watcher);
+
+    /*!
+     * \brief Stops tracking changes to the file this Document loads from.
+     */
+    void unwatch();
+
+    /*!
+     * \brief Reloads this Document if the Watcher passed to watch() has
+     *        reported a change to its file since it was last loaded.
+     *
+     * \return Whether the Document was reloaded.
+     *
+     * \throw arc::ex::IOError See reload().
+     * \throw arc::ex::ParseError See reload().
+     */
+    bool reload_if_changed();
+
     /*!
      * \brief Retrieves data from the Document using the given Visitor object.
      *
@@ -358,6 +405,21 @@ private:
      *        used).
      */
     const arc::str::UTF8String* m_memory;
+
+    /*!
+     * \brief The Watcher tracking changes to the file (null if not being
+     *        watched).
+     */
+    arc::io::sys::Watcher* m_watcher;
+    /*!
+     * \brief The id of the watch on the file.
+     */
+    arc::uint64 m_watch_id;
+    /*!
+     * \brief Whether a change to the file has been reported since it was last
+     *        loaded.
+     */
+    std::atomic<bool> m_changed;
 };
 
 } // namespace config
@@ -0,0 +1,787 @@
+// hide from doxygen
+#ifndef IN_DOXYGEN
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+#include <json/json.h>
+
+#include <arcanecore/base/Exceptions.hpp>
+#include <arcanecore/io/sys/FileReader.hpp>
+#include <arcanecore/io/sys/FileSystemOperations.hpp>
+#include <arcanecore/io/sys/FileWriter.hpp>
+#include <arcanecore/io/sys/IOStats.hpp>
+
+#include <arcanecore/log/Shared.hpp>
+#include <arcanecore/log/outputs/StdOutput.hpp>
+
+
+//------------------------------------------------------------------------------
+//                                   CONSTANTS
+//------------------------------------------------------------------------------
+
+static const arc::str::UTF8String APP_NAME("ArcaneCore::IOBenchmark");
+// the number of times each path operation is performed
+static const std::size_t PATH_OPERATIONS = 50000;
+// the maximum number of files created in a single directory of the tree
+static const std::size_t TREE_DIRECTORY_SIZE = 1000;
+//----------------------------COMMAND LINE ARGUMENTS----------------------------
+// shows the help and exits
+static const arc::str::UTF8String ARG_HELP("--help");
+// defines the path the JSON results are written to
+static const arc::str::UTF8String ARG_OUTPUT("--output");
+// defines the directory the benchmark files are created in
+static const arc::str::UTF8String ARG_WORK_DIR("--work_dir");
+// defines the size in bytes of the files that are read and written
+static const arc::str::UTF8String ARG_FILE_SIZE("--file_size");
+// defines the number of files in the tree that is listed
+static const arc::str::UTF8String ARG_TREE_SIZE("--tree_size");
+// defines the number of times each benchmark is run
+static const arc::str::UTF8String ARG_ITERATIONS("--iterations");
+
+//------------------------------------------------------------------------------
+//                                    OBJECTS
+//------------------------------------------------------------------------------
+
+/*!
+ * \brief The fastest run of a benchmark.
+ */
+struct Measurement
+{
+    //----------------------------PUBLIC ATTRIBUTES-----------------------------
+    double seconds;
+    arc::io::sys::IOStats io_stats;
+};
+
+//------------------------------------------------------------------------------
+//                                    GLOBALS
+//------------------------------------------------------------------------------
+
+// logging
+arc::log::Input* g_logger = nullptr;
+arc::log::StdOutput* g_std_output = nullptr;
+// where results are written, or empty for stdout
+arc::io::sys::Path g_output;
+// the directory benchmark files are created in
+arc::io::sys::Path g_work_dir(std::vector<arc::str::UTF8String>(
+    1, "io_benchmark_data"));
+// the size of files read and written
+arc::uint64 g_file_size = 67108864U;
+// the number of files listed
+arc::uint64 g_tree_size = 100000U;
+// the number of times each benchmark is run
+arc::uint64 g_iterations = 3;
+// prevents benchmarked work from being optimised away
+volatile std::size_t g_sink = 0;
+
+//------------------------------------------------------------------------------
+//                                   PROTOTYPES
+//------------------------------------------------------------------------------
+
+/*!
+ * \brief Parses the command line arguments.
+ */
+int parse_args(int argc, char* argv[]);
+
+/*!
+ * \brief Runs all benchmarks and writes the results.
+ */
+int execute();
+
+/*!
+ * \brief Measures reading lines with each encoding and newline symbol.
+ */
+void benchmark_read_line(Json::Value& results);
+
+/*!
+ * \brief Measures reading a file in blocks of various sizes.
+ */
+void benchmark_read(Json::Value& results);
+
+/*!
+ * \brief Measures writing to a file with and without flushing.
+ */
+void benchmark_write(Json::Value& results);
+
+/*!
+ * \brief Measures listing a large directory tree.
+ */
+void benchmark_list(Json::Value& results);
+
+/*!
+ * \brief Measures constructing and converting paths.
+ */
+void benchmark_path(Json::Value& results);
+
+/*!
+ * \brief cleans up memory before exiting.
+ */
+void cleanup();
+
+/*!
+ * \brief Shows the help print out for this tool.
+ */
+void show_help();
+
+//------------------------------------------------------------------------------
+//                                 MAIN FUNCTION
+//------------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    // set up logging, results may be written to stdout so only errors are
+    // reported
+    g_logger = arc::log::shared_handler.vend_input(arc::log::Profile(APP_NAME));
+    g_std_output = new arc::log::StdOutput(arc::log::VERBOSITY_WARNING);
+    arc::log::shared_handler.add_output(g_std_output);
+
+    // parse arguments
+    int ret_code = parse_args(argc, argv);
+    if(ret_code != 0)
+    {
+        cleanup();
+        return ret_code;
+    }
+
+    ret_code = execute();
+
+    cleanup();
+    return ret_code;
+}
+
+//------------------------------------------------------------------------------
+//                                   FUNCTIONS
+//------------------------------------------------------------------------------
+
+/*!
+ * \brief Reads the unsigned integer value following the argument at the given
+ *        index.
+ */
+static bool parse_uint_arg(
+        int argc,
+        char* argv[],
+        std::size_t& i,
+        arc::uint64& value)
+{
+    arc::str::UTF8String arg(argv[i]);
+    if(i >= static_cast<std::size_t>(argc) - 1)
+    {
+        g_logger->critical << "Incorrect usage of argument \"" << arg
+                           << "\". It must be followed by an unsigned "
+                           << "integral number." << std::endl;
+        return false;
+    }
+
+    arc::str::UTF8String value_s(argv[++i]);
+    if(!value_s.is_uint())
+    {
+        g_logger->critical << "Incorrect usage of argument \"" << arg
+                           << "\". The provided value must be an unsigned "
+                           << "integral number, whereas \"" << value_s
+                           << "\" was given." << std::endl;
+        return false;
+    }
+    value = value_s.to_uint64();
+    return true;
+}
+
+int parse_args(int argc, char* argv[])
+{
+    std::size_t arg_count = static_cast<std::size_t>(argc);
+    for(std::size_t i = 1; i < arg_count; ++i)
+    {
+        arc::str::UTF8String arg(argv[i]);
+
+        // output
+        if(arg == ARG_OUTPUT || arg == ARG_WORK_DIR)
+        {
+            // check there is another argument
+            if(i >= arg_count - 1)
+            {
+                g_logger->critical << "Incorrect usage of argument \"" << arg
+                                   << "\". It must be followed by a path."
+                                   << std::endl;
+                return -1;
+            }
+            arc::io::sys::Path path(arc::str::UTF8String(argv[++i]));
+            if(arg == ARG_OUTPUT)
+            {
+                g_output = path;
+            }
+            else
+            {
+                g_work_dir = path;
+            }
+        }
+        // sizes
+        else if(arg == ARG_FILE_SIZE)
+        {
+            if(!parse_uint_arg(argc, argv, i, g_file_size))
+            {
+                return -1;
+            }
+        }
+        else if(arg == ARG_TREE_SIZE)
+        {
+            if(!parse_uint_arg(argc, argv, i, g_tree_size))
+            {
+                return -1;
+            }
+        }
+        else if(arg == ARG_ITERATIONS)
+        {
+            if(!parse_uint_arg(argc, argv, i, g_iterations))
+            {
+                return -1;
+            }
+            if(g_iterations == 0)
+            {
+                g_iterations = 1;
+            }
+        }
+        // help
+        else if(arg == ARG_HELP)
+        {
+            show_help();
+            return 1;
+        }
+        else
+        {
+            g_logger->critical << "Unrecognised argument: \"" << arg << "\""
+                               << std::endl;
+            show_help();
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+/*!
+ * \brief Returns the number of seconds since the given time.
+ */
+static double get_elapsed_seconds(
+        const std::chrono::steady_clock::time_point& start)
+{
+    return std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start).count();
+}
+
+/*!
+ * \brief Runs the given function once per iteration and returns the fastest
+ *        run along with the I/O it performed.
+ *
+ * The setup function is called before each run, outside of the timed section.
+ */
+template<typename SetupFunction, typename Function>
+static Measurement measure(SetupFunction setup, Function function)
+{
+    Measurement best;
+    best.seconds = -1.0;
+    for(arc::uint64 i = 0; i < g_iterations; ++i)
+    {
+        setup();
+
+        arc::io::sys::reset_global_io_stats();
+        std::chrono::steady_clock::time_point start =
+            std::chrono::steady_clock::now();
+        function();
+        double seconds = get_elapsed_seconds(start);
+
+        if(best.seconds < 0.0 || seconds < best.seconds)
+        {
+            best.seconds = seconds;
+            best.io_stats = arc::io::sys::get_global_io_stats();
+        }
+    }
+    return best;
+}
+
+/*!
+ * \brief Builds the JSON result of a benchmark.
+ *
+ * \param name The name of the benchmark.
+ * \param parameters The parameters that distinguish this result from others
+ *                   of the same benchmark.
+ * \param measurement The measurement of the benchmark.
+ * \param bytes The number of bytes processed by a single run, or 0.
+ * \param operations The number of operations performed by a single run.
+ */
+static Json::Value make_result(
+        const char* name,
+        const Json::Value& parameters,
+        const Measurement& measurement,
+        arc::uint64 bytes,
+        arc::uint64 operations)
+{
+    Json::Value result(Json::objectValue);
+    result["name"] = name;
+    result["parameters"] = parameters;
+    result["seconds"] = measurement.seconds;
+    result["operations"] = static_cast<Json::UInt64>(operations);
+
+    // guard against timer resolution
+    double seconds = measurement.seconds;
+    if(seconds <= 0.0)
+    {
+        seconds = 1e-9;
+    }
+    result["operations_per_second"] = static_cast<double>(operations) / seconds;
+    if(bytes > 0)
+    {
+        result["bytes"] = static_cast<Json::UInt64>(bytes);
+        result["megabytes_per_second"] =
+            (static_cast<double>(bytes) / 1048576.0) / seconds;
+    }
+
+    Json::Value io(Json::objectValue);
+    const arc::io::sys::IOStats& stats = measurement.io_stats;
+    io["bytes_read"] = static_cast<Json::UInt64>(stats.bytes_read);
+    io["bytes_written"] = static_cast<Json::UInt64>(stats.bytes_written);
+    io["read_calls"] = static_cast<Json::UInt64>(stats.read_calls);
+    io["write_calls"] = static_cast<Json::UInt64>(stats.write_calls);
+    io["seek_calls"] = static_cast<Json::UInt64>(stats.seek_calls);
+    io["flush_calls"] = static_cast<Json::UInt64>(stats.flush_calls);
+    io["blocked_seconds"] = static_cast<double>(stats.blocked_time) / 1e9;
+    result["io"] = io;
+
+    return result;
+}
+
+/*!
+ * \brief Returns the path of a file with the given name in the work directory.
+ */
+static arc::io::sys::Path get_work_path(const arc::str::UTF8String& name)
+{
+    arc::io::sys::Path path(g_work_dir);
+    path << name;
+    return path;
+}
+
+int execute()
+{
+    Json::Value root(Json::objectValue);
+    Json::Value results(Json::arrayValue);
+    try
+    {
+        // recreate the work directory
+        if(arc::io::sys::exists(g_work_dir))
+        {
+            arc::io::sys::delete_path_rec(g_work_dir);
+        }
+        arc::io::sys::create_directory(g_work_dir);
+
+        benchmark_read_line(results);
+        benchmark_read(results);
+        benchmark_write(results);
+        benchmark_list(results);
+        benchmark_path(results);
+
+        arc::io::sys::delete_path_rec(g_work_dir);
+    }
+    catch(const arc::ex::ArcException& e)
+    {
+        g_logger->critical << "Benchmark failed with " << e.get_type() << ": "
+                           << e.what() << std::endl;
+        return -1;
+    }
+
+    Json::Value parameters(Json::objectValue);
+    parameters["file_size"] = static_cast<Json::UInt64>(g_file_size);
+    parameters["tree_size"] = static_cast<Json::UInt64>(g_tree_size);
+    parameters["iterations"] = static_cast<Json::UInt64>(g_iterations);
+    parameters["path_operations"] = static_cast<Json::UInt64>(PATH_OPERATIONS);
+#ifdef ARC_IO_DISABLE_STATS
+    parameters["io_stats"] = false;
+#else
+    parameters["io_stats"] = true;
+#endif
+
+    root["benchmark"] = "io";
+    root["parameters"] = parameters;
+    root["results"] = results;
+
+    Json::StyledWriter json_writer;
+    std::string json(json_writer.write(root));
+    if(g_output.is_empty())
+    {
+        std::cout << json;
+    }
+    else
+    {
+        arc::io::sys::FileWriter writer(g_output);
+        writer.write(json.c_str(), json.length());
+        writer.close();
+    }
+
+    return 0;
+}
+
+void benchmark_read_line(Json::Value& results)
+{
+    const arc::io::sys::FileHandle::Encoding encodings[] = {
+        arc::io::sys::FileHandle::ENCODING_UTF8,
+        arc::io::sys::FileHandle::ENCODING_UTF16_LITTLE_ENDIAN,
+        arc::io::sys::FileHandle::ENCODING_UTF16_BIG_ENDIAN
+    };
+    const char* encoding_names[] = {"utf8", "utf16_le", "utf16_be"};
+    const arc::io::sys::FileHandle::Newline newlines[] = {
+        arc::io::sys::FileHandle::NEWLINE_UNIX,
+        arc::io::sys::FileHandle::NEWLINE_WINDOWS
+    };
+    const char* newline_names[] = {"unix", "windows"};
+
+    // mostly ASCII with some multi-byte symbols, as most text files are
+    const arc::str::UTF8String line(
+        "The quick brown fox jumps over the lazy dog - Ünïcödé ✓"
+    );
+    const arc::uint64 line_count = g_file_size / (line.get_byte_length() + 1);
+    const arc::io::sys::Path path(get_work_path("read_line.txt"));
+
+    for(std::size_t e = 0; e < 3; ++e)
+    {
+        for(std::size_t n = 0; n < 2; ++n)
+        {
+            {
+                arc::io::sys::FileWriter writer(
+                    arc::io::sys::FileWriter::OPEN_TRUNCATE,
+                    encodings[e],
+                    newlines[n]
+                );
+                writer.set_buffer_size(65536);
+                writer.open(path);
+                for(arc::uint64 i = 0; i < line_count; ++i)
+                {
+                    writer.write_line(line, false);
+                }
+            }
+
+            arc::uint64 bytes = 0;
+            arc::uint64 lines = 0;
+            Measurement measurement = measure(
+                []() {},
+                [&]()
+                {
+                    arc::io::sys::FileReader reader(
+                        path,
+                        encodings[e],
+                        newlines[n]
+                    );
+                    bytes = static_cast<arc::uint64>(reader.get_size());
+                    lines = 0;
+                    arc::str::UTF8String data;
+                    try
+                    {
+                        while(true)
+                        {
+                            reader.read_line(data);
+                            ++lines;
+                        }
+                    }
+                    catch(const arc::ex::EOFError&)
+                    {
+                    }
+                }
+            );
+
+            Json::Value parameters(Json::objectValue);
+            parameters["encoding"] = encoding_names[e];
+            parameters["newline"] = newline_names[n];
+            results.append(
+                make_result("read_line", parameters, measurement, bytes, lines)
+            );
+        }
+    }
+
+    arc::io::sys::delete_path(path);
+}
+
+void benchmark_read(Json::Value& results)
+{
+    const arc::io::sys::Path path(get_work_path("read.bin"));
+
+    // write the file to read
+    std::vector<char> block(1048576);
+    for(std::size_t i = 0; i < block.size(); ++i)
+    {
+        block[i] = static_cast<char>(i * 31);
+    }
+    {
+        arc::io::sys::FileWriter writer(path);
+        for(arc::uint64 i = 0; i < g_file_size; i += block.size())
+        {
+            std::size_t length = static_cast<std::size_t>(std::min(
+                static_cast<arc::uint64>(block.size()),
+                g_file_size - i
+            ));
+            writer.write(&block[0], length, false);
+        }
+    }
+
+    const std::size_t block_sizes[] = {4096, 65536, 1048576};
+    for(std::size_t b = 0; b < 3; ++b)
+    {
+        const std::size_t block_size = block_sizes[b];
+        arc::uint64 reads = 0;
+        Measurement measurement = measure(
+            []() {},
+            [&]()
+            {
+                arc::io::sys::FileReader reader(
+                    path,
+                    arc::io::sys::FileHandle::ENCODING_RAW
+                );
+                reads = 0;
+                for(arc::uint64 i = 0; i < g_file_size; i += block_size)
+                {
+                    arc::int64 length = static_cast<arc::int64>(std::min(
+                        static_cast<arc::uint64>(block_size),
+                        g_file_size - i
+                    ));
+                    reader.read(&block[0], length);
+                    ++reads;
+                }
+            }
+        );
+
+        Json::Value parameters(Json::objectValue);
+        parameters["block_size"] = static_cast<Json::UInt64>(block_size);
+        results.append(
+            make_result("read", parameters, measurement, g_file_size, reads)
+        );
+    }
+
+    arc::io::sys::delete_path(path);
+}
+
+void benchmark_write(Json::Value& results)
+{
+    const arc::io::sys::Path path(get_work_path("write.bin"));
+    // flushing every write is much slower, so less data is written
+    const arc::uint64 total_size = g_file_size / 8;
+
+    std::vector<char> block(4096, 'a');
+    const std::size_t block_sizes[] = {64, 4096};
+    for(std::size_t b = 0; b < 2; ++b)
+    {
+        for(std::size_t f = 0; f < 2; ++f)
+        {
+            const std::size_t block_size = block_sizes[b];
+            const bool flush = f == 1;
+            arc::uint64 writes = 0;
+            Measurement measurement = measure(
+                [&]()
+                {
+                    if(arc::io::sys::exists(path))
+                    {
+                        arc::io::sys::delete_path(path);
+                    }
+                },
+                [&]()
+                {
+                    arc::io::sys::FileWriter writer(path);
+                    writes = 0;
+                    for(arc::uint64 i = 0; i < total_size; i += block_size)
+                    {
+                        writer.write(&block[0], block_size, flush);
+                        ++writes;
+                    }
+                    writer.close();
+                }
+            );
+
+            Json::Value parameters(Json::objectValue);
+            parameters["block_size"] = static_cast<Json::UInt64>(block_size);
+            parameters["flush"] = flush;
+            results.append(make_result(
+                "write",
+                parameters,
+                measurement,
+                writes * block_size,
+                writes
+            ));
+        }
+    }
+
+    arc::io::sys::delete_path(path);
+}
+
+void benchmark_list(Json::Value& results)
+{
+    arc::io::sys::Path root(get_work_path("tree"));
+
+    // build the tree, this is timed as well since it is mostly file creation
+    std::vector<arc::io::sys::Path> directories;
+    std::chrono::steady_clock::time_point start =
+        std::chrono::steady_clock::now();
+    arc::io::sys::reset_global_io_stats();
+    arc::io::sys::create_directory(root);
+    for(arc::uint64 i = 0; i < g_tree_size; ++i)
+    {
+        if(i % TREE_DIRECTORY_SIZE == 0)
+        {
+            arc::io::sys::Path directory(root);
+            directory << (arc::str::UTF8String("dir_") << directories.size());
+            arc::io::sys::create_directory(directory);
+            directories.push_back(directory);
+        }
+        arc::io::sys::Path file(directories.back());
+        file << (arc::str::UTF8String("file_") << i);
+        arc::io::sys::FileWriter writer(file);
+    }
+    Measurement creation;
+    creation.seconds = get_elapsed_seconds(start);
+    creation.io_stats = arc::io::sys::get_global_io_stats();
+    const arc::uint64 entry_count = g_tree_size + directories.size();
+
+    Json::Value parameters(Json::objectValue);
+    parameters["tree_size"] = static_cast<Json::UInt64>(g_tree_size);
+    results.append(
+        make_result("create_tree", parameters, creation, 0, entry_count)
+    );
+
+    arc::uint64 listed = 0;
+    Measurement measurement = measure(
+        []() {},
+        [&]()
+        {
+            listed = 0;
+            ARC_FOR_EACH(directory, directories)
+            {
+                listed += arc::io::sys::list(*directory).size();
+            }
+        }
+    );
+    results.append(make_result("list", parameters, measurement, 0, listed));
+
+    measurement = measure(
+        []() {},
+        [&]()
+        {
+            listed = arc::io::sys::list_rec(root).size();
+        }
+    );
+    results.append(make_result("list_rec", parameters, measurement, 0, listed));
+
+    start = std::chrono::steady_clock::now();
+    arc::io::sys::delete_path_rec(root);
+    Measurement deletion;
+    deletion.seconds = get_elapsed_seconds(start);
+    results.append(
+        make_result("delete_tree", parameters, deletion, 0, entry_count)
+    );
+}
+
+void benchmark_path(Json::Value& results)
+{
+    const arc::str::UTF8String string_path(
+        "projects/arcane/resources/textures/environment/sky_box.png");
+    std::vector<arc::str::UTF8String> components;
+    components.push_back("projects");
+    components.push_back("arcane");
+    components.push_back("resources");
+    components.push_back("textures");
+    components.push_back("environment");
+    components.push_back("sky_box.png");
+    Json::Value parameters(Json::objectValue);
+    parameters["components"] = static_cast<Json::UInt64>(components.size());
+
+    Measurement measurement = measure(
+        []() {},
+        [&]()
+        {
+            for(std::size_t i = 0; i < PATH_OPERATIONS; ++i)
+            {
+                arc::io::sys::Path path(string_path);
+                g_sink = g_sink + path.get_length();
+            }
+        }
+    );
+    results.append(make_result(
+        "path_from_string",
+        parameters,
+        measurement,
+        0,
+        PATH_OPERATIONS
+    ));
+
+    measurement = measure(
+        []() {},
+        [&]()
+        {
+            for(std::size_t i = 0; i < PATH_OPERATIONS; ++i)
+            {
+                arc::io::sys::Path path;
+                ARC_FOR_EACH(component, components)
+                {
+                    path << *component;
+                }
+                g_sink = g_sink + path.get_length();
+            }
+        }
+    );
+    results.append(make_result(
+        "path_join",
+        parameters,
+        measurement,
+        0,
+        PATH_OPERATIONS
+    ));
+
+    const arc::io::sys::Path path(components);
+    measurement = measure(
+        []() {},
+        [&]()
+        {
+            for(std::size_t i = 0; i < PATH_OPERATIONS; ++i)
+            {
+                g_sink = g_sink + path.to_unix().get_byte_length();
+            }
+        }
+    );
+    results.append(make_result(
+        "path_to_unix",
+        parameters,
+        measurement,
+        0,
+        PATH_OPERATIONS
+    ));
+}
+
+void cleanup()
+{
+    arc::log::shared_handler.remove_output(g_std_output);
+    arc::log::shared_handler.remove_input(g_logger);
+}
+
+void show_help()
+{
+    arc::str::UTF8String divider("=");
+    divider *= 80;
+
+    std::cout << divider << std::endl;
+    std::cout << APP_NAME << std::endl;
+    std::cout << divider << std::endl;
+    std::cout << "Arguments:" << std::endl;
+    std::cout << "----------\n" << std::endl;
+    std::cout << ARG_HELP << ": Displays this help and exits.\n" << std::endl;
+    std::cout << ARG_OUTPUT << ": The path to write the JSON results to. "
+              << "Defaults to writing the\n          results to stdout.\n"
+              << std::endl;
+    std::cout << ARG_WORK_DIR << ": The directory benchmark files are created "
+              << "in, this is deleted\n            once the benchmark is "
+              << "complete. Defaults to \"io_benchmark_data\".\n" << std::endl;
+    std::cout << ARG_FILE_SIZE << ": The size in bytes of the files that are "
+              << "read and written.\n             Defaults to 67108864.\n"
+              << std::endl;
+    std::cout << ARG_TREE_SIZE << ": The number of files in the directory tree "
+              << "that is listed.\n             Defaults to 100000.\n"
+              << std::endl;
+    std::cout << ARG_ITERATIONS << ": The number of times each benchmark is "
+              << "run, the fastest run\n              is reported. Defaults to "
+              << "3." << std::endl;
+}
+
+#endif
+// IN_DOXYGEN
@@ -9,7 +9,7 @@ namespace io
 namespace dl
 {
 
-Handle open_library(const arc::io::sys::Path& path)
+Handle open_library(const arc::io::sys::Path& path, BindMode bind_mode)
 {
     if(!arc::io::sys::exists(path))
     {
@@ -36,7 +36,12 @@ Handle open_library(const arc::io::sys::Path& path)
     #elif defined(ARC_OS_UNIX)
 
         // get the handle
-        handle = dlopen(path.to_native().get_raw(), RTLD_LAZY);
+        int flags = RTLD_LAZY;
+        if(bind_mode == BIND_NOW)
+        {
+            flags = RTLD_NOW;
+        }
+        handle = dlopen(path.to_native().get_raw(), flags);
         if(handle == nullptr)
         {
             throw arc::ex::DynamicLinkError(dlerror());
@@ -44,17 +44,43 @@ namespace dl
  */
 typedef void* Handle;
 
+//------------------------------------------------------------------------------
+//                                   ENUMERATOR
+//------------------------------------------------------------------------------
+
+/*!
+ * \brief When the functions a dynamic library references are bound.
+ */
+enum BindMode
+{
+    /// Functions are bound the first time they are called.
+    BIND_LAZY = 0,
+    /// All functions are bound when the library is opened, so missing
+    /// dependencies are reported immediately rather than on first use.
+    BIND_NOW
+};
+
+//------------------------------------------------------------------------------
+//                                   FUNCTIONS
+//------------------------------------------------------------------------------
+
 /*!
  * \brief Opens the dynamic library at the given location.
  *
+ * \note The bind mode is ignored on Windows, which always binds when the
+ *       library is loaded.
+ *
  * \param path The path to the library.
+ * \param bind_mode When the functions referenced by the library are bound.
  * \return The handle for the loaded library.
  *
  * \throws arc::ex::IOError If the given path does not exist.
  * \throws arc::ex::DynamicLinkError If the file cannot be opened as a dynamic
  *                                   library.
  */
-Handle open_library(const arc::io::sys::Path& path);
+Handle open_library(
+        const arc::io::sys::Path& path,
+        BindMode bind_mode = BIND_LAZY);
 
 /*!
  * \brief Closes the library pointed to be the given handle.
@@ -0,0 +1,508 @@
+#include "arcanecore/io/dl/Library.hpp"
+
+#include <mutex>
+#include <unordered_map>
+
+#include "arcanecore/io/sys/DirEntry.hpp"
+#include "arcanecore/io/sys/PathAtom.hpp"
+
+#ifdef ARC_OS_LINUX
+    #include <link.h>
+#endif
+
+namespace arc
+{
+namespace io
+{
+namespace dl
+{
+
+//------------------------------------------------------------------------------
+//                                    OBJECTS
+//------------------------------------------------------------------------------
+
+/*!
+ * \brief The remembered symbol offsets of a library file.
+ */
+struct PrelinkEntry
+{
+    //----------------------------PUBLIC ATTRIBUTES-----------------------------
+    // used to detect whether the file has changed since the offsets were
+    // recorded
+    arc::uint64 inode;
+    arc::int64 size;
+    arc::uint64 modified_time;
+    std::unordered_map<arc::str::UTF8String, std::size_t> offsets;
+    //-------------------------------CONSTRUCTOR--------------------------------
+    PrelinkEntry()
+        :
+        inode        (0),
+        size         (0),
+        modified_time(0)
+    {
+    }
+};
+
+/*!
+ * \brief The state shared by every Library opened to the same path.
+ */
+struct LibraryData
+{
+    //----------------------------PUBLIC ATTRIBUTES-----------------------------
+    arc::io::sys::PathAtom path;
+    Handle handle;
+    // the address symbol offsets are relative to, or 0 if prelinking is not
+    // being used
+    std::size_t base_address;
+    std::mutex mutex;
+    std::unordered_map<arc::str::UTF8String, void*> symbols;
+    //-------------------------------CONSTRUCTOR--------------------------------
+    LibraryData(const arc::io::sys::PathAtom& _path, Handle _handle)
+        :
+        path        (_path),
+        handle      (_handle),
+        base_address(0)
+    {
+    }
+    //--------------------------------DESTRUCTOR--------------------------------
+    ~LibraryData();
+};
+
+//------------------------------------------------------------------------------
+//                                    GLOBALS
+//------------------------------------------------------------------------------
+
+/*!
+ * \brief Protects the open libraries and prelink tables.
+ */
+static std::mutex& get_registry_mutex()
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
+/*!
+ * \brief The libraries that are currently open, by path.
+ */
+static std::unordered_map<arc::io::sys::PathAtom, std::weak_ptr<LibraryData>>&
+    get_open_libraries()
+{
+    static std::unordered_map<
+        arc::io::sys::PathAtom,
+        std::weak_ptr<LibraryData>
+    > open_libraries;
+    return open_libraries;
+}
+
+/*!
+ * \brief The remembered symbol offsets of each library file that has been
+ *        opened with prelinking.
+ */
+static std::unordered_map<arc::io::sys::PathAtom, PrelinkEntry>&
+    get_prelink_entries()
+{
+    static std::unordered_map<arc::io::sys::PathAtom, PrelinkEntry> entries;
+    return entries;
+}
+
+//------------------------------------------------------------------------------
+//                               STATIC FUNCTIONS
+//------------------------------------------------------------------------------
+
+/*!
+ * \brief Returns the address symbol offsets are measured from for the given
+ *        handle, or ```0``` if it cannot be determined.
+ */
+static std::size_t get_base_address(Handle handle)
+{
+#ifdef ARC_OS_LINUX
+
+    struct link_map* map = nullptr;
+    if(dlinfo(handle, RTLD_DI_LINKMAP, &map) != 0 || map == nullptr)
+    {
+        return 0;
+    }
+    return static_cast<std::size_t>(map->l_addr);
+
+#else
+
+    return 0;
+
+#endif
+}
+
+/*!
+ * \brief Returns whether the given address belongs to the file of the library
+ *        with the given base address, rather than one of its dependencies.
+ */
+static bool is_in_library(void* address, std::size_t base_address)
+{
+#ifdef ARC_OS_LINUX
+
+    Dl_info info;
+    if(dladdr(address, &info) == 0)
+    {
+        return false;
+    }
+    return reinterpret_cast<std::size_t>(info.dli_fbase) == base_address;
+
+#else
+
+    return false;
+
+#endif
+}
+
+/*!
+ * \brief Returns the remembered offsets of the given library file, which are
+ *        discarded first if the file has changed since they were recorded.
+ *
+ * \note The registry mutex must be held.
+ */
+static PrelinkEntry& get_prelink_entry(const arc::io::sys::PathAtom& path)
+{
+    PrelinkEntry& entry = get_prelink_entries()[path];
+
+    arc::io::sys::DirEntry file(path.get_path());
+    if(entry.inode != file.get_inode() ||
+       entry.size != file.get_size() ||
+       entry.modified_time != file.get_modified_time())
+    {
+        entry.inode = file.get_inode();
+        entry.size = file.get_size();
+        entry.modified_time = file.get_modified_time();
+        entry.offsets.clear();
+    }
+    return entry;
+}
+
+/*!
+ * \brief Returns the shared data for the given library path, opening the
+ *        library if no Library is currently using it.
+ */
+static std::shared_ptr<LibraryData> acquire_library(
+        const arc::io::sys::Path& path,
+        BindMode bind_mode,
+        bool prelink)
+{
+    arc::io::sys::PathAtom atom(path);
+
+    std::lock_guard<std::mutex> lock(get_registry_mutex());
+    std::weak_ptr<LibraryData>& open = get_open_libraries()[atom];
+
+    std::shared_ptr<LibraryData> data(open.lock());
+    if(!data)
+    {
+        data.reset(new LibraryData(atom, open_library(path, bind_mode)));
+        open = data;
+    }
+
+    std::lock_guard<std::mutex> data_lock(data->mutex);
+    if(prelink && data->base_address == 0)
+    {
+        std::size_t base_address = get_base_address(data->handle);
+        // the offsets can't be trusted if the file can't be checked for
+        // changes
+        PrelinkEntry* entry = nullptr;
+        try
+        {
+            entry = &get_prelink_entry(atom);
+        }
+        catch(const arc::ex::IOError&)
+        {
+            base_address = 0;
+        }
+
+        if(base_address != 0)
+        {
+            // bind all known symbols up front so that the lookups of this
+            // library don't need the registry lock
+            data->base_address = base_address;
+            ARC_FOR_EACH(offset, entry->offsets)
+            {
+                data->symbols[offset->first] = reinterpret_cast<void*>(
+                    base_address + offset->second);
+            }
+        }
+    }
+
+    return data;
+}
+
+/*!
+ * \brief Returns the named symbol from the given shared library data, looking
+ *        it up in the library if it has not been bound before.
+ */
+static void* bind_shared(LibraryData& data, const arc::str::UTF8String& name)
+{
+    std::size_t base_address = 0;
+    {
+        std::lock_guard<std::mutex> lock(data.mutex);
+        auto cached = data.symbols.find(name);
+        if(cached != data.symbols.end())
+        {
+            return cached->second;
+        }
+        base_address = data.base_address;
+    }
+
+    void* address = bind_symbol<void>(data.handle, name);
+
+    {
+        std::lock_guard<std::mutex> lock(data.mutex);
+        data.symbols[name] = address;
+    }
+
+    // remember the offset of symbols that belong to the library itself,
+    // symbols found in its dependencies may not move along with it
+    if(base_address != 0 && is_in_library(address, base_address))
+    {
+        std::lock_guard<std::mutex> lock(get_registry_mutex());
+        get_prelink_entries()[data.path].offsets[name] =
+            reinterpret_cast<std::size_t>(address) - base_address;
+    }
+
+    return address;
+}
+
+//------------------------------------------------------------------------------
+//                                   DESTRUCTOR
+//------------------------------------------------------------------------------
+
+LibraryData::~LibraryData()
+{
+    {
+        std::lock_guard<std::mutex> lock(get_registry_mutex());
+        // another Library may have opened the path again since the last
+        // reference to this data was released
+        auto open = get_open_libraries().find(path);
+        if(open != get_open_libraries().end() && open->second.expired())
+        {
+            get_open_libraries().erase(open);
+        }
+    }
+
+    try
+    {
+        close_library(handle);
+    }
+    catch(...)
+    {
+        // there's no one to report the failure to
+    }
+}
+
+//------------------------------------------------------------------------------
+//                                  CONSTRUCTORS
+//------------------------------------------------------------------------------
+
+Library::Library()
+    :
+    m_bind_mode(BIND_LAZY),
+    m_prelink  (false)
+{
+}
+
+Library::Library(
+        const arc::io::sys::Path& path,
+        BindMode bind_mode,
+        bool prelink)
+    :
+    m_bind_mode(bind_mode),
+    m_prelink  (prelink)
+{
+    open(path, bind_mode, prelink);
+}
+
+Library::Library(const Library& other)
+    :
+    m_data     (other.m_data),
+    m_path     (other.m_path),
+    m_bind_mode(other.m_bind_mode),
+    m_prelink  (other.m_prelink),
+    m_names    (other.m_names),
+    m_symbols  (other.m_symbols)
+{
+}
+
+Library::Library(Library&& other)
+    :
+    m_data     (std::move(other.m_data)),
+    m_path     (std::move(other.m_path)),
+    m_bind_mode(other.m_bind_mode),
+    m_prelink  (other.m_prelink),
+    m_names    (std::move(other.m_names)),
+    m_symbols  (std::move(other.m_symbols))
+{
+}
+
+//------------------------------------------------------------------------------
+//                                   DESTRUCTOR
+//------------------------------------------------------------------------------
+
+Library::~Library()
+{
+}
+
+//------------------------------------------------------------------------------
+//                                   OPERATORS
+//------------------------------------------------------------------------------
+
+Library& Library::operator=(const Library& other)
+{
+    m_data      = other.m_data;
+    m_path      = other.m_path;
+    m_bind_mode = other.m_bind_mode;
+    m_prelink   = other.m_prelink;
+    m_names     = other.m_names;
+    m_symbols   = other.m_symbols;
+
+    return *this;
+}
+
+Library& Library::operator=(Library&& other)
+{
+    m_data      = std::move(other.m_data);
+    m_path      = std::move(other.m_path);
+    m_bind_mode = other.m_bind_mode;
+    m_prelink   = other.m_prelink;
+    m_names     = std::move(other.m_names);
+    m_symbols   = std::move(other.m_symbols);
+
+    return *this;
+}
+
+//------------------------------------------------------------------------------
+//                            PUBLIC MEMBER FUNCTIONS
+//------------------------------------------------------------------------------
+
+bool Library::is_open() const
+{
+    return static_cast<bool>(m_data);
+}
+
+const arc::io::sys::Path& Library::get_path() const
+{
+    return m_path;
+}
+
+Handle Library::get_handle() const
+{
+    if(!m_data)
+    {
+        return nullptr;
+    }
+    return m_data->handle;
+}
+
+std::size_t Library::get_reference_count() const
+{
+    return static_cast<std::size_t>(m_data.use_count());
+}
+
+void Library::open(
+        const arc::io::sys::Path& path,
+        BindMode bind_mode,
+        bool prelink)
+{
+    if(m_data)
+    {
+        throw arc::ex::StateError(
+            "Library cannot be opened since it is already open.");
+    }
+
+    std::shared_ptr<LibraryData> data(
+        acquire_library(path, bind_mode, prelink));
+    m_path = path;
+    m_bind_mode = bind_mode;
+    m_prelink = prelink;
+
+    // bind the declared symbols, reporting all missing symbols at once
+    std::vector<void*> symbols(m_names.size(), nullptr);
+    arc::str::UTF8String missing;
+    for(std::size_t i = 0; i < m_names.size(); ++i)
+    {
+        try
+        {
+            symbols[i] = bind_shared(*data, m_names[i]);
+        }
+        catch(const arc::ex::DynamicLinkError&)
+        {
+            if(!missing.is_empty())
+            {
+                missing << ", ";
+            }
+            missing << "\"" << m_names[i] << "\"";
+        }
+    }
+    if(!missing.is_empty())
+    {
+        arc::str::UTF8String error_message;
+        error_message << "Failed to bind symbols from library \"" << path
+                      << "\": " << missing;
+        throw arc::ex::DynamicLinkError(error_message);
+    }
+
+    m_data = data;
+    m_symbols.swap(symbols);
+}
+
+void Library::close()
+{
+    m_data.reset();
+    m_symbols.assign(m_symbols.size(), nullptr);
+}
+
+void Library::reload()
+{
+    if(m_path.is_empty())
+    {
+        throw arc::ex::StateError(
+            "Library cannot be reloaded since it has never been opened.");
+    }
+
+    close();
+    // copy since open assigns the path
+    arc::io::sys::Path path(m_path);
+    open(path, m_bind_mode, m_prelink);
+}
+
+//------------------------------------------------------------------------------
+//                            PRIVATE MEMBER FUNCTIONS
+//------------------------------------------------------------------------------
+
+std::size_t Library::declare(const arc::str::UTF8String& name)
+{
+    void* address = bind(name);
+    m_names.push_back(name);
+    m_symbols.push_back(address);
+    return m_names.size() - 1;
+}
+
+void* Library::bind(const arc::str::UTF8String& name)
+{
+    if(!m_data)
+    {
+        throw arc::ex::StateError(
+            "Symbols cannot be bound since the Library is not open.");
+    }
+    return bind_shared(*m_data, name);
+}
+
+void Library::throw_bad_index(std::size_t index) const
+{
+    arc::str::UTF8String error_message;
+    error_message << "Symbol index " << index << " was not declared by this "
+                  << "Library which has " << m_symbols.size() << " symbols.";
+    throw arc::ex::IndexOutOfBoundsError(error_message);
+}
+
+void Library::throw_not_open() const
+{
+    throw arc::ex::StateError(
+        "Symbols cannot be retrieved since the Library is not open.");
+}
+
+} // namespace dl
+} // namespace io
+} // namespace arc
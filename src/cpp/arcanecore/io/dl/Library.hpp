@@ -0,0 +1,372 @@
+/*!
+ * \file
+ * \author David Saxon
+ */
+#ifndef ARCANECORE_IO_DL_LIBRARY_HPP_
+#define ARCANECORE_IO_DL_LIBRARY_HPP_
+
+#include <memory>
+#include <vector>
+
+#include "arcanecore/base/lang/Restrictors.hpp"
+#include "arcanecore/io/dl/DLOperations.hpp"
+
+namespace arc
+{
+namespace io
+{
+namespace dl
+{
+
+//------------------------------------------------------------------------------
+//                              FORWARD DECLARATIONS
+//------------------------------------------------------------------------------
+
+struct LibraryData;
+
+/*!
+ * \brief An open dynamic library along with a table of the symbols bound from
+ *        it.
+ *
+ * Symbols are declared once with declare_symbol(), which binds the symbol and
+ * returns a typed index into the symbol table of the Library. Retrieving the
+ * symbol with get_symbol() is then only an array lookup. When the Library is
+ * reopened, for example with reload(), every declared symbol is bound again
+ * so the indices remain valid.
+ *
+ * All Library objects opened to the same path share a single handle to the
+ * library, which is only closed once every Library using it has been closed
+ * or destroyed. Symbols bound through a shared handle are cached so that each
+ * symbol is only looked up once however many Library objects use it.
+ *
+ * If a Library is opened with prelinking enabled, the offset of each symbol
+ * from the base address of the library is remembered for the remainder of the
+ * process. If the same unmodified file is opened again after being unloaded,
+ * its symbols are bound from these offsets without being looked up.
+ * Prelinking is currently only supported on Linux, and is ignored on other
+ * platforms.
+ *
+ * \par Example Usage
+ *
+ * \code
+ * arc::io::dl::Library library(plugin_path, arc::io::dl::BIND_NOW);
+ * arc::io::dl::Library::Symbol<int(int, int)> add =
+ *     library.declare_symbol<int(int, int)>("add");
+ *
+ * int result = library.get_symbol(add)(1, 2);
+ *
+ * // after the plugin has been rebuilt
+ * library.reload();
+ * result = library.get_symbol(add)(1, 2);
+ * \endcode
+ */
+class Library : private arc::lang::Noncomparable
+{
+public:
+
+    //--------------------------------------------------------------------------
+    //                                  CLASSES
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief The typed index of a symbol declared with declare_symbol().
+     *
+     * \tparam SymbolType The type of the symbol.
+     */
+    template<typename SymbolType>
+    class Symbol
+    {
+    private:
+
+        friend class Library;
+
+    public:
+
+        //-------------------------------CONSTRUCTOR----------------------------
+
+        /*!
+         * \brief Creates a Symbol that does not refer to any declared symbol.
+         */
+        Symbol()
+            : m_index(static_cast<std::size_t>(-1))
+        {
+        }
+
+    private:
+
+        //----------------------------PRIVATE ATTRIBUTES------------------------
+
+        /*!
+         * \brief The index of the symbol in the table of the Library.
+         */
+        std::size_t m_index;
+    };
+
+    //--------------------------------------------------------------------------
+    //                                CONSTRUCTORS
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief Creates a new Library that is not open.
+     */
+    Library();
+
+    /*!
+     * \brief Creates a new Library and opens it to the given path.
+     *
+     * \param path The path to the dynamic library.
+     * \param bind_mode When the functions referenced by the library are
+     *                  bound. This is ignored if another Library has already
+     *                  opened the same path.
+     * \param prelink Whether the offsets of bound symbols should be
+     *                remembered to bind them again when the library is
+     *                reopened.
+     *
+     * \throws arc::ex::IOError If the given path does not exist.
+     * \throws arc::ex::DynamicLinkError If the file cannot be opened as a
+     *                                   dynamic library.
+     */
+    Library(
+            const arc::io::sys::Path& path,
+            BindMode bind_mode = BIND_LAZY,
+            bool prelink = false);
+
+    /*!
+     * \brief Copy constructor.
+     *
+     * The new Library shares the handle of the other Library, and has a copy
+     * of its symbol table.
+     */
+    Library(const Library& other);
+
+    /*!
+     * \brief Move constructor.
+     */
+    Library(Library&& other);
+
+    //--------------------------------------------------------------------------
+    //                                 DESTRUCTOR
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief Closes this Library.
+     */
+    ~Library();
+
+    //--------------------------------------------------------------------------
+    //                                 OPERATORS
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief Copy assignment operator.
+     *
+     * Closes this Library and shares the handle of the other Library, along
+     * with a copy of its symbol table.
+     */
+    Library& operator=(const Library& other);
+
+    /*!
+     * \brief Move assignment operator.
+     */
+    Library& operator=(Library&& other);
+
+    //--------------------------------------------------------------------------
+    //                          PUBLIC MEMBER FUNCTIONS
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief Returns whether this Library is open.
+     */
+    bool is_open() const;
+
+    /*!
+     * \brief Returns the path of the library this Library was last opened to.
+     */
+    const arc::io::sys::Path& get_path() const;
+
+    /*!
+     * \brief Returns the handle to the loaded library, or ```nullptr``` if
+     *        this Library is not open.
+     */
+    Handle get_handle() const;
+
+    /*!
+     * \brief Returns the number of Library objects sharing the handle of this
+     *        Library, or ```0``` if this Library is not open.
+     */
+    std::size_t get_reference_count() const;
+
+    /*!
+     * \brief Opens this Library to the given path and binds all symbols that
+     *        have been declared.
+     *
+     * \param path The path to the dynamic library.
+     * \param bind_mode When the functions referenced by the library are
+     *                  bound. This is ignored if another Library has already
+     *                  opened the same path.
+     * \param prelink Whether the offsets of bound symbols should be
+     *                remembered to bind them again when the library is
+     *                reopened.
+     *
+     * \throws arc::ex::StateError If this Library is already open.
+     * \throws arc::ex::IOError If the given path does not exist.
+     * \throws arc::ex::DynamicLinkError If the file cannot be opened as a
+     *                                   dynamic library, or any declared
+     *                                   symbol cannot be bound. In either case
+     *                                   this Library is left closed.
+     */
+    void open(
+            const arc::io::sys::Path& path,
+            BindMode bind_mode = BIND_LAZY,
+            bool prelink = false);
+
+    /*!
+     * \brief Closes this Library.
+     *
+     * The library is only unloaded once every Library sharing its handle has
+     * been closed. Declared symbols are kept so that they can be bound again
+     * if this Library is reopened.
+     */
+    void close();
+
+    /*!
+     * \brief Closes and reopens this Library with the path and options it was
+     *        last opened with, binding all declared symbols again.
+     *
+     * \note The library is only actually reloaded from disk if no other
+     *       Library shares its handle.
+     *
+     * \throws arc::ex::StateError If this Library has never been opened.
+     * \throws arc::ex::IOError If the path no longer exists.
+     * \throws arc::ex::DynamicLinkError If the library or any declared symbol
+     *                                   cannot be loaded.
+     */
+    void reload();
+
+    /*!
+     * \brief Binds the symbol with the given name and adds it to the symbol
+     *        table of this Library.
+     *
+     * \tparam SymbolType The type of the symbol.
+     *
+     * \param name The name of the symbol to bind.
+     *
+     * \return The index used to retrieve the symbol with get_symbol().
+     *
+     * \throws arc::ex::StateError If this Library is not open.
+     * \throws arc::ex::DynamicLinkError If the symbol cannot be bound.
+     */
+    template<typename SymbolType>
+    Symbol<SymbolType> declare_symbol(const arc::str::UTF8String& name)
+    {
+        Symbol<SymbolType> symbol;
+        symbol.m_index = declare(name);
+        return symbol;
+    }
+
+    /*!
+     * \brief Returns a symbol from the symbol table of this Library.
+     *
+     * \throws arc::ex::StateError If this Library is not open.
+     * \throws arc::ex::IndexOutOfBoundsError If the symbol was not declared by
+     *                                        this Library.
+     */
+    template<typename SymbolType>
+    SymbolType* get_symbol(const Symbol<SymbolType>& symbol) const
+    {
+        if(symbol.m_index >= m_symbols.size())
+        {
+            throw_bad_index(symbol.m_index);
+        }
+        void* address = m_symbols[symbol.m_index];
+        if(address == nullptr)
+        {
+            throw_not_open();
+        }
+        return reinterpret_cast<SymbolType*>(
+            reinterpret_cast<intptr_t>(address)
+        );
+    }
+
+    /*!
+     * \brief Binds the symbol with the given name without adding it to the
+     *        symbol table of this Library.
+     *
+     * Symbols are cached by the handle shared between Library objects, so
+     * binding the same symbol again does not look it up in the library.
+     *
+     * \throws arc::ex::StateError If this Library is not open.
+     * \throws arc::ex::DynamicLinkError If the symbol cannot be bound.
+     */
+    template<typename SymbolType>
+    SymbolType* bind_symbol(const arc::str::UTF8String& name)
+    {
+        return reinterpret_cast<SymbolType*>(
+            reinterpret_cast<intptr_t>(bind(name))
+        );
+    }
+
+private:
+
+    //--------------------------------------------------------------------------
+    //                             PRIVATE ATTRIBUTES
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief The data shared by all Library objects opened to the same path,
+     *        or null if this Library is not open.
+     */
+    std::shared_ptr<LibraryData> m_data;
+    /*!
+     * \brief The path this Library was last opened to.
+     */
+    arc::io::sys::Path m_path;
+    /*!
+     * \brief The bind mode this Library was last opened with.
+     */
+    BindMode m_bind_mode;
+    /*!
+     * \brief Whether this Library was last opened with prelinking.
+     */
+    bool m_prelink;
+    /*!
+     * \brief The names of the declared symbols.
+     */
+    std::vector<arc::str::UTF8String> m_names;
+    /*!
+     * \brief The addresses of the declared symbols, which are null while this
+     *        Library is closed.
+     */
+    std::vector<void*> m_symbols;
+
+    //--------------------------------------------------------------------------
+    //                          PRIVATE MEMBER FUNCTIONS
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief Binds the given symbol and adds it to the symbol table, returning
+     *        its index.
+     */
+    std::size_t declare(const arc::str::UTF8String& name);
+
+    /*!
+     * \brief Binds the given symbol through the shared handle.
+     */
+    void* bind(const arc::str::UTF8String& name);
+
+    /*!
+     * \brief Throws the error for an index that is not in the symbol table.
+     */
+    void throw_bad_index(std::size_t index) const;
+
+    /*!
+     * \brief Throws the error for retrieving a symbol while not open.
+     */
+    void throw_not_open() const;
+};
+
+} // namespace dl
+} // namespace io
+} // namespace arc
+
+#endif
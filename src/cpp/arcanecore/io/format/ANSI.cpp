@@ -15,44 +15,59 @@ void apply_escape_sequence(
         arc::str::UTF8String& text,
         ANSIColour              colour,
         ANSIAttribute           attribute)
+{
+    arc::str::UTF8StringBuilder r;
+    begin_escape_sequence(r, colour, attribute);
+    // write the string and closing sequence
+    r << text;
+    end_escape_sequence(r);
+    // done
+    text.assign(r.get_raw(), r.get_byte_length());
+}
+
+void begin_escape_sequence(
+        arc::str::UTF8StringBuilder& builder,
+        ANSIColour colour,
+        ANSIAttribute attribute)
 {
     // start the opening escape sequence
-    arc::str::UTF8String r("\033[");
+    builder << "\033[";
     // write the attribute
     switch (attribute)
     {
         case ANSI_ATTR_NONE:
         {
-            r << "00;";
+            builder << "00;";
             break;
         }
         case ANSI_ATTR_BOLD:
         {
-            r << "01;";
+            builder << "01;";
             break;
         }
         case ANSI_ATTR_UNDERSCORE:
         {
-            r << "04;";
+            builder << "04;";
             break;
         }
         case ANSI_ATTR_BLINK:
         {
-            r << "05;";
+            builder << "05;";
             break;
         }
         case ANSI_ATTR_REVERSE:
         {
-            r << "07;";
+            builder << "07;";
             break;
         }
     }
     // write the colour
-    r << static_cast< arc::uint32 >(colour) << "m";
-    // write the string and closing sequence
-    r << text << "\033[00m";
-    // done
-    text.assign(r);
+    builder << static_cast< arc::uint32 >(colour) << "m";
+}
+
+void end_escape_sequence(arc::str::UTF8StringBuilder& builder)
+{
+    builder << "\033[00m";
 }
 
 } // namespace format
@@ -7,6 +7,7 @@
 #define ARCANECORE_IO_FORMAT_ANSI_HPP_
 
 #include "arcanecore/base/str/UTF8String.hpp"
+#include "arcanecore/base/str/UTF8StringBuilder.hpp"
 
 namespace arc
 {
@@ -88,6 +89,29 @@ void apply_escape_sequence(
         ANSIColour colour,
         ANSIAttribute attribute = ANSI_ATTR_NONE);
 
+/*!
+ * \brief Appends the opening of an ANSI escape sequence to the given builder,
+ *        so that the text appended after it is decorated.
+ *
+ * This allows text to be decorated while it is being built, rather than
+ * wrapping it afterwards with apply_escape_sequence(). The decorated text
+ * must be followed by end_escape_sequence().
+ *
+ * \param builder The builder to append the escape sequence to.
+ * \param colour the colour to use on the text.
+ * \param attribute the attribute to use on the text.
+ */
+void begin_escape_sequence(
+        arc::str::UTF8StringBuilder& builder,
+        ANSIColour colour,
+        ANSIAttribute attribute = ANSI_ATTR_NONE);
+
+/*!
+ * \brief Appends the ANSI escape sequence that ends the decoration started by
+ *        begin_escape_sequence() to the given builder.
+ */
+void end_escape_sequence(arc::str::UTF8StringBuilder& builder);
+
 } // namespace format
 } // namespace io
 } // namespace arc
@@ -0,0 +1,709 @@
+#include "arcanecore/io/sys/AsyncFile.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+
+#include "arcanecore/base/Exceptions.hpp"
+#include "arcanecore/io/sys/FileHandle.hpp"
+
+namespace arc
+{
+namespace io
+{
+namespace sys
+{
+
+//------------------------------------------------------------------------------
+//                                    OBJECTS
+//------------------------------------------------------------------------------
+
+/*!
+ * \brief FileHandle used by an AsyncFile to perform positional reads and
+ *        writes on the file's descriptor.
+ */
+struct AsyncHandle : public arc::io::sys::FileHandle
+{
+    //-------------------------------CONSTRUCTOR--------------------------------
+    AsyncHandle(const arc::io::sys::Path& path, int flags)
+        :
+        FileHandle(path, ENCODING_RAW, NEWLINE_UNIX),
+        m_flags   (flags)
+    {
+    }
+    //--------------------------------DESTRUCTOR--------------------------------
+    virtual ~AsyncHandle()
+    {
+    }
+    //-------------------------PUBLIC MEMBER FUNCTIONS--------------------------
+    using FileHandle::descriptor_read_at;
+    using FileHandle::descriptor_write_at;
+    virtual void open()
+    {
+        m_descriptor = open_descriptor(m_path, m_flags);
+        if(m_descriptor < 0)
+        {
+            arc::str::UTF8String error_message;
+            error_message << "Failed to open AsyncFile to path: \'"
+                          << m_path.to_native() << "\'.";
+            throw arc::ex::IOError(error_message);
+        }
+        m_open = true;
+    }
+    virtual void close()
+    {
+        close_descriptor();
+        m_open = false;
+    }
+    virtual arc::int64 get_size() const
+    {
+        return descriptor_size();
+    }
+    virtual arc::int64 tell() const
+    {
+        throw arc::ex::NotImplementedError(
+            "AsyncFile handles have no file position indicator.");
+    }
+    virtual void seek(arc::int64 index)
+    {
+        throw arc::ex::NotImplementedError(
+            "AsyncFile handles have no file position indicator.");
+    }
+private:
+    //----------------------------PRIVATE ATTRIBUTES----------------------------
+    int m_flags;
+};
+
+/*!
+ * \brief The state of a single request shared between the Request objects
+ *        referring to it and the I/O threads.
+ */
+struct AsyncRequest : public std::enable_shared_from_this<AsyncRequest>
+{
+    //----------------------------PUBLIC ATTRIBUTES-----------------------------
+    bool write;
+    char* read_data;
+    const char* write_data;
+    arc::int64 length;
+    arc::int64 offset;
+    AsyncFile::Callback callback;
+    std::atomic<int> status;
+    std::promise<arc::int64> promise;
+    std::shared_future<arc::int64> future;
+    //-------------------------------CONSTRUCTOR--------------------------------
+    AsyncRequest(
+            bool _write,
+            char* _read_data,
+            const char* _write_data,
+            arc::int64 _length,
+            arc::int64 _offset,
+            const AsyncFile::Callback& _callback)
+        :
+        write     (_write),
+        read_data (_read_data),
+        write_data(_write_data),
+        length    (_length),
+        offset    (_offset),
+        callback  (_callback),
+        status    (AsyncFile::Request::STATUS_PENDING),
+        future    (promise.get_future())
+    {
+    }
+    //-------------------------PUBLIC MEMBER FUNCTIONS--------------------------
+    /*!
+     * \brief Moves the request from the pending to the cancelled state,
+     *        releases anything waiting on it, and invokes its callback.
+     *
+     * \returns Whether the request was cancelled.
+     */
+    bool cancel()
+    {
+        int expected = AsyncFile::Request::STATUS_PENDING;
+        if(!status.compare_exchange_strong(
+                expected,
+                AsyncFile::Request::STATUS_CANCELLED))
+        {
+            return false;
+        }
+        promise.set_exception(std::make_exception_ptr(arc::ex::StateError(
+            "AsyncFile request was cancelled before it was performed.")));
+        notify();
+        return true;
+    }
+    /*!
+     * \brief Invokes the callback of the request, if it has one, now that the
+     *        request has been performed or cancelled.
+     */
+    void notify()
+    {
+        if(!callback)
+        {
+            return;
+        }
+        // there is no caller to report an exception to from here
+        try
+        {
+            callback(AsyncFile::Request(shared_from_this()));
+        }
+        catch(...)
+        {
+        }
+    }
+};
+
+/*!
+ * \brief The file handle, request queue, and I/O threads of an open AsyncFile.
+ */
+struct AsyncEngine
+{
+    //----------------------------PUBLIC ATTRIBUTES-----------------------------
+    std::unique_ptr<AsyncHandle> handle;
+    std::mutex mutex;
+    std::condition_variable not_empty;
+    std::condition_variable not_full;
+    std::condition_variable idle;
+    std::deque<std::shared_ptr<AsyncRequest>> queue;
+    std::vector<std::thread> threads;
+    std::size_t active;
+    bool stop;
+    //-------------------------------CONSTRUCTOR--------------------------------
+    AsyncEngine(AsyncHandle* _handle)
+        :
+        handle(_handle),
+        active(0),
+        stop  (false)
+    {
+    }
+};
+
+//------------------------------------------------------------------------------
+//                                    REQUEST
+//------------------------------------------------------------------------------
+
+AsyncFile::Request::Request()
+{
+}
+
+AsyncFile::Request::Request(const std::shared_ptr<AsyncRequest>& request)
+    :
+    m_request(request)
+{
+}
+
+bool AsyncFile::Request::is_valid() const
+{
+    return static_cast<bool>(m_request);
+}
+
+AsyncFile::Request::Status AsyncFile::Request::get_status() const
+{
+    check_valid();
+    return static_cast<Status>(m_request->status.load());
+}
+
+bool AsyncFile::Request::cancel()
+{
+    check_valid();
+    return m_request->cancel();
+}
+
+arc::int64 AsyncFile::Request::wait() const
+{
+    check_valid();
+    return m_request->future.get();
+}
+
+std::shared_future<arc::int64> AsyncFile::Request::get_future() const
+{
+    check_valid();
+    return m_request->future;
+}
+
+void AsyncFile::Request::check_valid() const
+{
+    if(!m_request)
+    {
+        throw arc::ex::StateError(
+            "Request does not refer to a submitted AsyncFile request.");
+    }
+}
+
+//------------------------------------------------------------------------------
+//                                  CONSTRUCTORS
+//------------------------------------------------------------------------------
+
+AsyncFile::AsyncFile(
+        Access access,
+        std::size_t thread_count,
+        std::size_t max_queue_depth)
+    :
+    m_access         (access),
+    m_thread_count   (thread_count),
+    m_max_queue_depth(max_queue_depth)
+{
+}
+
+AsyncFile::AsyncFile(
+        const arc::io::sys::Path& path,
+        Access access,
+        std::size_t thread_count,
+        std::size_t max_queue_depth)
+    :
+    m_path           (path),
+    m_access         (access),
+    m_thread_count   (thread_count),
+    m_max_queue_depth(max_queue_depth)
+{
+    open();
+}
+
+//------------------------------------------------------------------------------
+//                                   DESTRUCTOR
+//------------------------------------------------------------------------------
+
+AsyncFile::~AsyncFile()
+{
+    if(is_open())
+    {
+        close();
+    }
+}
+
+//------------------------------------------------------------------------------
+//                            PUBLIC MEMBER FUNCTIONS
+//------------------------------------------------------------------------------
+
+bool AsyncFile::is_open() const
+{
+    return static_cast<bool>(get_engine());
+}
+
+const arc::io::sys::Path& AsyncFile::get_path() const
+{
+    return m_path;
+}
+
+void AsyncFile::set_path(const arc::io::sys::Path& path)
+{
+    // ensure the file isn't open
+    if(is_open())
+    {
+        throw arc::ex::StateError(
+            "AsyncFile path cannot be changed since the file is open.");
+    }
+
+    m_path = path;
+}
+
+AsyncFile::Access AsyncFile::get_access() const
+{
+    return m_access;
+}
+
+void AsyncFile::set_access(Access access)
+{
+    // ensure the file isn't open
+    if(is_open())
+    {
+        throw arc::ex::StateError(
+            "AsyncFile access cannot be changed since the file is open.");
+    }
+
+    m_access = access;
+}
+
+std::size_t AsyncFile::get_thread_count() const
+{
+    return m_thread_count;
+}
+
+void AsyncFile::set_thread_count(std::size_t thread_count)
+{
+    // ensure the file isn't open
+    if(is_open())
+    {
+        throw arc::ex::StateError(
+            "AsyncFile thread count cannot be changed since the file is open.");
+    }
+    if(thread_count == 0)
+    {
+        throw arc::ex::ValueError(
+            "AsyncFile requires at least one I/O thread.");
+    }
+
+    m_thread_count = thread_count;
+}
+
+std::size_t AsyncFile::get_max_queue_depth() const
+{
+    return m_max_queue_depth;
+}
+
+void AsyncFile::set_max_queue_depth(std::size_t max_queue_depth)
+{
+    // ensure the file isn't open
+    if(is_open())
+    {
+        throw arc::ex::StateError(
+            "AsyncFile maximum queue depth cannot be changed since the file "
+            "is open."
+        );
+    }
+    if(max_queue_depth == 0)
+    {
+        throw arc::ex::ValueError(
+            "AsyncFile maximum queue depth must be at least 1.");
+    }
+
+    m_max_queue_depth = max_queue_depth;
+}
+
+void AsyncFile::open()
+{
+    std::lock_guard<std::mutex> engine_lock(m_engine_mutex);
+
+    // ensure the file is not already open
+    if(m_engine)
+    {
+        throw arc::ex::StateError(
+            "AsyncFile cannot be opened since it is already open.");
+    }
+
+    // open the handle
+    int flags = O_RDONLY;
+    if(m_access == ACCESS_WRITE)
+    {
+        flags = O_WRONLY | O_CREAT;
+    }
+    else if(m_access == ACCESS_READ_WRITE)
+    {
+        flags = O_RDWR | O_CREAT;
+    }
+    std::shared_ptr<AsyncEngine> engine(
+        new AsyncEngine(new AsyncHandle(m_path, flags)));
+    engine->handle->open();
+
+    // start the I/O threads
+    std::size_t thread_count = m_thread_count > 0 ? m_thread_count : 1;
+    for(std::size_t i = 0; i < thread_count; ++i)
+    {
+        engine->threads.push_back(
+            std::thread(&AsyncFile::run_io_thread, this, engine.get()));
+    }
+    m_engine = engine;
+}
+
+void AsyncFile::open(const arc::io::sys::Path& path)
+{
+    set_path(path);
+    open();
+}
+
+void AsyncFile::close()
+{
+    // take the engine so no new submitters can reach it, submitters that
+    // already hold a reference keep it alive until they leave
+    std::shared_ptr<AsyncEngine> engine;
+    {
+        std::lock_guard<std::mutex> engine_lock(m_engine_mutex);
+        engine.swap(m_engine);
+    }
+
+    // ensure the file is not already closed
+    if(!engine)
+    {
+        throw arc::ex::StateError(
+            "AsyncFile cannot be closed since it is already closed.");
+    }
+
+    // the I/O threads will perform the remaining requests before exiting,
+    // submitters blocked on a full queue will leave without queuing their
+    // request
+    {
+        std::lock_guard<std::mutex> lock(engine->mutex);
+        engine->stop = true;
+    }
+    engine->not_empty.notify_all();
+    engine->not_full.notify_all();
+    ARC_FOR_EACH(thread, engine->threads)
+    {
+        thread->join();
+    }
+
+    std::lock_guard<std::mutex> lock(engine->mutex);
+    engine->handle->close();
+}
+
+arc::int64 AsyncFile::get_size() const
+{
+    std::shared_ptr<AsyncEngine> engine = get_engine();
+
+    // ensure the file is open, the handle is closed once the engine has been
+    // stopped
+    std::unique_lock<std::mutex> lock;
+    if(engine)
+    {
+        lock = std::unique_lock<std::mutex>(engine->mutex);
+    }
+    if(!engine || engine->stop)
+    {
+        throw arc::ex::StateError(
+            "File size cannot be queried while the AsyncFile is closed.");
+    }
+
+    return engine->handle->get_size();
+}
+
+std::size_t AsyncFile::get_queue_depth() const
+{
+    std::shared_ptr<AsyncEngine> engine = get_engine();
+    if(!engine)
+    {
+        return 0;
+    }
+
+    std::lock_guard<std::mutex> lock(engine->mutex);
+    return engine->queue.size();
+}
+
+AsyncFile::Request AsyncFile::read_at(
+        char* data,
+        arc::int64 length,
+        arc::int64 offset,
+        Callback callback)
+{
+    // ensure the file is open for reading
+    std::shared_ptr<AsyncEngine> engine = get_engine();
+    if(!engine)
+    {
+        throw arc::ex::StateError(
+            "Read request cannot be submitted while the AsyncFile is closed.");
+    }
+    if(m_access == ACCESS_WRITE)
+    {
+        throw arc::ex::StateError(
+            "Read request cannot be submitted to an AsyncFile opened with "
+            "write only access."
+        );
+    }
+    if(offset < 0)
+    {
+        arc::str::UTF8String error_message;
+        error_message << "Cannot read from negative file offset: " << offset;
+        throw arc::ex::IndexOutOfBoundsError(error_message);
+    }
+
+    return submit(engine, std::shared_ptr<AsyncRequest>(new AsyncRequest(
+        false,
+        data,
+        nullptr,
+        length,
+        offset,
+        callback
+    )));
+}
+
+AsyncFile::Request AsyncFile::write_at(
+        const char* data,
+        std::size_t length,
+        arc::int64 offset,
+        Callback callback)
+{
+    // ensure the file is open for writing
+    std::shared_ptr<AsyncEngine> engine = get_engine();
+    if(!engine)
+    {
+        throw arc::ex::StateError(
+            "Write request cannot be submitted while the AsyncFile is closed.");
+    }
+    if(m_access == ACCESS_READ)
+    {
+        throw arc::ex::StateError(
+            "Write request cannot be submitted to an AsyncFile opened with "
+            "read only access."
+        );
+    }
+    if(offset < 0)
+    {
+        arc::str::UTF8String error_message;
+        error_message << "Cannot write to negative file offset: " << offset;
+        throw arc::ex::IndexOutOfBoundsError(error_message);
+    }
+
+    return submit(engine, std::shared_ptr<AsyncRequest>(new AsyncRequest(
+        true,
+        nullptr,
+        data,
+        static_cast<arc::int64>(length),
+        offset,
+        callback
+    )));
+}
+
+void AsyncFile::wait_all()
+{
+    // ensure the file is open
+    std::shared_ptr<AsyncEngine> engine = get_engine();
+    if(!engine)
+    {
+        throw arc::ex::StateError(
+            "Requests cannot be waited on while the AsyncFile is closed.");
+    }
+
+    std::unique_lock<std::mutex> lock(engine->mutex);
+    while(!engine->queue.empty() || engine->active > 0)
+    {
+        engine->idle.wait(lock);
+    }
+}
+
+std::size_t AsyncFile::cancel_all()
+{
+    // ensure the file is open
+    std::shared_ptr<AsyncEngine> engine = get_engine();
+    if(!engine)
+    {
+        throw arc::ex::StateError(
+            "Requests cannot be cancelled while the AsyncFile is closed.");
+    }
+
+    std::deque<std::shared_ptr<AsyncRequest>> queued;
+    {
+        std::lock_guard<std::mutex> lock(engine->mutex);
+        queued.swap(engine->queue);
+    }
+
+    // the requests are cancelled outside of the lock since their callbacks may
+    // submit new requests
+    std::size_t cancelled = 0;
+    ARC_FOR_EACH(request, queued)
+    {
+        if((*request)->cancel())
+        {
+            ++cancelled;
+        }
+    }
+    engine->not_full.notify_all();
+    engine->idle.notify_all();
+
+    return cancelled;
+}
+
+//------------------------------------------------------------------------------
+//                            PRIVATE MEMBER FUNCTIONS
+//------------------------------------------------------------------------------
+
+std::shared_ptr<AsyncEngine> AsyncFile::get_engine() const
+{
+    std::lock_guard<std::mutex> engine_lock(m_engine_mutex);
+    return m_engine;
+}
+
+AsyncFile::Request AsyncFile::submit(
+        const std::shared_ptr<AsyncEngine>& engine,
+        const std::shared_ptr<AsyncRequest>& request)
+{
+    std::size_t max_queue_depth = m_max_queue_depth > 0 ? m_max_queue_depth : 1;
+
+    std::unique_lock<std::mutex> lock(engine->mutex);
+    // apply back pressure while the queue is full
+    while(engine->queue.size() >= max_queue_depth && !engine->stop)
+    {
+        engine->not_full.wait(lock);
+    }
+
+    // the file was closed while waiting, the I/O threads may have already
+    // exited so the request would never be performed
+    bool stopped = engine->stop;
+    if(!stopped)
+    {
+        engine->queue.push_back(request);
+        engine->not_empty.notify_one();
+    }
+    lock.unlock();
+
+    if(stopped)
+    {
+        throw arc::ex::StateError(
+            "Request cannot be submitted since the AsyncFile was closed.");
+    }
+    return Request(request);
+}
+
+void AsyncFile::run_io_thread(AsyncEngine* engine)
+{
+    AsyncHandle* handle = engine->handle.get();
+
+    std::unique_lock<std::mutex> lock(engine->mutex);
+    while(true)
+    {
+        while(engine->queue.empty() && !engine->stop)
+        {
+            engine->not_empty.wait(lock);
+        }
+        // only exit once all requests have been performed
+        if(engine->queue.empty())
+        {
+            break;
+        }
+
+        std::shared_ptr<AsyncRequest> request = engine->queue.front();
+        engine->queue.pop_front();
+        ++engine->active;
+        engine->not_full.notify_one();
+        lock.unlock();
+
+        // skip requests that have been cancelled
+        int expected = Request::STATUS_PENDING;
+        if(request->status.compare_exchange_strong(
+                expected,
+                Request::STATUS_RUNNING))
+        {
+            try
+            {
+                arc::int64 result = request->length;
+                if(request->write)
+                {
+                    handle->descriptor_write_at(
+                        request->write_data,
+                        static_cast<std::size_t>(request->length),
+                        request->offset
+                    );
+                }
+                else
+                {
+                    result = handle->descriptor_read_at(
+                        request->read_data,
+                        request->length,
+                        request->offset
+                    );
+                }
+                request->status = Request::STATUS_COMPLETE;
+                request->promise.set_value(result);
+            }
+            catch(...)
+            {
+                request->status = Request::STATUS_FAILED;
+                request->promise.set_exception(std::current_exception());
+            }
+
+            request->notify();
+        }
+
+        lock.lock();
+        --engine->active;
+        if(engine->queue.empty() && engine->active == 0)
+        {
+            engine->idle.notify_all();
+        }
+    }
+}
+
+} // namespace sys
+} // namespace io
+} // namespace arc
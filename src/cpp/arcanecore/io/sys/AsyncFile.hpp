@@ -0,0 +1,519 @@
+/*!
+ * \file
+ * \author David Saxon
+ */
+#ifndef ARCANECORE_IO_SYS_ASYNCFILE_HPP_
+#define ARCANECORE_IO_SYS_ASYNCFILE_HPP_
+
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+
+#include "arcanecore/base/Types.hpp"
+#include "arcanecore/io/sys/Path.hpp"
+
+namespace arc
+{
+namespace io
+{
+namespace sys
+{
+
+//------------------------------------------------------------------------------
+//                             FORWARD DECELERATIONS
+//------------------------------------------------------------------------------
+
+struct AsyncEngine;
+struct AsyncRequest;
+
+/*!
+ * \brief Used for reading from and writing to a file asynchronously.
+ *
+ * Read and write requests are placed in a queue and performed by a pool of
+ * I/O threads owned by the AsyncFile, so that the calling thread may continue
+ * with other work while the requests are being performed. Each request is
+ * positional (see arc::io::sys::FileReader::read_at()), so requests may be
+ * performed in any order and concurrently with one another.
+ *
+ * Completion of a request can be waited on using the returned
+ * arc::io::sys::AsyncFile::Request object, or a callback can be provided
+ * which will be invoked from an I/O thread once the request has been
+ * performed.
+ *
+ * Example usage:
+ *
+ * \code
+ * arc::io::sys::AsyncFile file(path);
+ *
+ * char* data = new char[1024];
+ * arc::io::sys::AsyncFile::Request request = file.read_at(data, 1024, 0);
+ *
+ * // ... other work
+ *
+ * arc::int64 bytes_read = request.wait();
+ * \endcode
+ *
+ * \note Requests may be submitted from multiple threads concurrently, and
+ *       concurrently with the AsyncFile being closed. All other functions of
+ *       the AsyncFile should only be used from one thread at a time.
+ */
+class AsyncFile
+{
+private:
+
+    ARC_DISALLOW_COPY_AND_ASSIGN(AsyncFile);
+
+public:
+
+    //--------------------------------------------------------------------------
+    //                                 ENUMERATOR
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief The possible ways an AsyncFile can access its file.
+     */
+    enum Access
+    {
+        /// The file may only be read from.
+        ACCESS_READ = 0,
+        /// The file may only be written to. The file is created if it does
+        /// not exist, any existing data in the file is retained.
+        ACCESS_WRITE,
+        /// The file may be read from and written to. The file is created if
+        /// it does not exist, any existing data in the file is retained.
+        ACCESS_READ_WRITE
+    };
+
+    //--------------------------------------------------------------------------
+    //                                  CLASSES
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief Handle to a read or write request that has been submitted to an
+     *        AsyncFile.
+     *
+     * Copies of a Request refer to the same underlying request. A Request may
+     * safely outlive the AsyncFile it was submitted to.
+     */
+    class Request
+    {
+    public:
+
+        //----------------------------------------------------------------------
+        //                              ENUMERATOR
+        //----------------------------------------------------------------------
+
+        /*!
+         * \brief The possible states of a request.
+         */
+        enum Status
+        {
+            /// The request is waiting in the queue to be performed.
+            STATUS_PENDING = 0,
+            /// The request is currently being performed by an I/O thread.
+            STATUS_RUNNING,
+            /// The request has been performed successfully.
+            STATUS_COMPLETE,
+            /// The request was cancelled before it was performed.
+            STATUS_CANCELLED,
+            /// The request was performed but an error occurred.
+            STATUS_FAILED
+        };
+
+        //----------------------------------------------------------------------
+        //                             CONSTRUCTORS
+        //----------------------------------------------------------------------
+
+        /*!
+         * \brief Creates a new Request which does not refer to any submitted
+         *        request.
+         */
+        Request();
+
+        //----------------------------------------------------------------------
+        //                        PUBLIC MEMBER FUNCTIONS
+        //----------------------------------------------------------------------
+
+        /*!
+         * \brief Returns whether this Request refers to a submitted request.
+         */
+        bool is_valid() const;
+
+        /*!
+         * \brief Returns the current state of the request.
+         *
+         * \throws arc::ex::StateError If this Request is not valid.
+         */
+        Status get_status() const;
+
+        /*!
+         * \brief Attempts to cancel the request.
+         *
+         * The request can only be cancelled if it has not yet been started by
+         * an I/O thread. The callback of a cancelled request is invoked from
+         * the cancelling thread.
+         *
+         * \returns Whether the request was cancelled.
+         *
+         * \throws arc::ex::StateError If this Request is not valid.
+         */
+        bool cancel();
+
+        /*!
+         * \brief Blocks until the request has been performed and returns the
+         *        number of bytes that were read or written.
+         *
+         * \throws arc::ex::StateError If this Request is not valid or the
+         *                             request was cancelled.
+         * \throws arc::ex::IOError If the request failed, or the exception
+         *                          the request failed with.
+         */
+        arc::int64 wait() const;
+
+        /*!
+         * \brief Returns a future that will hold the number of bytes read or
+         *        written once the request has been performed.
+         *
+         * If the request fails or is cancelled the future will hold the same
+         * exception that wait() would throw.
+         *
+         * \throws arc::ex::StateError If this Request is not valid.
+         */
+        std::shared_future<arc::int64> get_future() const;
+
+    private:
+
+        friend class AsyncFile;
+        friend struct AsyncRequest;
+
+        //----------------------------------------------------------------------
+        //                          PRIVATE ATTRIBUTES
+        //----------------------------------------------------------------------
+
+        /*!
+         * \brief The state of the request shared with the I/O threads.
+         */
+        std::shared_ptr<AsyncRequest> m_request;
+
+        //----------------------------------------------------------------------
+        //                         PRIVATE CONSTRUCTORS
+        //----------------------------------------------------------------------
+
+        Request(const std::shared_ptr<AsyncRequest>& request);
+
+        //----------------------------------------------------------------------
+        //                       PRIVATE MEMBER FUNCTIONS
+        //----------------------------------------------------------------------
+
+        /*!
+         * \brief Throws a arc::ex::StateError if this Request is not valid.
+         */
+        void check_valid() const;
+    };
+
+    //--------------------------------------------------------------------------
+    //                                  TYPEDEFS
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief Function invoked from an I/O thread once a request has been
+     *        performed, or from the cancelling thread once a request has been
+     *        cancelled.
+     *
+     * The provided Request will have either the
+     * arc::io::sys::AsyncFile::Request::STATUS_COMPLETE,
+     * arc::io::sys::AsyncFile::Request::STATUS_FAILED, or
+     * arc::io::sys::AsyncFile::Request::STATUS_CANCELLED status.
+     */
+    typedef std::function<void(const Request&)> Callback;
+
+    //--------------------------------------------------------------------------
+    //                                CONSTRUCTORS
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief Default constructor.
+     *
+     * Creates a new unopened AsyncFile with no file path yet defined.
+     *
+     * \param access How the file will be accessed.
+     * \param thread_count The number of I/O threads that will perform
+     *                     requests.
+     * \param max_queue_depth The maximum number of requests that may be
+     *                        waiting in the queue, once reached submitting a
+     *                        new request will block until a request has been
+     *                        taken by an I/O thread.
+     */
+    AsyncFile(
+            Access access               = ACCESS_READ,
+            std::size_t thread_count    = 2,
+            std::size_t max_queue_depth = 64);
+
+    /*!
+     * \brief Path constructor.
+     *
+     * Creates a new AsyncFile opened to the given path.
+     *
+     * \param path The path to the file to access.
+     * \param access How the file will be accessed.
+     * \param thread_count The number of I/O threads that will perform
+     *                     requests.
+     * \param max_queue_depth The maximum number of requests that may be
+     *                        waiting in the queue, once reached submitting a
+     *                        new request will block until a request has been
+     *                        taken by an I/O thread.
+     *
+     * \throws arc::ex::IOError If the path cannot be opened.
+     */
+    AsyncFile(
+            const arc::io::sys::Path& path,
+            Access access               = ACCESS_READ,
+            std::size_t thread_count    = 2,
+            std::size_t max_queue_depth = 64);
+
+    //--------------------------------------------------------------------------
+    //                                 DESTRUCTOR
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief Closes the AsyncFile if it is open, waiting for any queued
+     *        requests to be performed first.
+     */
+    ~AsyncFile();
+
+    //--------------------------------------------------------------------------
+    //                          PUBLIC MEMBER FUNCTIONS
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief Returns whether this AsyncFile is currently open.
+     */
+    bool is_open() const;
+
+    /*!
+     * \brief Returns the path this AsyncFile is using.
+     */
+    const arc::io::sys::Path& get_path() const;
+
+    /*!
+     * \brief Sets the path of the file this AsyncFile will access.
+     *
+     * \throws arc::ex::StateError If this AsyncFile is open.
+     */
+    void set_path(const arc::io::sys::Path& path);
+
+    /*!
+     * \brief Returns how this AsyncFile accesses its file.
+     */
+    Access get_access() const;
+
+    /*!
+     * \brief Sets how this AsyncFile will access its file.
+     *
+     * \throws arc::ex::StateError If this AsyncFile is open.
+     */
+    void set_access(Access access);
+
+    /*!
+     * \brief Returns the number of I/O threads used to perform requests.
+     */
+    std::size_t get_thread_count() const;
+
+    /*!
+     * \brief Sets the number of I/O threads used to perform requests.
+     *
+     * \throws arc::ex::StateError If this AsyncFile is open.
+     * \throws arc::ex::ValueError If the thread count is ```0```.
+     */
+    void set_thread_count(std::size_t thread_count);
+
+    /*!
+     * \brief Returns the maximum number of requests that may be waiting in the
+     *        queue.
+     */
+    std::size_t get_max_queue_depth() const;
+
+    /*!
+     * \brief Sets the maximum number of requests that may be waiting in the
+     *        queue.
+     *
+     * \throws arc::ex::StateError If this AsyncFile is open.
+     * \throws arc::ex::ValueError If the queue depth is ```0```.
+     */
+    void set_max_queue_depth(std::size_t max_queue_depth);
+
+    /*!
+     * \brief Opens this AsyncFile to the internal path and starts the I/O
+     *        threads.
+     *
+     * \throws arc::ex::StateError If this AsyncFile is already open.
+     * \throws arc::ex::IOError If the path cannot be opened.
+     */
+    void open();
+
+    /*!
+     * \brief Sets the path of this AsyncFile and then opens it.
+     *
+     * \throws arc::ex::StateError If this AsyncFile is already open.
+     * \throws arc::ex::IOError If the path cannot be opened.
+     */
+    void open(const arc::io::sys::Path& path);
+
+    /*!
+     * \brief Waits for all queued requests to be performed, then stops the I/O
+     *        threads and closes the file.
+     *
+     * Any submitters blocked on a full queue are released without their
+     * requests being queued, see read_at() and write_at().
+     *
+     * \throws arc::ex::StateError If this AsyncFile is not open.
+     */
+    void close();
+
+    /*!
+     * \brief Returns the current size of the file in bytes.
+     *
+     * \throws arc::ex::StateError If this AsyncFile is not open.
+     */
+    arc::int64 get_size() const;
+
+    /*!
+     * \brief Returns the number of requests currently waiting in the queue.
+     */
+    std::size_t get_queue_depth() const;
+
+    /*!
+     * \brief Submits a request to read a block of data from the given byte
+     *        offset of the file.
+     *
+     * \param data Character array that file data will be copied into. This
+     *             must remain valid until the request has been performed or
+     *             cancelled.
+     * \param length The maximum number of bytes to read. Less bytes will be
+     *               read if the end of the file is reached.
+     * \param offset The byte index in the file to begin reading from.
+     * \param callback Optional function to invoke once the read has been
+     *                 performed.
+     *
+     * \throws arc::ex::StateError If this AsyncFile is not open, was not
+     *                             opened with read access, or was closed while
+     *                             waiting for space in the queue.
+     * \throws arc::ex::IndexOutOfBoundsError If the given offset is less than
+     *                                          0.
+     */
+    Request read_at(
+            char* data,
+            arc::int64 length,
+            arc::int64 offset,
+            Callback callback = Callback());
+
+    /*!
+     * \brief Submits a request to write a block of data at the given byte
+     *        offset of the file.
+     *
+     * \param data The data to write to the file. This must remain valid until
+     *             the request has been performed or cancelled.
+     * \param length The number of bytes in the data to write.
+     * \param offset The byte index in the file to begin writing at.
+     * \param callback Optional function to invoke once the write has been
+     *                 performed.
+     *
+     * \throws arc::ex::StateError If this AsyncFile is not open, was not
+     *                             opened with write access, or was closed while
+     *                             waiting for space in the queue.
+     * \throws arc::ex::IndexOutOfBoundsError If the given offset is less than
+     *                                          0.
+     */
+    Request write_at(
+            const char* data,
+            std::size_t length,
+            arc::int64 offset,
+            Callback callback = Callback());
+
+    /*!
+     * \brief Blocks until all submitted requests have been performed.
+     *
+     * \throws arc::ex::StateError If this AsyncFile is not open.
+     */
+    void wait_all();
+
+    /*!
+     * \brief Cancels all requests that are waiting in the queue.
+     *
+     * The callbacks of the cancelled requests are invoked from the calling
+     * thread.
+     *
+     * \returns The number of requests that were cancelled.
+     *
+     * \throws arc::ex::StateError If this AsyncFile is not open.
+     */
+    std::size_t cancel_all();
+
+private:
+
+    //--------------------------------------------------------------------------
+    //                             PRIVATE ATTRIBUTES
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief The path to the file being accessed.
+     */
+    arc::io::sys::Path m_path;
+    /*!
+     * \brief How the file is accessed.
+     */
+    Access m_access;
+    /*!
+     * \brief The number of I/O threads to use.
+     */
+    std::size_t m_thread_count;
+    /*!
+     * \brief The maximum number of requests that may be waiting in the queue.
+     */
+    std::size_t m_max_queue_depth;
+
+    /*!
+     * \brief Guards m_engine, which submitters may read while the AsyncFile is
+     *        being closed.
+     */
+    mutable std::mutex m_engine_mutex;
+    /*!
+     * \brief The file handle, request queue, and I/O threads, this is null if
+     *        the AsyncFile is not open.
+     *
+     * Functions take their own reference to the engine so that it remains
+     * valid if the AsyncFile is closed while they are using it.
+     */
+    std::shared_ptr<AsyncEngine> m_engine;
+
+    //--------------------------------------------------------------------------
+    //                          PRIVATE MEMBER FUNCTIONS
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief Returns a reference to the engine, or null if the AsyncFile is
+     *        not open.
+     */
+    std::shared_ptr<AsyncEngine> get_engine() const;
+
+    /*!
+     * \brief Places the given request in the queue of the given engine,
+     *        blocking while the queue is full.
+     */
+    Request submit(
+            const std::shared_ptr<AsyncEngine>& engine,
+            const std::shared_ptr<AsyncRequest>& request);
+
+    /*!
+     * \brief Performs requests from the queue of the given engine until it is
+     *        stopped and the queue is empty.
+     */
+    void run_io_thread(AsyncEngine* engine);
+};
+
+} // namespace sys
+} // namespace io
+} // namespace arc
+
+#endif
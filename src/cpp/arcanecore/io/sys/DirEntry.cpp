@@ -0,0 +1,435 @@
+#include "arcanecore/io/sys/DirEntry.hpp"
+
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#ifdef ARC_OS_UNIX
+
+    #include <dirent.h>
+    #include <fcntl.h>
+
+#elif defined(ARC_OS_WINDOWS)
+
+    #include <windows.h>
+
+#endif
+
+#include "arcanecore/base/Exceptions.hpp"
+#include "arcanecore/base/os/OSOperations.hpp"
+#include "arcanecore/base/str/StringOperations.hpp"
+
+namespace arc
+{
+namespace io
+{
+namespace sys
+{
+
+//------------------------------------------------------------------------------
+//                                STATIC FUNCTIONS
+//------------------------------------------------------------------------------
+
+#ifdef ARC_OS_UNIX
+
+/*!
+ * \brief Returns the entry type for the given stat mode.
+ */
+static DirEntry::Type type_from_mode(mode_t mode)
+{
+    if(S_ISREG(mode))
+    {
+        return DirEntry::TYPE_FILE;
+    }
+    if(S_ISDIR(mode))
+    {
+        return DirEntry::TYPE_DIRECTORY;
+    }
+    if(S_ISLNK(mode))
+    {
+        return DirEntry::TYPE_SYMBOLIC_LINK;
+    }
+    return DirEntry::TYPE_OTHER;
+}
+
+/*!
+ * \brief Returns the modification time of the given stat in milliseconds.
+ */
+static arc::uint64 modified_time_from_stat(const struct stat& s)
+{
+    arc::uint64 ret = static_cast<arc::uint64>(s.st_mtime) * 1000;
+#ifdef ARC_OS_LINUX
+    ret += static_cast<arc::uint64>(s.st_mtim.tv_nsec) / 1000000;
+#endif
+    return ret;
+}
+
+#elif defined(ARC_OS_WINDOWS)
+
+/*!
+ * \brief Returns the given Windows file time in milliseconds since Linux Epoch.
+ */
+static arc::uint64 modified_time_from_file_time(const FILETIME& file_time)
+{
+    // file times are measured in 100 nanosecond intervals since 1601
+    arc::uint64 t =
+        (static_cast<arc::uint64>(file_time.dwHighDateTime) << 32) |
+        static_cast<arc::uint64>(file_time.dwLowDateTime);
+    static const arc::uint64 epoch_offset = 116444736000000000ULL;
+    if(t < epoch_offset)
+    {
+        return 0;
+    }
+    return (t - epoch_offset) / 10000;
+}
+
+#endif
+
+//------------------------------------------------------------------------------
+//                                  CONSTRUCTORS
+//------------------------------------------------------------------------------
+
+DirEntry::DirEntry()
+    :
+    m_type         (TYPE_UNKNOWN),
+    m_inode        (0),
+    m_has_metadata (false),
+    m_size         (0),
+    m_modified_time(0)
+{
+}
+
+DirEntry::DirEntry(const arc::io::sys::Path& path)
+    :
+    m_path         (path),
+    m_type         (TYPE_UNKNOWN),
+    m_inode        (0),
+    m_has_metadata (false),
+    m_size         (0),
+    m_modified_time(0)
+{
+}
+
+DirEntry::DirEntry(
+        const arc::io::sys::Path& path,
+        Type type,
+        arc::uint64 inode)
+    :
+    m_path         (path),
+    m_type         (type),
+    m_inode        (inode),
+    m_has_metadata (false),
+    m_size         (0),
+    m_modified_time(0)
+{
+}
+
+//------------------------------------------------------------------------------
+//                            PUBLIC STATIC FUNCTIONS
+//------------------------------------------------------------------------------
+
+bool DirEntry::read_directory(
+        const arc::io::sys::Path& path,
+        bool include_special,
+        bool load_metadata,
+        std::vector<DirEntry>& entries)
+{
+#ifdef ARC_OS_UNIX
+
+    DIR* dir = opendir(path.get_native_raw());
+    if(dir == NULL)
+    {
+        return false;
+    }
+    int dir_fd = dirfd(dir);
+
+    struct dirent* dir_entry;
+    while((dir_entry = readdir(dir)) != NULL)
+    {
+        const char* name = dir_entry->d_name;
+
+        // . or ..?
+        if(!include_special && name[0] == '.' &&
+           (name[1] == '\0' || (name[1] == '.' && name[2] == '\0')))
+        {
+            continue;
+        }
+
+        arc::io::sys::Path entry_path(path);
+        entry_path << name;
+        entries.push_back(DirEntry(
+            entry_path,
+            TYPE_UNKNOWN,
+            static_cast<arc::uint64>(dir_entry->d_ino)
+        ));
+        DirEntry& entry = entries.back();
+
+        // use the type from the directory listing where possible
+#ifdef DT_UNKNOWN
+        switch(dir_entry->d_type)
+        {
+            case DT_REG:
+                entry.m_type = TYPE_FILE;
+                break;
+            case DT_DIR:
+                entry.m_type = TYPE_DIRECTORY;
+                break;
+            case DT_LNK:
+                entry.m_type = TYPE_SYMBOLIC_LINK;
+                break;
+            case DT_UNKNOWN:
+                break;
+            default:
+                entry.m_type = TYPE_OTHER;
+                break;
+        }
+#endif
+        // otherwise stat relative to the open directory
+        if(load_metadata || entry.m_type == TYPE_UNKNOWN)
+        {
+            struct stat s;
+            if(fstatat(dir_fd, name, &s, AT_SYMLINK_NOFOLLOW) == 0)
+            {
+                entry.m_type          = type_from_mode(s.st_mode);
+                entry.m_inode         = static_cast<arc::uint64>(s.st_ino);
+                entry.m_size          = static_cast<arc::int64>(s.st_size);
+                entry.m_modified_time = modified_time_from_stat(s);
+                entry.m_has_metadata  = true;
+            }
+        }
+    }
+    closedir(dir);
+    return true;
+
+#elif defined(ARC_OS_WINDOWS)
+
+    // construct the directory path
+    arc::str::UTF8String u(path.to_windows());
+    if(!u.ends_with("\\"))
+    {
+        u += "\\";
+    }
+    u += "*";
+
+    // utf-16
+    std::size_t length = 0;
+    const char* p = arc::str::utf8_to_utf16(
+            u,
+            length,
+            arc::data::ENDIAN_LITTLE
+    );
+
+    WIN32_FIND_DATAW find_data;
+    HANDLE find_handle = FindFirstFileW((const wchar_t*) p, &find_data);
+    delete[] p;
+
+    if(find_handle == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+
+    do
+    {
+        arc::io::sys::Path entry_path(path);
+        entry_path << arc::str::utf16_to_utf8(
+                (const char*) find_data.cFileName,
+                arc::str::npos
+        );
+
+        if(!include_special &&
+           (entry_path.get_back_view() == "." ||
+            entry_path.get_back_view() == ".."))
+        {
+            continue;
+        }
+
+        // the type and metadata are provided by the find data
+        Type type = TYPE_FILE;
+        if(find_data.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT)
+        {
+            type = TYPE_SYMBOLIC_LINK;
+        }
+        else if(find_data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
+        {
+            type = TYPE_DIRECTORY;
+        }
+
+        entries.push_back(DirEntry(entry_path, type, 0));
+        DirEntry& entry = entries.back();
+        entry.m_size = static_cast<arc::int64>(
+            (static_cast<arc::uint64>(find_data.nFileSizeHigh) << 32) |
+            static_cast<arc::uint64>(find_data.nFileSizeLow)
+        );
+        entry.m_modified_time =
+            modified_time_from_file_time(find_data.ftLastWriteTime);
+        entry.m_has_metadata = true;
+    }
+    while(FindNextFileW(find_handle, &find_data) != 0);
+    FindClose(find_handle);
+    return true;
+
+#else
+
+    throw arc::ex::NotImplementedError(
+            "arc::io::sys::DirEntry::read_directory has not yet been "
+            "implemented for this platform"
+    );
+
+#endif
+}
+
+//------------------------------------------------------------------------------
+//                                   OPERATORS
+//------------------------------------------------------------------------------
+
+bool DirEntry::operator<(const DirEntry& other) const
+{
+    return m_path < other.m_path;
+}
+
+//------------------------------------------------------------------------------
+//                            PUBLIC MEMBER FUNCTIONS
+//------------------------------------------------------------------------------
+
+const arc::io::sys::Path& DirEntry::get_path() const
+{
+    return m_path;
+}
+
+DirEntry::Type DirEntry::get_type() const
+{
+    if(m_type == TYPE_UNKNOWN && !m_has_metadata)
+    {
+        load_metadata();
+    }
+    return m_type;
+}
+
+bool DirEntry::is_special() const
+{
+    if(m_path.is_empty())
+    {
+        return false;
+    }
+    arc::str::UTF8StringView name(m_path.get_back_view());
+    return name == "." || name == "..";
+}
+
+arc::uint64 DirEntry::get_inode() const
+{
+#ifdef ARC_OS_UNIX
+    if(m_inode == 0 && !m_has_metadata)
+    {
+        load_metadata();
+    }
+#endif
+    return m_inode;
+}
+
+arc::int64 DirEntry::get_size() const
+{
+    if(!m_has_metadata && !load_metadata())
+    {
+        arc::str::UTF8String error_message;
+        error_message << "Failed to query the size of path: \'";
+        error_message << m_path.to_native() << "\'. OS error: ";
+        error_message << arc::os::get_last_system_error_message();
+        throw arc::ex::IOError(error_message);
+    }
+    return m_size;
+}
+
+arc::uint64 DirEntry::get_modified_time() const
+{
+    if(!m_has_metadata && !load_metadata())
+    {
+        arc::str::UTF8String error_message;
+        error_message << "Failed to query the modification time of path: \'";
+        error_message << m_path.to_native() << "\'. OS error: ";
+        error_message << arc::os::get_last_system_error_message();
+        throw arc::ex::IOError(error_message);
+    }
+    return m_modified_time;
+}
+
+bool DirEntry::has_metadata() const
+{
+    return m_has_metadata;
+}
+
+//------------------------------------------------------------------------------
+//                            PRIVATE MEMBER FUNCTIONS
+//------------------------------------------------------------------------------
+
+bool DirEntry::load_metadata() const
+{
+#ifdef ARC_OS_UNIX
+
+    struct stat s;
+    if(lstat(m_path.get_native_raw(), &s) != 0)
+    {
+        return false;
+    }
+
+    m_type          = type_from_mode(s.st_mode);
+    m_inode         = static_cast<arc::uint64>(s.st_ino);
+    m_size          = static_cast<arc::int64>(s.st_size);
+    m_modified_time = modified_time_from_stat(s);
+    m_has_metadata  = true;
+    return true;
+
+#elif defined(ARC_OS_WINDOWS)
+
+    // utf-16
+    std::size_t length = 0;
+    const char* p = arc::str::utf8_to_utf16(
+            m_path.to_windows().get_raw(),
+            length,
+            arc::data::ENDIAN_LITTLE
+    );
+
+    WIN32_FILE_ATTRIBUTE_DATA attributes;
+    BOOL result = GetFileAttributesExW(
+        (const wchar_t*) p,
+        GetFileExInfoStandard,
+        &attributes
+    );
+    delete[] p;
+
+    if(!result)
+    {
+        return false;
+    }
+
+    if(attributes.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT)
+    {
+        m_type = TYPE_SYMBOLIC_LINK;
+    }
+    else if(attributes.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
+    {
+        m_type = TYPE_DIRECTORY;
+    }
+    else
+    {
+        m_type = TYPE_FILE;
+    }
+    m_size = static_cast<arc::int64>(
+        (static_cast<arc::uint64>(attributes.nFileSizeHigh) << 32) |
+        static_cast<arc::uint64>(attributes.nFileSizeLow)
+    );
+    m_modified_time = modified_time_from_file_time(attributes.ftLastWriteTime);
+    m_has_metadata = true;
+    return true;
+
+#else
+
+    throw arc::ex::NotImplementedError(
+            "arc::io::sys::DirEntry has not yet been implemented for this "
+            "platform"
+    );
+
+#endif
+}
+
+} // namespace sys
+} // namespace io
+} // namespace arc
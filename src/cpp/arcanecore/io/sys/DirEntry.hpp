@@ -0,0 +1,223 @@
+/*!
+ * \file
+ * \author David Saxon
+ */
+#ifndef ARCANECORE_IO_SYS_DIRENTRY_HPP_
+#define ARCANECORE_IO_SYS_DIRENTRY_HPP_
+
+#include <vector>
+
+#include "arcanecore/base/Types.hpp"
+#include "arcanecore/io/sys/Path.hpp"
+
+namespace arc
+{
+namespace io
+{
+namespace sys
+{
+
+/*!
+ * \brief A path read from a directory along with its file system metadata.
+ *
+ * Directory entries are usually created by arc::io::sys::list_entries(), which
+ * fills in the type of each entry from the directory listing itself where the
+ * platform supports it. This means an entry can be passed to operations such
+ * as arc::io::sys::is_directory() without the file system being queried again.
+ *
+ * The size and modification time of an entry are loaded the first time they
+ * are requested, unless they were already loaded while listing the directory.
+ *
+ * \note The metadata of a DirEntry describes the path at the time it was read
+ *       and does not follow symbolic links.
+ */
+class DirEntry
+{
+public:
+
+    //--------------------------------------------------------------------------
+    //                                 ENUMERATOR
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief The possible types of a directory entry.
+     */
+    enum Type
+    {
+        /// The type of the entry could not be determined.
+        TYPE_UNKNOWN = 0,
+        /// The entry is a regular file.
+        TYPE_FILE,
+        /// The entry is a directory.
+        TYPE_DIRECTORY,
+        /// The entry is a symbolic link.
+        TYPE_SYMBOLIC_LINK,
+        /// The entry is some other type of file system object.
+        TYPE_OTHER
+    };
+
+    //--------------------------------------------------------------------------
+    //                                CONSTRUCTORS
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief Creates a new empty DirEntry.
+     */
+    DirEntry();
+
+    /*!
+     * \brief Creates a new DirEntry for the given path.
+     *
+     * The type and metadata of the entry will be queried from the file system
+     * when they are first requested.
+     */
+    explicit DirEntry(const arc::io::sys::Path& path);
+
+    /*!
+     * \brief Creates a new DirEntry for the given path which has already been
+     *        read from a directory.
+     *
+     * \param path The path of the entry.
+     * \param type The type of the entry, if this is TYPE_UNKNOWN the type will
+     *             be queried from the file system when first requested.
+     * \param inode The inode number of the entry.
+     */
+    DirEntry(const arc::io::sys::Path& path, Type type, arc::uint64 inode);
+
+    //--------------------------------------------------------------------------
+    //                          PUBLIC STATIC FUNCTIONS
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief Reads the entries of the given directory.
+     *
+     * This is the implementation of arc::io::sys::list_entries(), the read
+     * entries are appended to the given vector in the order the operating
+     * system provides them.
+     *
+     * \param path The path of the directory to read.
+     * \param include_special Whether the special "." and ".." entries will be
+     *                        included.
+     * \param load_metadata Whether the size and modification time of each
+     *                      entry should be loaded while the directory is open.
+     * \param entries Returns the entries read from the directory.
+     *
+     * \return Whether the directory could be read.
+     */
+    static bool read_directory(
+            const arc::io::sys::Path& path,
+            bool include_special,
+            bool load_metadata,
+            std::vector<DirEntry>& entries);
+
+    //--------------------------------------------------------------------------
+    //                                 OPERATORS
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief Orders entries by their path.
+     */
+    bool operator<(const DirEntry& other) const;
+
+    //--------------------------------------------------------------------------
+    //                          PUBLIC MEMBER FUNCTIONS
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief Returns the path of this entry.
+     */
+    const arc::io::sys::Path& get_path() const;
+
+    /*!
+     * \brief Returns the type of this entry.
+     *
+     * If the type was not provided by the directory listing the file system
+     * will be queried, if the path no longer exists TYPE_UNKNOWN is returned.
+     */
+    Type get_type() const;
+
+    /*!
+     * \brief Returns whether this entry is one of the special "." or ".."
+     *        entries of a directory.
+     */
+    bool is_special() const;
+
+    /*!
+     * \brief Returns the inode number of this entry.
+     *
+     * Inode numbers are not available on Windows, so this always returns
+     * ```0```.
+     */
+    arc::uint64 get_inode() const;
+
+    /*!
+     * \brief Returns the size of this entry in bytes.
+     *
+     * \throws arc::ex::IOError If the metadata of the entry needed to be loaded
+     *                          but the path no longer exists.
+     */
+    arc::int64 get_size() const;
+
+    /*!
+     * \brief Returns the time this entry was last modified, measured in
+     *        milliseconds since Linux Epoch (1st January 1970).
+     *
+     * \throws arc::ex::IOError If the metadata of the entry needed to be loaded
+     *                          but the path no longer exists.
+     */
+    arc::uint64 get_modified_time() const;
+
+    /*!
+     * \brief Returns whether the size and modification time of this entry
+     *        have been loaded.
+     */
+    bool has_metadata() const;
+
+private:
+
+    //--------------------------------------------------------------------------
+    //                             PRIVATE ATTRIBUTES
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief The path of the entry.
+     */
+    arc::io::sys::Path m_path;
+    /*!
+     * \brief The type of the entry.
+     */
+    mutable Type m_type;
+    /*!
+     * \brief The inode number of the entry.
+     */
+    mutable arc::uint64 m_inode;
+    /*!
+     * \brief Whether the size and modification time have been loaded.
+     */
+    mutable bool m_has_metadata;
+    /*!
+     * \brief The size of the entry in bytes.
+     */
+    mutable arc::int64 m_size;
+    /*!
+     * \brief The modification time of the entry in milliseconds.
+     */
+    mutable arc::uint64 m_modified_time;
+
+    //--------------------------------------------------------------------------
+    //                          PRIVATE MEMBER FUNCTIONS
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief Queries the file system for the metadata of this entry.
+     *
+     * \return Whether the path could be queried.
+     */
+    bool load_metadata() const;
+};
+
+} // namespace sys
+} // namespace io
+} // namespace arc
+
+#endif
@@ -0,0 +1,274 @@
+#include "arcanecore/io/sys/DirectoryWalker.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace arc
+{
+namespace io
+{
+namespace sys
+{
+
+//------------------------------------------------------------------------------
+//                                    OBJECTS
+//------------------------------------------------------------------------------
+
+/*!
+ * \brief A directory waiting to be read by a parallel walk.
+ */
+struct PendingDirectory
+{
+    //----------------------------PUBLIC ATTRIBUTES-----------------------------
+    arc::io::sys::Path path;
+    std::size_t depth;
+    //-------------------------------CONSTRUCTOR--------------------------------
+    PendingDirectory(const arc::io::sys::Path& _path, std::size_t _depth)
+        :
+        path (_path),
+        depth(_depth)
+    {
+    }
+};
+
+//------------------------------------------------------------------------------
+//                                  CONSTRUCTORS
+//------------------------------------------------------------------------------
+
+DirectoryWalker::DirectoryWalker(const arc::io::sys::Path& root)
+    :
+    m_root           (root),
+    m_thread_count   (1),
+    m_sorted         (false),
+    m_include_special(false),
+    m_load_metadata  (false)
+{
+}
+
+//------------------------------------------------------------------------------
+//                            PUBLIC MEMBER FUNCTIONS
+//------------------------------------------------------------------------------
+
+const arc::io::sys::Path& DirectoryWalker::get_root() const
+{
+    return m_root;
+}
+
+void DirectoryWalker::set_filter(Filter filter)
+{
+    m_filter = filter;
+}
+
+void DirectoryWalker::set_prune(Prune prune)
+{
+    m_prune = prune;
+}
+
+std::size_t DirectoryWalker::get_thread_count() const
+{
+    return m_thread_count;
+}
+
+void DirectoryWalker::set_thread_count(std::size_t thread_count)
+{
+    m_thread_count = thread_count;
+}
+
+bool DirectoryWalker::get_sorted() const
+{
+    return m_sorted;
+}
+
+void DirectoryWalker::set_sorted(bool sorted)
+{
+    m_sorted = sorted;
+}
+
+bool DirectoryWalker::get_include_special() const
+{
+    return m_include_special;
+}
+
+void DirectoryWalker::set_include_special(bool include_special)
+{
+    m_include_special = include_special;
+}
+
+bool DirectoryWalker::get_load_metadata() const
+{
+    return m_load_metadata;
+}
+
+void DirectoryWalker::set_load_metadata(bool load_metadata)
+{
+    m_load_metadata = load_metadata;
+}
+
+void DirectoryWalker::walk(Visitor visitor) const
+{
+    if(m_thread_count > 1)
+    {
+        walk_parallel(visitor);
+    }
+    else
+    {
+        walk_serial(m_root, 0, visitor);
+    }
+}
+
+//------------------------------------------------------------------------------
+//                            PRIVATE MEMBER FUNCTIONS
+//------------------------------------------------------------------------------
+
+void DirectoryWalker::walk_serial(
+        const arc::io::sys::Path& directory,
+        std::size_t depth,
+        const Visitor& visitor) const
+{
+    // the directory is read completely before descending so that only one
+    // directory is held open at a time
+    std::vector<arc::io::sys::DirEntry> dir_entries;
+    if(!arc::io::sys::DirEntry::read_directory(
+            directory,
+            m_include_special,
+            m_load_metadata,
+            dir_entries))
+    {
+        return;
+    }
+    if(m_sorted)
+    {
+        std::sort(dir_entries.begin(), dir_entries.end());
+    }
+
+    ARC_FOR_EACH(dir_entry, dir_entries)
+    {
+        Entry entry(*dir_entry, depth);
+
+        if(!m_filter || m_filter(entry))
+        {
+            visitor(entry);
+        }
+
+        // descend?
+        if(entry.get_type() == arc::io::sys::DirEntry::TYPE_DIRECTORY &&
+           !entry.is_special()                                      &&
+           (!m_prune || !m_prune(entry)))
+        {
+            walk_serial(entry.get_path(), depth + 1, visitor);
+        }
+    }
+}
+
+void DirectoryWalker::walk_parallel(const Visitor& visitor) const
+{
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::deque<PendingDirectory> pending;
+    // the number of directories queued or being read
+    std::size_t outstanding = 1;
+    std::exception_ptr error;
+
+    pending.push_back(PendingDirectory(m_root, 0));
+
+    auto run = [&]()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        while(true)
+        {
+            while(pending.empty() && outstanding > 0 && !error)
+            {
+                condition.wait(lock);
+            }
+            if(pending.empty() || error)
+            {
+                break;
+            }
+
+            PendingDirectory directory(pending.front());
+            pending.pop_front();
+            lock.unlock();
+
+            // read without holding the lock
+            std::vector<arc::io::sys::DirEntry> dir_entries;
+            arc::io::sys::DirEntry::read_directory(
+                directory.path,
+                m_include_special,
+                m_load_metadata,
+                dir_entries
+            );
+            if(m_sorted)
+            {
+                std::sort(dir_entries.begin(), dir_entries.end());
+            }
+
+            lock.lock();
+            try
+            {
+                ARC_FOR_EACH(dir_entry, dir_entries)
+                {
+                    if(error)
+                    {
+                        break;
+                    }
+
+                    Entry entry(*dir_entry, directory.depth);
+
+                    if(!m_filter || m_filter(entry))
+                    {
+                        visitor(entry);
+                    }
+
+                    if(entry.get_type() ==
+                           arc::io::sys::DirEntry::TYPE_DIRECTORY &&
+                       !entry.is_special()                        &&
+                       (!m_prune || !m_prune(entry)))
+                    {
+                        pending.push_back(PendingDirectory(
+                            entry.get_path(),
+                            entry.depth + 1
+                        ));
+                        ++outstanding;
+                        condition.notify_one();
+                    }
+                }
+            }
+            catch(...)
+            {
+                if(!error)
+                {
+                    error = std::current_exception();
+                }
+            }
+
+            if(--outstanding == 0 || error)
+            {
+                condition.notify_all();
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for(std::size_t i = 0; i < m_thread_count; ++i)
+    {
+        threads.push_back(std::thread(run));
+    }
+    ARC_FOR_EACH(thread, threads)
+    {
+        thread->join();
+    }
+
+    if(error)
+    {
+        std::rethrow_exception(error);
+    }
+}
+
+} // namespace sys
+} // namespace io
+} // namespace arc
@@ -0,0 +1,276 @@
+/*!
+ * \file
+ * \author David Saxon
+ */
+#ifndef ARCANECORE_IO_SYS_DIRECTORYWALKER_HPP_
+#define ARCANECORE_IO_SYS_DIRECTORYWALKER_HPP_
+
+#include <functional>
+
+#include "arcanecore/io/sys/DirEntry.hpp"
+
+namespace arc
+{
+namespace io
+{
+namespace sys
+{
+
+/*!
+ * \brief Used to visit every path beneath a directory.
+ *
+ * Entries are passed to a visitor function as soon as their directory has
+ * been read, rather than being collected into a single list. Each entry is a
+ * arc::io::sys::DirEntry, so its type is retrieved from the directory listing
+ * itself where the platform supports it and the file system is only queried
+ * separately when the type is not available.
+ *
+ * Filter and prune functions can be provided to control which paths are
+ * passed to the visitor and which directories are descended into, and
+ * subdirectories may be traversed in parallel using a pool of threads.
+ *
+ * Example usage:
+ *
+ * \code
+ * arc::io::sys::DirectoryWalker walker(root);
+ * // don't descend into hidden directories
+ * walker.set_prune([](const arc::io::sys::DirectoryWalker::Entry& entry)
+ * {
+ *     return entry.get_path().get_back().starts_with(".");
+ * });
+ * walker.walk([](const arc::io::sys::DirectoryWalker::Entry& entry)
+ * {
+ *     // ... process entry.get_path()
+ * });
+ * \endcode
+ *
+ * \note Symbolic links are never followed.
+ */
+class DirectoryWalker
+{
+public:
+
+    //--------------------------------------------------------------------------
+    //                                  STRUCTS
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief A directory entry found while walking, along with its depth.
+     *
+     * The path of the entry begins with the root path of the walk.
+     */
+    struct Entry : public arc::io::sys::DirEntry
+    {
+        /*!
+         * \brief How far beneath the root the entry is, where the direct
+         *        children of the root have a depth of ```0```.
+         */
+        std::size_t depth;
+
+        Entry(const arc::io::sys::DirEntry& entry, std::size_t _depth)
+            :
+            arc::io::sys::DirEntry(entry),
+            depth                 (_depth)
+        {
+        }
+    };
+
+    //--------------------------------------------------------------------------
+    //                                  TYPEDEFS
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief Function which receives the entries found by the walk.
+     */
+    typedef std::function<void(const Entry&)> Visitor;
+
+    /*!
+     * \brief Function which returns whether the given entry should be passed
+     *        to the visitor.
+     */
+    typedef std::function<bool(const Entry&)> Filter;
+
+    /*!
+     * \brief Function which returns whether the walk should not descend into
+     *        the given directory entry.
+     */
+    typedef std::function<bool(const Entry&)> Prune;
+
+    //--------------------------------------------------------------------------
+    //                                CONSTRUCTORS
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief Creates a new DirectoryWalker that will walk the given directory.
+     *
+     * \param root The path of the directory to walk.
+     */
+    DirectoryWalker(const arc::io::sys::Path& root);
+
+    //--------------------------------------------------------------------------
+    //                          PUBLIC MEMBER FUNCTIONS
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief Returns the path of the directory that will be walked.
+     */
+    const arc::io::sys::Path& get_root() const;
+
+    /*!
+     * \brief Sets the function used to select which entries are passed to the
+     *        visitor.
+     *
+     * A directory that is filtered out will still be descended into unless it
+     * is also pruned, see set_prune(). By default every entry is passed to the
+     * visitor.
+     */
+    void set_filter(Filter filter);
+
+    /*!
+     * \brief Sets the function used to select directories that will not be
+     *        descended into.
+     *
+     * The prune function is only called for directory entries. A pruned
+     * directory is still passed to the visitor if it passes the filter. By
+     * default every directory is descended into.
+     */
+    void set_prune(Prune prune);
+
+    /*!
+     * \brief Returns the number of threads used to walk the directory.
+     */
+    std::size_t get_thread_count() const;
+
+    /*!
+     * \brief Sets the number of threads used to walk the directory.
+     *
+     * If the thread count is ```0``` or ```1``` (the default) the walk is
+     * performed entirely on the thread calling walk(). Otherwise the given
+     * number of threads will read directories in parallel. Regardless of the
+     * thread count the visitor, filter and prune functions are never called
+     * concurrently.
+     */
+    void set_thread_count(std::size_t thread_count);
+
+    /*!
+     * \brief Returns whether the entries of each directory will be visited in
+     *        sorted order.
+     */
+    bool get_sorted() const;
+
+    /*!
+     * \brief Sets whether the entries of each directory will be visited in
+     *        sorted order.
+     *
+     * When walking with a single thread, sorted entries result in the same
+     * order as arc::io::sys::list_rec(). Otherwise the entries are visited in
+     * the order the operating system provides them, which is faster. Defaults
+     * to ```false```.
+     */
+    void set_sorted(bool sorted);
+
+    /*!
+     * \brief Returns whether the special "." and ".." entries of each
+     *        directory will be visited.
+     */
+    bool get_include_special() const;
+
+    /*!
+     * \brief Sets whether the special "." and ".." entries of each directory
+     *        will be visited.
+     *
+     * Special entries are never descended into. Defaults to ```false```.
+     */
+    void set_include_special(bool include_special);
+
+    /*!
+     * \brief Returns whether the size and modification time of each entry
+     *        will be loaded while its directory is read.
+     */
+    bool get_load_metadata() const;
+
+    /*!
+     * \brief Sets whether the size and modification time of each entry will be
+     *        loaded while its directory is read.
+     *
+     * This should be enabled if the visitor will request the metadata of most
+     * entries, since it can then be queried relative to the open directory.
+     * Defaults to ```false```.
+     */
+    void set_load_metadata(bool load_metadata);
+
+    /*!
+     * \brief Walks the directory passing the entries found to the given
+     *        visitor.
+     *
+     * When walking with a single thread directories are walked depth first,
+     * so the entries beneath a directory are visited directly after the
+     * directory itself.
+     *
+     * If the root path is not a directory, or a directory cannot be read,
+     * there are no entries to visit for that directory.
+     *
+     * \throws Any exception thrown by the visitor, filter, or prune functions,
+     *         the walk is stopped as soon as possible once an exception has
+     *         been thrown.
+     */
+    void walk(Visitor visitor) const;
+
+private:
+
+    //--------------------------------------------------------------------------
+    //                             PRIVATE ATTRIBUTES
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief The directory to walk.
+     */
+    arc::io::sys::Path m_root;
+    /*!
+     * \brief The function used to filter the visited entries.
+     */
+    Filter m_filter;
+    /*!
+     * \brief The function used to prune directories from the walk.
+     */
+    Prune m_prune;
+    /*!
+     * \brief The number of threads used to walk.
+     */
+    std::size_t m_thread_count;
+    /*!
+     * \brief Whether the entries of each directory are sorted.
+     */
+    bool m_sorted;
+    /*!
+     * \brief Whether special directory entries are visited.
+     */
+    bool m_include_special;
+    /*!
+     * \brief Whether entry metadata is loaded while reading directories.
+     */
+    bool m_load_metadata;
+
+    //--------------------------------------------------------------------------
+    //                          PRIVATE MEMBER FUNCTIONS
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief Recursively walks the given directory on the calling thread.
+     */
+    void walk_serial(
+            const arc::io::sys::Path& directory,
+            std::size_t depth,
+            const Visitor& visitor) const;
+
+    /*!
+     * \brief Walks the root directory using a pool of threads.
+     */
+    void walk_parallel(const Visitor& visitor) const;
+};
+
+} // namespace sys
+} // namespace io
+} // namespace arc
+
+#endif
@@ -1,6 +1,21 @@
 #include "arcanecore/io/sys/FileHandle.hpp"
 
 #include "arcanecore/base/Exceptions.hpp"
+#include "arcanecore/base/os/OSOperations.hpp"
+
+#ifdef ARC_OS_UNIX
+    #include <cerrno>
+    #include <fcntl.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#elif defined(ARC_OS_WINDOWS)
+    #include <fcntl.h>
+    #include <io.h>
+    #include <sys/stat.h>
+    #include <windows.h>
+
+    #include "arcanecore/base/str/StringOperations.hpp"
+#endif
 
 namespace arc
 {
@@ -15,31 +30,49 @@ namespace sys
 
 FileHandle::FileHandle(FileHandle&& other)
     :
-    m_open    (other.m_open),
-    m_path    (std::move(other.m_path)),
-    m_encoding(other.m_encoding),
-    m_newline (other.m_newline)
+    m_open      (other.m_open),
+    m_descriptor(other.m_descriptor),
+    m_path      (std::move(other.m_path)),
+    m_encoding   (other.m_encoding),
+    m_newline    (other.m_newline),
+    m_io_counters(std::move(other.m_io_counters))
 {
     // reset other resources
-    other.m_open     = false;
+    other.m_open       = false;
+    other.m_descriptor = -1;
     other.m_encoding = ENCODING_DETECT;
     other.m_newline  = NEWLINE_UNIX;
 }
 
+//------------------------------------------------------------------------------
+//                                   DESTRUCTOR
+//------------------------------------------------------------------------------
+
+FileHandle::~FileHandle()
+{
+    close_descriptor();
+}
+
 //------------------------------------------------------------------------------
 //                                   OPERATORS
 //------------------------------------------------------------------------------
 
 FileHandle& FileHandle::operator=(FileHandle&& other)
 {
+    // release any descriptor still held by this handle
+    close_descriptor();
+
     // steal resources
     m_open = other.m_open;
+    m_descriptor = other.m_descriptor;
     m_path = std::move(other.m_path);
     m_encoding = other.m_encoding;
     m_newline = other.m_newline;
+    m_io_counters = std::move(other.m_io_counters);
 
     // reset other resources
     other.m_open = false;
+    other.m_descriptor = -1;
     other.m_encoding = ENCODING_DETECT;
     other.m_newline  = NEWLINE_UNIX;
 
@@ -70,6 +103,16 @@ FileHandle::Newline FileHandle::get_newline() const
     return m_newline;
 }
 
+arc::io::sys::IOStats FileHandle::get_io_stats() const
+{
+    return m_io_counters.get_stats();
+}
+
+void FileHandle::reset_io_stats()
+{
+    m_io_counters.reset();
+}
+
 void FileHandle::set_path(const arc::io::sys::Path& path)
 {
     // ensure the handle isn't open
@@ -138,9 +181,10 @@ std::size_t FileHandle::get_bom_size() const
 
 FileHandle::FileHandle(Encoding encoding, Newline newline)
     :
-    m_open    (false),
-    m_encoding(encoding),
-    m_newline (newline)
+    m_open      (false),
+    m_descriptor(-1),
+    m_encoding  (encoding),
+    m_newline   (newline)
 {
     handle_newline_detect();
 }
@@ -150,14 +194,356 @@ FileHandle::FileHandle(
         Encoding encoding,
         Newline newline)
     :
-    m_open    (false),
-    m_path    (path),
-    m_encoding(encoding),
-    m_newline (newline)
+    m_open      (false),
+    m_descriptor(-1),
+    m_path      (path),
+    m_encoding  (encoding),
+    m_newline   (newline)
 {
     handle_newline_detect();
 }
 
+//------------------------------------------------------------------------------
+//                           PROTECTED STATIC FUNCTIONS
+//------------------------------------------------------------------------------
+
+int FileHandle::open_descriptor(const arc::io::sys::Path& path, int flags)
+{
+#ifdef ARC_OS_UNIX
+
+    int descriptor = -1;
+    do
+    {
+        descriptor = ::open(
+            path.to_native().get_raw(),
+            flags | O_CLOEXEC,
+            0666
+        );
+    }
+    while(descriptor < 0 && errno == EINTR);
+    return descriptor;
+
+#elif defined(ARC_OS_WINDOWS)
+
+    // utf-16 path
+    std::size_t length = 0;
+    const char* w_path = arc::str::utf8_to_utf16(
+        path.to_windows(),
+        length,
+        arc::data::ENDIAN_LITTLE
+    );
+    int descriptor = _wopen(
+        (const wchar_t*) w_path,
+        flags | _O_BINARY | _O_NOINHERIT,
+        _S_IREAD | _S_IWRITE
+    );
+    delete[] w_path;
+    return descriptor;
+
+#else
+
+    throw arc::ex::NotImplementedError(
+        "FileHandle::open_descriptor has not yet been implemented for this "
+        "platform."
+    );
+
+#endif
+}
+
+//------------------------------------------------------------------------------
+//                           PROTECTED MEMBER FUNCTIONS
+//------------------------------------------------------------------------------
+
+void FileHandle::close_descriptor()
+{
+    if(m_descriptor < 0)
+    {
+        return;
+    }
+
+#ifdef ARC_OS_UNIX
+    // the descriptor is released even if close is interrupted on Linux, so
+    // it must not be retried
+    ::close(m_descriptor);
+#elif defined(ARC_OS_WINDOWS)
+    _close(m_descriptor);
+#endif
+    m_descriptor = -1;
+}
+
+arc::int64 FileHandle::descriptor_size() const
+{
+#ifdef ARC_OS_UNIX
+
+    struct stat s;
+    if(fstat(m_descriptor, &s) != 0)
+    {
+        arc::str::UTF8String error_message;
+        error_message << "Failed to query the size of file \"" << m_path
+                      << "\": " << arc::os::get_last_system_error_message();
+        throw arc::ex::IOError(error_message);
+    }
+    return static_cast<arc::int64>(s.st_size);
+
+#elif defined(ARC_OS_WINDOWS)
+
+    return static_cast<arc::int64>(_filelengthi64(m_descriptor));
+
+#else
+
+    return 0;
+
+#endif
+}
+
+arc::int64 FileHandle::descriptor_tell() const
+{
+    arc::uint64 start_time = IOCounters::start_timer();
+#ifdef ARC_OS_UNIX
+    arc::int64 result =
+        static_cast<arc::int64>(lseek(m_descriptor, 0, SEEK_CUR));
+#elif defined(ARC_OS_WINDOWS)
+    arc::int64 result = static_cast<arc::int64>(_telli64(m_descriptor));
+#else
+    arc::int64 result = -1;
+#endif
+    m_io_counters.record_seek(start_time);
+
+    if(result < 0)
+    {
+        arc::str::UTF8String error_message;
+        error_message << "Failed to query the position in file \"" << m_path
+                      << "\": " << arc::os::get_last_system_error_message();
+        throw arc::ex::IOError(error_message);
+    }
+    return result;
+}
+
+void FileHandle::descriptor_seek(arc::int64 index)
+{
+    arc::uint64 start_time = IOCounters::start_timer();
+#ifdef ARC_OS_UNIX
+    arc::int64 result = static_cast<arc::int64>(
+        lseek(m_descriptor, static_cast<off_t>(index), SEEK_SET));
+#elif defined(ARC_OS_WINDOWS)
+    arc::int64 result = static_cast<arc::int64>(
+        _lseeki64(m_descriptor, index, SEEK_SET));
+#else
+    arc::int64 result = -1;
+#endif
+    m_io_counters.record_seek(start_time);
+
+    if(result < 0)
+    {
+        arc::str::UTF8String error_message;
+        error_message << "Failed to seek to byte " << index << " of file \""
+                      << m_path << "\": "
+                      << arc::os::get_last_system_error_message();
+        throw arc::ex::IOError(error_message);
+    }
+}
+
+arc::int64 FileHandle::descriptor_read(char* data, arc::int64 length)
+{
+    arc::int64 total = 0;
+    while(total < length)
+    {
+        arc::uint64 start_time = IOCounters::start_timer();
+#ifdef ARC_OS_UNIX
+        ssize_t result = ::read(
+            m_descriptor,
+            data + total,
+            static_cast<std::size_t>(length - total)
+        );
+        if(result < 0 && errno == EINTR)
+        {
+            continue;
+        }
+#elif defined(ARC_OS_WINDOWS)
+        int result = _read(
+            m_descriptor,
+            data + total,
+            static_cast<unsigned int>(length - total)
+        );
+#else
+        int result = -1;
+#endif
+        m_io_counters.record_read(
+            static_cast<arc::uint64>(result < 0 ? 0 : result),
+            start_time
+        );
+        if(result < 0)
+        {
+            arc::str::UTF8String error_message;
+            error_message << "Failed to read from file \"" << m_path << "\": "
+                          << arc::os::get_last_system_error_message();
+            throw arc::ex::IOError(error_message);
+        }
+        if(result == 0)
+        {
+            break;
+        }
+        total += static_cast<arc::int64>(result);
+    }
+    return total;
+}
+
+arc::int64 FileHandle::descriptor_read_at(
+        char* data,
+        arc::int64 length,
+        arc::int64 offset) const
+{
+    arc::int64 total = 0;
+    while(total < length)
+    {
+        arc::uint64 start_time = IOCounters::start_timer();
+#ifdef ARC_OS_UNIX
+        ssize_t result = pread(
+            m_descriptor,
+            data + total,
+            static_cast<std::size_t>(length - total),
+            static_cast<off_t>(offset + total)
+        );
+        if(result < 0 && errno == EINTR)
+        {
+            continue;
+        }
+#elif defined(ARC_OS_WINDOWS)
+        // Windows has no pread, so an overlapped read is used instead. Note
+        // that this moves the descriptor's file offset.
+        OVERLAPPED overlapped = {};
+        overlapped.Offset = static_cast<DWORD>(offset + total);
+        overlapped.OffsetHigh = static_cast<DWORD>((offset + total) >> 32);
+        DWORD read_count = 0;
+        int result = -1;
+        if(ReadFile(
+                (HANDLE) _get_osfhandle(m_descriptor),
+                data + total,
+                static_cast<DWORD>(length - total),
+                &read_count,
+                &overlapped))
+        {
+            result = static_cast<int>(read_count);
+        }
+        else if(GetLastError() == ERROR_HANDLE_EOF)
+        {
+            result = 0;
+        }
+#else
+        int result = -1;
+#endif
+        m_io_counters.record_read(
+            static_cast<arc::uint64>(result < 0 ? 0 : result),
+            start_time
+        );
+        if(result < 0)
+        {
+            arc::str::UTF8String error_message;
+            error_message << "Failed to read from file \"" << m_path << "\": "
+                          << arc::os::get_last_system_error_message();
+            throw arc::ex::IOError(error_message);
+        }
+        if(result == 0)
+        {
+            break;
+        }
+        total += static_cast<arc::int64>(result);
+    }
+    return total;
+}
+
+void FileHandle::descriptor_write(const char* data, std::size_t length)
+{
+    std::size_t total = 0;
+    while(total < length)
+    {
+        arc::uint64 start_time = IOCounters::start_timer();
+#ifdef ARC_OS_UNIX
+        ssize_t result = ::write(m_descriptor, data + total, length - total);
+        if(result < 0 && errno == EINTR)
+        {
+            continue;
+        }
+#elif defined(ARC_OS_WINDOWS)
+        int result = _write(
+            m_descriptor,
+            data + total,
+            static_cast<unsigned int>(length - total)
+        );
+#else
+        int result = -1;
+#endif
+        m_io_counters.record_write(
+            static_cast<arc::uint64>(result < 0 ? 0 : result),
+            start_time
+        );
+        if(result < 0)
+        {
+            arc::str::UTF8String error_message;
+            error_message << "Failed to write to file \"" << m_path << "\": "
+                          << arc::os::get_last_system_error_message();
+            throw arc::ex::IOError(error_message);
+        }
+        total += static_cast<std::size_t>(result);
+    }
+}
+
+void FileHandle::descriptor_write_at(
+        const char* data,
+        std::size_t length,
+        arc::int64 offset) const
+{
+    std::size_t total = 0;
+    while(total < length)
+    {
+        arc::int64 position = offset + static_cast<arc::int64>(total);
+        arc::uint64 start_time = IOCounters::start_timer();
+#ifdef ARC_OS_UNIX
+        ssize_t result = pwrite(
+            m_descriptor,
+            data + total,
+            length - total,
+            static_cast<off_t>(position)
+        );
+        if(result < 0 && errno == EINTR)
+        {
+            continue;
+        }
+#elif defined(ARC_OS_WINDOWS)
+        // Windows has no pwrite, so an overlapped write is used instead. Note
+        // that this moves the descriptor's file offset.
+        OVERLAPPED overlapped = {};
+        overlapped.Offset = static_cast<DWORD>(position);
+        overlapped.OffsetHigh = static_cast<DWORD>(position >> 32);
+        DWORD write_count = 0;
+        int result = -1;
+        if(WriteFile(
+                (HANDLE) _get_osfhandle(m_descriptor),
+                data + total,
+                static_cast<DWORD>(length - total),
+                &write_count,
+                &overlapped))
+        {
+            result = static_cast<int>(write_count);
+        }
+#else
+        int result = -1;
+#endif
+        m_io_counters.record_write(
+            static_cast<arc::uint64>(result < 0 ? 0 : result),
+            start_time
+        );
+        if(result < 0)
+        {
+            arc::str::UTF8String error_message;
+            error_message << "Failed to write to file \"" << m_path << "\": "
+                          << arc::os::get_last_system_error_message();
+            throw arc::ex::IOError(error_message);
+        }
+        total += static_cast<std::size_t>(result);
+    }
+}
+
 //------------------------------------------------------------------------------
 //                            PRIVATE MEMBER FUNCTIONS
 //------------------------------------------------------------------------------
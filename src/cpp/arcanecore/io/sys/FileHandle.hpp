@@ -6,6 +6,7 @@
 #define ARCANECORE_IO_SYS_FILEHANDLE_HPP_
 
 #include "arcanecore/base/Types.hpp"
+#include "arcanecore/io/sys/IOStats.hpp"
 #include "arcanecore/io/sys/Path.hpp"
 
 namespace arc
@@ -77,9 +78,7 @@ public:
     //                                 DESTRUCTOR
     //--------------------------------------------------------------------------
 
-    virtual ~FileHandle()
-    {
-    }
+    virtual ~FileHandle();
 
     //--------------------------------------------------------------------------
     //                                 OPERATORS
@@ -118,6 +117,18 @@ public:
      */
     Newline get_newline() const;
 
+    /*!
+     * \brief Returns a snapshot of the I/O this FileHandle has performed.
+     *
+     * \note All counts are zero if ```ARC_IO_DISABLE_STATS``` is defined.
+     */
+    arc::io::sys::IOStats get_io_stats() const;
+
+    /*!
+     * \brief Sets the I/O counts of this FileHandle back to zero.
+     */
+    void reset_io_stats();
+
     /*!
      * \brief Sets the path to be used by this FileHandle.
      *
@@ -221,6 +232,12 @@ protected:
      */
     bool m_open;
 
+    /*!
+     * \brief The operating system file descriptor used to access the file,
+     *        this is ```-1``` when no file is open.
+     */
+    int m_descriptor;
+
     /*!
      * \brief The path this FileHandle is using.
      */
@@ -233,6 +250,11 @@ protected:
      * \brief The newline symbol this FileHandle is using.
      */
     Newline m_newline;
+    /*!
+     * \brief The I/O performed by this FileHandle, this is mutable since const
+     *        functions such as tell() still perform system calls.
+     */
+    mutable arc::io::sys::IOCounters m_io_counters;
 
     //--------------------------------------------------------------------------
     //                           PROTECTED CONSTRUCTORS
@@ -271,6 +293,91 @@ protected:
             Encoding encoding = ENCODING_DETECT,
             Newline newline = NEWLINE_UNIX);
 
+    //--------------------------------------------------------------------------
+    //                          PROTECTED STATIC FUNCTIONS
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief Opens an operating system file descriptor to the given path.
+     *
+     * \param path The path of the file to open.
+     * \param flags The POSIX style ```O_*``` flags to open the file with.
+     *
+     * \returns The new file descriptor, or ```-1``` if the file could not be
+     *          opened.
+     */
+    static int open_descriptor(const arc::io::sys::Path& path, int flags);
+
+    //--------------------------------------------------------------------------
+    //                         PROTECTED MEMBER FUNCTIONS
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief Closes the current file descriptor if there is one.
+     */
+    void close_descriptor();
+
+    /*!
+     * \brief Returns the size in bytes of the file the current descriptor
+     *        refers to.
+     */
+    arc::int64 descriptor_size() const;
+
+    /*!
+     * \brief Returns the position of the current descriptor's file offset.
+     *
+     * \throws arc::ex::IOError If the position cannot be queried.
+     */
+    arc::int64 descriptor_tell() const;
+
+    /*!
+     * \brief Sets the current descriptor's file offset to the given index.
+     */
+    void descriptor_seek(arc::int64 index);
+
+    /*!
+     * \brief Reads up to the given number of bytes from the current
+     *        descriptor's file offset, stopping early only at the end of the
+     *        file.
+     *
+     * \returns The number of bytes read.
+     *
+     * \throws arc::ex::IOError If the read fails.
+     */
+    arc::int64 descriptor_read(char* data, arc::int64 length);
+
+    /*!
+     * \brief Reads up to the given number of bytes starting at the given
+     *        offset in the file, without using or modifying the descriptor's
+     *        file offset.
+     *
+     * \returns The number of bytes read.
+     *
+     * \throws arc::ex::IOError If the read fails.
+     */
+    arc::int64 descriptor_read_at(
+            char* data,
+            arc::int64 length,
+            arc::int64 offset) const;
+
+    /*!
+     * \brief Writes the given bytes at the current descriptor's file offset.
+     *
+     * \throws arc::ex::IOError If the write fails.
+     */
+    void descriptor_write(const char* data, std::size_t length);
+
+    /*!
+     * \brief Writes the given bytes starting at the given offset in the file,
+     *        without using or modifying the descriptor's file offset.
+     *
+     * \throws arc::ex::IOError If the write fails.
+     */
+    void descriptor_write_at(
+            const char* data,
+            std::size_t length,
+            arc::int64 offset) const;
+
 private:
 
     //--------------------------------------------------------------------------
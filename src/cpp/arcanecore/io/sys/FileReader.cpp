@@ -1,11 +1,19 @@
 #include "arcanecore/io/sys/FileReader.hpp"
 
+#include <algorithm>
 #include <cstring>
-#include <fstream>
+#include <vector>
 
 #include "arcanecore/base/str/StringOperations.hpp"
+#include "arcanecore/base/str/UTF16Decoder.hpp"
 #include "arcanecore/base/Exceptions.hpp"
 
+#ifdef ARC_OS_UNIX
+    #include <fcntl.h>
+#elif defined(ARC_OS_WINDOWS)
+    #include <fcntl.h>
+#endif
+
 namespace arc
 {
 namespace io
@@ -13,6 +21,16 @@ namespace io
 namespace sys
 {
 
+//------------------------------------------------------------------------------
+//                                   CONSTANTS
+//------------------------------------------------------------------------------
+
+/*!
+ * \brief The maximum number of bytes read ahead of the file position indicator
+ *        into the buffer.
+ */
+static const arc::int64 READ_AHEAD_SIZE = 64 * 1024;
+
 //------------------------------------------------------------------------------
 //                                    OBJECTS
 //------------------------------------------------------------------------------
@@ -39,17 +57,15 @@ struct NewlineChecker
         delete[] newline_sequence;
     }
     //-------------------------PUBLIC MEMBER FUNCTIONS--------------------------
-    bool check(const std::vector<char>& data)
+    bool check(const std::vector<char>& data, std::size_t end)
     {
-        if(data.size() < sequence_length)
+        if(end < sequence_length)
         {
             return false;
         }
-        // could perform some sort of caching?
         for(std::size_t i = 0; i < sequence_length; ++i)
         {
-            if(data[data.size() - (sequence_length - i)]
-               != newline_sequence[i])
+            if(data[end - (sequence_length - i)] != newline_sequence[i])
             {
                 return false;
             }
@@ -65,10 +81,13 @@ struct NewlineChecker
 FileReader::FileReader(Encoding encoding, Newline newline)
     :
     FileHandle             (encoding, newline),
-    m_stream               (nullptr),
     m_size                 (0),
+    m_position             (0),
+    m_eof                  (false),
     m_newline_checker_valid(false),
-    m_newline_checker      (new NewlineChecker())
+    m_newline_checker      (new NewlineChecker()),
+    m_buffer_offset        (0),
+    m_buffer_length        (0)
 {
 }
 
@@ -79,10 +98,13 @@ FileReader::FileReader(
         Newline newline)
     :
     FileHandle             (path, encoding, newline),
-    m_stream               (nullptr),
     m_size                 (0),
+    m_position             (0),
+    m_eof                  (false),
     m_newline_checker_valid(false),
-    m_newline_checker      (new NewlineChecker())
+    m_newline_checker      (new NewlineChecker()),
+    m_buffer_offset        (0),
+    m_buffer_length        (0)
 {
     open();
 }
@@ -90,15 +112,22 @@ FileReader::FileReader(
 FileReader::FileReader(FileReader&& other)
     :
     FileHandle             (std::move(other)),
-    m_stream               (other.m_stream),
     m_size                 (other.m_size),
+    m_position             (other.m_position),
+    m_eof                  (other.m_eof),
     m_newline_checker_valid(other.m_newline_checker_valid),
-    m_newline_checker      (std::move(other.m_newline_checker))
+    m_newline_checker      (std::move(other.m_newline_checker)),
+    m_buffer               (std::move(other.m_buffer)),
+    m_buffer_offset        (other.m_buffer_offset),
+    m_buffer_length        (other.m_buffer_length)
 {
     // reset other resources
-    other.m_stream = nullptr;
     other.m_size = 0;
+    other.m_position = 0;
+    other.m_eof = false;
     other.m_newline_checker_valid = false;
+    other.m_buffer_offset = 0;
+    other.m_buffer_length = 0;
 }
 
 //------------------------------------------------------------------------------
@@ -109,15 +138,22 @@ FileReader& FileReader::operator=(FileReader&& other)
 {
     // steal
     FileHandle::operator=(std::move(other));
-    m_stream = other.m_stream;
     m_size = other.m_size;
+    m_position = other.m_position;
+    m_eof = other.m_eof;
     m_newline_checker_valid =  other.m_newline_checker_valid;
     m_newline_checker = std::move(other.m_newline_checker);
+    m_buffer = std::move(other.m_buffer);
+    m_buffer_offset = other.m_buffer_offset;
+    m_buffer_length = other.m_buffer_length;
 
     // reset
-    other.m_stream = nullptr;
     other.m_size = 0;
+    other.m_position = 0;
+    other.m_eof = false;
     other.m_newline_checker_valid = false;
+    other.m_buffer_offset = 0;
+    other.m_buffer_length = 0;
 
     return *this;
 }
@@ -126,16 +162,9 @@ FileReader& FileReader::operator=(FileReader&& other)
 //                                   DESTRUCTOR
 //------------------------------------------------------------------------------
 
-inline FileReader::~FileReader()
+FileReader::~FileReader()
 {
-    if(m_open)
-    {
-        m_stream->close();
-    }
-    if(m_stream)
-    {
-        delete m_stream;
-    }
+    // the descriptor is closed by the FileHandle destructor
 }
 
 //------------------------------------------------------------------------------
@@ -151,45 +180,12 @@ void FileReader::open()
             "FileReader cannot be opened since it is already open.");
     }
 
-    // ensure we clean up the existing stream
-    if (m_stream)
-    {
-        delete m_stream;
-    }
-
-    // create a new stream
-#ifdef ARC_OS_WINDOWS
-
-    // utf-16 path
-    std::size_t length = 0;
-    const char* p = arc::str::utf8_to_utf16(
-        m_path.to_windows(),
-        length,
-        arc::data::ENDIAN_LITTLE
-    );
-
-    m_stream = new std::ifstream(
-        (const wchar_t*) p,
-        std::ios_base::in | std::ios_base::binary
-    );
-
-    delete[] p;
-
-#else
-
-    m_stream = new std::ifstream(
-        m_path.to_native().get_raw(),
-        std::ios_base::in | std::ios_base::binary
-    );
-
-#endif
+    // open the file descriptor
+    m_descriptor = open_descriptor(m_path, O_RDONLY);
 
     // did opening fail?
-    if(!m_stream->good())
+    if(m_descriptor < 0)
     {
-        // clean up
-        delete m_stream;
-
         // throw exception
         arc::str::UTF8String error_message;
         error_message << "Failed to open FileReader to path: \'"
@@ -198,9 +194,18 @@ void FileReader::open()
     }
 
     // retrieve the size of the file
-    m_stream->seekg(0, std::ios_base::end);
-    m_size = m_stream->tellg();
-    m_stream->seekg(0, std::ios_base::beg);
+    try
+    {
+        m_size = descriptor_size();
+    }
+    catch(...)
+    {
+        close_descriptor();
+        throw;
+    }
+    m_position = 0;
+    m_eof = false;
+    m_buffer_length = 0;
 
     // file reader is open
     m_open = true;
@@ -229,10 +234,11 @@ void FileReader::close()
             "FileReader cannot be closed since it is already closed.");
     }
 
-    // close and delete the stream
-    m_stream->close();
-    delete m_stream;
-    m_stream = nullptr;
+    // close the descriptor
+    close_descriptor();
+    m_position = 0;
+    m_eof = false;
+    m_buffer_length = 0;
     m_open = false;
 }
 
@@ -261,7 +267,7 @@ arc::int64 FileReader::tell() const
         );
     }
 
-    return m_stream->tellg();
+    return m_position;
 }
 
 void FileReader::seek(arc::int64 index)
@@ -283,10 +289,11 @@ void FileReader::seek(arc::int64 index)
     // clear any eof file flags before seeking within the file range
     else
     {
-        m_stream->clear();
+        m_eof = false;
     }
 
-    m_stream->seekg(index);
+    // reads are positional so only the tracked position needs to move
+    m_position = index;
 }
 
 bool FileReader::eof() const
@@ -299,7 +306,7 @@ bool FileReader::eof() const
         );
     }
 
-    return m_stream->eof();
+    return m_eof;
 }
 
 bool FileReader::has_bom()
@@ -375,15 +382,46 @@ void FileReader::read(char* data, arc::int64 length)
 {
     check_can_read();
 
-    m_stream->read(data, length);
+    arc::int64 read_length = 0;
+    if(length > 0)
+    {
+        read_length = read_buffered(data, length);
+        m_position += read_length;
+    }
+
+    // set the EOF flag as soon as the end of the file has been reached, rather
+    // than only once a read has gone past it. A short read also means the end
+    // of the file, which is earlier than expected if the file has shrunk since
+    // it was opened
+    if(read_length < length || m_position >= m_size)
+    {
+        m_eof = true;
+    }
+}
 
-    // little bit of a hack, but for some reason ifstream::read doesn't set the
-    // EOF flag unless you read past the end of the file. So we will forcibly
-    // set it if the we are at the end of the file.
-    if(!eof() && tell() >= get_size())
+arc::int64 FileReader::read_at(
+        char* data,
+        arc::int64 length,
+        arc::int64 offset) const
+{
+    // ensure the FileReader is open
+    if(!m_open)
     {
-        m_stream->setstate(std::ios_base::eofbit);
+        throw arc::ex::StateError(
+            "Cannot read data from a FileReader that is not open.");
+    }
+    if(offset < 0)
+    {
+        arc::str::UTF8String error_message;
+        error_message << "Cannot read from negative file offset: " << offset;
+        throw arc::ex::IndexOutOfBoundsError(error_message);
     }
+    if(length <= 0)
+    {
+        return 0;
+    }
+
+    return descriptor_read_at(data, length, offset);
 }
 
 void FileReader::read(arc::str::UTF8String& data, arc::int64 length)
@@ -412,44 +450,28 @@ void FileReader::read(arc::str::UTF8String& data, arc::int64 length)
         length -= bom_size;
     }
 
-    // read from file
     std::size_t length_t = static_cast<std::size_t>(length);
+
+    // UTF-16 is decoded in chunks so that the raw file data and the decoded
+    // string do not need to be held in memory at the same time
+    if(m_encoding == ENCODING_UTF16_LITTLE_ENDIAN ||
+       m_encoding == ENCODING_UTF16_BIG_ENDIAN)
+    {
+        read_utf16(data, length_t);
+        return;
+    }
+
+    // read from file, less data than requested is read if the file has shrunk
     char* c_data = new char[length_t + 1];
+    arc::int64 start = tell();
     read(c_data, length);
+    length_t = static_cast<std::size_t>(tell() - start);
     // ensure the data is null terminated
     c_data[length_t] = '\0';
 
-    // do we need to convert the encoding
-    switch(m_encoding)
-    {
-        case ENCODING_UTF16_LITTLE_ENDIAN:
-        {
-            data = arc::str::utf16_to_utf8(
-                c_data,
-                length_t,
-                arc::data::ENDIAN_LITTLE
-            );
-            delete[] c_data;
-            break;
-        }
-        case ENCODING_UTF16_BIG_ENDIAN:
-        {
-            data = arc::str::utf16_to_utf8(
-                c_data,
-                length_t,
-                arc::data::ENDIAN_BIG
-            );
-            delete[] c_data;
-            break;
-        }
-        default:
-        {
-            // TODO: optimised version of claim that takes length?
-            // give the character data to the UTF8String
-            data.claim(c_data);
-            break;
-        }
-    }
+    // TODO: optimised version of claim that takes length?
+    // give the character data to the UTF8String
+    data.claim(c_data);
 }
 
 std::size_t FileReader::read_line(char** data)
@@ -465,28 +487,45 @@ std::size_t FileReader::read_line(char** data)
     // get the newline checker to use
     NewlineChecker* newline_checker = get_newline_checker();
 
-    // TODO: this can be optimised to read blocks of data
-
-    // read characters into a vector
+    // read blocks of data until the newline sequence is found
+    static const arc::int64 block_size = 256;
     std::vector<char> read_data;
     std::size_t data_size = 0;
-    while(!eof())
-    {
-        read_data.push_back('\0');
-        read(&read_data[read_data.size() - 1], 1);
-        data_size = read_data.size();
-        // have we read the newline character?
-        if(newline_checker->check(read_data))
+    bool found_newline = false;
+    while(!found_newline && !eof())
+    {
+        // the block is cut short if the end of the file is reached
+        arc::int64 start = tell();
+        std::size_t offset = read_data.size();
+        read_data.resize(offset + static_cast<std::size_t>(block_size));
+        read(&read_data[offset], block_size);
+        read_data.resize(offset + static_cast<std::size_t>(tell() - start));
+
+        // search the new block for the newline symbol
+        for(std::size_t i = offset + 1; i <= read_data.size(); ++i)
         {
-            data_size -= newline_checker->sequence_length;
-            break;
+            if(newline_checker->check(read_data, i))
+            {
+                found_newline = true;
+                data_size = i - newline_checker->sequence_length;
+                // move back to the start of the next line
+                seek(start + static_cast<arc::int64>(i - offset));
+                break;
+            }
+        }
+        if(!found_newline)
+        {
+            data_size = read_data.size();
         }
     }
 
     // allocate new data
     *data = new char[data_size + 1];
     // copy
-    memcpy(*data, &read_data[0], data_size);
+    if(data_size > 0)
+    {
+        memcpy(*data, &read_data[0], data_size);
+    }
     // write null terminator
     (*data)[data_size] = '\0';
 
@@ -686,6 +725,133 @@ NewlineChecker* FileReader::get_newline_checker()
     return m_newline_checker.get();
 }
 
+arc::int64 FileReader::read_buffered(char* data, arc::int64 length)
+{
+    // copy whatever the buffer holds from the current position
+    arc::int64 copied = 0;
+    arc::int64 buffer_end = m_buffer_offset + m_buffer_length;
+    if(m_position >= m_buffer_offset && m_position < buffer_end)
+    {
+        copied = std::min(length, buffer_end - m_position);
+        memcpy(
+            data,
+            &m_buffer[static_cast<std::size_t>(m_position - m_buffer_offset)],
+            static_cast<std::size_t>(copied)
+        );
+        if(copied == length)
+        {
+            return copied;
+        }
+    }
+
+    arc::int64 position = m_position + copied;
+    arc::int64 remaining = length - copied;
+
+    // nothing past the size the file had when it was opened is read, which
+    // also keeps the buffer for reads that run up to the end of the file
+    if(position >= m_size)
+    {
+        return copied;
+    }
+
+    // large reads gain nothing from the buffer so go straight to the file
+    if(remaining >= READ_AHEAD_SIZE)
+    {
+        return copied + descriptor_read_at(data + copied, remaining, position);
+    }
+
+    // refill the buffer, only reading ahead as far as the end of the file
+    arc::int64 fill_length = std::max(
+        remaining,
+        std::min(READ_AHEAD_SIZE, m_size - position)
+    );
+    if(m_buffer.size() < static_cast<std::size_t>(fill_length))
+    {
+        m_buffer.resize(static_cast<std::size_t>(fill_length));
+    }
+    m_buffer_offset = position;
+    m_buffer_length = descriptor_read_at(&m_buffer[0], fill_length, position);
+
+    arc::int64 buffered = std::min(remaining, m_buffer_length);
+    memcpy(data + copied, &m_buffer[0], static_cast<std::size_t>(buffered));
+    return copied + buffered;
+}
+
+void FileReader::read_utf16(arc::str::UTF8String& data, std::size_t length)
+{
+    // the number of bytes of UTF-16 data that are decoded at a time
+    static const std::size_t chunk_size = 64 * 1024;
+
+    arc::str::UTF16Decoder decoder(
+        m_encoding == ENCODING_UTF16_BIG_ENDIAN
+            ? arc::data::ENDIAN_BIG
+            : arc::data::ENDIAN_LITTLE
+    );
+
+    // most text decodes to fewer UTF-8 bytes than UTF-16 bytes so start with
+    // the length of the input and only grow if needed
+    std::size_t capacity = length + arc::str::UTF16Decoder::MAX_FINISH_LENGTH;
+    char* output = new char[capacity + 1];
+    std::size_t output_length = 0;
+
+    std::vector<char> chunk(std::min(chunk_size, length));
+    std::size_t remaining = length;
+    try
+    {
+        while(remaining > 0)
+        {
+            std::size_t read_length = std::min(chunk_size, remaining);
+            arc::int64 start = tell();
+            read(&chunk[0], static_cast<arc::int64>(read_length));
+            remaining -= read_length;
+
+            // stop at the end of the file if it has shrunk since it was opened
+            std::size_t chunk_length = static_cast<std::size_t>(tell() - start);
+            if(chunk_length < read_length)
+            {
+                read_length = chunk_length;
+                remaining = 0;
+            }
+
+            // grow to the worst case for the rest of the file
+            std::size_t required = output_length +
+                arc::str::UTF16Decoder::get_max_output_length(read_length) +
+                arc::str::UTF16Decoder::MAX_FINISH_LENGTH;
+            if(required > capacity)
+            {
+                capacity = std::max(
+                    required,
+                    output_length +
+                    arc::str::UTF16Decoder::get_max_output_length(
+                        read_length + remaining
+                    ) +
+                    arc::str::UTF16Decoder::MAX_FINISH_LENGTH
+                );
+                char* grown = new char[capacity + 1];
+                memcpy(grown, output, output_length);
+                delete[] output;
+                output = grown;
+            }
+
+            output_length += decoder.decode(
+                &chunk[0],
+                read_length,
+                output + output_length
+            );
+        }
+    }
+    catch(...)
+    {
+        delete[] output;
+        throw;
+    }
+    output_length += decoder.finish(output + output_length);
+
+    // give the character data to the UTF8String
+    output[output_length] = '\0';
+    data.claim(output);
+}
+
 } // namespace sys
 } // namespace io
 } // namespace arc
@@ -6,11 +6,10 @@
 #define ARCANECORE_IO_SYS_FILEREADER_HPP_
 
 #include <memory>
+#include <vector>
 
 #include "arcanecore/io/sys/FileHandle.hpp"
 
-class ifstream;
-
 namespace arc
 {
 namespace io
@@ -197,17 +196,47 @@ public:
      * Unicode BOM (if the file has one). To read the data starting after the
      * BOM the seek_to_data_start() function can be used.
      *
+     * Small reads are served from a buffer that is filled by reading ahead of
+     * the file position indicator, so changes made to the file through other
+     * handles may not be seen until the file is reopened.
+     *
      * \param data Character array that file data will be copied into.
      * \param length The number of characters to read from the file. If this is
      *               greater than the number of characters in the file this
      *               function will read the remaining characters up to the end
-     *               of the file.
+     *               of the file, and the End of File Marker will be set.
      *
      * \throws arc::ex::StateError If this FileReader is not open.
      * \throws arc::ex::EOFError If the End of File Marker has been reached.
      */
     virtual void read(char* data, arc::int64 length);
 
+    /*!
+     * \brief Reads a block of data from the given byte offset of the file
+     *        without using or moving the file position indicator.
+     *
+     * Unlike read() this function does not modify any state of the
+     * FileReader, so multiple threads may call this function concurrently on
+     * the same FileReader (on Windows the underlying file pointer is moved, so
+     * this should not be mixed with concurrent calls to read()).
+     *
+     * \param data Character array that file data will be copied into.
+     * \param length The maximum number of bytes to read from the file.
+     * \param offset The byte index in the file to begin reading from.
+     *
+     * \returns The number of bytes actually read, this will be less than
+     *          length if the end of the file is reached.
+     *
+     * \throws arc::ex::StateError If this FileReader is not open.
+     * \throws arc::ex::IndexOutOfBoundsError If the given offset is less than
+     *                                          0.
+     * \throws arc::ex::IOError If the read fails.
+     */
+    virtual arc::int64 read_at(
+            char* data,
+            arc::int64 length,
+            arc::int64 offset) const;
+
     /*!
      * \brief Reads a block of data from the file and returns it (converting
      *        the data encoding if needed) represented as a
@@ -292,14 +321,24 @@ protected:
     //--------------------------------------------------------------------------
 
     /*!
-     * \brief The input stream used to read the file.
+     * \brief The size of the file in bytes.
      */
-    std::ifstream* m_stream;
+    arc::int64 m_size;
 
     /*!
-     * \brief The size of the file in bytes.
+     * \brief The index of the byte the file position indicator is at.
+     *
+     * The position is tracked here rather than by the descriptor's file offset
+     * so that reads are positional and telling or seeking does not require a
+     * system call.
      */
-    arc::int64 m_size;
+    arc::int64 m_position;
+
+    /*!
+     * \brief Whether the file position indicator has reached the end of the
+     *        file.
+     */
+    bool m_eof;
 
     /*!
      * \brief Whether the current static newline checker is valid for the
@@ -336,6 +375,21 @@ private:
      */
     std::unique_ptr<NewlineChecker> m_newline_checker;
 
+    /*!
+     * \brief Data that has been read ahead of the file position indicator.
+     */
+    std::vector<char> m_buffer;
+
+    /*!
+     * \brief The byte index in the file of the first byte of the buffer.
+     */
+    arc::int64 m_buffer_offset;
+
+    /*!
+     * \brief The number of valid bytes in the buffer.
+     */
+    arc::int64 m_buffer_length;
+
     //--------------------------------------------------------------------------
     //                          PRIVATE MEMBER FUNCTIONS
     //--------------------------------------------------------------------------
@@ -347,6 +401,23 @@ private:
      * This function will initialise the checker if need be.
      */
     NewlineChecker* get_newline_checker();
+
+    /*!
+     * \brief Copies up to the given number of bytes from the file position
+     *        indicator into the data, refilling the buffer if needed.
+     *
+     * The file position indicator is not moved.
+     *
+     * \returns The number of bytes copied, which is less than the given length
+     *          if the end of the file is reached.
+     */
+    arc::int64 read_buffered(char* data, arc::int64 length);
+
+    /*!
+     * \brief Reads and decodes the given number of bytes of UTF-16 data from
+     *        the current position in the file.
+     */
+    void read_utf16(arc::str::UTF8String& data, std::size_t length);
 };
 
 } // namespace sys
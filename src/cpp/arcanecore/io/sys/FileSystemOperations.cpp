@@ -1,15 +1,41 @@
 #include "arcanecore/io/sys/FileSystemOperations.hpp"
 
 #include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <thread>
+#include <vector>
 
 #ifdef ARC_OS_UNIX
 
     #include <dirent.h>
+    #include <fcntl.h>
     #include <unistd.h>
 
-#elif defined(ARC_OS_WINDOWS)
+#endif
+
+#ifdef ARC_OS_LINUX
+
+    #include <linux/fs.h>
+    #include <sys/ioctl.h>
+
+    // copy_file_range() is available from glibc 2.27
+    #if defined(__GLIBC__) && \
+        (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 27))
+        #define ARC_HAS_COPY_FILE_RANGE
+    #endif
+
+#endif
+
+#ifdef ARC_OS_WINDOWS
 
     #include <windows.h>
 
@@ -18,6 +44,7 @@
 #include "arcanecore/base/Exceptions.hpp"
 #include "arcanecore/base/os/OSOperations.hpp"
 #include "arcanecore/base/str/StringOperations.hpp"
+#include "arcanecore/io/sys/DirectoryWalker.hpp"
 
 namespace arc
 {
@@ -26,6 +53,991 @@ namespace io
 namespace sys
 {
 
+//------------------------------------------------------------------------------
+//                                    OBJECTS
+//------------------------------------------------------------------------------
+
+#ifdef ARC_OS_UNIX
+
+/*!
+ * \brief Closes the held file descriptor when it goes out of scope.
+ */
+struct DescriptorGuard
+{
+    //----------------------------PUBLIC ATTRIBUTES-----------------------------
+    int descriptor;
+    //-------------------------------CONSTRUCTOR--------------------------------
+    DescriptorGuard(int _descriptor)
+        :
+        descriptor(_descriptor)
+    {
+    }
+    //--------------------------------DESTRUCTOR--------------------------------
+    ~DescriptorGuard()
+    {
+        if(descriptor >= 0)
+        {
+            close(descriptor);
+        }
+    }
+};
+
+/*!
+ * \brief The name and type of an entry read relative to a directory
+ *        descriptor.
+ */
+struct NamedEntry
+{
+    //----------------------------PUBLIC ATTRIBUTES-----------------------------
+    std::string name;
+    arc::io::sys::DirEntry::Type type;
+    //-------------------------------CONSTRUCTOR--------------------------------
+    NamedEntry(const char* _name, arc::io::sys::DirEntry::Type _type)
+        :
+        name(_name),
+        type(_type)
+    {
+    }
+};
+
+/*!
+ * \brief A directory being emptied by delete_directory_at().
+ *
+ * Each directory is deleted from its parent once everything beneath it has
+ * been deleted.
+ */
+struct DeleteNode
+{
+    //----------------------------PUBLIC ATTRIBUTES-----------------------------
+    // the directory containing this directory, null for the directory the
+    // deletion started from, which is deleted by the caller
+    std::shared_ptr<DeleteNode> parent;
+    // the name of this directory in its parent
+    std::string name;
+    // the path of this directory, only used for error messages
+    arc::io::sys::Path path;
+    DescriptorGuard dir;
+    // the number of sub directories that have not been deleted yet, plus one
+    // while the entries of this directory are being deleted
+    std::atomic<std::size_t> pending;
+    //-------------------------------CONSTRUCTORS-------------------------------
+    explicit DeleteNode(const arc::io::sys::Path& _path)
+        :
+        path   (_path),
+        dir    (-1),
+        pending(1)
+    {
+    }
+    DeleteNode(const std::shared_ptr<DeleteNode>& _parent, const char* _name)
+        :
+        parent (_parent),
+        name   (_name),
+        path   (_parent->path),
+        dir    (-1),
+        pending(1)
+    {
+        path << _name;
+    }
+};
+
+/*!
+ * \brief A directory being copied by copy_directory_at().
+ *
+ * The permissions of each copied directory are applied once everything
+ * beneath it has been copied, since they may not allow writing.
+ */
+struct CopyNode
+{
+    //----------------------------PUBLIC ATTRIBUTES-----------------------------
+    // the directory containing this directory, null for the directory the
+    // copy started from
+    std::shared_ptr<CopyNode> parent;
+    // the paths of this directory, only used for error messages
+    arc::io::sys::Path src_path;
+    arc::io::sys::Path dst_path;
+    DescriptorGuard src_dir;
+    DescriptorGuard dst_dir;
+    // the permissions of the source directory
+    mode_t mode;
+    // the number of entries that have not been copied yet, plus one while the
+    // entries of this directory are being read
+    std::atomic<std::size_t> pending;
+    //-------------------------------CONSTRUCTORS-------------------------------
+    CopyNode(
+            const arc::io::sys::Path& _src_path,
+            const arc::io::sys::Path& _dst_path)
+        :
+        src_path(_src_path),
+        dst_path(_dst_path),
+        src_dir (-1),
+        dst_dir (-1),
+        mode    (0),
+        pending (1)
+    {
+    }
+    CopyNode(const std::shared_ptr<CopyNode>& _parent, const char* _name)
+        :
+        parent  (_parent),
+        src_path(_parent->src_path),
+        dst_path(_parent->dst_path),
+        src_dir (-1),
+        dst_dir (-1),
+        mode    (0),
+        pending (1)
+    {
+        src_path << _name;
+        dst_path << _name;
+    }
+};
+
+#else
+
+/*!
+ * \brief A directory being emptied by delete_directory_rec().
+ *
+ * Each directory is deleted once everything beneath it has been deleted.
+ */
+struct DeleteNode
+{
+    //----------------------------PUBLIC ATTRIBUTES-----------------------------
+    // the directory containing this directory, null for the directory the
+    // deletion started from, which is deleted by the caller
+    std::shared_ptr<DeleteNode> parent;
+    arc::io::sys::DirEntry entry;
+    // the number of sub directories that have not been deleted yet, plus one
+    // while the entries of this directory are being deleted
+    std::atomic<std::size_t> pending;
+    //-------------------------------CONSTRUCTOR--------------------------------
+    DeleteNode(
+            const std::shared_ptr<DeleteNode>& _parent,
+            const arc::io::sys::DirEntry& _entry)
+        :
+        parent (_parent),
+        entry  (_entry),
+        pending(1)
+    {
+    }
+};
+
+#endif
+
+/*!
+ * \brief A group of threads that work through a shared stack of tasks until
+ *        it is empty, where running tasks may push further tasks.
+ *
+ * A single pool is used for a whole recursive operation, so that sub
+ * directories at every depth are processed independently. Tasks are taken
+ * from the top of the stack so that a hierarchy is worked through depth first,
+ * which keeps the number of partially processed directories (and so open
+ * descriptors) low.
+ *
+ * If a task throws the remaining tasks are discarded and the first exception
+ * is rethrown by run().
+ */
+class TaskPool
+{
+private:
+
+    ARC_DISALLOW_COPY_AND_ASSIGN(TaskPool);
+
+public:
+
+    //-------------------------------CONSTRUCTOR--------------------------------
+
+    /*!
+     * \brief Creates a new pool which runs tasks using the given number of
+     *        threads, including the thread that calls run().
+     *
+     * If ```0``` is given the number of hardware threads is used instead.
+     */
+    explicit TaskPool(std::size_t thread_count)
+        :
+        m_thread_count(resolve_thread_count(thread_count)),
+        m_active      (0),
+        m_failed      (false)
+    {
+    }
+
+    //-------------------------PUBLIC MEMBER FUNCTIONS--------------------------
+
+    /*!
+     * \brief Adds a task to the pool, this may be called from within a task.
+     */
+    void push(const std::function<void()>& task)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_tasks.push_back(task);
+        }
+        m_condition.notify_one();
+    }
+
+    /*!
+     * \brief Runs tasks until there are none left, then returns once all of
+     *        the pool's threads have finished.
+     */
+    void run()
+    {
+        std::vector<std::thread> threads;
+        try
+        {
+            // the calling thread is one of the workers
+            for(std::size_t i = 1; i < m_thread_count; ++i)
+            {
+                threads.push_back(std::thread(&TaskPool::work, this));
+            }
+        }
+        catch(...)
+        {
+            // continue with the threads that could be started, since the
+            // calling thread alone is able to complete the tasks
+        }
+
+        work();
+        ARC_FOR_EACH(thread, threads)
+        {
+            thread->join();
+        }
+
+        if(m_error)
+        {
+            std::rethrow_exception(m_error);
+        }
+    }
+
+private:
+
+    //----------------------------PRIVATE ATTRIBUTES----------------------------
+
+    std::size_t m_thread_count;
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    std::vector<std::function<void()>> m_tasks;
+    // the number of tasks being run, which may push more tasks
+    std::size_t m_active;
+    bool m_failed;
+    std::exception_ptr m_error;
+
+    //-------------------------PRIVATE MEMBER FUNCTIONS-------------------------
+
+    /*!
+     * \brief Returns the number of threads the pool should use for the
+     *        requested thread count.
+     */
+    static std::size_t resolve_thread_count(std::size_t thread_count)
+    {
+        if(thread_count > 0)
+        {
+            return thread_count;
+        }
+        // hardware_concurrency() may report 0 if it is not computable
+        const std::size_t hardware = std::thread::hardware_concurrency();
+        return hardware > 0 ? hardware : 1;
+    }
+
+    /*!
+     * \brief Runs tasks until there are none left and none running, or until a
+     *        task has failed.
+     */
+    void work()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        while(true)
+        {
+            while(m_tasks.empty() && m_active > 0 && !m_failed)
+            {
+                m_condition.wait(lock);
+            }
+            if(m_tasks.empty() || m_failed)
+            {
+                // wake the other workers so they see the pool has finished
+                m_condition.notify_all();
+                return;
+            }
+
+            std::function<void()> task(std::move(m_tasks.back()));
+            m_tasks.pop_back();
+            ++m_active;
+            lock.unlock();
+
+            std::exception_ptr error;
+            try
+            {
+                task();
+            }
+            catch(...)
+            {
+                error = std::current_exception();
+            }
+            // release anything held by the task before locking
+            task = nullptr;
+
+            lock.lock();
+            --m_active;
+            if(error && !m_failed)
+            {
+                m_error = error;
+                m_failed = true;
+            }
+        }
+    }
+};
+
+//------------------------------------------------------------------------------
+//                                STATIC FUNCTIONS
+//------------------------------------------------------------------------------
+
+#ifdef ARC_OS_UNIX
+
+/*!
+ * \brief Throws an IOError for an operation on the named entry of the given
+ *        directory which failed with the current system error.
+ */
+static void throw_path_error(
+        const char* message,
+        const arc::io::sys::Path& directory,
+        const char* name)
+{
+    // retrieve the error before anything else can modify it
+    arc::str::UTF8String os_error(arc::os::get_last_system_error_message());
+
+    arc::io::sys::Path path(directory);
+    if(name != nullptr)
+    {
+        path << name;
+    }
+
+    arc::str::UTF8String error_message;
+    error_message << message << ": \'" << path.to_native() << "\'. OS error: ";
+    error_message << os_error;
+    throw arc::ex::IOError(error_message);
+}
+
+/*!
+ * \brief Opens the named directory relative to the given directory
+ *        descriptor, without following symbolic links.
+ */
+static int open_directory_at(int dir_fd, const char* name)
+{
+    int fd = -1;
+    do
+    {
+        fd = openat(
+            dir_fd,
+            name,
+            O_RDONLY | O_DIRECTORY | O_NOFOLLOW | O_CLOEXEC
+        );
+    }
+    while(fd < 0 && errno == EINTR);
+    return fd;
+}
+
+/*!
+ * \brief Opens the given directory, following symbolic links, so that its
+ *        entries can be opened relative to it.
+ *
+ * \return The descriptor of the directory, or AT_FDCWD if the path is empty.
+ *
+ * \throws arc::ex::IOError If the directory cannot be opened.
+ */
+static int open_parent_at(const arc::io::sys::Path& path)
+{
+    if(path.is_empty())
+    {
+        return AT_FDCWD;
+    }
+
+    int fd = -1;
+    do
+    {
+        fd = open(path.get_native_raw(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    }
+    while(fd < 0 && errno == EINTR);
+    if(fd < 0)
+    {
+        throw_path_error("Failed to open directory", path, nullptr);
+    }
+    return fd;
+}
+
+/*!
+ * \brief Reads the names and types of the entries of the directory open with
+ *        the given descriptor, excluding "." and "..".
+ *
+ * The given descriptor remains open and owned by the caller.
+ *
+ * \return Whether the directory could be read.
+ */
+static bool read_directory_at(int dir_fd, std::vector<NamedEntry>& entries)
+{
+    // the directory stream takes ownership of the descriptor it is given
+    int stream_fd = fcntl(dir_fd, F_DUPFD_CLOEXEC, 0);
+    if(stream_fd < 0)
+    {
+        return false;
+    }
+    DIR* dir = fdopendir(stream_fd);
+    if(dir == NULL)
+    {
+        close(stream_fd);
+        return false;
+    }
+
+    struct dirent* dir_entry;
+    while((dir_entry = readdir(dir)) != NULL)
+    {
+        const char* name = dir_entry->d_name;
+        if(name[0] == '.' &&
+           (name[1] == '\0' || (name[1] == '.' && name[2] == '\0')))
+        {
+            continue;
+        }
+
+        // use the type from the directory listing where possible, otherwise
+        // stat relative to the directory
+        mode_t mode = 0;
+#ifdef DT_UNKNOWN
+        if(dir_entry->d_type != DT_UNKNOWN)
+        {
+            mode = DTTOIF(dir_entry->d_type);
+        }
+        else
+#endif
+        {
+            struct stat s;
+            if(fstatat(dir_fd, name, &s, AT_SYMLINK_NOFOLLOW) == 0)
+            {
+                mode = s.st_mode;
+            }
+        }
+
+        arc::io::sys::DirEntry::Type type = arc::io::sys::DirEntry::TYPE_OTHER;
+        if(S_ISREG(mode))
+        {
+            type = arc::io::sys::DirEntry::TYPE_FILE;
+        }
+        else if(S_ISDIR(mode))
+        {
+            type = arc::io::sys::DirEntry::TYPE_DIRECTORY;
+        }
+        else if(S_ISLNK(mode))
+        {
+            type = arc::io::sys::DirEntry::TYPE_SYMBOLIC_LINK;
+        }
+        entries.push_back(NamedEntry(name, type));
+    }
+    closedir(dir);
+    return true;
+}
+
+/*!
+ * \brief Marks one pending entry of the given directory as deleted.
+ *
+ * Once nothing is left beneath the directory it is deleted from its parent,
+ * which may in turn complete the parent.
+ */
+static void finish_delete_node(std::shared_ptr<DeleteNode> node)
+{
+    while(node && --node->pending == 0)
+    {
+        std::shared_ptr<DeleteNode> parent(node->parent);
+        if(parent &&
+           unlinkat(
+               parent->dir.descriptor,
+               node->name.c_str(),
+               AT_REMOVEDIR
+           ) != 0)
+        {
+            throw_path_error(
+                "Failed to delete path", parent->path, node->name.c_str());
+        }
+        node = parent;
+    }
+}
+
+/*!
+ * \brief Deletes the entries of the directory open in the given node.
+ *
+ * Each sub directory is emptied by its own task pushed to the given pool.
+ */
+static void delete_directory_at(
+        TaskPool& pool,
+        const std::shared_ptr<DeleteNode>& node)
+{
+    std::vector<NamedEntry> entries;
+    if(!read_directory_at(node->dir.descriptor, entries))
+    {
+        throw_path_error("Failed to read directory", node->path, nullptr);
+    }
+
+    ARC_FOR_EACH(entry, entries)
+    {
+        if(entry->type == arc::io::sys::DirEntry::TYPE_DIRECTORY)
+        {
+            ++node->pending;
+            // the sub directory is opened by its own task so that only the
+            // directories being worked on hold descriptors
+            std::string name(entry->name);
+            pool.push([&pool, node, name]()
+            {
+                std::shared_ptr<DeleteNode> sub_node(
+                    new DeleteNode(node, name.c_str()));
+                sub_node->dir.descriptor =
+                    open_directory_at(node->dir.descriptor, name.c_str());
+                if(sub_node->dir.descriptor < 0)
+                {
+                    throw_path_error(
+                        "Failed to open directory", sub_node->path, nullptr);
+                }
+                delete_directory_at(pool, sub_node);
+            });
+        }
+        else if(unlinkat(node->dir.descriptor, entry->name.c_str(), 0) != 0)
+        {
+            throw_path_error(
+                "Failed to delete path", node->path, entry->name.c_str());
+        }
+    }
+
+    finish_delete_node(node);
+}
+
+/*!
+ * \brief Copies the contents of one open file to another.
+ *
+ * Where supported the destination is cloned from the source or copied within
+ * the kernel, otherwise the data is copied through a user space buffer.
+ *
+ * \return Whether the copy succeeded.
+ */
+static bool copy_file_contents(int in_fd, int out_fd)
+{
+#ifdef FICLONE
+    // share the source's extents on file systems that support reflinks
+    if(ioctl(out_fd, FICLONE, in_fd) == 0)
+    {
+        return true;
+    }
+#endif
+
+#ifdef ARC_HAS_COPY_FILE_RANGE
+    // copy within the kernel, falling back to the buffered copy if the file
+    // system (or pair of file systems) doesn't support it
+    while(true)
+    {
+        ssize_t copied = copy_file_range(
+            in_fd,
+            NULL,
+            out_fd,
+            NULL,
+            1024 * 1024 * 1024,
+            0
+        );
+        if(copied > 0)
+        {
+            continue;
+        }
+        if(copied == 0)
+        {
+            return true;
+        }
+        if(errno == EINTR)
+        {
+            continue;
+        }
+        if(errno != ENOSYS && errno != EXDEV && errno != EINVAL &&
+           errno != EOPNOTSUPP)
+        {
+            return false;
+        }
+        break;
+    }
+#endif
+
+    std::vector<char> buffer(128 * 1024);
+    while(true)
+    {
+        ssize_t read_bytes = read(in_fd, &buffer[0], buffer.size());
+        if(read_bytes == 0)
+        {
+            return true;
+        }
+        if(read_bytes < 0)
+        {
+            if(errno == EINTR)
+            {
+                continue;
+            }
+            return false;
+        }
+
+        ssize_t offset = 0;
+        while(offset < read_bytes)
+        {
+            ssize_t written = write(
+                out_fd,
+                &buffer[offset],
+                static_cast<std::size_t>(read_bytes - offset)
+            );
+            if(written < 0)
+            {
+                if(errno == EINTR)
+                {
+                    continue;
+                }
+                return false;
+            }
+            offset += written;
+        }
+    }
+}
+
+/*!
+ * \brief Copies an entry relative to the source directory descriptor to the
+ *        destination directory descriptor.
+ *
+ * Symbolic links are recreated rather than followed. Directories are copied by
+ * copy_directory_at() instead.
+ *
+ * \param src_dir_fd The descriptor of the directory containing the entry.
+ * \param dst_dir_fd The descriptor of the directory to copy the entry to.
+ * \param src_name The name of the entry to copy.
+ * \param dst_name The name to copy the entry to.
+ * \param type The type of the entry to copy.
+ * \param src_path The path of the source directory, only used for error
+ *                 messages.
+ * \param dst_path The path of the destination directory, only used for error
+ *                 messages.
+ */
+static void copy_entry_at(
+        int src_dir_fd,
+        int dst_dir_fd,
+        const char* src_name,
+        const char* dst_name,
+        arc::io::sys::DirEntry::Type type,
+        const arc::io::sys::Path& src_path,
+        const arc::io::sys::Path& dst_path)
+{
+    switch(type)
+    {
+        case arc::io::sys::DirEntry::TYPE_FILE:
+        {
+            DescriptorGuard in(openat(
+                src_dir_fd,
+                src_name,
+                O_RDONLY | O_NOFOLLOW | O_CLOEXEC
+            ));
+            struct stat s;
+            if(in.descriptor < 0 || fstat(in.descriptor, &s) != 0)
+            {
+                throw_path_error("Failed to open file", src_path, src_name);
+            }
+
+            DescriptorGuard out(openat(
+                dst_dir_fd,
+                dst_name,
+                O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC,
+                s.st_mode & 07777
+            ));
+            if(out.descriptor < 0)
+            {
+                throw_path_error("Failed to create file", dst_path, dst_name);
+            }
+
+            if(!copy_file_contents(in.descriptor, out.descriptor))
+            {
+                throw_path_error("Failed to copy file", src_path, src_name);
+            }
+            break;
+        }
+        case arc::io::sys::DirEntry::TYPE_SYMBOLIC_LINK:
+        {
+            std::vector<char> target(256);
+            while(true)
+            {
+                ssize_t length = readlinkat(
+                    src_dir_fd,
+                    src_name,
+                    &target[0],
+                    target.size()
+                );
+                if(length < 0)
+                {
+                    throw_path_error(
+                        "Failed to read symbolic link", src_path, src_name);
+                }
+                if(static_cast<std::size_t>(length) < target.size())
+                {
+                    target[length] = '\0';
+                    break;
+                }
+                target.resize(target.size() * 2);
+            }
+
+            if(symlinkat(&target[0], dst_dir_fd, dst_name) != 0)
+            {
+                throw_path_error(
+                    "Failed to create symbolic link", dst_path, dst_name);
+            }
+            break;
+        }
+        default:
+        {
+            errno = ENOTSUP;
+            throw_path_error("Cannot copy special file", src_path, src_name);
+        }
+    }
+}
+
+/*!
+ * \brief Marks one pending entry of the given directory as copied.
+ *
+ * Once everything beneath the directory has been copied the source
+ * permissions are applied to it, which may in turn complete its parent.
+ */
+static void finish_copy_node(std::shared_ptr<CopyNode> node)
+{
+    while(node && --node->pending == 0)
+    {
+        if((node->mode & 0700) != 0700)
+        {
+            fchmod(node->dst_dir.descriptor, node->mode & 07777);
+        }
+        std::shared_ptr<CopyNode> parent(node->parent);
+        node = parent;
+    }
+}
+
+/*!
+ * \brief Opens the named source directory and creates and opens the named
+ *        destination directory of the given node.
+ *
+ * \param node The node to open, its paths are used for error messages.
+ * \param src_dir_fd The descriptor of the directory containing the source.
+ * \param dst_dir_fd The descriptor of the directory to create the copy in.
+ * \param src_name The name of the source directory.
+ * \param dst_name The name of the directory to create.
+ */
+static void open_copy_node(
+        CopyNode& node,
+        int src_dir_fd,
+        int dst_dir_fd,
+        const char* src_name,
+        const char* dst_name)
+{
+    node.src_dir.descriptor = open_directory_at(src_dir_fd, src_name);
+    struct stat s;
+    if(node.src_dir.descriptor < 0 || fstat(node.src_dir.descriptor, &s) != 0)
+    {
+        throw_path_error("Failed to open directory", node.src_path, nullptr);
+    }
+    node.mode = s.st_mode;
+
+    // ensure the copied contents can be written
+    if(mkdirat(dst_dir_fd, dst_name, (s.st_mode & 07777) | 0700) != 0)
+    {
+        throw_path_error(
+            "Failed to create directory", node.dst_path, nullptr);
+    }
+    node.dst_dir.descriptor = open_directory_at(dst_dir_fd, dst_name);
+    if(node.dst_dir.descriptor < 0)
+    {
+        throw_path_error("Failed to open directory", node.dst_path, nullptr);
+    }
+}
+
+/*!
+ * \brief Copies the entries of the source directory open in the given node to
+ *        its destination directory.
+ *
+ * Each entry is copied by its own task pushed to the given pool, and sub
+ * directories are in turn copied the same way.
+ */
+static void copy_directory_at(
+        TaskPool& pool,
+        const std::shared_ptr<CopyNode>& node)
+{
+    std::vector<NamedEntry> entries;
+    if(!read_directory_at(node->src_dir.descriptor, entries))
+    {
+        throw_path_error("Failed to read directory", node->src_path, nullptr);
+    }
+
+    ARC_FOR_EACH(entry, entries)
+    {
+        ++node->pending;
+        std::string name(entry->name);
+        if(entry->type == arc::io::sys::DirEntry::TYPE_DIRECTORY)
+        {
+            pool.push([&pool, node, name]()
+            {
+                std::shared_ptr<CopyNode> sub_node(
+                    new CopyNode(node, name.c_str()));
+                open_copy_node(
+                    *sub_node,
+                    node->src_dir.descriptor,
+                    node->dst_dir.descriptor,
+                    name.c_str(),
+                    name.c_str()
+                );
+                copy_directory_at(pool, sub_node);
+            });
+        }
+        else
+        {
+            arc::io::sys::DirEntry::Type type = entry->type;
+            pool.push([node, name, type]()
+            {
+                copy_entry_at(
+                    node->src_dir.descriptor,
+                    node->dst_dir.descriptor,
+                    name.c_str(),
+                    name.c_str(),
+                    type,
+                    node->src_path,
+                    node->dst_path
+                );
+                finish_copy_node(node);
+            });
+        }
+    }
+
+    finish_copy_node(node);
+}
+
+#else
+
+/*!
+ * \brief Marks one pending entry of the given directory as deleted.
+ *
+ * Once nothing is left beneath the directory it is deleted, which may in turn
+ * complete its parent.
+ */
+static void finish_delete_node(std::shared_ptr<DeleteNode> node)
+{
+    while(node && --node->pending == 0)
+    {
+        std::shared_ptr<DeleteNode> parent(node->parent);
+        if(parent)
+        {
+            arc::io::sys::delete_path(node->entry);
+        }
+        node = parent;
+    }
+}
+
+/*!
+ * \brief Deletes the entries of the directory of the given node.
+ *
+ * Each sub directory is emptied by its own task pushed to the given pool.
+ */
+static void delete_directory_rec(
+        TaskPool& pool,
+        const std::shared_ptr<DeleteNode>& node)
+{
+    // the types of the sub paths are read along with their names, so they
+    // don't need to be queried again
+    std::vector<arc::io::sys::DirEntry> sub_entries;
+    arc::io::sys::DirEntry::read_directory(
+        node->entry.get_path(),
+        false,
+        false,
+        sub_entries
+    );
+    ARC_FOR_EACH(sub_entry, sub_entries)
+    {
+        if(sub_entry->get_type() == arc::io::sys::DirEntry::TYPE_DIRECTORY)
+        {
+            ++node->pending;
+            std::shared_ptr<DeleteNode> sub_node(
+                new DeleteNode(node, *sub_entry));
+            pool.push([&pool, sub_node]()
+            {
+                delete_directory_rec(pool, sub_node);
+            });
+        }
+        else
+        {
+            arc::io::sys::delete_path(*sub_entry);
+        }
+    }
+
+    finish_delete_node(node);
+}
+
+#endif
+
+#ifdef ARC_OS_WINDOWS
+
+/*!
+ * \brief Copies the path of the given entry to the given destination.
+ *
+ * The entries of a copied directory are each copied by their own task pushed
+ * to the given pool.
+ */
+static void copy_entry_rec(
+        TaskPool& pool,
+        const arc::io::sys::DirEntry& entry,
+        const arc::io::sys::Path& destination)
+{
+    if(arc::io::sys::is_directory(entry, false))
+    {
+        arc::io::sys::create_directory(destination);
+
+        std::vector<arc::io::sys::DirEntry> sub_entries;
+        arc::io::sys::DirEntry::read_directory(
+            entry.get_path(),
+            false,
+            false,
+            sub_entries
+        );
+        ARC_FOR_EACH(sub_entry, sub_entries)
+        {
+            arc::io::sys::DirEntry sub(*sub_entry);
+            arc::io::sys::Path sub_destination(destination);
+            sub_destination << sub_entry->get_path().get_back_view().to_string();
+            pool.push([&pool, sub, sub_destination]()
+            {
+                copy_entry_rec(pool, sub, sub_destination);
+            });
+        }
+        return;
+    }
+
+    // utf-16
+    std::size_t length = 0;
+    const char* src = arc::str::utf8_to_utf16(
+            entry.get_path().to_windows().get_raw(),
+            length,
+            arc::data::ENDIAN_LITTLE
+    );
+    const char* dst = arc::str::utf8_to_utf16(
+            destination.to_windows().get_raw(),
+            length,
+            arc::data::ENDIAN_LITTLE
+    );
+
+    BOOL result = CopyFileW((const wchar_t*) src, (const wchar_t*) dst, TRUE);
+    delete[] src;
+    delete[] dst;
+
+    if(!result)
+    {
+        arc::str::UTF8String error_message;
+        error_message << "Failed to copy path: \'";
+        error_message << entry.get_path().to_native();
+        error_message << "\'. OS error: ";
+        error_message << arc::os::get_last_system_error_message();
+        throw arc::ex::IOError(error_message);
+    }
+}
+
+#endif
+
+//------------------------------------------------------------------------------
+//                                   FUNCTIONS
+//------------------------------------------------------------------------------
+
 bool exists(const arc::io::sys::Path& path, bool resolve_links)
 {
 #ifdef ARC_OS_UNIX
@@ -37,11 +1049,11 @@ bool exists(const arc::io::sys::Path& path, bool resolve_links)
     int stat_ret = false;
     if(resolve_links)
     {
-        stat_ret = stat(path.to_unix().get_raw(), &s);
+        stat_ret = stat(path.get_native_raw(), &s);
     }
     else
     {
-        stat_ret = lstat(path.to_unix().get_raw(), &s);
+        stat_ret = lstat(path.get_native_raw(), &s);
     }
 
     // return based on the stat return code
@@ -83,6 +1095,16 @@ bool exists(const arc::io::sys::Path& path, bool resolve_links)
     return true;
 }
 
+bool exists(const arc::io::sys::DirEntry& entry, bool resolve_links)
+{
+    if(resolve_links &&
+       entry.get_type() == arc::io::sys::DirEntry::TYPE_SYMBOLIC_LINK)
+    {
+        return exists(entry.get_path(), true);
+    }
+    return entry.get_type() != arc::io::sys::DirEntry::TYPE_UNKNOWN;
+}
+
 bool is_file(const arc::io::sys::Path& path, bool resolve_links)
 {
 #ifdef ARC_OS_UNIX
@@ -94,11 +1116,11 @@ bool is_file(const arc::io::sys::Path& path, bool resolve_links)
     int stat_ret = false;
     if(resolve_links)
     {
-        stat_ret = stat(path.to_unix().get_raw(), &s);
+        stat_ret = stat(path.get_native_raw(), &s);
     }
     else
     {
-        stat_ret = lstat(path.to_unix().get_raw(), &s);
+        stat_ret = lstat(path.get_native_raw(), &s);
     }
 
     if(stat_ret == 0)
@@ -143,6 +1165,16 @@ bool is_file(const arc::io::sys::Path& path, bool resolve_links)
 #endif
 }
 
+bool is_file(const arc::io::sys::DirEntry& entry, bool resolve_links)
+{
+    if(resolve_links &&
+       entry.get_type() == arc::io::sys::DirEntry::TYPE_SYMBOLIC_LINK)
+    {
+        return is_file(entry.get_path(), true);
+    }
+    return entry.get_type() == arc::io::sys::DirEntry::TYPE_FILE;
+}
+
 bool is_directory(
         const arc::io::sys::Path& path,
         bool  resolve_links)
@@ -156,11 +1188,11 @@ bool is_directory(
     int stat_ret = false;
     if(resolve_links)
     {
-        stat_ret = stat(path.to_unix().get_raw(), &s);
+        stat_ret = stat(path.get_native_raw(), &s);
     }
     else
     {
-        stat_ret = lstat(path.to_unix().get_raw(), &s);
+        stat_ret = lstat(path.get_native_raw(), &s);
     }
 
     if(stat_ret == 0)
@@ -205,12 +1237,24 @@ bool is_directory(
 #endif
 }
 
+bool is_directory(
+        const arc::io::sys::DirEntry& entry,
+        bool resolve_links)
+{
+    if(resolve_links &&
+       entry.get_type() == arc::io::sys::DirEntry::TYPE_SYMBOLIC_LINK)
+    {
+        return is_directory(entry.get_path(), true);
+    }
+    return entry.get_type() == arc::io::sys::DirEntry::TYPE_DIRECTORY;
+}
+
 bool is_symbolic_link(const arc::io::sys::Path& path)
 {
 #ifdef ARC_OS_UNIX
 
     struct stat s;
-    if(lstat(path.to_unix().get_raw(), &s) == 0)
+    if(lstat(path.get_native_raw(), &s) == 0)
     {
         if(S_ISLNK(s.st_mode))
         {
@@ -234,6 +1278,11 @@ bool is_symbolic_link(const arc::io::sys::Path& path)
 #endif
 }
 
+bool is_symbolic_link(const arc::io::sys::DirEntry& entry)
+{
+    return entry.get_type() == arc::io::sys::DirEntry::TYPE_SYMBOLIC_LINK;
+}
+
 std::vector<arc::io::sys::Path> list(
         const arc::io::sys::Path& path,
         bool include_special)
@@ -252,7 +1301,7 @@ std::vector<arc::io::sys::Path> list(
 
     // open the directory
     DIR* dir;
-    if((dir = opendir(path.to_unix().get_raw())) == NULL)
+    if((dir = opendir(path.get_native_raw())) == NULL)
     {
         // TODO: should this throw an error?
         // failed to open the directory
@@ -266,7 +1315,8 @@ std::vector<arc::io::sys::Path> list(
         p << dir_entry->d_name;
 
         // skip over . and ..?
-        if(!include_special && (p.get_back() == "." || p.get_back() == ".."))
+        if(!include_special &&
+           (p.get_back_view() == "." || p.get_back_view() == ".."))
         {
             continue;
         }
@@ -315,7 +1365,8 @@ std::vector<arc::io::sys::Path> list(
 
         // skip over . and ..?
         if(!include_special &&
-           (sub_path.get_back() == "." || sub_path.get_back() == ".."))
+           (sub_path.get_back_view() == "." ||
+            sub_path.get_back_view() == ".."))
         {
             continue;
         }
@@ -332,28 +1383,53 @@ std::vector<arc::io::sys::Path> list(
     return ret;
 }
 
+std::vector<arc::io::sys::DirEntry> list_entries(
+        const arc::io::sys::Path& path,
+        bool include_special,
+        bool load_metadata)
+{
+    std::vector<arc::io::sys::DirEntry> ret;
+
+    // is the given path a directory?
+    if(!is_directory(path, false))
+    {
+        return ret;
+    }
+
+    arc::io::sys::DirEntry::read_directory(
+        path,
+        include_special,
+        load_metadata,
+        ret
+    );
+
+    // order alphabetically
+    std::sort(ret.begin(), ret.end());
+    return ret;
+}
+
 std::vector<arc::io::sys::Path> list_rec(
         const arc::io::sys::Path& path,
         bool include_special)
 {
     std::vector<arc::io::sys::Path> ret;
 
-    std::vector<arc::io::sys::Path> ls(list(path, include_special));
-    ARC_FOR_EACH(it, ls)
+    // symbolic links are not resolved
+    if(!is_directory(path, false))
     {
-        ret.push_back(*it);
-        // recursively call and extend the return list
-        if(it->get_back() != "." && it->get_back() != "..")
-        {
-            std::vector<arc::io::sys::Path> d_ls(
-                list_rec(*it, include_special));
-            ARC_FOR_EACH(d_it, d_ls)
-            {
-                ret.push_back(*d_it);
-            }
-        }
+        return ret;
     }
 
+    // walk depth first with each directory sorted, so that each directory's
+    // sub-paths directly follow it
+    arc::io::sys::DirectoryWalker walker(path);
+    walker.set_sorted(true);
+    walker.set_include_special(include_special);
+    walker.walk([&ret](const arc::io::sys::DirectoryWalker::Entry& entry)
+    {
+        ret.push_back(entry.get_path());
+    });
+
     return ret;
 }
 
@@ -378,7 +1454,7 @@ bool create_directory(const arc::io::sys::Path& path)
 
 #ifdef ARC_OS_UNIX
 
-    if(mkdir(path.to_unix().get_raw(), 0777) != 0)
+    if(mkdir(path.get_native_raw(), 0777) != 0)
     {
         arc::str::UTF8String error_message;
         error_message << "Directory creation failed with OS error: ";
@@ -415,22 +1491,40 @@ bool create_directory(const arc::io::sys::Path& path)
 }
 
 void delete_path(const arc::io::sys::Path& path)
+{
+    delete_path(arc::io::sys::DirEntry(path));
+}
+
+void delete_path(const arc::io::sys::DirEntry& entry)
 {
     // does the file exist?
-    if(!exists(path))
+    arc::io::sys::DirEntry::Type type = entry.get_type();
+    if(type == arc::io::sys::DirEntry::TYPE_UNKNOWN)
     {
         arc::str::UTF8String error_message;
         error_message << "Cannot delete path because it does not exist: \'";
-        error_message << path.to_native() << "\'";
+        error_message << entry.get_path().to_native() << "\'";
         throw arc::ex::IOError(error_message);
     }
 
 #ifdef ARC_OS_UNIX
 
-    if(remove(path.to_unix().get_raw()) != 0)
+    // the type is already known so there's no need for remove() to try both
+    int result = 0;
+    if(type == arc::io::sys::DirEntry::TYPE_DIRECTORY)
+    {
+        result = rmdir(entry.get_path().get_native_raw());
+    }
+    else
+    {
+        result = unlink(entry.get_path().get_native_raw());
+    }
+
+    if(result != 0)
     {
         arc::str::UTF8String error_message;
-        error_message << "Failed to delete path: \'" << path.to_native();
+        error_message << "Failed to delete path: \'";
+        error_message << entry.get_path().to_native();
         error_message << " \'. OS error: ";
         error_message << arc::os::get_last_system_error_message();
         throw arc::ex::IOError(error_message);
@@ -441,19 +1535,21 @@ void delete_path(const arc::io::sys::Path& path)
     // utf-16
     std::size_t length = 0;
     const char* p = arc::str::utf8_to_utf16(
-            path.to_windows().get_raw(),
+            entry.get_path().to_windows().get_raw(),
             length,
             arc::data::ENDIAN_LITTLE
     );
 
     BOOL result = 0;
-    if(is_file(path))
+    if(type == arc::io::sys::DirEntry::TYPE_DIRECTORY ||
+       (type == arc::io::sys::DirEntry::TYPE_SYMBOLIC_LINK &&
+        is_directory(entry.get_path())))
     {
-        result = DeleteFileW((const wchar_t*) p);
+        result = RemoveDirectoryW((const wchar_t*) p);
     }
-    else if(is_directory(path))
+    else
     {
-        result = RemoveDirectoryW((const wchar_t*) p);
+        result = DeleteFileW((const wchar_t*) p);
     }
     delete[] p;
 
@@ -470,39 +1566,141 @@ void delete_path(const arc::io::sys::Path& path)
 #endif
 }
 
-void delete_path_rec(const arc::io::sys::Path& path)
+void delete_path_rec(
+        const arc::io::sys::Path& path,
+        std::size_t thread_count)
 {
-    // does the file exist?
-    if(!exists(path))
-    {
-        arc::str::UTF8String error_message;
-        error_message << "Cannot delete path because it does not exist: \'";
-        error_message << path.to_native() << "\'";
-        throw arc::ex::IOError(error_message);
-    }
+    delete_path_rec(arc::io::sys::DirEntry(path), thread_count);
+}
 
+void delete_path_rec(
+        const arc::io::sys::DirEntry& entry,
+        std::size_t thread_count)
+{
     // is this a directory? do we need to traverse it?
-    if(is_directory(path))
+    if(entry.get_type() == arc::io::sys::DirEntry::TYPE_DIRECTORY)
     {
-        std::vector<arc::io::sys::Path> sub_paths = list(path);
+#ifdef ARC_OS_UNIX
 
-        ARC_FOR_EACH(it, sub_paths)
+        // work relative to directory descriptors so that paths don't need to
+        // be rebuilt and resolved by the kernel for every sub path
+        std::shared_ptr<DeleteNode> root(new DeleteNode(entry.get_path()));
+        root->dir.descriptor = open_directory_at(
+            AT_FDCWD,
+            entry.get_path().get_native_raw()
+        );
+        if(root->dir.descriptor < 0)
         {
-            // skip . and ..
-            if(it->is_empty()         ||
-                 it->get_back() == "." ||
-                 it->get_back() == ".."  )
-            {
-                continue;
-            }
-
-            // follow paths
-            delete_path_rec(*it);
+            throw_path_error(
+                "Failed to open directory", entry.get_path(), nullptr);
         }
+
+        TaskPool pool(thread_count);
+        pool.push([&pool, root]()
+        {
+            delete_directory_at(pool, root);
+        });
+        pool.run();
+
+#else
+
+        std::shared_ptr<DeleteNode> root(new DeleteNode(nullptr, entry));
+        TaskPool pool(thread_count);
+        pool.push([&pool, root]()
+        {
+            delete_directory_rec(pool, root);
+        });
+        pool.run();
+
+#endif
     }
 
     // delete the path
-    delete_path(path);
+    delete_path(entry);
+}
+
+void copy_path_rec(
+        const arc::io::sys::Path& source,
+        const arc::io::sys::Path& destination,
+        std::size_t thread_count)
+{
+    arc::io::sys::DirEntry entry(source);
+    if(entry.get_type() == arc::io::sys::DirEntry::TYPE_UNKNOWN)
+    {
+        arc::str::UTF8String error_message;
+        error_message << "Cannot copy path because it does not exist: \'";
+        error_message << source.to_native() << "\'";
+        throw arc::ex::IOError(error_message);
+    }
+    if(exists(destination))
+    {
+        arc::str::UTF8String error_message;
+        error_message << "Cannot copy to path because it already exists: \'";
+        error_message << destination.to_native() << "\'";
+        throw arc::ex::IOError(error_message);
+    }
+
+#ifdef ARC_OS_UNIX
+
+    // work relative to the parent directories, so that the source and
+    // destination are opened by name like every other entry and error messages
+    // have their full paths
+    arc::io::sys::Path src_parent(source);
+    src_parent.remove(src_parent.get_length() - 1);
+    arc::io::sys::Path dst_parent(destination);
+    dst_parent.remove(dst_parent.get_length() - 1);
+    DescriptorGuard src_parent_dir(open_parent_at(src_parent));
+    DescriptorGuard dst_parent_dir(open_parent_at(dst_parent));
+    arc::str::UTF8String src_name(source.get_back());
+    arc::str::UTF8String dst_name(destination.get_back());
+
+    if(entry.get_type() != arc::io::sys::DirEntry::TYPE_DIRECTORY)
+    {
+        copy_entry_at(
+            src_parent_dir.descriptor,
+            dst_parent_dir.descriptor,
+            src_name.get_raw(),
+            dst_name.get_raw(),
+            entry.get_type(),
+            src_parent,
+            dst_parent
+        );
+        return;
+    }
+
+    std::shared_ptr<CopyNode> root(new CopyNode(source, destination));
+    open_copy_node(
+        *root,
+        src_parent_dir.descriptor,
+        dst_parent_dir.descriptor,
+        src_name.get_raw(),
+        dst_name.get_raw()
+    );
+
+    TaskPool pool(thread_count);
+    pool.push([&pool, root]()
+    {
+        copy_directory_at(pool, root);
+    });
+    pool.run();
+
+#elif defined(ARC_OS_WINDOWS)
+
+    TaskPool pool(thread_count);
+    pool.push([&pool, &entry, &destination]()
+    {
+        copy_entry_rec(pool, entry, destination);
+    });
+    pool.run();
+
+#else
+
+    throw arc::ex::NotImplementedError(
+            "arc::io::sys::copy_path_rec has not yet been implemented for "
+            "this platform"
+    );
+
+#endif
 }
 
 void validate(const arc::io::sys::Path& path)
@@ -514,12 +1712,10 @@ void validate(const arc::io::sys::Path& path)
     }
 
     // iterate over the path ensuring each path exists
-    for(std::size_t i = 1; i < path.get_length(); ++i)
+    arc::io::sys::Path p;
+    for(std::size_t i = 0; i < path.get_length() - 1; ++i)
     {
-        arc::io::sys::Path p(
-                path.get_components().begin(),
-                path.get_components().begin() + i
-        );
+        p << path[i];
         create_directory(p);
     }
 }
@@ -6,6 +6,7 @@
 #ifndef ARCANECORE_IO_SYS_FILESYSTEMOPERATIONS
 #define ARCANECORE_IO_SYS_FILESYSTEMOPERATIONS
 
+#include "arcanecore/io/sys/DirEntry.hpp"
 #include "arcanecore/io/sys/Path.hpp"
 
 namespace arc
@@ -32,6 +33,14 @@ namespace sys
  */
 bool exists(const arc::io::sys::Path& path, bool resolve_links = false);
 
+/*!
+ * \brief Checks whether the given directory entry exists on the file system.
+ *
+ * Unless the entry is a symbolic link and links are being resolved, this uses
+ * the type already known by the entry rather than querying the file system.
+ */
+bool exists(const arc::io::sys::DirEntry& entry, bool resolve_links = false);
+
 /*!
  * \brief Returns whether the given path is a regular file.
  *
@@ -47,6 +56,14 @@ bool exists(const arc::io::sys::Path& path, bool resolve_links = false);
  */
 bool is_file(const arc::io::sys::Path& path, bool resolve_links = false);
 
+/*!
+ * \brief Returns whether the given directory entry is a regular file.
+ *
+ * Unless the entry is a symbolic link and links are being resolved, this uses
+ * the type already known by the entry rather than querying the file system.
+ */
+bool is_file(const arc::io::sys::DirEntry& entry, bool resolve_links = false);
+
 /*!
  * \brief Returns whether the given path is a directory.
  *
@@ -64,6 +81,16 @@ bool is_directory(
         const arc::io::sys::Path& path,
         bool resolve_links = true);
 
+/*!
+ * \brief Returns whether the given directory entry is a directory.
+ *
+ * Unless the entry is a symbolic link and links are being resolved, this uses
+ * the type already known by the entry rather than querying the file system.
+ */
+bool is_directory(
+        const arc::io::sys::DirEntry& entry,
+        bool resolve_links = true);
+
 /*!
  * \brief Returns whether the given path is a symbolic link.
  *
@@ -71,6 +98,14 @@ bool is_directory(
  */
 bool is_symbolic_link(const arc::io::sys::Path& path);
 
+/*!
+ * \brief Returns whether the given directory entry is a symbolic link.
+ *
+ * This uses the type already known by the entry rather than querying the file
+ * system.
+ */
+bool is_symbolic_link(const arc::io::sys::DirEntry& entry);
+
 /*!
  * \brief Lists the file system paths located under the given path.
  *
@@ -87,6 +122,28 @@ std::vector<arc::io::sys::Path> list(
         const arc::io::sys::Path& path,
         bool include_special = false);
 
+/*!
+ * \brief Lists the entries located under the given path along with their
+ *        types.
+ *
+ * This performs the same function as list(), except each returned
+ * arc::io::sys::DirEntry also holds the type of the path, retrieved from the
+ * directory listing itself where the platform supports it. The returned
+ * entries can be passed to operations such as is_directory() to avoid querying
+ * the file system for each path again.
+ *
+ * \param path The file path to list entries for.
+ * \param include_special Whether the special symbols "." and ".." while be
+ *                        included with the returned entries.
+ * \param load_metadata Whether the size and modification time of each entry
+ *                      should be loaded while the directory is open, rather
+ *                      than when they are first requested.
+ */
+std::vector<arc::io::sys::DirEntry> list_entries(
+        const arc::io::sys::Path& path,
+        bool include_special = false,
+        bool load_metadata = false);
+
 /*!
  * \brief Lists all descendant file system paths located under the given path.
  *
@@ -124,6 +181,17 @@ bool create_directory(const arc::io::sys::Path& path);
  */
 void delete_path(const arc::io::sys::Path& path);
 
+/*!
+ * \brief Deletes the path of the given directory entry.
+ *
+ * This behaves the same as delete_path() except the type already known by the
+ * entry is used to decide how the path is deleted.
+ *
+ * \throws arc::ex::IOError If the path cannot be accessed
+ *                                          and/or modified to be deleted.
+ */
+void delete_path(const arc::io::sys::DirEntry& entry);
+
 /*!
  * \brief Deletes the given path on the file system and all subsequent paths
  *        under the given path.
@@ -131,14 +199,80 @@ void delete_path(const arc::io::sys::Path& path);
  * This effectively performs the same job as arc::io::sys::delete_path()
  * except that non-empty directories will also be deleted by this operation.
  *
+ * On Unix platforms the hierarchy is deleted relative to open directory
+ * descriptors, so full paths are not rebuilt for each sub path.
+ *
  * \note This operation will delete symbolic link objects but will not follow
  *       them to delete the path they point to.
  *
+ * \param path The path to delete.
+ * \param thread_count The number of threads used to delete the hierarchy,
+ *                     including the calling thread. Sub directories at every
+ *                     depth are deleted independently. If ```0``` (the
+ *                     default) the number of hardware threads reported by
+ *                     std::thread::hardware_concurrency() is used.
+ *
  * \throws arc::ex::IOError If a path in the directory hierarchy
  *                                          cannot be accessed and/or modified
  *                                          to be deleted.
  */
-void delete_path_rec(const arc::io::sys::Path& path);
+void delete_path_rec(
+        const arc::io::sys::Path& path,
+        std::size_t thread_count = 0);
+
+/*!
+ * \brief Deletes the path of the given directory entry and all subsequent
+ *        paths under it.
+ *
+ * This behaves the same as delete_path_rec() except the type already known by
+ * the entry is used to decide whether it needs to be traversed.
+ *
+ * \throws arc::ex::IOError If a path in the directory hierarchy
+ *                                          cannot be accessed and/or modified
+ *                                          to be deleted.
+ */
+void delete_path_rec(
+        const arc::io::sys::DirEntry& entry,
+        std::size_t thread_count = 0);
+
+/*!
+ * \brief Copies the given path on the file system and all subsequent paths
+ *        under it to the given destination.
+ *
+ * Directories are recreated with the same permissions as their source, and
+ * symbolic links are recreated rather than followed. On Linux the contents of
+ * files are cloned (reflinked) where the file system supports it, or are
+ * otherwise copied within the kernel.
+ *
+ * Example usage:
+ *
+ * \code
+ * arc::io::sys::Path source;
+ * source << "build" << "output";
+ * arc::io::sys::Path destination;
+ * destination << "staging" << "output";
+ *
+ * // copy everything under build/output using four threads
+ * arc::io::sys::copy_path_rec(source, destination, 4);
+ * \endcode
+ *
+ * \param source The path to copy.
+ * \param destination The path to copy to, which must not exist, although its
+ *                    parent directory must.
+ * \param thread_count The number of threads used to copy the hierarchy,
+ *                     including the calling thread. Sub directories and files
+ *                     at every depth are copied independently. If ```0```
+ *                     (the default) the number of hardware threads reported
+ *                     by std::thread::hardware_concurrency() is used.
+ *
+ * \throws arc::ex::IOError If the source path does not exist, the
+ *                          destination path already exists, or a path in the
+ *                          hierarchy cannot be copied.
+ */
+void copy_path_rec(
+        const arc::io::sys::Path& source,
+        const arc::io::sys::Path& destination,
+        std::size_t thread_count = 0);
 
 /*!
  * \brief Attempts to ensure all directories up to the provided path exist.
@@ -1,9 +1,29 @@
 #include "arcanecore/io/sys/FileWriter.hpp"
 
+#include <chrono>
+#include <condition_variable>
 #include <cstddef>
-#include <fstream>
+#include <cstring>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+#ifdef ARC_OS_UNIX
+
+    #include <cerrno>
+    #include <fcntl.h>
+    #include <sys/uio.h>
+    #include <unistd.h>
+
+#elif defined(ARC_OS_WINDOWS)
+
+    #include <fcntl.h>
+    #include <io.h>
+
+#endif
 
 #include "arcanecore/base/Exceptions.hpp"
+#include "arcanecore/base/os/OSOperations.hpp"
 #include "arcanecore/base/str/StringOperations.hpp"
 
 namespace arc
@@ -13,6 +33,170 @@ namespace io
 namespace sys
 {
 
+//------------------------------------------------------------------------------
+//                                    OBJECTS
+//------------------------------------------------------------------------------
+
+/*!
+ * \brief The state shared between a FileWriter and the background thread that
+ *        periodically synchronises its data to disk.
+ */
+struct SyncWorker
+{
+    //----------------------------PUBLIC ATTRIBUTES-----------------------------
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::thread thread;
+    FileWriter* writer;
+    int descriptor;
+    std::chrono::milliseconds period;
+    bool dirty;
+    bool stop;
+    // the first failure of the thread, which is rethrown on the writer's
+    // thread by its next write, flush, sync, or close
+    std::exception_ptr error;
+    // synchronisations made by the thread, which are added to the writer's
+    // counters once the thread has stopped
+    IOCounters io_counters;
+    //-------------------------------CONSTRUCTOR--------------------------------
+    SyncWorker(
+            FileWriter* _writer,
+            int _descriptor,
+            arc::uint32 _period)
+        :
+        writer    (_writer),
+        descriptor(_descriptor),
+        period    (_period),
+        dirty     (false),
+        stop      (false)
+    {
+    }
+};
+
+//------------------------------------------------------------------------------
+//                                   CONSTANTS
+//------------------------------------------------------------------------------
+
+/*!
+ * \brief The size of the write buffer used when no buffer size has been set.
+ */
+static const std::size_t DEFAULT_BUFFER_SIZE = 8192;
+
+/*!
+ * \brief The maximum number of segments passed to a single vectored write.
+ */
+static const std::size_t MAX_WRITE_VECTORS = 64;
+
+//------------------------------------------------------------------------------
+//                               STATIC FUNCTIONS
+//------------------------------------------------------------------------------
+
+/*!
+ * \brief Returns a lock on the mutex of the given worker, or an empty lock if
+ *        there is no worker.
+ */
+static std::unique_lock<std::mutex> lock_sync_worker(SyncWorker* worker)
+{
+    if(worker == nullptr)
+    {
+        return std::unique_lock<std::mutex>();
+    }
+    return std::unique_lock<std::mutex>(worker->mutex);
+}
+
+/*!
+ * \brief Asks the operating system to commit the data of the file the given
+ *        descriptor refers to, to disk.
+ *
+ * \returns Whether the synchronisation was successful.
+ */
+static bool commit_to_disk(int descriptor, IOCounters& io_counters)
+{
+    arc::uint64 start_time = IOCounters::start_timer();
+
+#ifdef ARC_OS_LINUX
+
+    bool result = fdatasync(descriptor) == 0;
+
+#elif defined(ARC_OS_UNIX)
+
+    bool result = fsync(descriptor) == 0;
+
+#elif defined(ARC_OS_WINDOWS)
+
+    bool result = _commit(descriptor) == 0;
+
+#else
+
+    bool result = false;
+    throw arc::ex::NotImplementedError(
+            "FileWriter synchronisation has not yet been implemented for this "
+            "platform"
+    );
+
+#endif
+
+    io_counters.record_flush(start_time);
+    return result;
+}
+
+#ifdef ARC_OS_UNIX
+
+/*!
+ * \brief Writes all of the given vectors to the given descriptor, continuing
+ *        after any partial writes.
+ *
+ * \note The contents of the vectors array are modified by this function.
+ *
+ * \throws arc::ex::IOError If the write fails.
+ */
+static void write_vectors(
+        int descriptor,
+        const arc::io::sys::Path& path,
+        struct iovec* vectors,
+        std::size_t count,
+        IOCounters& io_counters)
+{
+    while(count > 0)
+    {
+        arc::uint64 start_time = IOCounters::start_timer();
+        ssize_t result = ::writev(descriptor, vectors, static_cast<int>(count));
+        io_counters.record_write(
+            static_cast<arc::uint64>(result < 0 ? 0 : result),
+            start_time
+        );
+        if(result < 0)
+        {
+            if(errno == EINTR)
+            {
+                continue;
+            }
+            arc::str::UTF8String error_message;
+            error_message << "Failed to write to file \"" << path << "\": "
+                          << arc::os::get_last_system_error_message();
+            throw arc::ex::IOError(error_message);
+        }
+
+        // skip past the vectors that were written completely
+        std::size_t written = static_cast<std::size_t>(result);
+        while(count > 0 && written >= vectors->iov_len)
+        {
+            written -= vectors->iov_len;
+            ++vectors;
+            --count;
+        }
+        // and the written part of a partially written vector
+        if(count > 0)
+        {
+            char* base = static_cast<char*>(vectors->iov_base);
+            vectors->iov_base = base + written;
+            vectors->iov_len -= written;
+        }
+    }
+}
+
+#endif
+
 //------------------------------------------------------------------------------
 //                                  CONSTRUCTORS
 //------------------------------------------------------------------------------
@@ -22,9 +206,14 @@ FileWriter::FileWriter(
         Encoding encoding,
         Newline newline)
     :
-    FileHandle(encoding, newline),
-    m_open_mode(open_mode),
-    m_stream   (nullptr)
+    FileHandle       (encoding, newline),
+    m_open_mode      (open_mode),
+    m_buffer_size    (0),
+    m_durability     (DURABILITY_NONE),
+    m_sync_period    (1000),
+    m_buffer         (nullptr),
+    m_buffer_capacity(0),
+    m_buffer_used    (0)
 {
 }
 
@@ -34,21 +223,46 @@ FileWriter::FileWriter(
         Encoding encoding,
         Newline newline)
     :
-    FileHandle(path, encoding, newline),
-    m_open_mode(open_mode),
-    m_stream   (nullptr)
+    FileHandle       (path, encoding, newline),
+    m_open_mode      (open_mode),
+    m_buffer_size    (0),
+    m_durability     (DURABILITY_NONE),
+    m_sync_period    (1000),
+    m_buffer         (nullptr),
+    m_buffer_capacity(0),
+    m_buffer_used    (0)
 {
     open();
 }
 
 FileWriter::FileWriter(FileWriter&& other)
     :
-    FileHandle(std::move(other)),
-    m_open_mode(other.m_open_mode),
-    m_stream   (other.m_stream)
+    FileHandle       (std::move(other)),
+    m_open_mode      (other.m_open_mode),
+    m_buffer_size    (other.m_buffer_size),
+    m_durability     (other.m_durability),
+    m_sync_period    (other.m_sync_period),
+    m_buffer         (nullptr),
+    m_buffer_capacity(0),
+    m_buffer_used    (0),
+    m_sync_worker    (std::move(other.m_sync_worker))
 {
+    // the sync worker may be using the other writer's resources
+    std::unique_lock<std::mutex> lock(lock_sync_worker(m_sync_worker.get()));
+
+    // steal resources
+    m_buffer = other.m_buffer;
+    m_buffer_capacity = other.m_buffer_capacity;
+    m_buffer_used = other.m_buffer_used;
+    if(m_sync_worker)
+    {
+        m_sync_worker->writer = this;
+    }
+
     // reset other resources
-    other.m_stream = nullptr;
+    other.m_buffer = nullptr;
+    other.m_buffer_capacity = 0;
+    other.m_buffer_used = 0;
 }
 
 //------------------------------------------------------------------------------
@@ -59,11 +273,9 @@ FileWriter::~FileWriter()
 {
     if(m_open)
     {
-        m_stream->close();
-    }
-    if(m_stream)
-    {
-        delete m_stream;
+        // there is no caller to report failures to
+        std::exception_ptr sync_error;
+        shutdown(sync_error);
     }
 }
 
@@ -73,13 +285,39 @@ FileWriter::~FileWriter()
 
 FileWriter& FileWriter::operator=(FileWriter&& other)
 {
+    // release current resources
+    if(m_open)
+    {
+        // there is no caller to report failures to
+        std::exception_ptr sync_error;
+        shutdown(sync_error);
+    }
+
     // steal
     FileHandle::operator=(std::move(other));
     m_open_mode = other.m_open_mode;
-    m_stream = other.m_stream;
+    m_buffer_size = other.m_buffer_size;
+    m_durability = other.m_durability;
+    m_sync_period = other.m_sync_period;
+    m_sync_worker = std::move(other.m_sync_worker);
+    {
+        // the sync worker may be using the other writer's resources
+        std::unique_lock<std::mutex> lock(
+            lock_sync_worker(m_sync_worker.get()));
 
-    // reset
-    other.m_stream = nullptr;
+        m_buffer = other.m_buffer;
+        m_buffer_capacity = other.m_buffer_capacity;
+        m_buffer_used = other.m_buffer_used;
+        if(m_sync_worker)
+        {
+            m_sync_worker->writer = this;
+        }
+
+        // reset
+        other.m_buffer = nullptr;
+        other.m_buffer_capacity = 0;
+        other.m_buffer_used = 0;
+    }
 
     return *this;
 }
@@ -105,60 +343,89 @@ void FileWriter::set_open_mode(OpenMode open_mode)
     m_open_mode = open_mode;
 }
 
-void FileWriter::open()
+std::size_t FileWriter::get_buffer_size() const
 {
-    // ensure the file writer is not already open
+    return m_buffer_size;
+}
+
+void FileWriter::set_buffer_size(std::size_t buffer_size)
+{
+    // ensure the file writer isn't open
     if(m_open)
     {
         throw arc::ex::StateError(
-            "FileWriter cannot be opened since it is already open.");
+            "FileWriter buffer size cannot be changed since the writer is "
+            "open."
+        );
     }
 
-    // ensure we clean up the existing stream
-    if (m_stream)
-    {
-        delete m_stream;
-    }
+    m_buffer_size = buffer_size;
+}
 
-    // set up the flags for the stream
-    std::ios_base::openmode stream_flags
-            = std::ios_base::out | std::ios_base::binary;
-    if(m_open_mode == OPEN_TRUNCATE)
-    {
-        stream_flags |= std::ios_base::trunc;
-    }
-    else
+FileWriter::Durability FileWriter::get_durability() const
+{
+    return m_durability;
+}
+
+void FileWriter::set_durability(Durability durability)
+{
+    // ensure the file writer isn't open
+    if(m_open)
     {
-        stream_flags |= std::ios_base::app;
+        throw arc::ex::StateError(
+            "FileWriter durability cannot be changed since the writer is "
+            "open."
+        );
     }
 
-    // create a new stream
-#ifdef ARC_OS_WINDOWS
+    m_durability = durability;
+}
 
-    // utf-16 path
-    std::size_t length = 0;
-    const char* p = arc::str::utf8_to_utf16(
-        m_path.to_windows(),
-        length,
-        arc::data::ENDIAN_LITTLE
-    );
+arc::uint32 FileWriter::get_sync_period() const
+{
+    return m_sync_period;
+}
 
-    m_stream = new std::ofstream((const wchar_t*) p, stream_flags);
+void FileWriter::set_sync_period(arc::uint32 milliseconds)
+{
+    // ensure the file writer isn't open
+    if(m_open)
+    {
+        throw arc::ex::StateError(
+            "FileWriter sync period cannot be changed since the writer is "
+            "open."
+        );
+    }
 
-    delete[] p;
+    m_sync_period = milliseconds;
+}
 
-#else
+void FileWriter::open()
+{
+    // ensure the file writer is not already open
+    if(m_open)
+    {
+        throw arc::ex::StateError(
+            "FileWriter cannot be opened since it is already open.");
+    }
 
-    m_stream = new std::ofstream(m_path.to_native().get_raw(), stream_flags);
+    // set up the flags for the descriptor
+    int flags = O_WRONLY | O_CREAT;
+    if(m_open_mode == OPEN_TRUNCATE)
+    {
+        flags |= O_TRUNC;
+    }
+    else
+    {
+        flags |= O_APPEND;
+    }
 
-#endif
+    // open the file descriptor
+    m_descriptor = open_descriptor(m_path, flags);
 
     // did opening fail?
-    if(!m_stream->good())
+    if(m_descriptor < 0)
     {
-        // clean up
-        delete m_stream;
-
         // throw exception
         arc::str::UTF8String error_message;
         error_message << "Failed to open FileWriter to path: \'"
@@ -166,35 +433,114 @@ void FileWriter::open()
         throw arc::ex::IOError(error_message);
     }
 
-    // write the BOM based on the encoding
-    switch(m_encoding)
+    try
     {
-        case ENCODING_UTF8:
+        // appended data is written from the end of the file
+        if(m_open_mode == OPEN_APPEND)
         {
-            m_stream->write(arc::str::UTF8_BOM, arc::str::UTF8_BOM_SIZE);
-            break;
+            descriptor_seek(descriptor_size());
         }
-        case ENCODING_UTF16_LITTLE_ENDIAN:
-        {
-            m_stream->write(
-                arc::str::UTF16LE_BOM,
-                arc::str::UTF16_BOM_SIZE
-            );
-            break;
-        }
-        case ENCODING_UTF16_BIG_ENDIAN:
+
+        // write the BOM based on the encoding
+        switch(m_encoding)
         {
-            m_stream->write(
-                arc::str::UTF16BE_BOM,
-                arc::str::UTF16_BOM_SIZE
-            );
-            break;
+            case ENCODING_UTF8:
+            {
+                descriptor_write(arc::str::UTF8_BOM, arc::str::UTF8_BOM_SIZE);
+                break;
+            }
+            case ENCODING_UTF16_LITTLE_ENDIAN:
+            {
+                descriptor_write(
+                    arc::str::UTF16LE_BOM,
+                    arc::str::UTF16_BOM_SIZE
+                );
+                break;
+            }
+            case ENCODING_UTF16_BIG_ENDIAN:
+            {
+                descriptor_write(
+                    arc::str::UTF16BE_BOM,
+                    arc::str::UTF16_BOM_SIZE
+                );
+                break;
+            }
+            default:
+            {
+                // no BOM
+                break;
+            }
         }
-        default:
+    }
+    catch(...)
+    {
+        close_descriptor();
+        throw;
+    }
+
+    // set up the write buffer
+    m_buffer_capacity = m_buffer_size;
+    if(m_buffer_capacity == 0)
+    {
+        m_buffer_capacity = DEFAULT_BUFFER_SIZE;
+    }
+    m_buffer = new char[m_buffer_capacity];
+    m_buffer_used = 0;
+
+    // start periodic synchronisation
+    if(m_durability == DURABILITY_PERIODIC)
+    {
+        m_sync_worker.reset(new SyncWorker(this, m_descriptor, m_sync_period));
+        SyncWorker* worker = m_sync_worker.get();
+        worker->thread = std::thread([worker]()
         {
-            // no BOM
-            break;
-        }
+            std::unique_lock<std::mutex> lock(worker->mutex);
+            while(!worker->stop)
+            {
+                worker->condition.wait_for(lock, worker->period);
+                if(worker->stop || !worker->dirty)
+                {
+                    continue;
+                }
+
+                // hand the data to the operating system while holding the
+                // lock, but synchronise without it so writers aren't blocked
+                // on the disk
+                worker->dirty = false;
+                try
+                {
+                    worker->writer->flush_buffer();
+                }
+                catch(...)
+                {
+                    if(!worker->error)
+                    {
+                        worker->error = std::current_exception();
+                    }
+                    continue;
+                }
+                lock.unlock();
+                bool synced =
+                    commit_to_disk(worker->descriptor, worker->io_counters);
+                arc::str::UTF8String os_error;
+                if(!synced)
+                {
+                    os_error = arc::os::get_last_system_error_message();
+                }
+                lock.lock();
+
+                if(!synced && !worker->error)
+                {
+                    arc::str::UTF8String error_message;
+                    error_message << "Failed to synchronise FileWriter data "
+                                  << "to disk for path: \'"
+                                  << worker->writer->get_path().to_native()
+                                  << "\' with OS error: " << os_error;
+                    worker->error = std::make_exception_ptr(
+                        arc::ex::IOError(error_message));
+                }
+            }
+        });
     }
 
     // file write is open
@@ -217,11 +563,22 @@ void FileWriter::close()
             "FileWriter cannot be closed since it is already closed.");
     }
 
-    // close and delete the stream
-    m_stream->close();
-    delete m_stream;
-    m_stream = nullptr;
-    m_open = false;
+    // a failure of the sync worker is reported in favour of any failure while
+    // closing, since it happened first
+    std::exception_ptr sync_error;
+    bool synced = shutdown(sync_error);
+    if(sync_error)
+    {
+        std::rethrow_exception(sync_error);
+    }
+    if(!synced)
+    {
+        arc::str::UTF8String error_message;
+        error_message << "Failed to synchronise FileWriter data to disk for "
+                      << "path: \'" << m_path.to_native() << "\' with OS "
+                      << "error: " << arc::os::get_last_system_error_message();
+        throw arc::ex::IOError(error_message);
+    }
 }
 
 arc::int64 FileWriter::get_size() const
@@ -233,11 +590,18 @@ arc::int64 FileWriter::get_size() const
             "File size cannot be queried while the FileWriter is closed.");
     }
 
+    std::unique_lock<std::mutex> lock(lock_sync_worker(m_sync_worker.get()));
+
     // dynamically find the size
-    arc::int64 current = m_stream->tellp();
-    m_stream->seekp(0, std::ios_base::end);
-    arc::int64 size = m_stream->tellp();
-    m_stream->seekp(current, std::ios_base::beg);
+    arc::int64 current = descriptor_tell();
+    arc::int64 size = descriptor_size();
+
+    // buffered data will be written from the current position
+    arc::int64 buffered_end = current + static_cast<arc::int64>(m_buffer_used);
+    if(buffered_end > size)
+    {
+        size = buffered_end;
+    }
 
     return size;
 }
@@ -253,7 +617,10 @@ arc::int64 FileWriter::tell() const
         );
     }
 
-    return m_stream->tellp();
+    std::unique_lock<std::mutex> lock(lock_sync_worker(m_sync_worker.get()));
+
+    arc::int64 position = descriptor_tell();
+    return position + static_cast<arc::int64>(m_buffer_used);
 }
 
 void FileWriter::seek(arc::int64 index)
@@ -267,9 +634,22 @@ void FileWriter::seek(arc::int64 index)
         );
     }
 
-    // TODO: check size
+    std::unique_lock<std::mutex> lock(lock_sync_worker(m_sync_worker.get()));
+
+    // buffered data may extend the file so it is written out before the size
+    // is checked
+    flush_buffer();
 
-    m_stream->seekp(index);
+    arc::int64 size = descriptor_size();
+    if(index < 0 || index > size)
+    {
+        arc::str::UTF8String error_message;
+        error_message << "Cannot seek to byte index " << index << " of file "
+                      << "with size: " << size;
+        throw arc::ex::IndexOutOfBoundsError(error_message);
+    }
+
+    descriptor_seek(index);
 }
 
 void FileWriter::write(const char* data, std::size_t length, bool _flush)
@@ -280,17 +660,30 @@ void FileWriter::write(const char* data, std::size_t length, bool _flush)
         throw arc::ex::StateError(
             "File write cannot be performed while the FileWriter is closed.");
     }
+    rethrow_sync_error();
 
-    m_stream->write(data, length);
+    write_internal(data, length);
+    finish_write(_flush);
+}
 
-    // flush?
-    if(_flush)
+void FileWriter::write(const arc::str::UTF8String& data, bool _flush)
+{
+    // ensure the FileWriter is open
+    if(!m_open)
     {
-        flush();
+        throw arc::ex::StateError(
+            "File write cannot be performed while the FileWriter is closed.");
     }
+    rethrow_sync_error();
+
+    write_internal(data);
+    finish_write(_flush);
 }
 
-void FileWriter::write(const arc::str::UTF8String& data, bool _flush)
+void FileWriter::writev(
+        const Segment* segments,
+        std::size_t count,
+        bool _flush)
 {
     // ensure the FileWriter is open
     if(!m_open)
@@ -298,7 +691,213 @@ void FileWriter::write(const arc::str::UTF8String& data, bool _flush)
         throw arc::ex::StateError(
             "File write cannot be performed while the FileWriter is closed.");
     }
+    rethrow_sync_error();
 
+    {
+        std::unique_lock<std::mutex> lock(
+            lock_sync_worker(m_sync_worker.get()));
+
+        if(m_sync_worker)
+        {
+            m_sync_worker->dirty = true;
+        }
+
+        std::size_t total_length = 0;
+        for(std::size_t i = 0; i < count; ++i)
+        {
+            total_length += segments[i].length;
+        }
+
+        // gather the segments in the buffer if they fit, otherwise write them
+        // out along with the buffered data
+        if(m_buffer_used + total_length <= m_buffer_capacity)
+        {
+            for(std::size_t i = 0; i < count; ++i)
+            {
+                memcpy(
+                    m_buffer + m_buffer_used,
+                    segments[i].data,
+                    segments[i].length
+                );
+                m_buffer_used += segments[i].length;
+            }
+        }
+        else
+        {
+            write_gathered(segments, count);
+        }
+    }
+
+    finish_write(_flush);
+}
+
+void FileWriter::writev(std::initializer_list<Segment> segments, bool _flush)
+{
+    writev(segments.begin(), segments.size(), _flush);
+}
+
+void FileWriter::write_line(const char* data, std::size_t length, bool _flush)
+{
+    // ensure the FileWriter is open
+    if(!m_open)
+    {
+        throw arc::ex::StateError(
+            "File write cannot be performed while the FileWriter is closed.");
+    }
+    rethrow_sync_error();
+
+    // straight write the bytes first
+    if(length > 0)
+    {
+        write_internal(data, length);
+    }
+    // followed by a newline symbol
+    write_newline();
+
+    finish_write(_flush);
+}
+
+void FileWriter::write_line(const arc::str::UTF8String& data, bool _flush)
+{
+    // ensure the FileWriter is open
+    if(!m_open)
+    {
+        throw arc::ex::StateError(
+            "File write cannot be performed while the FileWriter is closed.");
+    }
+    rethrow_sync_error();
+
+    // write string
+    write_internal(data);
+    // then write newline
+    write_newline();
+
+    finish_write(_flush);
+}
+
+void FileWriter::flush()
+{
+    // ensure the FileWriter is open
+    if(!m_open)
+    {
+        throw arc::ex::StateError(
+            "Flush cannot be performed while the FileWriter is closed.");
+    }
+    rethrow_sync_error();
+
+    std::unique_lock<std::mutex> lock(lock_sync_worker(m_sync_worker.get()));
+
+    flush_buffer();
+}
+
+void FileWriter::sync()
+{
+    // ensure the FileWriter is open
+    if(!m_open)
+    {
+        throw arc::ex::StateError(
+            "Sync cannot be performed while the FileWriter is closed.");
+    }
+    rethrow_sync_error();
+
+    {
+        std::unique_lock<std::mutex> lock(
+            lock_sync_worker(m_sync_worker.get()));
+
+        flush_buffer();
+        if(m_sync_worker)
+        {
+            m_sync_worker->dirty = false;
+        }
+    }
+
+    if(!commit_to_disk(m_descriptor, m_io_counters))
+    {
+        arc::str::UTF8String error_message;
+        error_message << "Failed to synchronise FileWriter data to disk for "
+                      << "path: \'" << m_path.to_native() << "\' with OS "
+                      << "error: " << arc::os::get_last_system_error_message();
+        throw arc::ex::IOError(error_message);
+    }
+}
+
+void FileWriter::write_at(
+        const char* data,
+        std::size_t length,
+        arc::int64 offset)
+{
+    // ensure the FileWriter is open
+    if(!m_open)
+    {
+        throw arc::ex::StateError(
+            "File write cannot be performed while the FileWriter is closed.");
+    }
+    // positional writes are ignored by descriptors opened for appending
+    if(m_open_mode == OPEN_APPEND)
+    {
+        throw arc::ex::StateError(
+            "Positional writes cannot be performed by a FileWriter that was "
+            "opened in append mode."
+        );
+    }
+    if(offset < 0)
+    {
+        arc::str::UTF8String error_message;
+        error_message << "Cannot write to negative file offset: " << offset;
+        throw arc::ex::IndexOutOfBoundsError(error_message);
+    }
+
+    if(m_sync_worker)
+    {
+        std::lock_guard<std::mutex> lock(m_sync_worker->mutex);
+        m_sync_worker->dirty = true;
+    }
+
+    descriptor_write_at(data, length, offset);
+
+    // sync() would also flush the buffer which isn't safe to do concurrently
+    if(m_durability == DURABILITY_WRITE &&
+       !commit_to_disk(m_descriptor, m_io_counters))
+    {
+        arc::str::UTF8String error_message;
+        error_message << "Failed to synchronise FileWriter data to disk for "
+                      << "path: \'" << m_path.to_native() << "\' with OS "
+                      << "error: " << arc::os::get_last_system_error_message();
+        throw arc::ex::IOError(error_message);
+    }
+}
+
+//------------------------------------------------------------------------------
+//                            PRIVATE MEMBER FUNCTIONS
+//------------------------------------------------------------------------------
+
+void FileWriter::write_internal(const char* data, std::size_t length)
+{
+    std::unique_lock<std::mutex> lock(lock_sync_worker(m_sync_worker.get()));
+
+    if(m_sync_worker)
+    {
+        m_sync_worker->dirty = true;
+    }
+
+    // make room in the buffer
+    if(m_buffer_used + length > m_buffer_capacity)
+    {
+        flush_buffer();
+        // data that can't fit in the buffer at all is written straight through
+        if(length >= m_buffer_capacity)
+        {
+            descriptor_write(data, length);
+            return;
+        }
+    }
+
+    memcpy(m_buffer + m_buffer_used, data, length);
+    m_buffer_used += length;
+}
+
+void FileWriter::write_internal(const arc::str::UTF8String& data)
+{
     // write based on encoding
     switch(m_encoding)
     {
@@ -311,7 +910,7 @@ void FileWriter::write(const arc::str::UTF8String& data, bool _flush)
                 arc::data::ENDIAN_LITTLE,
                 false
             );
-            write(u_data, data_length, false);
+            write_internal(u_data, data_length);
             delete[] u_data;
             break;
         }
@@ -324,34 +923,86 @@ void FileWriter::write(const arc::str::UTF8String& data, bool _flush)
                 arc::data::ENDIAN_BIG,
                 false
             );
-            write(u_data, data_length, false);
+            write_internal(u_data, data_length);
             delete[] u_data;
             break;
         }
         default:
         {
-            write(data.get_raw(), data.get_byte_length() - 1, false);
+            write_internal(data.get_raw(), data.get_byte_length() - 1);
             break;
         }
     }
+}
 
-    // flush?
-    if(_flush)
+void FileWriter::write_gathered(const Segment* segments, std::size_t count)
+{
+    // the buffer is emptied even if the write fails so the failure isn't
+    // repeated by every following write
+    std::size_t buffer_used = m_buffer_used;
+    m_buffer_used = 0;
+
+#ifdef ARC_OS_UNIX
+
+    struct iovec vectors[MAX_WRITE_VECTORS];
+    std::size_t vector_count = 0;
+    if(buffer_used > 0)
     {
-        flush();
+        vectors[0].iov_base = m_buffer;
+        vectors[0].iov_len = buffer_used;
+        ++vector_count;
     }
-}
 
+    for(std::size_t i = 0; i < count; ++i)
+    {
+        if(segments[i].length == 0)
+        {
+            continue;
+        }
+        // write out the vectors gathered so far if there's no room for more
+        if(vector_count == MAX_WRITE_VECTORS)
+        {
+            write_vectors(
+                m_descriptor,
+                m_path,
+                vectors,
+                vector_count,
+                m_io_counters
+            );
+            vector_count = 0;
+        }
+        vectors[vector_count].iov_base = const_cast<char*>(segments[i].data);
+        vectors[vector_count].iov_len = segments[i].length;
+        ++vector_count;
+    }
+    if(vector_count > 0)
+    {
+        write_vectors(
+            m_descriptor,
+            m_path,
+            vectors,
+            vector_count,
+            m_io_counters
+        );
+    }
 
-void FileWriter::write_line(const char* data, std::size_t length, bool _flush)
-{
-    // straight write the bytes first
-    if(length > 0)
+#else
+
+    // no vectored write, so each segment is written separately
+    if(buffer_used > 0)
+    {
+        descriptor_write(m_buffer, buffer_used);
+    }
+    for(std::size_t i = 0; i < count; ++i)
     {
-        write(data, length, false);
+        descriptor_write(segments[i].data, segments[i].length);
     }
 
-    // followed by a newline symbol
+#endif
+}
+
+void FileWriter::write_newline()
+{
     switch(m_encoding)
     {
         case ENCODING_UTF16_LITTLE_ENDIAN:
@@ -361,13 +1012,13 @@ void FileWriter::write_line(const char* data, std::size_t length, bool _flush)
                 const std::size_t newline_length = 4;
                 const char newline_symbol[newline_length]
                     = {'\r', '\0', '\n', '\0'};
-                write(newline_symbol, newline_length, false);
+                write_internal(newline_symbol, newline_length);
             }
             else
             {
                 const std::size_t newline_length = 2;
                 const char newline_symbol[newline_length] = {'\n', '\0'};
-                write(newline_symbol, newline_length, false);
+                write_internal(newline_symbol, newline_length);
             }
             break;
         }
@@ -378,13 +1029,13 @@ void FileWriter::write_line(const char* data, std::size_t length, bool _flush)
                 const std::size_t newline_length = 4;
                 const char newline_symbol[newline_length]
                     = {'\0', '\r', '\0', '\n'};
-                write(newline_symbol, newline_length, false);
+                write_internal(newline_symbol, newline_length);
             }
             else
             {
                 const std::size_t newline_length = 2;
                 const char newline_symbol[newline_length] = {'\0', '\n'};
-                write(newline_symbol, newline_length, false);
+                write_internal(newline_symbol, newline_length);
             }
             break;
         }
@@ -394,43 +1045,106 @@ void FileWriter::write_line(const char* data, std::size_t length, bool _flush)
             {
                 const std::size_t newline_length = 2;
                 const char newline_symbol[newline_length] = {'\r', '\n'};
-                write(newline_symbol, newline_length, false);
+                write_internal(newline_symbol, newline_length);
             }
             else
             {
                 const std::size_t newline_length = 1;
                 const char newline_symbol[newline_length] = {'\n'};
-                write(newline_symbol, newline_length, false);
+                write_internal(newline_symbol, newline_length);
             }
             break;
         }
     }
+}
 
-    // flush?
-    if(_flush)
+void FileWriter::finish_write(bool _flush)
+{
+    if(m_durability == DURABILITY_WRITE)
+    {
+        sync();
+    }
+    // the flush argument is only respected when no buffer size has been set
+    else if(_flush && m_buffer_size == 0)
     {
         flush();
     }
 }
 
-void FileWriter::write_line(const arc::str::UTF8String& data, bool _flush)
+void FileWriter::rethrow_sync_error()
 {
-    // write string
-    write(data, false);
-    // then write newline
-    write_line("", 0, _flush);
+    if(!m_sync_worker)
+    {
+        return;
+    }
+
+    std::exception_ptr error;
+    {
+        std::lock_guard<std::mutex> lock(m_sync_worker->mutex);
+        error = m_sync_worker->error;
+        m_sync_worker->error = nullptr;
+    }
+    if(error)
+    {
+        std::rethrow_exception(error);
+    }
 }
 
-void FileWriter::flush()
+void FileWriter::flush_buffer()
 {
-    // ensure the FileWriter is open
-    if(!m_open)
+    if(m_buffer_used > 0)
     {
-        throw arc::ex::StateError(
-            "Flush cannot be performed while the FileWriter is closed.");
+        // the buffer is emptied even if the write fails so the failure isn't
+        // repeated by every following write
+        std::size_t buffer_used = m_buffer_used;
+        m_buffer_used = 0;
+        descriptor_write(m_buffer, buffer_used);
     }
+}
+
+bool FileWriter::shutdown(std::exception_ptr& r_sync_error)
+{
+    // stop periodic synchronisation
+    if(m_sync_worker)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_sync_worker->mutex);
+            m_sync_worker->stop = true;
+        }
+        m_sync_worker->condition.notify_all();
+        m_sync_worker->thread.join();
+        m_io_counters.merge(m_sync_worker->io_counters);
+        r_sync_error = m_sync_worker->error;
+        m_sync_worker.reset();
+    }
+
+    // write out any remaining data
+    bool synced = true;
+    try
+    {
+        flush_buffer();
+    }
+    catch(...)
+    {
+        synced = false;
+    }
+
+    if(synced &&
+       (m_durability == DURABILITY_CLOSE ||
+        m_durability == DURABILITY_PERIODIC))
+    {
+        synced = commit_to_disk(m_descriptor, m_io_counters);
+    }
+
+    // close the descriptor and release the buffer
+    close_descriptor();
+    delete[] m_buffer;
+    m_buffer = nullptr;
+    m_buffer_capacity = 0;
+    m_buffer_used = 0;
+    m_open = false;
 
-    m_stream->flush();
+    return synced;
 }
 
 } // namespace sys
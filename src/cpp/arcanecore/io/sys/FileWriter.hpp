@@ -5,9 +5,12 @@
 #ifndef ARCANECORE_IO_SYS_FILEWRITER_HPP_
 #define ARCANECORE_IO_SYS_FILEWRITER_HPP_
 
-#include "arcanecore/io/sys/FileHandle.hpp"
+#include <cstring>
+#include <exception>
+#include <initializer_list>
+#include <memory>
 
-class ofstream;
+#include "arcanecore/io/sys/FileHandle.hpp"
 
 namespace arc
 {
@@ -16,6 +19,11 @@ namespace io
 namespace sys
 {
 
+//------------------------------------------------------------------------------
+//                             FORWARD DECELERATIONS
+//------------------------------------------------------------------------------
+
+struct SyncWorker;
 
 /*!
  * \brief Used for writing to a file on disk.
@@ -45,6 +53,88 @@ public:
         OPEN_APPEND
     };
 
+    /*!
+     * \brief The possible policies for when a FileWriter commits written data
+     *        to the physical storage device.
+     *
+     * Flushing a FileWriter only hands the data to the operating system, which
+     * may hold it in memory for some time. These policies control when the
+     * FileWriter will additionally ask the operating system to synchronise the
+     * file's data to disk.
+     */
+    enum Durability
+    {
+        /// The FileWriter will never explicitly synchronise data to disk, this
+        /// is left up to the operating system.
+        DURABILITY_NONE = 0,
+        /// Data will be synchronised to disk when the FileWriter is closed.
+        DURABILITY_CLOSE,
+        /// Data will be synchronised to disk periodically from a background
+        /// thread, so that many writes are committed with a single
+        /// synchronisation. Data is also synchronised when the FileWriter is
+        /// closed. See set_sync_period(). If the background thread fails to
+        /// write or synchronise the data the failure is rethrown by the next
+        /// write, flush, sync, or close.
+        DURABILITY_PERIODIC,
+        /// Data will be synchronised to disk after every write.
+        DURABILITY_WRITE
+    };
+
+    //--------------------------------------------------------------------------
+    //                                  STRUCTS
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief A reference to a contiguous block of bytes to be written by
+     *        writev().
+     *
+     * A Segment does not own the data it refers to, so the data must remain
+     * valid until the write has been performed.
+     */
+    struct Segment
+    {
+        /*!
+         * \brief The start of the bytes to write.
+         */
+        const char* data;
+        /*!
+         * \brief The number of bytes to write.
+         */
+        std::size_t length;
+
+        /*!
+         * \brief Creates a segment referring to the given byte array.
+         */
+        Segment(const char* _data, std::size_t _length)
+            :
+            data  (_data),
+            length(_length)
+        {
+        }
+
+        /*!
+         * \brief Creates a segment referring to the given null terminated
+         *        string, excluding the null terminator.
+         */
+        Segment(const char* _data)
+            :
+            data  (_data),
+            length(strlen(_data))
+        {
+        }
+
+        /*!
+         * \brief Creates a segment referring to the raw UTF-8 data of the
+         *        given string, excluding the null terminator.
+         */
+        Segment(const arc::str::UTF8String& _data)
+            :
+            data  (_data.get_raw()),
+            length(_data.get_byte_length() - 1)
+        {
+        }
+    };
+
     //--------------------------------------------------------------------------
     //                                CONSTRUCTORS
     //--------------------------------------------------------------------------
@@ -131,6 +221,63 @@ public:
      */
     void set_open_mode(OpenMode open_mode);
 
+    /*!
+     * \brief Returns the size in bytes of the write buffer used by this
+     *        FileWriter.
+     */
+    std::size_t get_buffer_size() const;
+
+    /*!
+     * \brief Sets the size in bytes of the write buffer used by this
+     *        FileWriter.
+     *
+     * If the buffer size is ```0``` (the default) data is held in a small
+     * internal buffer which is written to the file whenever the ```flush```
+     * parameter of the write functions is ```true```.
+     *
+     * Otherwise data is accumulated in a buffer of the given size and is only
+     * written to the file when the buffer is full, flush() or sync() is
+     * called, or the FileWriter is closed. In this mode the ```flush```
+     * parameter of the write functions is ignored, so that callers that
+     * flush after every write do not defeat the buffer. The durability policy
+     * (see set_durability()) is still applied.
+     *
+     * \throws arc::ex::StateError If this FileWriter is open.
+     */
+    void set_buffer_size(std::size_t buffer_size);
+
+    /*!
+     * \brief Returns the durability policy of this FileWriter.
+     */
+    Durability get_durability() const;
+
+    /*!
+     * \brief Sets the policy for when this FileWriter will synchronise written
+     *        data to disk.
+     *
+     * \throws arc::ex::StateError If this FileWriter is open.
+     */
+    void set_durability(Durability durability);
+
+    /*!
+     * \brief Returns the number of milliseconds between each synchronisation
+     *        when the arc::io::sys::FileWriter::DURABILITY_PERIODIC policy is
+     *        being used.
+     */
+    arc::uint32 get_sync_period() const;
+
+    /*!
+     * \brief Sets the number of milliseconds between each synchronisation
+     *        when the arc::io::sys::FileWriter::DURABILITY_PERIODIC policy is
+     *        being used.
+     *
+     * Synchronisation is only performed if data has been written since the
+     * last synchronisation. The default period is 1000 milliseconds.
+     *
+     * \throws arc::ex::StateError If this FileWriter is open.
+     */
+    void set_sync_period(arc::uint32 milliseconds);
+
     /*!
      * \brief Opens this FileWriter to the internal path.
      *
@@ -149,6 +296,16 @@ public:
 
     /*!
      * \brief Closes this FileWriter.
+     *
+     * Any buffered data is written to the file before closing, and if the
+     * durability policy is arc::io::sys::FileWriter::DURABILITY_CLOSE or
+     * arc::io::sys::FileWriter::DURABILITY_PERIODIC the file's data is
+     * synchronised to disk.
+     *
+     * \throws arc::ex::IOError If the data could not be synchronised, or
+     *                           periodic synchronisation failed since the
+     *                           last write. The FileWriter will still be
+     *                           closed.
      */
     virtual void close();
 
@@ -187,12 +344,51 @@ public:
      *
      * \param data The byte array to write to the file.
      * \param length The number of bytes in the provided data.
-     * \param flush Whether flush() will be called after writing.
+     * \param flush Whether flush() will be called after writing. This is
+     *              ignored if this FileWriter has a write buffer, see
+     *              set_buffer_size().
      *
      * \throws arc::ex::StateError If this FileWriter is not open.
      */
     void write(const char* data, std::size_t length, bool flush = true);
 
+    /*!
+     * \brief Writes the given segments of data to the file, one after the
+     *        other, as if they were a single contiguous array.
+     *
+     * This allows a record made up of several pieces to be written without
+     * first concatenating the pieces. Small records are gathered in the write
+     * buffer, while records larger than the remaining buffer space are written
+     * along with the buffer contents using a single vectored write.
+     *
+     * Like write(const char*, std::size_t, bool) this function writes the raw
+     * bytes of each segment, so assumes the data is in the correct encoding.
+     *
+     * \param segments Pointer to the first of the segments to write.
+     * \param count The number of segments to write.
+     * \param flush Whether flush() will be called after writing. This is
+     *              ignored if this FileWriter has a write buffer, see
+     *              set_buffer_size().
+     *
+     * \throws arc::ex::StateError If this FileWriter is not open.
+     * \throws arc::ex::IOError If the write fails.
+     */
+    void writev(const Segment* segments, std::size_t count, bool flush = true);
+
+    /*!
+     * \brief Writes the given segments of data to the file, one after the
+     *        other, as if they were a single contiguous array.
+     *
+     * Example usage:
+     *
+     * \code
+     * writer.writev({name, ": ", value, "\n"});
+     * \endcode
+     *
+     * See writev(const Segment*, std::size_t, bool).
+     */
+    void writev(std::initializer_list<Segment> segments, bool flush = true);
+
     /*!
      * \brief Writes the given arc::str::UTF8String to the file.
      *
@@ -201,7 +397,9 @@ public:
      * converted to this FileWriter's newline type and are left as is.
      *
      * \param data The string to write to the file.
-     * \param flush Whether flush() will be called after writing.
+     * \param flush Whether flush() will be called after writing. This is
+     *              ignored if this FileWriter has a write buffer, see
+     *              set_buffer_size().
      *
      * \throws arc::ex::StateError If this FileWriter is not open.
      */
@@ -219,7 +417,9 @@ public:
      *
      * \param data The byte array to write to the file.
      * \param length The number of bytes in the provided data.
-     * \param flush Whether flush() will be called after writing.
+     * \param flush Whether flush() will be called after writing. This is
+     *              ignored if this FileWriter has a write buffer, see
+     *              set_buffer_size().
      *
      * \throws arc::ex::StateError If this FileWriter is not open.
      */
@@ -236,7 +436,9 @@ public:
      * to match the FileWriter's newline type.
      *
      * \param data The string to write to the file.
-     * \param flush Whether flush() will be called after writing.
+     * \param flush Whether flush() will be called after writing. This is
+     *              ignored if this FileWriter has a write buffer, see
+     *              set_buffer_size().
      *
      * \throws arc::ex::StateError If this FileWriter is not open.
      */
@@ -249,6 +451,40 @@ public:
      */
     void flush();
 
+    /*!
+     * \brief Writes any currently buffered data to the file and then
+     *        synchronises the file's data to disk.
+     *
+     * This is performed regardless of the durability policy of this
+     * FileWriter.
+     *
+     * \throws arc::ex::StateError If this FileWriter is not open.
+     * \throws arc::ex::IOError If the data could not be synchronised.
+     */
+    void sync();
+
+    /*!
+     * \brief Writes the given data at the given byte offset of the file
+     *        without using or moving the file position indicator.
+     *
+     * The data bypasses the write buffer and any data currently held in the
+     * buffer is not flushed first. Multiple threads may call this function
+     * concurrently on the same FileWriter to write to separate regions of the
+     * file. The durability policy is still applied.
+     *
+     * \param data The data to write to the file.
+     * \param length The number of bytes in the data to write.
+     * \param offset The byte index in the file to begin writing at.
+     *
+     * \throws arc::ex::StateError If this FileWriter is not open, or was
+     *                              opened with
+     *                              arc::io::sys::FileWriter::OPEN_APPEND.
+     * \throws arc::ex::IndexOutOfBoundsError If the given offset is less than
+     *                                          0.
+     * \throws arc::ex::IOError If the write fails.
+     */
+    void write_at(const char* data, std::size_t length, arc::int64 offset);
+
 private:
 
     //--------------------------------------------------------------------------
@@ -259,11 +495,100 @@ private:
      * \brief The mode the FileWriter should be opened with.
      */
     OpenMode m_open_mode;
+    /*!
+     * \brief The size of the write buffer in bytes.
+     */
+    std::size_t m_buffer_size;
+    /*!
+     * \brief The policy for synchronising data to disk.
+     */
+    Durability m_durability;
+    /*!
+     * \brief The milliseconds between periodic synchronisations.
+     */
+    arc::uint32 m_sync_period;
+
+    /*!
+     * \brief The write buffer, this is null if the FileWriter is not open.
+     */
+    char* m_buffer;
+    /*!
+     * \brief The number of bytes the write buffer can hold.
+     */
+    std::size_t m_buffer_capacity;
+    /*!
+     * \brief The number of bytes currently held in the write buffer.
+     */
+    std::size_t m_buffer_used;
+
+    /*!
+     * \brief The background worker used for periodic synchronisation, this is
+     *        null unless the durability policy is
+     *        arc::io::sys::FileWriter::DURABILITY_PERIODIC and the FileWriter
+     *        is open.
+     */
+    std::unique_ptr<SyncWorker> m_sync_worker;
+
+    //--------------------------------------------------------------------------
+    //                          PRIVATE MEMBER FUNCTIONS
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief Writes the given data to the write buffer, or directly to the
+     *        file if the data does not fit in the buffer.
+     */
+    void write_internal(const char* data, std::size_t length);
+
+    /*!
+     * \brief Converts the given string to this FileWriter's encoding and
+     *        writes it via write_internal().
+     */
+    void write_internal(const arc::str::UTF8String& data);
+
+    /*!
+     * \brief Writes the contents of the write buffer followed by the given
+     *        segments directly to the file, using a single vectored write
+     *        where supported.
+     *
+     * \note If there is a sync worker its mutex must be held by the caller.
+     */
+    void write_gathered(const Segment* segments, std::size_t count);
 
     /*!
-     * \brief The output stream used to write to the file.
+     * \brief Writes this FileWriter's newline symbol in its encoding via
+     *        write_internal().
+     */
+    void write_newline();
+
+    /*!
+     * \brief Applies the flush argument of a public write function and the
+     *        durability policy once the write has been performed.
+     */
+    void finish_write(bool _flush);
+
+    /*!
+     * \brief Rethrows the first failure of the sync worker since the last
+     *        time this was called, if there has been one.
+     */
+    void rethrow_sync_error();
+
+    /*!
+     * \brief Moves the contents of the write buffer to the file.
+     *
+     * \note If there is a sync worker its mutex must be held by the caller.
+     */
+    void flush_buffer();
+
+    /*!
+     * \brief Flushes the buffer, stops any sync worker and closes the file,
+     *        without checking whether this FileWriter is open.
+     *
+     * \param r_sync_error Returns the failure of the sync worker that has not
+     *                     yet been reported, if there is one.
+     * \returns Whether the data was synchronised to disk successfully if
+     *          required by the durability policy.
      */
-    std::ofstream* m_stream;
+    bool shutdown(std::exception_ptr& r_sync_error);
 };
 
 } // namespace sys
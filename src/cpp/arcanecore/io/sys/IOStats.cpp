@@ -0,0 +1,257 @@
+#include "arcanecore/io/sys/IOStats.hpp"
+
+#ifndef ARC_IO_DISABLE_STATS
+    #include <chrono>
+#endif
+
+namespace arc
+{
+namespace io
+{
+namespace sys
+{
+
+#ifndef ARC_IO_DISABLE_STATS
+
+//------------------------------------------------------------------------------
+//                                   GLOBALS
+//------------------------------------------------------------------------------
+
+/*!
+ * \brief Returns the counters that all I/O in the process is recorded to.
+ */
+static IOCounters& get_global_counters()
+{
+    static IOCounters global_counters;
+    return global_counters;
+}
+
+//------------------------------------------------------------------------------
+//                               STATIC FUNCTIONS
+//------------------------------------------------------------------------------
+
+/*!
+ * \brief Adds a value to a counter, the counts are only ever read as a
+ *        snapshot so no ordering is required.
+ */
+static void add(std::atomic<arc::uint64>& counter, arc::uint64 value)
+{
+    counter.fetch_add(value, std::memory_order_relaxed);
+}
+
+/*!
+ * \brief Moves the value of a counter to another, leaving it at zero.
+ */
+static void take(std::atomic<arc::uint64>& to, std::atomic<arc::uint64>& from)
+{
+    to.store(
+        from.exchange(0, std::memory_order_relaxed),
+        std::memory_order_relaxed
+    );
+}
+
+/*!
+ * \brief Returns the number of nanoseconds since the given start time.
+ */
+static arc::uint64 get_elapsed_time(arc::uint64 start_time)
+{
+    return IOCounters::start_timer() - start_time;
+}
+
+//------------------------------------------------------------------------------
+//                                  CONSTRUCTORS
+//------------------------------------------------------------------------------
+
+IOCounters::IOCounters()
+    :
+    m_bytes_read   (0),
+    m_bytes_written(0),
+    m_read_calls   (0),
+    m_write_calls  (0),
+    m_seek_calls   (0),
+    m_flush_calls  (0),
+    m_blocked_time (0)
+{
+}
+
+IOCounters::IOCounters(IOCounters&& other)
+    :
+    m_bytes_read   (0),
+    m_bytes_written(0),
+    m_read_calls   (0),
+    m_write_calls  (0),
+    m_seek_calls   (0),
+    m_flush_calls  (0),
+    m_blocked_time (0)
+{
+    *this = std::move(other);
+}
+
+//------------------------------------------------------------------------------
+//                                   OPERATORS
+//------------------------------------------------------------------------------
+
+IOCounters& IOCounters::operator=(IOCounters&& other)
+{
+    take(m_bytes_read,    other.m_bytes_read);
+    take(m_bytes_written, other.m_bytes_written);
+    take(m_read_calls,    other.m_read_calls);
+    take(m_write_calls,   other.m_write_calls);
+    take(m_seek_calls,    other.m_seek_calls);
+    take(m_flush_calls,   other.m_flush_calls);
+    take(m_blocked_time,  other.m_blocked_time);
+
+    return *this;
+}
+
+//------------------------------------------------------------------------------
+//                            PUBLIC STATIC FUNCTIONS
+//------------------------------------------------------------------------------
+
+arc::uint64 IOCounters::start_timer()
+{
+    // the steady clock is used since the system clock may jump
+    return static_cast<arc::uint64>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()
+        ).count()
+    );
+}
+
+//------------------------------------------------------------------------------
+//                            PUBLIC MEMBER FUNCTIONS
+//------------------------------------------------------------------------------
+
+IOStats IOCounters::get_stats() const
+{
+    IOStats stats;
+    stats.bytes_read    = m_bytes_read.load(std::memory_order_relaxed);
+    stats.bytes_written = m_bytes_written.load(std::memory_order_relaxed);
+    stats.read_calls    = m_read_calls.load(std::memory_order_relaxed);
+    stats.write_calls   = m_write_calls.load(std::memory_order_relaxed);
+    stats.seek_calls    = m_seek_calls.load(std::memory_order_relaxed);
+    stats.flush_calls   = m_flush_calls.load(std::memory_order_relaxed);
+    stats.blocked_time  = m_blocked_time.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void IOCounters::reset()
+{
+    m_bytes_read.store(0, std::memory_order_relaxed);
+    m_bytes_written.store(0, std::memory_order_relaxed);
+    m_read_calls.store(0, std::memory_order_relaxed);
+    m_write_calls.store(0, std::memory_order_relaxed);
+    m_seek_calls.store(0, std::memory_order_relaxed);
+    m_flush_calls.store(0, std::memory_order_relaxed);
+    m_blocked_time.store(0, std::memory_order_relaxed);
+}
+
+void IOCounters::merge(const IOCounters& other)
+{
+    IOStats stats(other.get_stats());
+    add(m_bytes_read,    stats.bytes_read);
+    add(m_bytes_written, stats.bytes_written);
+    add(m_read_calls,    stats.read_calls);
+    add(m_write_calls,   stats.write_calls);
+    add(m_seek_calls,    stats.seek_calls);
+    add(m_flush_calls,   stats.flush_calls);
+    add(m_blocked_time,  stats.blocked_time);
+}
+
+void IOCounters::record_read(arc::uint64 bytes, arc::uint64 start_time)
+{
+    arc::uint64 elapsed = get_elapsed_time(start_time);
+    IOCounters& global_counters = get_global_counters();
+
+    add(m_bytes_read, bytes);
+    add(m_read_calls, 1);
+    add(m_blocked_time, elapsed);
+    add(global_counters.m_bytes_read, bytes);
+    add(global_counters.m_read_calls, 1);
+    add(global_counters.m_blocked_time, elapsed);
+}
+
+void IOCounters::record_write(arc::uint64 bytes, arc::uint64 start_time)
+{
+    arc::uint64 elapsed = get_elapsed_time(start_time);
+    IOCounters& global_counters = get_global_counters();
+
+    add(m_bytes_written, bytes);
+    add(m_write_calls, 1);
+    add(m_blocked_time, elapsed);
+    add(global_counters.m_bytes_written, bytes);
+    add(global_counters.m_write_calls, 1);
+    add(global_counters.m_blocked_time, elapsed);
+}
+
+void IOCounters::record_seek(arc::uint64 start_time)
+{
+    arc::uint64 elapsed = get_elapsed_time(start_time);
+    IOCounters& global_counters = get_global_counters();
+
+    add(m_seek_calls, 1);
+    add(m_blocked_time, elapsed);
+    add(global_counters.m_seek_calls, 1);
+    add(global_counters.m_blocked_time, elapsed);
+}
+
+void IOCounters::record_flush(arc::uint64 start_time)
+{
+    arc::uint64 elapsed = get_elapsed_time(start_time);
+    IOCounters& global_counters = get_global_counters();
+
+    add(m_flush_calls, 1);
+    add(m_blocked_time, elapsed);
+    add(global_counters.m_flush_calls, 1);
+    add(global_counters.m_blocked_time, elapsed);
+}
+
+#endif
+
+//------------------------------------------------------------------------------
+//                                   FUNCTIONS
+//------------------------------------------------------------------------------
+
+IOStats get_global_io_stats()
+{
+#ifndef ARC_IO_DISABLE_STATS
+    return get_global_counters().get_stats();
+#else
+    return IOStats();
+#endif
+}
+
+void reset_global_io_stats()
+{
+#ifndef ARC_IO_DISABLE_STATS
+    get_global_counters().reset();
+#endif
+}
+
+//------------------------------------------------------------------------------
+//                                   OPERATORS
+//------------------------------------------------------------------------------
+
+std::ostream& operator<<(std::ostream& stream, const IOStats& stats)
+{
+    arc::str::UTF8String s;
+    s << stats;
+    stream << s;
+    return stream;
+}
+
+arc::str::UTF8String& operator<<(
+        arc::str::UTF8String& s,
+        const IOStats& stats)
+{
+    s << "read: " << stats.bytes_read << " bytes in " << stats.read_calls
+      << " calls, written: " << stats.bytes_written << " bytes in "
+      << stats.write_calls << " calls, seeks: " << stats.seek_calls
+      << ", flushes: " << stats.flush_calls << ", blocked: "
+      << (stats.blocked_time / 1000) << "us";
+    return s;
+}
+
+} // namespace sys
+} // namespace io
+} // namespace arc
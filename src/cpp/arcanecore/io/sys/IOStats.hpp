@@ -0,0 +1,309 @@
+/*!
+ * \file
+ * \author David Saxon
+ */
+#ifndef ARCANECORE_IO_SYS_IOSTATS_HPP_
+#define ARCANECORE_IO_SYS_IOSTATS_HPP_
+
+#include <ostream>
+
+#ifndef ARC_IO_DISABLE_STATS
+    #include <atomic>
+#endif
+
+#include "arcanecore/base/Types.hpp"
+#include "arcanecore/base/str/UTF8String.hpp"
+
+namespace arc
+{
+namespace io
+{
+namespace sys
+{
+
+/*!
+ * \brief A snapshot of the I/O performed by a FileHandle or by the whole
+ *        process.
+ *
+ * Call counts are the number of system calls made, so a single read that the
+ * operating system completes in several parts counts as several calls.
+ */
+struct IOStats
+{
+public:
+
+    //----------------------------PUBLIC ATTRIBUTES-----------------------------
+
+    /*!
+     * \brief The number of bytes read.
+     */
+    arc::uint64 bytes_read;
+    /*!
+     * \brief The number of bytes written.
+     */
+    arc::uint64 bytes_written;
+    /*!
+     * \brief The number of read system calls.
+     */
+    arc::uint64 read_calls;
+    /*!
+     * \brief The number of write system calls, a vectored write counts once.
+     */
+    arc::uint64 write_calls;
+    /*!
+     * \brief The number of system calls that queried or moved a file offset.
+     */
+    arc::uint64 seek_calls;
+    /*!
+     * \brief The number of system calls that synchronised data to disk.
+     */
+    arc::uint64 flush_calls;
+    /*!
+     * \brief The total number of nanoseconds spent blocked in the above
+     *        system calls.
+     */
+    arc::uint64 blocked_time;
+
+    //-------------------------------CONSTRUCTOR--------------------------------
+
+    IOStats()
+        :
+        bytes_read   (0),
+        bytes_written(0),
+        read_calls   (0),
+        write_calls  (0),
+        seek_calls   (0),
+        flush_calls  (0),
+        blocked_time (0)
+    {
+    }
+};
+
+/*!
+ * \brief Thread safe counters that I/O is recorded to.
+ *
+ * Everything recorded to an IOCounters object is also recorded to the process
+ * wide counters, see get_global_io_stats().
+ *
+ * If ```ARC_IO_DISABLE_STATS``` is defined this object holds no data and all
+ * of its functions are empty inline functions, so recording has no cost.
+ *
+ * \par Example Usage
+ *
+ * \code
+ * arc::uint64 start_time = arc::io::sys::IOCounters::start_timer();
+ * ssize_t result = ::read(descriptor, data, length);
+ * counters.record_read(result, start_time);
+ * \endcode
+ */
+class IOCounters
+{
+public:
+
+    //--------------------------------------------------------------------------
+    //                                CONSTRUCTORS
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief Creates new zeroed counters.
+     */
+    IOCounters();
+
+    /*!
+     * \brief Move constructor.
+     *
+     * Takes the counts of the given object, which is then reset.
+     */
+    IOCounters(IOCounters&& other);
+
+    //--------------------------------------------------------------------------
+    //                                 OPERATORS
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief Move assignment operator.
+     *
+     * Takes the counts of the given object, which is then reset.
+     */
+    IOCounters& operator=(IOCounters&& other);
+
+    //--------------------------------------------------------------------------
+    //                          PUBLIC STATIC FUNCTIONS
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief Returns the start time to pass to the record functions once the
+     *        system call being timed has returned.
+     */
+    static arc::uint64 start_timer();
+
+    //--------------------------------------------------------------------------
+    //                          PUBLIC MEMBER FUNCTIONS
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief Returns a snapshot of the current counts.
+     */
+    IOStats get_stats() const;
+
+    /*!
+     * \brief Sets all counts back to zero.
+     *
+     * \note This does not affect the process wide counters.
+     */
+    void reset();
+
+    /*!
+     * \brief Adds the counts of the given object to this object's counts
+     *        without recording them to the process wide counters again.
+     */
+    void merge(const IOCounters& other);
+
+    /*!
+     * \brief Records a read system call.
+     *
+     * \param bytes The number of bytes the call read.
+     * \param start_time The value returned by start_timer() before the call.
+     */
+    void record_read(arc::uint64 bytes, arc::uint64 start_time);
+
+    /*!
+     * \brief Records a write system call.
+     *
+     * \param bytes The number of bytes the call wrote.
+     * \param start_time The value returned by start_timer() before the call.
+     */
+    void record_write(arc::uint64 bytes, arc::uint64 start_time);
+
+    /*!
+     * \brief Records a system call that queried or moved a file offset.
+     *
+     * \param start_time The value returned by start_timer() before the call.
+     */
+    void record_seek(arc::uint64 start_time);
+
+    /*!
+     * \brief Records a system call that synchronised data to disk.
+     *
+     * \param start_time The value returned by start_timer() before the call.
+     */
+    void record_flush(arc::uint64 start_time);
+
+#ifndef ARC_IO_DISABLE_STATS
+
+private:
+
+    //--------------------------------------------------------------------------
+    //                             PRIVATE ATTRIBUTES
+    //--------------------------------------------------------------------------
+
+    std::atomic<arc::uint64> m_bytes_read;
+    std::atomic<arc::uint64> m_bytes_written;
+    std::atomic<arc::uint64> m_read_calls;
+    std::atomic<arc::uint64> m_write_calls;
+    std::atomic<arc::uint64> m_seek_calls;
+    std::atomic<arc::uint64> m_flush_calls;
+    std::atomic<arc::uint64> m_blocked_time;
+
+#endif
+};
+
+//------------------------------------------------------------------------------
+//                                   FUNCTIONS
+//------------------------------------------------------------------------------
+
+/*!
+ * \brief Returns a snapshot of the I/O performed by every FileHandle in this
+ *        process.
+ */
+IOStats get_global_io_stats();
+
+/*!
+ * \brief Sets the process wide I/O counts back to zero.
+ */
+void reset_global_io_stats();
+
+//------------------------------------------------------------------------------
+//                                   OPERATORS
+//------------------------------------------------------------------------------
+
+/*!
+ * \brief Writes a single line summary of the given stats to the stream.
+ *
+ * This allows stats to be written directly to the streams of an
+ * arc::log::Input:
+ *
+ * \code
+ * logger->debug << "I/O: " << arc::io::sys::get_global_io_stats()
+ *               << std::endl;
+ * \endcode
+ */
+std::ostream& operator<<(std::ostream& stream, const IOStats& stats);
+
+/*!
+ * \brief Appends a single line summary of the given stats to the string.
+ */
+arc::str::UTF8String& operator<<(
+        arc::str::UTF8String& s,
+        const IOStats& stats);
+
+//------------------------------------------------------------------------------
+//                           DISABLED INLINE FUNCTIONS
+//------------------------------------------------------------------------------
+
+#ifdef ARC_IO_DISABLE_STATS
+
+inline IOCounters::IOCounters()
+{
+}
+
+inline IOCounters::IOCounters(IOCounters&&)
+{
+}
+
+inline IOCounters& IOCounters::operator=(IOCounters&&)
+{
+    return *this;
+}
+
+inline arc::uint64 IOCounters::start_timer()
+{
+    return 0;
+}
+
+inline IOStats IOCounters::get_stats() const
+{
+    return IOStats();
+}
+
+inline void IOCounters::reset()
+{
+}
+
+inline void IOCounters::merge(const IOCounters&)
+{
+}
+
+inline void IOCounters::record_read(arc::uint64, arc::uint64)
+{
+}
+
+inline void IOCounters::record_write(arc::uint64, arc::uint64)
+{
+}
+
+inline void IOCounters::record_seek(arc::uint64)
+{
+}
+
+inline void IOCounters::record_flush(arc::uint64)
+{
+}
+
+#endif
+
+} // namespace sys
+} // namespace io
+} // namespace arc
+
+#endif
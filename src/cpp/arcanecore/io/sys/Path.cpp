@@ -1,5 +1,6 @@
 #include "arcanecore/io/sys/Path.hpp"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstring>
 
@@ -24,41 +25,186 @@ namespace io
 namespace sys
 {
 
+//------------------------------------------------------------------------------
+//                                   CONSTANTS
+//------------------------------------------------------------------------------
+
+#ifdef ARC_OS_WINDOWS
+
+/*!
+ * \brief The separator between components in native path strings.
+ */
+static const char NATIVE_SEPARATOR = '\\';
+
+#else
+
+/*!
+ * \brief The separator between components in native path strings.
+ */
+static const char NATIVE_SEPARATOR = '/';
+
+#endif
+
+//------------------------------------------------------------------------------
+//                               COMPONENT REFERENCE
+//------------------------------------------------------------------------------
+
+Path::ComponentReference::ComponentReference(Path* path, std::size_t index)
+    :
+    m_path (path),
+    m_index(index)
+{
+}
+
+Path::ComponentReference::ComponentReference(const ComponentReference& other)
+    :
+    m_path (nullptr),
+    m_index(other.m_index)
+{
+    arc::str::UTF8StringView value(other.get_view());
+    m_value.assign(value.get_raw(), value.get_byte_length());
+}
+
+Path::ComponentReference::ComponentReference(ComponentReference&& other)
+    :
+    m_path (other.m_path),
+    m_index(other.m_index),
+    m_value(std::move(other.m_value))
+{
+}
+
+Path::ComponentReference& Path::ComponentReference::operator=(
+        const ComponentReference& other)
+{
+    if(this != &other)
+    {
+        // copy the value first, since both may refer to the same Path
+        std::string value(other.get_view().to_std_string());
+        if(m_path != nullptr)
+        {
+            m_path->replace_component(m_index, value.data(), value.size());
+        }
+        else
+        {
+            m_value.swap(value);
+        }
+    }
+    return *this;
+}
+
+Path::ComponentReference& Path::ComponentReference::operator=(
+        const arc::str::UTF8String& component)
+{
+    if(m_path != nullptr)
+    {
+        m_path->replace_component(
+            m_index,
+            component.get_raw(),
+            component.get_byte_length() - 1
+        );
+    }
+    else
+    {
+        m_value.assign(component.get_raw(), component.get_byte_length() - 1);
+    }
+    return *this;
+}
+
+Path::ComponentReference& Path::ComponentReference::operator+=(
+        const arc::str::UTF8String& component)
+{
+    std::string value(get_view().to_std_string());
+    value.append(component.get_raw(), component.get_byte_length() - 1);
+    if(m_path != nullptr)
+    {
+        m_path->replace_component(m_index, value.data(), value.size());
+    }
+    else
+    {
+        m_value.swap(value);
+    }
+    return *this;
+}
+
+bool Path::ComponentReference::operator==(
+        const arc::str::UTF8StringView& other) const
+{
+    return get_view() == other;
+}
+
+bool Path::ComponentReference::operator!=(
+        const arc::str::UTF8StringView& other) const
+{
+    return get_view() != other;
+}
+
+Path::ComponentReference::operator arc::str::UTF8StringView() const
+{
+    return get_view();
+}
+
+arc::str::UTF8StringView Path::ComponentReference::get_view() const
+{
+    if(m_path != nullptr)
+    {
+        const Path& path = *m_path;
+        return path[m_index];
+    }
+    return arc::str::UTF8StringView(m_value.data(), m_value.size());
+}
+
+arc::str::UTF8String Path::ComponentReference::to_string() const
+{
+    return get_view().to_string();
+}
+
 //------------------------------------------------------------------------------
 //                                  CONSTRUCTORS
 //------------------------------------------------------------------------------
 
 Path::Path()
+    :
+    m_hash             (0),
+    m_component_strings(nullptr)
 {
 }
 
 Path::Path(const std::vector<arc::str::UTF8String>& components)
     :
-    m_components(components)
+    m_hash             (0),
+    m_component_strings(nullptr)
 {
+    assign_components(components.begin(), components.end());
 }
 
 Path::Path(
         const std::vector<arc::str::UTF8String>::const_iterator& begin,
         const std::vector<arc::str::UTF8String>::const_iterator& end)
     :
-    m_components(begin, end)
+    m_hash             (0),
+    m_component_strings(nullptr)
 {
+    assign_components(begin, end);
 }
 
 Path::Path(const arc::str::UTF8String& string_path)
+    :
+    m_hash             (0),
+    m_component_strings(nullptr)
 {
+    std::vector<arc::str::UTF8String> components;
+
     // split the path into components based on the operating system
 #ifdef ARC_OS_UNIX
 
     arc::str::UTF8String santised_path(string_path);
     static const arc::str::UTF8String UNIX_SEP("/");
     santised_path.remove_duplicates(UNIX_SEP);
-    m_components = santised_path.split(UNIX_SEP);
+    components = santised_path.split(UNIX_SEP);
 
-    if(m_components.size() > 0 && m_components[0] == "")
+    if(components.size() > 0 && components[0] == "")
     {
-        m_components[0] = "/";
+        components[0] = "/";
     }
 
 #elif defined(ARC_OS_WINDOWS)
@@ -66,30 +212,45 @@ Path::Path(const arc::str::UTF8String& string_path)
     arc::str::UTF8String santised_path(string_path);
     const arc::str::UTF8String WINDOWS_SEP("\\");
     santised_path.remove_duplicates(WINDOWS_SEP);
-    m_components = santised_path.split(WINDOWS_SEP);
+    components = santised_path.split(WINDOWS_SEP);
 
 #endif
 
     // remove final space if the path ended with /
-    if(m_components.size() > 0 && m_components.back() == "")
+    std::size_t count = components.size();
+    if(count > 0 && components.back() == "")
     {
-        m_components = std::vector<arc::str::UTF8String>(
-            m_components.begin(), m_components.end() - 1);
+        --count;
     }
+    assign_components(components.begin(), components.begin() + count);
 }
 
 Path::Path(const Path& other)
     :
-    m_components(other.m_components)
+    m_native           (other.m_native),
+    m_components       (other.m_components),
+    m_hash             (other.m_hash.load(std::memory_order_relaxed)),
+    m_component_strings(nullptr)
 {
 }
 
+Path::Path(Path&& other)
+    :
+    m_native           (std::move(other.m_native)),
+    m_components       (std::move(other.m_components)),
+    m_hash             (other.m_hash.load(std::memory_order_relaxed)),
+    m_component_strings(other.m_component_strings.exchange(nullptr))
+{
+    other.clear();
+}
+
 //------------------------------------------------------------------------------
 //                                   DESTRUCTOR
 //------------------------------------------------------------------------------
 
 Path::~Path()
 {
+    delete m_component_strings.load();
 }
 
 //------------------------------------------------------------------------------
@@ -144,22 +305,62 @@ Path Path::from_windows_string(const arc::str::UTF8String& string_path)
 
 const Path& Path::operator=(const Path& other)
 {
-    m_components = other.m_components;
+    if(this != &other)
+    {
+        m_native = other.m_native;
+        m_components = other.m_components;
+        reset_caches();
+        m_hash.store(
+            other.m_hash.load(std::memory_order_relaxed),
+            std::memory_order_relaxed
+        );
+    }
+    return *this;
+}
+
+Path& Path::operator=(Path&& other)
+{
+    if(this != &other)
+    {
+        m_native = std::move(other.m_native);
+        m_components = std::move(other.m_components);
+        reset_caches();
+        m_hash.store(
+            other.m_hash.load(std::memory_order_relaxed),
+            std::memory_order_relaxed
+        );
+        m_component_strings.store(other.m_component_strings.exchange(nullptr));
+        other.clear();
+    }
     return *this;
 }
 
 bool Path::operator==(const Path& other) const
 {
-    // check length first
-    if(m_components.size() != other.m_components.size())
+    // check lengths first
+    if(m_components.size() != other.m_components.size() ||
+       m_native.size()     != other.m_native.size())
     {
         return false;
     }
 
-    // check each component
+    // paths with different hashes cannot be equal
+    std::size_t hash = m_hash.load(std::memory_order_relaxed);
+    std::size_t other_hash = other.m_hash.load(std::memory_order_relaxed);
+    if(hash != 0 && other_hash != 0 && hash != other_hash)
+    {
+        return false;
+    }
+
+    if(m_native != other.m_native)
+    {
+        return false;
+    }
+
+    // the same native string could be divided into components differently
     for(std::size_t i = 0; i < m_components.size(); ++i)
     {
-        if(m_components[i] != other.m_components [i])
+        if(m_components[i].length != other.m_components[i].length)
         {
             return false;
         }
@@ -178,12 +379,24 @@ bool Path::operator<(const Path& other) const
     // do the paths have the same length?
     if(m_components.size() == other.m_components.size())
     {
-        // perform check on each component
+        // perform check on each component, the byte order of UTF-8 data is
+        // the same as the order of its code points
         for(std::size_t i = 0; i < m_components.size(); ++i)
         {
-            if(m_components[i] != other.m_components[i])
+            const Component& a = m_components[i];
+            const Component& b = other.m_components[i];
+            int compare = memcmp(
+                m_native.data() + a.begin,
+                other.m_native.data() + b.begin,
+                std::min(a.length, b.length)
+            );
+            if(compare != 0)
             {
-                return m_components[i] < other.m_components[i];
+                return compare < 0;
+            }
+            if(a.length != b.length)
+            {
+                return a.length < b.length;
             }
         }
         return false;
@@ -193,14 +406,16 @@ bool Path::operator<(const Path& other) const
     return m_components.size() < other.m_components.size();
 }
 
-arc::str::UTF8String& Path::operator[](std::size_t index)
+Path::ComponentReference Path::operator[](std::size_t index)
 {
-    return m_components[index];
+    check_index(index);
+    return ComponentReference(this, index);
 }
 
 const arc::str::UTF8String& Path::operator[](std::size_t index) const
 {
-    return m_components[index];
+    check_index(index);
+    return get_components()[index];
 }
 
 Path Path::operator+(const Path& other) const
@@ -213,10 +428,18 @@ Path Path::operator+(const Path& other) const
 
 Path& Path::operator+=(const Path& other)
 {
+    // the native string may be reallocated while it is being read from
+    if(&other == this)
+    {
+        Path copy(other);
+        return *this += copy;
+    }
+
     // extend with other path's components
+    m_native.reserve(m_native.size() + other.m_native.size() + 1);
     ARC_FOR_EACH(it, other.m_components)
     {
-        m_components.push_back(*it);
+        append_component(other.m_native.data() + it->begin, it->length);
     }
 
     return *this;
@@ -233,7 +456,7 @@ Path& Path::operator<<(const arc::str::UTF8String& component)
 
 Path& Path::join(const arc::str::UTF8String& component)
 {
-    m_components.push_back(component);
+    append_component(component.get_raw(), component.get_byte_length() - 1);
     return *this;
 }
 
@@ -249,104 +472,110 @@ void Path::insert(std::size_t index, const arc::str::UTF8String& component)
         throw arc::ex::IndexOutOfBoundsError(error_message);
     }
 
-    // new vector to contain components
-    std::vector<arc::str::UTF8String> components;
-    // copy with the insert
-    for(std::size_t i = 0; i <= m_components.size(); ++i)
+    std::size_t length = component.get_byte_length() - 1;
+    if(index == m_components.size())
     {
-        if(i < index)
-        {
-            components.push_back(m_components[i]);
-        }
-        else if(i > index)
-        {
-            components.push_back(m_components[i - 1]);
-        }
-        else
-        {
-            components.push_back(component);
-        }
+        append_component(component.get_raw(), length);
+        return;
     }
-    // replace the current list of components
-    m_components = components;
+
+    // splice the component and a separator in before the current component
+    Component inserted;
+    inserted.begin = m_components[index].begin;
+    inserted.length = length;
+    m_native.insert(inserted.begin, component.get_raw(), length);
+    m_native.insert(inserted.begin + length, 1, NATIVE_SEPARATOR);
+    shift_components(index, static_cast<std::ptrdiff_t>(length + 1));
+    m_components.insert(m_components.begin() + index, inserted);
+
+    repair_separators();
+    reset_caches();
+}
+
+void Path::set_component(
+        std::size_t index,
+        const arc::str::UTF8String& component)
+{
+    check_index(index);
+    replace_component(
+        index,
+        component.get_raw(),
+        component.get_byte_length() - 1
+    );
 }
 
 void Path::clear()
 {
+    m_native.clear();
     m_components.clear();
+    reset_caches();
 }
 
 void Path::remove(std::size_t index)
 {
-    // check bounds
-    if(index >= m_components.size())
+    check_index(index);
+
+    if(m_components.size() == 1)
     {
-        arc::str::UTF8String error_message;
-        error_message << "Provided index: " << index << " is greater or equal "
-                      << "to the number of components in the path: "
-                      << m_components.size();
-        throw arc::ex::IndexOutOfBoundsError(error_message);
+        clear();
+        return;
     }
 
-    // new vector to contain components
-    std::vector<arc::str::UTF8String> components;
-    // copy with the remove
-    for(std::size_t i = 0; i < m_components.size(); ++i)
+    // erase the component along with the separator that follows it, or the
+    // separator that precedes it if it is the last component
+    std::size_t begin = m_components[index].begin;
+    std::size_t end = 0;
+    if(index + 1 < m_components.size())
     {
-        if(i < index)
-        {
-            components.push_back(m_components[i]);
-        }
-        else if(i > index)
-        {
-            components.push_back(m_components[i]);
-        }
+        end = m_components[index + 1].begin;
+    }
+    else
+    {
+        end = m_native.size();
+        begin = m_components[index - 1].begin + m_components[index - 1].length;
     }
-    // replace the current list of components
-    m_components = components;
+    m_native.erase(begin, end - begin);
+    shift_components(index + 1, -static_cast<std::ptrdiff_t>(end - begin));
+    m_components.erase(m_components.begin() + index);
+
+    repair_separators();
+    reset_caches();
 }
 
 arc::str::UTF8String Path::to_native() const
 {
-#ifdef ARC_OS_UNIX
-
-    return to_unix();
-
-#elif defined(ARC_OS_WINDOWS)
-
-    return to_windows();
+    return arc::str::UTF8String(m_native.data(), m_native.size());
+}
 
-#endif
+const char* Path::get_native_raw() const
+{
+    return m_native.c_str();
 }
 
 arc::str::UTF8String Path::to_unix() const
 {
-    std::vector<arc::str::UTF8String> components;
-    // special case for root (/)
-    bool is_root = false;
-    if(m_components.size() > 0 && m_components[0] == "/" )
-    {
-        is_root = true;
-        components = std::vector<arc::str::UTF8String>(
-                m_components.begin() + 1, m_components.end());
-    }
-    else
-    {
-        components = m_components;
-    }
+#ifdef ARC_OS_WINDOWS
 
-    arc::str::UTF8String ret = arc::str::join(components, "/");
-    if(is_root)
-    {
-        ret = arc::str::UTF8String("/") + ret;
-    }
+    return join_components('/');
 
-    return ret;
+#else
+
+    return to_native();
+
+#endif
 }
 
 arc::str::UTF8String Path::to_windows() const
 {
-    return arc::str::join(m_components, "\\");
+#ifdef ARC_OS_WINDOWS
+
+    return to_native();
+
+#else
+
+    return join_components('\\');
+
+#endif
 }
 
 Path Path::to_absolute() const
@@ -356,7 +585,7 @@ Path Path::to_absolute() const
 #ifdef ARC_OS_UNIX
 
     // if the path is already from root just return a copy of it
-    if(!is_empty() && get_front() == "/")
+    if(!is_empty() && get_front_view() == "/")
     {
         return Path(*this);
     }
@@ -415,7 +644,33 @@ bool Path::is_empty() const
 
 const std::vector<arc::str::UTF8String>& Path::get_components() const
 {
-    return m_components;
+    std::vector<arc::str::UTF8String>* strings =
+        m_component_strings.load(std::memory_order_acquire);
+    if(strings != nullptr)
+    {
+        return *strings;
+    }
+
+    std::vector<arc::str::UTF8String>* built =
+        new std::vector<arc::str::UTF8String>();
+    built->reserve(m_components.size());
+    ARC_FOR_EACH(it, m_components)
+    {
+        built->push_back(
+            arc::str::UTF8String(m_native.data() + it->begin, it->length));
+    }
+
+    // another thread may have built the components at the same time
+    if(m_component_strings.compare_exchange_strong(
+            strings,
+            built,
+            std::memory_order_acq_rel,
+            std::memory_order_acquire))
+    {
+        return *built;
+    }
+    delete built;
+    return *strings;
 }
 
 const arc::str::UTF8String& Path::get_front() const
@@ -428,7 +683,7 @@ const arc::str::UTF8String& Path::get_front() const
         );
     }
 
-    return m_components.front();
+    return (*this)[0];
 }
 
 const arc::str::UTF8String& Path::get_back() const
@@ -441,7 +696,44 @@ const arc::str::UTF8String& Path::get_back() const
         );
     }
 
-    return m_components.back();
+    return (*this)[m_components.size() - 1];
+}
+
+arc::str::UTF8StringView Path::get_component_view(std::size_t index) const
+{
+    check_index(index);
+
+    const Component& component = m_components[index];
+    return arc::str::UTF8StringView(
+        m_native.data() + component.begin,
+        component.length
+    );
+}
+
+arc::str::UTF8StringView Path::get_front_view() const
+{
+    // is the path empty?
+    if(is_empty())
+    {
+        throw arc::ex::IndexOutOfBoundsError(
+                "Cannot get the front component of an empty path."
+        );
+    }
+
+    return get_component_view(0);
+}
+
+arc::str::UTF8StringView Path::get_back_view() const
+{
+    // is the path empty?
+    if(is_empty())
+    {
+        throw arc::ex::IndexOutOfBoundsError(
+                "Cannot get the back component of an empty path."
+        );
+    }
+
+    return get_component_view(m_components.size() - 1);
 }
 
 arc::str::UTF8String Path::get_extension() const
@@ -450,20 +742,188 @@ arc::str::UTF8String Path::get_extension() const
     if(!m_components.empty())
     {
         // does the final component contain a period?
-        std::size_t loc = m_components.back().find_last(".");
-        if(loc != arc::str::npos)
+        const Component& back = m_components.back();
+        const char* data = m_native.data() + back.begin;
+        for(std::size_t i = back.length; i > 0; --i)
         {
-            // return the extension substring
-            return m_components.back().substring(
-                    loc + 1,
-                    m_components.back().get_length()
-            );
+            if(data[i - 1] == '.')
+            {
+                // return the extension substring
+                return arc::str::UTF8String(data + i, back.length - i);
+            }
         }
     }
     // there is no extension, return an empty string
     return "";
 }
 
+std::size_t Path::get_hash() const
+{
+    std::size_t hash = m_hash.load(std::memory_order_relaxed);
+    if(hash == 0)
+    {
+        std::hash<std::string> hasher;
+        hash = hasher(m_native);
+        // 0 is reserved to mean the hash has not been computed
+        if(hash == 0)
+        {
+            hash = 1;
+        }
+        m_hash.store(hash, std::memory_order_relaxed);
+    }
+    return hash;
+}
+
+//------------------------------------------------------------------------------
+//                            PRIVATE MEMBER FUNCTIONS
+//------------------------------------------------------------------------------
+
+void Path::assign_components(
+        const std::vector<arc::str::UTF8String>::const_iterator& begin,
+        const std::vector<arc::str::UTF8String>::const_iterator& end)
+{
+    clear();
+
+    std::size_t total_length = 0;
+    for(auto it = begin; it != end; ++it)
+    {
+        total_length += it->get_byte_length();
+    }
+    m_native.reserve(total_length);
+    m_components.reserve(static_cast<std::size_t>(end - begin));
+
+    for(auto it = begin; it != end; ++it)
+    {
+        append_component(it->get_raw(), it->get_byte_length() - 1);
+    }
+}
+
+void Path::append_component(const char* data, std::size_t length)
+{
+    // components are separated, except for the Unix root component
+    bool separate = !m_components.empty();
+#ifndef ARC_OS_WINDOWS
+    if(m_components.size() == 1 && m_native == "/")
+    {
+        separate = false;
+    }
+#endif
+    if(separate)
+    {
+        m_native += NATIVE_SEPARATOR;
+    }
+
+    Component component;
+    component.begin = m_native.size();
+    component.length = length;
+    m_native.append(data, length);
+    m_components.push_back(component);
+
+    reset_caches();
+}
+
+void Path::replace_component(
+        std::size_t index,
+        const char* data,
+        std::size_t length)
+{
+    Component& component = m_components[index];
+    m_native.replace(component.begin, component.length, data, length);
+    shift_components(
+        index + 1,
+        static_cast<std::ptrdiff_t>(length) -
+        static_cast<std::ptrdiff_t>(component.length)
+    );
+    component.length = length;
+
+    if(index == 0)
+    {
+        repair_separators();
+    }
+    reset_caches();
+}
+
+void Path::shift_components(std::size_t from, std::ptrdiff_t delta)
+{
+    for(std::size_t i = from; i < m_components.size(); ++i)
+    {
+        m_components[i].begin = static_cast<std::size_t>(
+            static_cast<std::ptrdiff_t>(m_components[i].begin) + delta);
+    }
+}
+
+void Path::repair_separators()
+{
+#ifndef ARC_OS_WINDOWS
+
+    // only the first two components can be followed by the wrong separator,
+    // since only the Unix root component at the front is not followed by one
+    bool root = !m_components.empty() &&
+                m_native.compare(
+                    m_components[0].begin,
+                    m_components[0].length,
+                    "/"
+                ) == 0;
+    for(std::size_t i = 0; i < 2 && i + 1 < m_components.size(); ++i)
+    {
+        std::size_t end = m_components[i].begin + m_components[i].length;
+        bool separated = m_components[i + 1].begin != end;
+        bool expected = !(i == 0 && root);
+        if(separated && !expected)
+        {
+            m_native.erase(end, 1);
+            shift_components(i + 1, -1);
+        }
+        else if(!separated && expected)
+        {
+            m_native.insert(end, 1, NATIVE_SEPARATOR);
+            shift_components(i + 1, 1);
+        }
+    }
+
+#endif
+}
+
+void Path::check_index(std::size_t index) const
+{
+    if(index >= m_components.size())
+    {
+        arc::str::UTF8String error_message;
+        error_message << "Provided index: " << index << " is greater or equal "
+                      << "to the number of components in the path: "
+                      << m_components.size();
+        throw arc::ex::IndexOutOfBoundsError(error_message);
+    }
+}
+
+void Path::reset_caches()
+{
+    m_hash.store(0, std::memory_order_relaxed);
+    delete m_component_strings.exchange(nullptr, std::memory_order_relaxed);
+}
+
+arc::str::UTF8String Path::join_components(char separator) const
+{
+    std::string joined;
+    joined.reserve(m_native.size());
+    for(std::size_t i = 0; i < m_components.size(); ++i)
+    {
+        // the Unix root component is not followed by a separator
+        if(i > 0 &&
+           !(i == 1 && separator == '/' && m_native.compare(
+                m_components[0].begin, m_components[0].length, "/") == 0))
+        {
+            joined += separator;
+        }
+        joined.append(
+            m_native,
+            m_components[i].begin,
+            m_components[i].length
+        );
+    }
+    return arc::str::UTF8String(joined.data(), joined.size());
+}
+
 //------------------------------------------------------------------------------
 //                               EXTERNAL OPERATORS
 //------------------------------------------------------------------------------
@@ -480,6 +940,22 @@ std::ostream& operator<<(std::ostream& stream, const Path& p)
     return stream;
 }
 
+arc::str::UTF8String& operator<<(
+        arc::str::UTF8String& s,
+        const Path::ComponentReference& component)
+{
+    s << component.get_view();
+    return s;
+}
+
+std::ostream& operator<<(
+        std::ostream& stream,
+        const Path::ComponentReference& component)
+{
+    stream << component.get_view();
+    return stream;
+}
+
 } // namespace sys
 } // namespace io
 } // namespace arc
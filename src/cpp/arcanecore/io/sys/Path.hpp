@@ -5,9 +5,14 @@
 #ifndef ARCANECORE_IO_FILE_PATH_HPP_
 #define ARCANECORE_IO_FILE_PATH_HPP_
 
+#include <atomic>
+#include <cstddef>
 #include <ostream>
+#include <string>
+#include <vector>
 
 #include "arcanecore/base/str/UTF8String.hpp"
+#include "arcanecore/base/str/UTF8StringView.hpp"
 
 namespace arc
 {
@@ -25,6 +30,15 @@ namespace sys
  * However this object is intended to provided platform independent methods for
  * dealing with file system paths.
  *
+ * Internally the components of a Path are stored in a single buffer that holds
+ * the native string representation of the path, along with the offsets of each
+ * component within it. This means the native string is always available
+ * without being rebuilt (see get_native_raw()). Components can be accessed
+ * without allocating as arc::str::UTF8StringView objects into the native string
+ * (see get_component_view()), while the functions that return components as
+ * arc::str::UTF8String references build and cache the component strings on
+ * first use (see get_components()).
+ *
  * \par Example Usage
  *
  * TODO:
@@ -33,6 +47,129 @@ class Path
 {
 public:
 
+    //--------------------------------------------------------------------------
+    //                               PUBLIC CLASSES
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief Refers to a component of a non-const Path so that it can be
+     *        modified through Path::operator[].
+     *
+     * Assigning to or appending to a ComponentReference replaces the
+     * component in the Path it was returned from, this is the same as calling
+     * Path::set_component().
+     *
+     * Example usage:
+     *
+     * \code
+     * arc::io::file::Path p;
+     * p << "path" << "to" << "file.txt";
+     * p[2] = "other";
+     * p[2] += ".txt";
+     * // p now contains ["path", "to", "other.txt"]
+     * \endcode
+     *
+     * \note Copying a ComponentReference copies the value of the component
+     *       rather than the reference, so the copy can be modified without
+     *       modifying the Path. This matches copying the arc::str::UTF8String
+     *       reference that was previously returned by Path::operator[].
+     *
+     * \warning A ComponentReference that refers to a Path is only valid until
+     *          the Path is destroyed or has components inserted or removed.
+     */
+    class ComponentReference
+    {
+    public:
+
+        //------------------------------CONSTRUCTORS----------------------------
+
+        /*!
+         * \brief Copy constructor.
+         *
+         * Creates a new ComponentReference which holds a copy of the value of
+         * the given reference's component.
+         */
+        ComponentReference(const ComponentReference& other);
+
+        /*!
+         * \brief Move constructor.
+         *
+         * Creates a new ComponentReference which refers to the same component
+         * as the given reference.
+         */
+        ComponentReference(ComponentReference&& other);
+
+        //--------------------------------OPERATORS-----------------------------
+
+        /*!
+         * \brief Replaces the value of the referenced component with the
+         *        value of the given reference's component.
+         */
+        ComponentReference& operator=(const ComponentReference& other);
+
+        /*!
+         * \brief Replaces the value of the referenced component.
+         */
+        ComponentReference& operator=(const arc::str::UTF8String& component);
+
+        /*!
+         * \brief Appends the given string to the referenced component.
+         */
+        ComponentReference& operator+=(const arc::str::UTF8String& component);
+
+        /*!
+         * \brief Returns whether the referenced component is equal to the
+         *        given string.
+         */
+        bool operator==(const arc::str::UTF8StringView& other) const;
+
+        /*!
+         * \brief Returns whether the referenced component is not equal to the
+         *        given string.
+         */
+        bool operator!=(const arc::str::UTF8StringView& other) const;
+
+        /*!
+         * \brief Returns a view of the value of the referenced component.
+         */
+        operator arc::str::UTF8StringView() const;
+
+        //-------------------------PUBLIC MEMBER FUNCTIONS----------------------
+
+        /*!
+         * \brief Returns a view of the value of the referenced component.
+         */
+        arc::str::UTF8StringView get_view() const;
+
+        /*!
+         * \brief Returns a new arc::str::UTF8String containing a copy of the
+         *        value of the referenced component.
+         */
+        arc::str::UTF8String to_string() const;
+
+    private:
+
+        friend class Path;
+
+        //----------------------------PRIVATE ATTRIBUTES------------------------
+
+        // the Path that the component belongs to, or null if this holds a copy
+        // of the component's value
+        Path* m_path;
+        // the index of the component within the Path
+        std::size_t m_index;
+        // the value of the component if this does not refer to a Path
+        std::string m_value;
+
+        //---------------------------PRIVATE CONSTRUCTORS-----------------------
+
+        /*!
+         * Creates a new ComponentReference to the component of the given Path
+         * at the given index.
+         */
+        ComponentReference(Path* path, std::size_t index);
+    };
+
     //--------------------------------------------------------------------------
     //                                CONSTRUCTORS
     //--------------------------------------------------------------------------
@@ -110,6 +247,13 @@ public:
      */
     Path(const Path& other);
 
+    /*!
+     * \brief Move constructor.
+     *
+     * \param other The Path to move resources from.
+     */
+    Path(Path&& other);
+
     //--------------------------------------------------------------------------
     //                                 DESTRUCTOR
     //--------------------------------------------------------------------------
@@ -147,6 +291,14 @@ public:
      */
     const Path& operator=(const Path& other);
 
+    /*!
+     * \brief Move assignment operator.
+     *
+     * \param other The Path to move resources from.
+     * \return Reference to this Path after the assignment has taken place.
+     */
+    Path& operator=(Path&& other);
+
     /*!
      * \brief Equality operator.
      *
@@ -188,17 +340,23 @@ public:
 
     /*!
      * \brief Returns a reference to the component of this Path at the given
-     *        index.
+     *        index, which can be assigned to in order to modify the component.
+     *
+     * See ComponentReference for details.
      *
      * \throws arc::ex::IndexOutOfBoundsError If the provided index is out of
      *                                          bounds of the number of
      *                                          components in this Path.
      */
-    arc::str::UTF8String& operator[](std::size_t index);
+    ComponentReference operator[](std::size_t index);
 
     /*!
-     * \brief Returns a const reference to the component of this Path at the
-     *        given index.
+     * \brief Returns a reference to the component of this Path at the given
+     *        index.
+     *
+     * The reference is to the strings built by get_components() so is only
+     * valid until this Path is next modified. Use get_component_view() to
+     * access a component without building the component strings.
      *
      * \throws arc::ex::IndexOutOfBoundsError If the provided index is out of
      *                                          bounds of the number of
@@ -326,6 +484,29 @@ public:
      */
     void insert(std::size_t index, const arc::str::UTF8String& component);
 
+    /*!
+     * \brief Replaces the component at the given index in this Path.
+     *
+     * Example usage:
+     *
+     * \code
+     * arc::io::file::Path p;
+     * p << "path" << "to" << "file.txt";
+     * p.set_component(2, "other.txt");
+     * // p now contains ["path", "to", "other.txt"]
+     * \endcode
+     *
+     * \throws arc::ex::IndexOutOfBoundsError If the provided index is out of
+     *                                          bounds of the number of
+     *                                          components in this Path.
+     *
+     * \param index The index of the component to replace.
+     * \param component The new value of the component.
+     */
+    void set_component(
+            std::size_t index,
+            const arc::str::UTF8String& component);
+
     /*!
      * \brief Reverts this Path to be an empty path.
      *
@@ -371,6 +552,18 @@ public:
      */
     arc::str::UTF8String to_native() const;
 
+    /*!
+     * \brief Returns the native string representation of this Path as a NULL
+     *        terminated UTF-8 encoded C string.
+     *
+     * This contains the same data as to_native(), however since the native
+     * string is stored by this Path no new string is constructed. The returned
+     * pointer is only valid until this Path is next modified.
+     *
+     * \warning The returned path is UTF-8 encoded. See to_native() for details.
+     */
+    const char* get_native_raw() const;
+
     /*!
      * \brief Returns the arc::str::UTF8String representation of this Path for
      *        Unix based operating systems.
@@ -455,23 +648,64 @@ public:
      * \code
      * ["path", "to", "file.txt"]
      * \endcode
+     *
+     * \note Since components are not stored as individual strings the vector
+     *       is built the first time this is called and then stored until this
+     *       path is modified, at which point any reference to it is no longer
+     *       valid. Prefer get_component_view(), get_front_view(), and
+     *       get_back_view() which do not allocate.
      */
     const std::vector< arc::str::UTF8String >& get_components() const;
 
-        /*!
-     * \brief Returns the first component of this path.
+    /*!
+     * \brief Returns a reference to the first component of this path.
+     *
+     * The reference is only valid until this Path is next modified.
      *
      * \throws arc::ex::IndexOutOfBoundsError If this path is empty.
      */
     const arc::str::UTF8String& get_front() const;
 
     /*!
-     * \brief Returns the last component of this path.
+     * \brief Returns a reference to the last component of this path.
+     *
+     * The reference is only valid until this Path is next modified.
      *
      * \throws arc::ex::IndexOutOfBoundsError If this path is empty.
      */
     const arc::str::UTF8String& get_back() const;
 
+    /*!
+     * \brief Returns a view of the component of this Path at the given index.
+     *
+     * Unlike operator[]() this does not build the component strings. The
+     * returned view refers to the native string of this Path, so it is not
+     * NULL terminated and is only valid until this Path is next modified.
+     *
+     * \throws arc::ex::IndexOutOfBoundsError If the provided index is out of
+     *                                          bounds of the number of
+     *                                          components in this Path.
+     */
+    arc::str::UTF8StringView get_component_view(std::size_t index) const;
+
+    /*!
+     * \brief Returns a view of the first component of this path.
+     *
+     * See get_component_view() for the lifetime of the returned view.
+     *
+     * \throws arc::ex::IndexOutOfBoundsError If this path is empty.
+     */
+    arc::str::UTF8StringView get_front_view() const;
+
+    /*!
+     * \brief Returns a view of the last component of this path.
+     *
+     * See get_component_view() for the lifetime of the returned view.
+     *
+     * \throws arc::ex::IndexOutOfBoundsError If this path is empty.
+     */
+    arc::str::UTF8StringView get_back_view() const;
+
     /*!
      * \brief Returns the file extension of the leaf component of this Path.
      *
@@ -487,16 +721,111 @@ public:
      */
     arc::str::UTF8String get_extension() const;
 
+    /*!
+     * \brief Returns the hash of this path.
+     *
+     * The hash is computed from the native string representation of this path
+     * the first time it is requested and is then stored until this path is
+     * modified.
+     */
+    std::size_t get_hash() const;
+
  private:
 
+    //--------------------------------------------------------------------------
+    //                              PRIVATE STRUCTS
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief The location of a component within the native string.
+     */
+    struct Component
+    {
+        std::size_t begin;
+        std::size_t length;
+    };
+
     //--------------------------------------------------------------------------
     //                             PRIVATE ATTRIBUTES
     //--------------------------------------------------------------------------
 
     /*!
-     * \brief List containing each individual component of this path.
+     * \brief The native string representation of this path, which contains
+     *        every component separated by the native separator.
+     */
+    std::string m_native;
+    /*!
+     * \brief The location of each component within the native string.
+     */
+    std::vector< Component > m_components;
+    /*!
+     * \brief The cached hash of this path, or ```0``` if it has not yet been
+     *        computed.
+     */
+    mutable std::atomic< std::size_t > m_hash;
+    /*!
+     * \brief The components of this path as separate strings, or null if
+     *        get_components() has not been called since this path was last
+     *        modified.
+     */
+    mutable std::atomic< std::vector< arc::str::UTF8String >* >
+        m_component_strings;
+
+    //--------------------------------------------------------------------------
+    //                          PRIVATE MEMBER FUNCTIONS
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief Replaces the components of this path with the given components.
+     */
+    void assign_components(
+            const std::vector< arc::str::UTF8String >::const_iterator& begin,
+            const std::vector< arc::str::UTF8String >::const_iterator& end);
+
+    /*!
+     * \brief Appends the given number of bytes of data as a new component.
      */
-    std::vector< arc::str::UTF8String > m_components;
+    void append_component(const char* data, std::size_t length);
+
+    /*!
+     * \brief Replaces the component at the given index with the given number
+     *        of bytes of data, by splicing the data into the native string.
+     */
+    void replace_component(
+            std::size_t index,
+            const char* data,
+            std::size_t length);
+
+    /*!
+     * \brief Moves the offsets of the components from the given index onwards
+     *        by the given number of bytes.
+     */
+    void shift_components(std::size_t from, std::ptrdiff_t delta);
+
+    /*!
+     * \brief Ensures the front components are followed by a separator, except
+     *        for the Unix root component, after a component has been inserted,
+     *        replaced, or removed from the front of this path.
+     */
+    void repair_separators();
+
+    /*!
+     * \brief Throws an IndexOutOfBoundsError if the given index is not the
+     *        index of a component in this path.
+     */
+    void check_index(std::size_t index) const;
+
+    /*!
+     * \brief Discards the cached hash and component strings after this path
+     *        has been modified.
+     */
+    void reset_caches();
+
+    /*!
+     * \brief Returns the components of this path joined by the given
+     *        separator.
+     */
+    arc::str::UTF8String join_components(char separator) const;
 };
 
 //------------------------------------------------------------------------------
@@ -507,6 +836,14 @@ arc::str::UTF8String& operator<<(arc::str::UTF8String& s, const Path& p);
 
 std::ostream& operator<<(std::ostream& stream, const Path& p);
 
+arc::str::UTF8String& operator<<(
+        arc::str::UTF8String& s,
+        const Path::ComponentReference& component);
+
+std::ostream& operator<<(
+        std::ostream& stream,
+        const Path::ComponentReference& component);
+
 } // namespace sys
 } // namespace io
 } // namespace arc
@@ -519,14 +856,14 @@ namespace std
 {
 
 template<>
-struct hash<arc::io::sys::Path> :
-    public unary_function<arc::io::sys::Path, size_t>
+struct hash<arc::io::sys::Path>
 {
+    typedef arc::io::sys::Path argument_type;
+    typedef std::size_t result_type;
+
     std::size_t operator()(const arc::io::sys::Path& value) const
     {
-        // TODO: could use custom faster hash here
-        std::hash<arc::str::UTF8String> hasher;
-        return hasher(value.to_unix());
+        return value.get_hash();
     }
 };
 
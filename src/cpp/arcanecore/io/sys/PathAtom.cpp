@@ -0,0 +1,159 @@
+#include "arcanecore/io/sys/PathAtom.hpp"
+
+#include <deque>
+#include <limits>
+#include <mutex>
+#include <unordered_map>
+
+#include "arcanecore/base/Exceptions.hpp"
+
+namespace arc
+{
+namespace io
+{
+namespace sys
+{
+
+//------------------------------------------------------------------------------
+//                                    OBJECTS
+//------------------------------------------------------------------------------
+
+/*!
+ * \brief The process wide table of interned paths.
+ */
+struct PathAtomTable
+{
+    //----------------------------PUBLIC ATTRIBUTES-----------------------------
+    std::mutex mutex;
+    // a deque is used so that references to the paths remain valid as the
+    // table grows
+    std::deque<arc::io::sys::Path> paths;
+    std::unordered_map<arc::io::sys::Path, arc::uint32> ids;
+    //-------------------------------CONSTRUCTOR--------------------------------
+    PathAtomTable()
+    {
+        // the empty path always has the id 0
+        paths.push_back(arc::io::sys::Path());
+        ids[paths.back()] = 0;
+    }
+};
+
+//------------------------------------------------------------------------------
+//                                STATIC FUNCTIONS
+//------------------------------------------------------------------------------
+
+/*!
+ * \brief Returns the table of interned paths.
+ */
+static PathAtomTable& get_table()
+{
+    static PathAtomTable table;
+    return table;
+}
+
+//------------------------------------------------------------------------------
+//                                  CONSTRUCTORS
+//------------------------------------------------------------------------------
+
+PathAtom::PathAtom()
+    :
+    m_id(0)
+{
+}
+
+PathAtom::PathAtom(const arc::io::sys::Path& path)
+{
+    // the empty path doesn't need a lookup
+    if(path.is_empty())
+    {
+        m_id = 0;
+        return;
+    }
+
+    PathAtomTable& table = get_table();
+    std::lock_guard<std::mutex> lock(table.mutex);
+
+    std::unordered_map<arc::io::sys::Path, arc::uint32>::const_iterator
+        f_id = table.ids.find(path);
+    if(f_id != table.ids.end())
+    {
+        m_id = f_id->second;
+        return;
+    }
+
+    if(table.paths.size() >= std::numeric_limits<arc::uint32>::max())
+    {
+        throw arc::ex::StateError(
+            "The maximum number of interned paths has been reached."
+        );
+    }
+
+    m_id = static_cast<arc::uint32>(table.paths.size());
+    table.paths.push_back(path);
+    table.ids[table.paths.back()] = m_id;
+}
+
+//------------------------------------------------------------------------------
+//                            PUBLIC STATIC FUNCTIONS
+//------------------------------------------------------------------------------
+
+bool PathAtom::find(const arc::io::sys::Path& path, PathAtom& atom)
+{
+    if(path.is_empty())
+    {
+        atom.m_id = 0;
+        return true;
+    }
+
+    PathAtomTable& table = get_table();
+    std::lock_guard<std::mutex> lock(table.mutex);
+
+    std::unordered_map<arc::io::sys::Path, arc::uint32>::const_iterator
+        f_id = table.ids.find(path);
+    if(f_id == table.ids.end())
+    {
+        return false;
+    }
+    atom.m_id = f_id->second;
+    return true;
+}
+
+std::size_t PathAtom::get_table_size()
+{
+    PathAtomTable& table = get_table();
+    std::lock_guard<std::mutex> lock(table.mutex);
+    return table.paths.size();
+}
+
+//------------------------------------------------------------------------------
+//                            PUBLIC MEMBER FUNCTIONS
+//------------------------------------------------------------------------------
+
+const arc::io::sys::Path& PathAtom::get_path() const
+{
+    PathAtomTable& table = get_table();
+    std::lock_guard<std::mutex> lock(table.mutex);
+    return table.paths[m_id];
+}
+
+//------------------------------------------------------------------------------
+//                               EXTERNAL OPERATORS
+//------------------------------------------------------------------------------
+
+arc::str::UTF8String& operator<<(
+        arc::str::UTF8String& s,
+        const PathAtom& atom)
+{
+    s << atom.get_path();
+    return s;
+}
+
+std::ostream& operator<<(std::ostream& stream, const PathAtom& atom)
+{
+    stream << atom.get_path();
+    return stream;
+}
+
+} // namespace sys
+} // namespace io
+} // namespace arc
@@ -0,0 +1,195 @@
+/*!
+ * \file
+ * \author David Saxon
+ */
+#ifndef ARCANECORE_IO_SYS_PATHATOM_HPP_
+#define ARCANECORE_IO_SYS_PATHATOM_HPP_
+
+#include <ostream>
+
+#include "arcanecore/base/Types.hpp"
+#include "arcanecore/io/sys/Path.hpp"
+
+namespace arc
+{
+namespace io
+{
+namespace sys
+{
+
+/*!
+ * \brief An interned arc::io::sys::Path that is represented by a 32-bit id.
+ *
+ * Every distinct Path that a PathAtom is constructed from is stored once in a
+ * process wide table and assigned a stable id. Two PathAtoms are equal if and
+ * only if they were constructed from equal Paths, so comparing and hashing
+ * PathAtoms only compares and hashes their ids. This makes PathAtoms suitable
+ * as keys for lookups that are performed frequently on the same set of paths.
+ *
+ * Constructing a PathAtom from a Path requires a lookup in the table, as does
+ * converting back with get_path(), so these conversions should happen at the
+ * boundaries of code that performs many lookups.
+ *
+ * \note Paths are never removed from the table once interned. The table is
+ *       safe to access from multiple threads.
+ *
+ * \par Example Usage
+ *
+ * \code
+ * arc::io::sys::Path p;
+ * p << "res" << "textures" << "stone.png";
+ *
+ * arc::io::sys::PathAtom a(p);
+ * arc::io::sys::PathAtom b(arc::io::sys::Path::from_unix_string(
+ *     "res/textures/stone.png"));
+ * // a == b and a.get_id() == b.get_id()
+ * // a.get_path() == p
+ * \endcode
+ */
+class PathAtom
+{
+public:
+
+    //--------------------------------------------------------------------------
+    //                                CONSTRUCTORS
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief Creates a new PathAtom for the empty path.
+     *
+     * The empty path always has the id ```0```.
+     */
+    PathAtom();
+
+    /*!
+     * \brief Creates a new PathAtom for the given path.
+     *
+     * If the path has not yet been interned it is added to the table.
+     */
+    explicit PathAtom(const arc::io::sys::Path& path);
+
+    //--------------------------------------------------------------------------
+    //                          PUBLIC STATIC FUNCTIONS
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief Returns the PathAtom for the given path if it has already been
+     *        interned.
+     *
+     * Unlike the constructor this does not add the path to the table.
+     *
+     * \param path The path to look up.
+     * \param atom Returns the PathAtom for the path if it exists.
+     *
+     * \return Whether the path has been interned.
+     */
+    static bool find(const arc::io::sys::Path& path, PathAtom& atom);
+
+    /*!
+     * \brief Returns the number of distinct paths that have been interned,
+     *        including the empty path.
+     */
+    static std::size_t get_table_size();
+
+    //--------------------------------------------------------------------------
+    //                                 OPERATORS
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief Returns whether this PathAtom refers to the same path as the
+     *        other given PathAtom.
+     */
+    bool operator==(const PathAtom& other) const
+    {
+        return m_id == other.m_id;
+    }
+
+    /*!
+     * \brief Returns whether this PathAtom refers to a different path to the
+     *        other given PathAtom.
+     */
+    bool operator!=(const PathAtom& other) const
+    {
+        return m_id != other.m_id;
+    }
+
+    /*!
+     * \brief Orders PathAtoms by their ids.
+     *
+     * \note This is the order paths were interned in, not the order of the
+     *       paths themselves.
+     */
+    bool operator<(const PathAtom& other) const
+    {
+        return m_id < other.m_id;
+    }
+
+    //--------------------------------------------------------------------------
+    //                          PUBLIC MEMBER FUNCTIONS
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief Returns the id of this PathAtom.
+     *
+     * Ids are only stable for the lifetime of the process.
+     */
+    arc::uint32 get_id() const
+    {
+        return m_id;
+    }
+
+    /*!
+     * \brief Returns the path this PathAtom refers to.
+     *
+     * The returned reference remains valid for the lifetime of the process.
+     */
+    const arc::io::sys::Path& get_path() const;
+
+private:
+
+    //--------------------------------------------------------------------------
+    //                             PRIVATE ATTRIBUTES
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief The id of the path in the intern table.
+     */
+    arc::uint32 m_id;
+};
+
+//------------------------------------------------------------------------------
+//                               EXTERNAL OPERATORS
+//------------------------------------------------------------------------------
+
+arc::str::UTF8String& operator<<(
+        arc::str::UTF8String& s,
+        const PathAtom& atom);
+
+std::ostream& operator<<(std::ostream& stream, const PathAtom& atom);
+
+} // namespace sys
+} // namespace io
+} // namespace arc
+
+//------------------------------------------------------------------------------
+//                                      HASH
+//------------------------------------------------------------------------------
+
+namespace std
+{
+
+template<>
+struct hash<arc::io::sys::PathAtom>
+{
+    typedef arc::io::sys::PathAtom argument_type;
+    typedef std::size_t result_type;
+
+    std::size_t operator()(const arc::io::sys::PathAtom& value) const
+    {
+        return static_cast<std::size_t>(value.get_id());
+    }
+};
+
+} // namespace std
+
+#endif
@@ -0,0 +1,731 @@
+#include "arcanecore/io/sys/Watcher.hpp"
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+
+#ifdef ARC_OS_LINUX
+
+    #include <cerrno>
+    #include <fcntl.h>
+    #include <poll.h>
+    #include <sys/inotify.h>
+    #include <unistd.h>
+
+#endif
+
+#include "arcanecore/base/Exceptions.hpp"
+#include "arcanecore/base/clock/ClockOperations.hpp"
+#include "arcanecore/base/os/OSOperations.hpp"
+#include "arcanecore/io/sys/DirectoryWalker.hpp"
+
+namespace arc
+{
+namespace io
+{
+namespace sys
+{
+
+//------------------------------------------------------------------------------
+//                                    OBJECTS
+//------------------------------------------------------------------------------
+
+/*!
+ * \brief A file or directory that has been requested to be watched.
+ */
+struct WatchRecord
+{
+    //----------------------------PUBLIC ATTRIBUTES-----------------------------
+    arc::io::sys::Path path;
+    // the name of the watched file within its directory, or empty if this is
+    // a directory watch
+    std::string file_name;
+    bool recursive;
+    Watcher::Callback callback;
+    // the descriptors of the directories watched for this record
+    std::vector<int> descriptors;
+    //-------------------------------CONSTRUCTOR--------------------------------
+    WatchRecord()
+        :
+        recursive(false)
+    {
+    }
+};
+
+/*!
+ * \brief A directory being monitored by the operating system.
+ */
+struct WatchedDirectory
+{
+    //----------------------------PUBLIC ATTRIBUTES-----------------------------
+    arc::io::sys::Path path;
+    // the ids of the watches which require this directory
+    std::vector<arc::uint64> watch_ids;
+};
+
+/*!
+ * \brief An event that is waiting for its path to stop changing.
+ */
+struct PendingEvent
+{
+    //----------------------------PUBLIC ATTRIBUTES-----------------------------
+    Watcher::Event event;
+    arc::uint64 last_time;
+};
+
+/*!
+ * \brief The state of a Watcher which is shared with its background thread.
+ */
+struct WatcherEngine
+{
+    //----------------------------PUBLIC ATTRIBUTES-----------------------------
+    arc::uint64 debounce_time;
+    // guards all of the following attributes
+    std::mutex mutex;
+    // held while callbacks are being run so that unwatch() can wait for them
+    std::recursive_mutex delivery_mutex;
+    bool stop;
+    arc::uint64 next_id;
+    std::map<arc::uint64, WatchRecord> watches;
+    std::map<int, WatchedDirectory> directories;
+    std::map<std::pair<arc::uint64, arc::io::sys::Path>, PendingEvent> pending;
+    std::vector<Watcher::Event> queue;
+    std::thread thread;
+#ifdef ARC_OS_LINUX
+    int notify_fd;
+    // pipe used to wake the background thread
+    int wake_fds[2];
+#endif
+    //-------------------------------CONSTRUCTOR--------------------------------
+    WatcherEngine(arc::uint64 _debounce_time)
+        :
+        debounce_time(_debounce_time),
+        stop         (false),
+        next_id      (1)
+    {
+#ifdef ARC_OS_LINUX
+        notify_fd   = -1;
+        wake_fds[0] = -1;
+        wake_fds[1] = -1;
+#endif
+    }
+};
+
+//------------------------------------------------------------------------------
+//                                STATIC FUNCTIONS
+//------------------------------------------------------------------------------
+
+/*!
+ * \brief Throws an IOError for a path that could not be watched.
+ */
+static void throw_watch_error(const arc::io::sys::Path& path)
+{
+    arc::str::UTF8String error_message;
+    error_message << "Failed to watch path: \'" << path.to_native()
+                  << "\'. OS error: "
+                  << arc::os::get_last_system_error_message();
+    throw arc::ex::IOError(error_message);
+}
+
+/*!
+ * \brief Adds the given event to the pending events, or coalesces it with
+ *        the pending event for the same path.
+ */
+static void add_pending(
+        WatcherEngine& engine,
+        arc::uint64 watch_id,
+        const arc::io::sys::Path& path,
+        arc::uint32 flags,
+        arc::uint64 now)
+{
+    PendingEvent& pending = engine.pending[std::make_pair(watch_id, path)];
+    if(pending.event.path.is_empty())
+    {
+        pending.event.watch_id = watch_id;
+        pending.event.path = path;
+        pending.event.flags = 0;
+    }
+    pending.event.flags |= flags;
+    pending.last_time = now;
+}
+
+#ifdef ARC_OS_LINUX
+
+/*!
+ * \brief The inotify events used to watch directories.
+ */
+static const arc::uint32 WATCH_MASK =
+    IN_CREATE     | IN_MODIFY      | IN_CLOSE_WRITE | IN_ATTRIB  |
+    IN_DELETE     | IN_MOVED_FROM  | IN_MOVED_TO    |
+    IN_DELETE_SELF | IN_MOVE_SELF  | IN_ONLYDIR;
+
+/*!
+ * \brief Starts monitoring the given directory for the given watch record.
+ *
+ * \return Whether the directory could be monitored.
+ */
+static bool add_directory(
+        WatcherEngine& engine,
+        arc::uint64 watch_id,
+        WatchRecord& record,
+        const arc::io::sys::Path& path)
+{
+    int descriptor = inotify_add_watch(
+        engine.notify_fd,
+        path.get_native_raw(),
+        WATCH_MASK
+    );
+    if(descriptor < 0)
+    {
+        return false;
+    }
+
+    // the same descriptor is returned if the directory is already monitored
+    WatchedDirectory& directory = engine.directories[descriptor];
+    if(directory.watch_ids.empty())
+    {
+        directory.path = path;
+    }
+    if(std::find(
+            directory.watch_ids.begin(),
+            directory.watch_ids.end(),
+            watch_id) == directory.watch_ids.end())
+    {
+        directory.watch_ids.push_back(watch_id);
+        record.descriptors.push_back(descriptor);
+    }
+    return true;
+}
+
+/*!
+ * \brief Starts monitoring the given directory and all of its subdirectories
+ *        for the given watch record.
+ */
+static bool add_directory_rec(
+        WatcherEngine& engine,
+        arc::uint64 watch_id,
+        WatchRecord& record,
+        const arc::io::sys::Path& path)
+{
+    if(!add_directory(engine, watch_id, record, path))
+    {
+        return false;
+    }
+
+    arc::io::sys::DirectoryWalker walker(path);
+    walker.walk([&](const arc::io::sys::DirectoryWalker::Entry& entry)
+    {
+        if(entry.get_type() == arc::io::sys::DirEntry::TYPE_DIRECTORY)
+        {
+            // subdirectories may be removed while being walked
+            add_directory(engine, watch_id, record, entry.get_path());
+        }
+    });
+    return true;
+}
+
+/*!
+ * \brief Stops monitoring the given directory for the given watch.
+ */
+static void remove_directory(
+        WatcherEngine& engine,
+        arc::uint64 watch_id,
+        int descriptor)
+{
+    std::map<int, WatchedDirectory>::iterator f_directory =
+        engine.directories.find(descriptor);
+    if(f_directory == engine.directories.end())
+    {
+        return;
+    }
+
+    std::vector<arc::uint64>& ids = f_directory->second.watch_ids;
+    ids.erase(std::remove(ids.begin(), ids.end(), watch_id), ids.end());
+    if(ids.empty())
+    {
+        inotify_rm_watch(engine.notify_fd, descriptor);
+        engine.directories.erase(f_directory);
+    }
+}
+
+/*!
+ * \brief Returns the event flags for the given inotify mask.
+ */
+static arc::uint32 flags_from_mask(arc::uint32 mask)
+{
+    arc::uint32 flags = 0;
+    if(mask & (IN_CREATE | IN_MOVED_TO))
+    {
+        flags |= Watcher::EVENT_CREATED;
+    }
+    if(mask & (IN_MODIFY | IN_CLOSE_WRITE | IN_ATTRIB))
+    {
+        flags |= Watcher::EVENT_MODIFIED;
+    }
+    if(mask & (IN_DELETE | IN_MOVED_FROM | IN_DELETE_SELF | IN_MOVE_SELF))
+    {
+        flags |= Watcher::EVENT_DELETED;
+    }
+    return flags;
+}
+
+/*!
+ * \brief Records a single inotify event as pending for the watches it
+ *        applies to.
+ */
+static void handle_event(
+        WatcherEngine& engine,
+        const struct inotify_event* notify_event,
+        arc::uint64 now)
+{
+    // events were lost so every watch should be rescanned
+    if(notify_event->mask & IN_Q_OVERFLOW)
+    {
+        ARC_FOR_EACH(watch, engine.watches)
+        {
+            add_pending(
+                engine,
+                watch->first,
+                watch->second.path,
+                Watcher::EVENT_OVERFLOW,
+                now
+            );
+        }
+        return;
+    }
+
+    std::map<int, WatchedDirectory>::iterator f_directory =
+        engine.directories.find(notify_event->wd);
+    if(f_directory == engine.directories.end())
+    {
+        return;
+    }
+
+    // the directory is no longer being monitored
+    if(notify_event->mask & IN_IGNORED)
+    {
+        ARC_FOR_EACH(watch_id, f_directory->second.watch_ids)
+        {
+            std::vector<int>& descriptors =
+                engine.watches[*watch_id].descriptors;
+            descriptors.erase(
+                std::remove(
+                    descriptors.begin(),
+                    descriptors.end(),
+                    notify_event->wd
+                ),
+                descriptors.end()
+            );
+        }
+        engine.directories.erase(f_directory);
+        return;
+    }
+
+    arc::uint32 flags = flags_from_mask(notify_event->mask);
+    if(flags == 0)
+    {
+        return;
+    }
+
+    const char* name = notify_event->len > 0 ? notify_event->name : "";
+    arc::io::sys::Path event_path(f_directory->second.path);
+    if(name[0] != '\0')
+    {
+        event_path << name;
+    }
+
+    // copy since recursive watches may add directories
+    std::vector<arc::uint64> watch_ids(f_directory->second.watch_ids);
+    ARC_FOR_EACH(watch_id, watch_ids)
+    {
+        WatchRecord& record = engine.watches[*watch_id];
+
+        if(!record.file_name.empty())
+        {
+            if(record.file_name == name)
+            {
+                add_pending(engine, *watch_id, record.path, flags, now);
+            }
+            continue;
+        }
+
+        // start monitoring new subdirectories
+        if(record.recursive                              &&
+           (notify_event->mask & IN_ISDIR)               &&
+           (notify_event->mask & (IN_CREATE | IN_MOVED_TO)))
+        {
+            add_directory_rec(engine, *watch_id, record, event_path);
+        }
+
+        add_pending(engine, *watch_id, event_path, flags, now);
+    }
+}
+
+#endif
+
+/*!
+ * \brief Reports the pending events whose paths have stopped changing.
+ */
+static void deliver_events(WatcherEngine& engine, arc::uint64 now)
+{
+    std::vector<Watcher::Event> due;
+    {
+        std::lock_guard<std::mutex> lock(engine.mutex);
+        std::map<std::pair<arc::uint64, arc::io::sys::Path>, PendingEvent>::
+            iterator pending = engine.pending.begin();
+        while(pending != engine.pending.end())
+        {
+            if(pending->second.last_time + engine.debounce_time > now)
+            {
+                ++pending;
+                continue;
+            }
+
+            const Watcher::Event& event = pending->second.event;
+            std::map<arc::uint64, WatchRecord>::const_iterator f_watch =
+                engine.watches.find(event.watch_id);
+            if(f_watch != engine.watches.end() && f_watch->second.callback)
+            {
+                due.push_back(event);
+            }
+            else
+            {
+                engine.queue.push_back(event);
+            }
+            engine.pending.erase(pending++);
+        }
+    }
+    if(due.empty())
+    {
+        return;
+    }
+
+    std::lock_guard<std::recursive_mutex> delivery_lock(engine.delivery_mutex);
+    ARC_FOR_EACH(event, due)
+    {
+        // the watch may have been removed since the event was collected
+        Watcher::Callback callback;
+        {
+            std::lock_guard<std::mutex> lock(engine.mutex);
+            std::map<arc::uint64, WatchRecord>::const_iterator f_watch =
+                engine.watches.find(event->watch_id);
+            if(f_watch == engine.watches.end())
+            {
+                continue;
+            }
+            callback = f_watch->second.callback;
+        }
+
+        // there is nowhere to report errors on the background thread
+        try
+        {
+            callback(*event);
+        }
+        catch(...)
+        {
+        }
+    }
+}
+
+#ifdef ARC_OS_LINUX
+
+/*!
+ * \brief The function run by the background thread of a Watcher.
+ */
+static void run(WatcherEngine& engine)
+{
+    // buffer suitably aligned for inotify events
+    static const std::size_t buffer_size = 16 * 1024;
+    std::vector<struct inotify_event> buffer(
+        buffer_size / sizeof(struct inotify_event)
+    );
+
+    while(true)
+    {
+        // wait until the next pending event is due
+        int timeout = -1;
+        {
+            std::lock_guard<std::mutex> lock(engine.mutex);
+            if(engine.stop)
+            {
+                break;
+            }
+            if(!engine.pending.empty())
+            {
+                arc::uint64 now = arc::clock::get_current_time();
+                arc::uint64 due = now + engine.debounce_time;
+                ARC_FOR_EACH(pending, engine.pending)
+                {
+                    due = std::min(
+                        due,
+                        pending->second.last_time + engine.debounce_time
+                    );
+                }
+                timeout = due > now ? static_cast<int>(due - now) : 0;
+            }
+        }
+
+        struct pollfd poll_fds[2];
+        poll_fds[0].fd      = engine.notify_fd;
+        poll_fds[0].events  = POLLIN;
+        poll_fds[0].revents = 0;
+        poll_fds[1].fd      = engine.wake_fds[0];
+        poll_fds[1].events  = POLLIN;
+        poll_fds[1].revents = 0;
+        if(poll(poll_fds, 2, timeout) < 0 && errno != EINTR)
+        {
+            break;
+        }
+
+        // drain wake ups
+        if(poll_fds[1].revents & POLLIN)
+        {
+            char drain[64];
+            while(read(engine.wake_fds[0], drain, sizeof(drain)) > 0)
+            {
+            }
+        }
+
+        if(poll_fds[0].revents & POLLIN)
+        {
+            char* data = reinterpret_cast<char*>(&buffer[0]);
+            ssize_t length;
+            while((length = read(engine.notify_fd, data, buffer_size)) > 0)
+            {
+                arc::uint64 now = arc::clock::get_current_time();
+                std::lock_guard<std::mutex> lock(engine.mutex);
+                for(ssize_t offset = 0; offset < length;)
+                {
+                    const struct inotify_event* notify_event =
+                        reinterpret_cast<const struct inotify_event*>(
+                            data + offset
+                        );
+                    handle_event(engine, notify_event, now);
+                    offset += sizeof(struct inotify_event) + notify_event->len;
+                }
+            }
+        }
+
+        deliver_events(engine, arc::clock::get_current_time());
+    }
+}
+
+#endif
+
+//------------------------------------------------------------------------------
+//                                  CONSTRUCTORS
+//------------------------------------------------------------------------------
+
+Watcher::Watcher(arc::uint64 debounce_time)
+    :
+    m_engine(new WatcherEngine(debounce_time))
+{
+#ifdef ARC_OS_LINUX
+
+    m_engine->notify_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if(m_engine->notify_fd < 0)
+    {
+        arc::str::UTF8String error_message;
+        error_message << "Failed to initialise file system notifications. OS "
+                      << "error: " << arc::os::get_last_system_error_message();
+        throw arc::ex::IOError(error_message);
+    }
+    if(pipe2(m_engine->wake_fds, O_NONBLOCK | O_CLOEXEC) != 0)
+    {
+        close(m_engine->notify_fd);
+        arc::str::UTF8String error_message;
+        error_message << "Failed to create Watcher wake up pipe. OS error: "
+                      << arc::os::get_last_system_error_message();
+        throw arc::ex::IOError(error_message);
+    }
+
+    WatcherEngine* engine = m_engine.get();
+    m_engine->thread = std::thread([engine]()
+    {
+        run(*engine);
+    });
+
+#else
+
+    throw arc::ex::NotImplementedError(
+            "arc::io::sys::Watcher has not yet been implemented for this "
+            "platform"
+    );
+
+#endif
+}
+
+//------------------------------------------------------------------------------
+//                                   DESTRUCTOR
+//------------------------------------------------------------------------------
+
+Watcher::~Watcher()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_engine->mutex);
+        m_engine->stop = true;
+    }
+
+#ifdef ARC_OS_LINUX
+
+    char wake = 0;
+    if(write(m_engine->wake_fds[1], &wake, 1) < 0)
+    {
+        // the pipe is non-blocking so is only full if a wake up is pending
+    }
+    if(m_engine->thread.joinable())
+    {
+        m_engine->thread.join();
+    }
+    close(m_engine->wake_fds[0]);
+    close(m_engine->wake_fds[1]);
+    close(m_engine->notify_fd);
+
+#endif
+}
+
+//------------------------------------------------------------------------------
+//                            PUBLIC MEMBER FUNCTIONS
+//------------------------------------------------------------------------------
+
+arc::uint64 Watcher::get_debounce_time() const
+{
+    return m_engine->debounce_time;
+}
+
+arc::uint64 Watcher::watch_file(
+        const arc::io::sys::Path& path,
+        Callback callback)
+{
+    // watch the directory containing the file
+    arc::io::sys::Path directory(path);
+    if(!directory.is_empty())
+    {
+        directory.remove(directory.get_length() - 1);
+    }
+    if(directory.is_empty())
+    {
+        directory << ".";
+    }
+
+    std::lock_guard<std::mutex> lock(m_engine->mutex);
+
+    arc::uint64 watch_id = m_engine->next_id;
+    WatchRecord& record = m_engine->watches[watch_id];
+    record.path = path;
+    record.file_name = path.is_empty() ? "" : path.get_back().get_raw();
+    record.callback = callback;
+
+#ifdef ARC_OS_LINUX
+    if(record.file_name.empty() ||
+       !add_directory(*m_engine, watch_id, record, directory))
+    {
+        m_engine->watches.erase(watch_id);
+        throw_watch_error(path);
+    }
+#endif
+
+    ++m_engine->next_id;
+    return watch_id;
+}
+
+arc::uint64 Watcher::watch_directory(
+        const arc::io::sys::Path& path,
+        bool recursive,
+        Callback callback)
+{
+    std::lock_guard<std::mutex> lock(m_engine->mutex);
+
+    arc::uint64 watch_id = m_engine->next_id;
+    WatchRecord& record = m_engine->watches[watch_id];
+    record.path = path;
+    record.recursive = recursive;
+    record.callback = callback;
+
+#ifdef ARC_OS_LINUX
+    bool added = recursive
+        ? add_directory_rec(*m_engine, watch_id, record, path)
+        : add_directory(*m_engine, watch_id, record, path);
+    if(!added)
+    {
+        m_engine->watches.erase(watch_id);
+        throw_watch_error(path);
+    }
+#endif
+
+    ++m_engine->next_id;
+    return watch_id;
+}
+
+bool Watcher::unwatch(arc::uint64 watch_id)
+{
+    // wait for any running callbacks
+    std::lock_guard<std::recursive_mutex> delivery_lock(
+        m_engine->delivery_mutex);
+    std::lock_guard<std::mutex> lock(m_engine->mutex);
+
+    std::map<arc::uint64, WatchRecord>::iterator f_watch =
+        m_engine->watches.find(watch_id);
+    if(f_watch == m_engine->watches.end())
+    {
+        return false;
+    }
+
+#ifdef ARC_OS_LINUX
+    ARC_FOR_EACH(descriptor, f_watch->second.descriptors)
+    {
+        remove_directory(*m_engine, watch_id, *descriptor);
+    }
+#endif
+    m_engine->watches.erase(f_watch);
+
+    // discard the events of the watch
+    std::map<std::pair<arc::uint64, arc::io::sys::Path>, PendingEvent>::
+        iterator pending = m_engine->pending.begin();
+    while(pending != m_engine->pending.end())
+    {
+        if(pending->first.first == watch_id)
+        {
+            m_engine->pending.erase(pending++);
+        }
+        else
+        {
+            ++pending;
+        }
+    }
+    std::vector<Event>& queue = m_engine->queue;
+    std::vector<Event>::iterator queued = queue.begin();
+    while(queued != queue.end())
+    {
+        if(queued->watch_id == watch_id)
+        {
+            queued = queue.erase(queued);
+        }
+        else
+        {
+            ++queued;
+        }
+    }
+
+    return true;
+}
+
+std::size_t Watcher::poll_events(std::vector<Event>& events)
+{
+    std::lock_guard<std::mutex> lock(m_engine->mutex);
+    std::size_t count = m_engine->queue.size();
+    events.insert(
+        events.end(),
+        m_engine->queue.begin(),
+        m_engine->queue.end()
+    );
+    m_engine->queue.clear();
+    return count;
+}
+
+} // namespace sys
+} // namespace io
+} // namespace arc
@@ -0,0 +1,235 @@
+/*!
+ * \file
+ * \author David Saxon
+ */
+#ifndef ARCANECORE_IO_SYS_WATCHER_HPP_
+#define ARCANECORE_IO_SYS_WATCHER_HPP_
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "arcanecore/base/Types.hpp"
+#include "arcanecore/base/lang/Restrictors.hpp"
+#include "arcanecore/io/sys/Path.hpp"
+
+namespace arc
+{
+namespace io
+{
+namespace sys
+{
+
+//------------------------------------------------------------------------------
+//                              FORWARD DECLARATIONS
+//------------------------------------------------------------------------------
+
+struct WatcherEngine;
+
+/*!
+ * \brief Reports changes made to files and directories on the file system.
+ *
+ * A Watcher monitors the file system on a background thread and reports
+ * changes without the file system needing to be polled. Changes made to the
+ * same path in quick succession are coalesced into a single event, which is
+ * only reported once the path has not changed for the debounce time of the
+ * Watcher. This means a file that is written in several steps is reported
+ * once its writer has finished.
+ *
+ * Each watch may either provide a callback, which is called on the
+ * background thread of the Watcher, or have its events queued until they are
+ * retrieved with poll_events().
+ *
+ * \par Example Usage
+ *
+ * \code
+ * arc::io::sys::Watcher watcher;
+ * watcher.watch_file(
+ *     config_path,
+ *     [](const arc::io::sys::Watcher::Event& event)
+ *     {
+ *         // ... react to event.path changing
+ *     }
+ * );
+ *
+ * // or without a callback
+ * watcher.watch_directory(resource_path, true);
+ * std::vector<arc::io::sys::Watcher::Event> events;
+ * watcher.poll_events(events);
+ * \endcode
+ *
+ * \note Watchers are currently only implemented for Linux, using inotify.
+ */
+class Watcher
+    : private arc::lang::Noncopyable
+    , private arc::lang::Nonmovable
+    , private arc::lang::Noncomparable
+{
+public:
+
+    //--------------------------------------------------------------------------
+    //                                 ENUMERATOR
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief Flags describing the changes an event represents.
+     */
+    enum EventFlag
+    {
+        /// The path was created or moved to its location.
+        EVENT_CREATED  = 1UL << 0,
+        /// The contents or attributes of the path were modified.
+        EVENT_MODIFIED = 1UL << 1,
+        /// The path was deleted or moved away from its location.
+        EVENT_DELETED  = 1UL << 2,
+        /// Events were lost because too many occurred at once, the path of
+        /// the event is the path of the watch which should be rescanned.
+        EVENT_OVERFLOW = 1UL << 3
+    };
+
+    //--------------------------------------------------------------------------
+    //                                  STRUCTS
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief A change to a watched path.
+     */
+    struct Event
+    {
+        /*!
+         * \brief The id of the watch the event was reported for.
+         */
+        arc::uint64 watch_id;
+        /*!
+         * \brief The path that changed.
+         */
+        arc::io::sys::Path path;
+        /*!
+         * \brief Bitwise OR of the EventFlag values for every change that was
+         *        coalesced into this event.
+         */
+        arc::uint32 flags;
+    };
+
+    //--------------------------------------------------------------------------
+    //                                  TYPEDEFS
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief Function which receives the events of a watch.
+     */
+    typedef std::function<void(const Event&)> Callback;
+
+    //--------------------------------------------------------------------------
+    //                                CONSTRUCTORS
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief Creates a new Watcher and starts its background thread.
+     *
+     * \param debounce_time The number of milliseconds a path must go without
+     *                      changing before its coalesced event is reported.
+     *
+     * \throws arc::ex::IOError If the platform's file system notifications
+     *                          could not be initialised.
+     */
+    Watcher(arc::uint64 debounce_time = 100);
+
+    //--------------------------------------------------------------------------
+    //                                 DESTRUCTOR
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief Stops the background thread, events that have not yet been
+     *        reported are discarded.
+     */
+    ~Watcher();
+
+    //--------------------------------------------------------------------------
+    //                          PUBLIC MEMBER FUNCTIONS
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief Returns the number of milliseconds a path must go without
+     *        changing before its event is reported.
+     */
+    arc::uint64 get_debounce_time() const;
+
+    /*!
+     * \brief Starts watching the given file.
+     *
+     * The directory containing the file is watched rather than the file
+     * itself, so the file does not need to exist yet and changes are still
+     * reported if the file is replaced by renaming another file over it.
+     *
+     * \param path The path of the file to watch.
+     * \param callback The function that events will be passed to, if this is
+     *                 empty events will be queued for poll_events().
+     *
+     * \return The id of the new watch.
+     *
+     * \throws arc::ex::IOError If the directory containing the file cannot be
+     *                          watched.
+     */
+    arc::uint64 watch_file(
+            const arc::io::sys::Path& path,
+            Callback callback = Callback());
+
+    /*!
+     * \brief Starts watching the given directory.
+     *
+     * Events are reported for the directory itself and for the paths it
+     * contains.
+     *
+     * \param path The path of the directory to watch.
+     * \param recursive Whether all subdirectories, including those created
+     *                  after the watch was added, should also be watched.
+     * \param callback The function that events will be passed to, if this is
+     *                 empty events will be queued for poll_events().
+     *
+     * \return The id of the new watch.
+     *
+     * \throws arc::ex::IOError If the directory cannot be watched.
+     */
+    arc::uint64 watch_directory(
+            const arc::io::sys::Path& path,
+            bool recursive = false,
+            Callback callback = Callback());
+
+    /*!
+     * \brief Stops the watch with the given id.
+     *
+     * Once this returns the callback of the watch is not running and will not
+     * be called again. Queued events of the watch are discarded.
+     *
+     * \return Whether there was a watch with the given id.
+     */
+    bool unwatch(arc::uint64 watch_id);
+
+    /*!
+     * \brief Retrieves the reported events of watches that do not have a
+     *        callback.
+     *
+     * \param events Vector the events are appended to.
+     *
+     * \return The number of events that were retrieved.
+     */
+    std::size_t poll_events(std::vector<Event>& events);
+
+private:
+
+    //--------------------------------------------------------------------------
+    //                             PRIVATE ATTRIBUTES
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief The state shared with the background thread.
+     */
+    std::unique_ptr<WatcherEngine> m_engine;
+};
+
+} // namespace sys
+} // namespace io
+} // namespace arc
+
+#endif
@@ -5,7 +5,7 @@
 #ifndef ARCANECORE_LOG_PROFILE_HPP_
 #define ARCANECORE_LOG_PROFILE_HPP_
 
-#include <arcanecore/base/str/UTF8String.hpp>
+#include <arcanecore/base/str/Atom.hpp>
 
 
 namespace arc
@@ -17,6 +17,9 @@ namespace log
  * \brief Structure used to stored information about a logging profile.
  *
  * Used to define information that should be included with log entries.
+ *
+ * The name and version are interned as arc::str::Atom objects, so the copies
+ * of the profile held by each arc::log::Stream share the same text.
  */
 struct Profile
 {
@@ -30,14 +33,14 @@ public:
      * \note If application name is left empty it will not be included in log
      *       entires.
      */
-    const arc::str::UTF8String app_name;
+    const arc::str::Atom app_name;
     /*!
      * \brief The version of the application writing logs using this profile.
      *
      * \note If application name is left empty it will not be included in log
      *       entries.
      */
-    const arc::str::UTF8String app_version;
+    const arc::str::Atom app_version;
 
     //-------------------------------CONSTRUCTOR--------------------------------
 
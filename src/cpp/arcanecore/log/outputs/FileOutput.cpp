@@ -8,6 +8,12 @@ namespace arc
 namespace log
 {
 
+//------------------------------------------------------------------------------
+//                           PRIVATE STATIC ATTRIBUTES
+//------------------------------------------------------------------------------
+
+const std::size_t FileOutput::BUFFER_SIZE = 8192;
+
 //------------------------------------------------------------------------------
 //                                  CONSTRUCTOR
 //------------------------------------------------------------------------------
@@ -18,9 +24,12 @@ FileOutput::FileOutput(
         arc::log::Verbosity verbosity_level)
     :
     AbstractOutput(verbosity_level),
-    m_path        (path),
-    m_opened_once (false)
+    m_path           (path),
+    m_opened_once    (false),
+    m_flush_verbosity(arc::log::VERBOSITY_WARNING)
 {
+    m_writer.set_buffer_size(BUFFER_SIZE);
+
     m_enabled = false;
     if(open_now)
     {
@@ -68,6 +77,16 @@ void FileOutput::set_enabled(bool enabled)
     AbstractOutput::set_enabled(enabled);
 }
 
+arc::log::Verbosity FileOutput::get_flush_verbosity() const
+{
+    return m_flush_verbosity;
+}
+
+void FileOutput::set_flush_verbosity(arc::log::Verbosity flush_verbosity)
+{
+    m_flush_verbosity = flush_verbosity;
+}
+
 void FileOutput::write(
         arc::log::Verbosity verbosity,
         const arc::log::Profile& profile,
@@ -79,64 +98,78 @@ void FileOutput::write(
         return;
     }
 
-    arc::str::UTF8String formatted;
-    // add the app name and version to the prefix (if required)
-    if(!profile.app_name.is_empty())
-    {
-        formatted = profile.app_name;
-    }
-    if(!profile.app_version.is_empty())
+    // the app name and version prefix (if required)
+    bool has_name = !profile.app_name.is_empty();
+    bool has_version = !profile.app_version.is_empty();
+    const char* prefix_open = "";
+    const char* prefix_separator = "";
+    const char* prefix_close = "";
+    if(has_name || has_version)
     {
-        if(!formatted.is_empty())
-        {
-            formatted += "-";
-        }
-        formatted += profile.app_version;
+        prefix_open = "{";
+        prefix_close = "} - ";
     }
-    if(!formatted.is_empty())
+    if(has_name && has_version)
     {
-        formatted = arc::str::UTF8String("{") + formatted + "} - ";
+        prefix_separator = "-";
     }
-    // add the verbosity level to the prefix
+
+    // the verbosity level prefix
+    const char* level = "";
     switch(verbosity)
     {
         case arc::log::VERBOSITY_CRITICAL:
         {
-            formatted += "[CRITICAL]: ";
+            level = "[CRITICAL]: ";
             break;
         }
         case arc::log::VERBOSITY_ERROR:
         {
-            formatted += "[ERROR]: ";
+            level = "[ERROR]: ";
             break;
         }
         case arc::log::VERBOSITY_WARNING:
         {
-            formatted += "[WARNING]: ";
+            level = "[WARNING]: ";
             break;
         }
         case arc::log::VERBOSITY_NOTICE:
         {
-            formatted += "[NOTICE]: ";
+            level = "[NOTICE]: ";
             break;
         }
         case arc::log::VERBOSITY_INFO:
         {
-            formatted += "[INFO]: ";
+            level = "[INFO]: ";
             break;
         }
         case arc::log::VERBOSITY_DEBUG:
         {
-            formatted += "[DEBUG]: ";
+            level = "[DEBUG]: ";
             break;
         }
     }
 
-    // add the message to formatted string
-    formatted += message;
+    // buffer the prefixes and message without concatenating them
+    m_writer.writev(
+        {
+            prefix_open,
+            profile.app_name.get_string(),
+            prefix_separator,
+            profile.app_version.get_string(),
+            prefix_close,
+            level,
+            message
+        },
+        false
+    );
 
-    // write to the file
-    m_writer.write(formatted, true);
+    // severe messages are written out straight away so they are not lost if
+    // the application crashes
+    if(verbosity <= m_flush_verbosity)
+    {
+        m_writer.flush();
+    }
 }
 
 } // namespace log
@@ -22,6 +22,10 @@ namespace log
  * The file handle is only opened when the output is first enabled (which by
  * default happens at construction time). If the output is later disabled the
  * file handle will be closed, and reopened the next time the output is enabled.
+ *
+ * Messages are buffered and written to the file when the buffer is full, when a
+ * message at or below the flush verbosity level is logged (see
+ * set_flush_verbosity()), or when the file handle is closed.
  */
 class FileOutput : public arc::log::AbstractOutput
 {
@@ -57,6 +61,21 @@ public:
     // override
     virtual void set_enabled(bool enabled);
 
+    /*!
+     * \brief Returns the maximum verbosity level of messages that cause the
+     *        buffered log to be written to the file immediately.
+     */
+    arc::log::Verbosity get_flush_verbosity() const;
+
+    /*!
+     * \brief Sets the maximum verbosity level of messages that cause the
+     *        buffered log to be written to the file immediately.
+     *
+     * Defaults to arc::log::VERBOSITY_WARNING so that the messages most likely
+     * to precede a crash are not lost in the buffer.
+     */
+    void set_flush_verbosity(arc::log::Verbosity flush_verbosity);
+
     // override
     virtual void write(
             arc::log::Verbosity verbosity,
@@ -65,6 +84,16 @@ public:
 
 private:
 
+    //--------------------------------------------------------------------------
+    //                          PRIVATE STATIC ATTRIBUTES
+    //--------------------------------------------------------------------------
+
+    /*!
+     * \brief The size in bytes of the buffer log messages are accumulated in
+     *        before they are written to the file.
+     */
+    static const std::size_t BUFFER_SIZE;
+
     //--------------------------------------------------------------------------
     //                             PRIVATE ATTRIBUTES
     //--------------------------------------------------------------------------
@@ -83,6 +112,12 @@ private:
      * \brief Whether the file handle has been opened before.
      */
     bool m_opened_once;
+
+    /*!
+     * \brief The maximum verbosity level of messages that are written to the
+     *        file immediately.
+     */
+    arc::log::Verbosity m_flush_verbosity;
 };
 
 } // namespace log
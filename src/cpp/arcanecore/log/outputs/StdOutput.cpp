@@ -35,26 +35,9 @@ void StdOutput::write(
         return;
     }
 
-    arc::str::UTF8String formatted;
-    // add the app name and version to the prefix (if required)
-    if(!profile.app_name.is_empty())
-    {
-        formatted = profile.app_name;
-    }
-    if(!profile.app_version.is_empty())
-    {
-        if(!formatted.is_empty())
-        {
-            formatted += "-";
-        }
-        formatted += profile.app_version;
-    }
-    if(!formatted.is_empty())
-    {
-        formatted = arc::str::UTF8String("{") + formatted + "} - ";
-    }
-    // add the verbosity level to the prefix, for efficiency evaluate ANSI
-    // colour and attributes here too.
+    // evaluate the verbosity level prefix, and for efficiency the ANSI colour
+    // and attributes here too.
+    const char* level = "";
     arc::io::format::ANSIColour ansi_colour =
         arc::io::format::ANSI_FG_DEFAULT;
     arc::io::format::ANSIAttribute ansi_attribute =
@@ -63,48 +46,45 @@ void StdOutput::write(
     {
         case arc::log::VERBOSITY_CRITICAL:
         {
-            formatted += "[CRITICAL]: ";
+            level = "[CRITICAL]: ";
             ansi_colour    = arc::io::format::ANSI_FG_RED;
             ansi_attribute = arc::io::format::ANSI_ATTR_BLINK;
             break;
         }
         case arc::log::VERBOSITY_ERROR:
         {
-            formatted += "[ERROR]: ";
+            level = "[ERROR]: ";
             ansi_colour    = arc::io::format::ANSI_FG_YELLOW;
             ansi_attribute = arc::io::format::ANSI_ATTR_UNDERSCORE;
             break;
         }
         case arc::log::VERBOSITY_WARNING:
         {
-            formatted += "[WARNING]: ";
+            level = "[WARNING]: ";
             ansi_colour    = arc::io::format::ANSI_FG_LIGHT_YELLOW;
             ansi_attribute = arc::io::format::ANSI_ATTR_BOLD;
             break;
         }
         case arc::log::VERBOSITY_NOTICE:
         {
-            formatted += "[NOTICE]: ";
+            level = "[NOTICE]: ";
             ansi_colour = arc::io::format::ANSI_FG_WHITE;
             break;
         }
         case arc::log::VERBOSITY_INFO:
         {
-            formatted += "[INFO]: ";
+            level = "[INFO]: ";
             ansi_colour = arc::io::format::ANSI_FG_GREEN;
             break;
         }
         case arc::log::VERBOSITY_DEBUG:
         {
-            formatted += "[DEBUG]: ";
+            level = "[DEBUG]: ";
             ansi_colour = arc::io::format::ANSI_FG_CYAN;
             break;
         }
     }
 
-    // add the message
-    formatted += message;
-
     // apply ANSI escape sequences?
     bool apply_ansi = false;
     if(m_use_ansi == USEANSI_ALWAYS)
@@ -118,14 +98,38 @@ void StdOutput::write(
     }
 #endif
 
+    // the message is formatted in a buffer that is reused by every message
+    // written from this thread, all of the parts are already valid UTF-8 so
+    // the buffer is written out directly
+    static thread_local arc::str::UTF8StringBuilder formatted;
+    formatted.clear();
+
     if(apply_ansi)
     {
-        arc::io::format::apply_escape_sequence(
+        arc::io::format::begin_escape_sequence(
             formatted,
             ansi_colour,
             ansi_attribute
         );
     }
+    // add the app name and version to the prefix (if required)
+    bool has_name = !profile.app_name.is_empty();
+    bool has_version = !profile.app_version.is_empty();
+    if(has_name || has_version)
+    {
+        formatted << "{" << profile.app_name.get_string();
+        if(has_name && has_version)
+        {
+            formatted << "-";
+        }
+        formatted << profile.app_version.get_string() << "} - ";
+    }
+    // add the level and message
+    formatted << level << message;
+    if(apply_ansi)
+    {
+        arc::io::format::end_escape_sequence(formatted);
+    }
 
     if(verbosity < 4)
     {
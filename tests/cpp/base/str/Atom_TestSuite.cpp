@@ -0,0 +1,168 @@
+#include "arcanecore/test/ArcTest.hpp"
+
+ARC_TEST_MODULE(base.str.Atom)
+
+#include <thread>
+#include <unordered_set>
+
+#include "arcanecore/base/str/Atom.hpp"
+
+namespace
+{
+
+//------------------------------------------------------------------------------
+//                                GENERIC FIXTURE
+//------------------------------------------------------------------------------
+
+class AtomFixture : public arc::test::Fixture
+{
+public:
+
+    //----------------------------PUBLIC ATTRIBUTES-----------------------------
+
+    std::vector<arc::str::UTF8String> strings;
+
+    //-------------------------PUBLIC MEMBER FUNCTIONS--------------------------
+
+    virtual void setup()
+    {
+        for(std::size_t i = 0; i < 16; ++i)
+        {
+            strings.push_back(arc::str::UTF8String("atom.key_") << i);
+        }
+        strings.push_back("atom.ｕｎｉｃｏｄｅ.測試");
+        strings.push_back(
+            "atom.a key that is too long to be stored in the local buffer");
+    }
+};
+
+//------------------------------------------------------------------------------
+//                                   INTERNING
+//------------------------------------------------------------------------------
+
+ARC_TEST_UNIT_FIXTURE(interning, AtomFixture)
+{
+    ARC_TEST_MESSAGE("Checking the size of an Atom");
+    ARC_CHECK_EQUAL(sizeof(arc::str::Atom), sizeof(void*));
+
+    ARC_TEST_MESSAGE("Checking the empty string");
+    arc::str::Atom empty;
+    ARC_CHECK_EQUAL(empty.get_id(), 0);
+    ARC_CHECK_TRUE(empty.is_empty());
+    ARC_CHECK_TRUE(empty.get_string().is_empty());
+    ARC_CHECK_EQUAL(arc::str::Atom(""), empty);
+
+    ARC_TEST_MESSAGE("Checking equal strings share an entry");
+    std::unordered_set<std::size_t> ids;
+    ARC_FOR_EACH(s, fixture->strings)
+    {
+        arc::str::Atom atom(*s);
+        ids.insert(atom.get_id());
+
+        ARC_CHECK_NOT_EQUAL(atom, empty);
+        ARC_CHECK_FALSE(atom.is_empty());
+        ARC_CHECK_EQUAL(atom.get_string(), *s);
+        ARC_CHECK_EQUAL(atom.get_hash(), s->get_hash());
+
+        arc::str::Atom copy(arc::str::UTF8StringView(s->get_raw()));
+        ARC_CHECK_EQUAL(copy, atom);
+        ARC_CHECK_EQUAL(copy.get_id(), atom.get_id());
+        ARC_CHECK_EQUAL(&copy.get_string(), &atom.get_string());
+        ARC_CHECK_EQUAL(
+            std::hash<arc::str::Atom>()(copy),
+            std::hash<arc::str::Atom>()(atom)
+        );
+    }
+    ARC_CHECK_EQUAL(ids.size(), fixture->strings.size());
+
+    ARC_TEST_MESSAGE("Checking views of part of a string");
+    arc::str::UTF8StringView view(fixture->strings[3]);
+    arc::str::Atom prefix(view.split(".")[0]);
+    ARC_CHECK_EQUAL(prefix.get_string(), "atom");
+    ARC_CHECK_EQUAL(prefix, arc::str::Atom("atom"));
+
+    ARC_TEST_MESSAGE("Checking interning again does not grow the pool");
+    std::size_t pool_size = arc::str::Atom::get_pool_size();
+    ARC_FOR_EACH(s, fixture->strings)
+    {
+        arc::str::Atom atom(*s);
+    }
+    ARC_CHECK_EQUAL(arc::str::Atom::get_pool_size(), pool_size);
+
+    ARC_TEST_MESSAGE("Checking string conversion");
+    arc::str::UTF8String s("key: ");
+    s << prefix;
+    ARC_CHECK_EQUAL(s, "key: atom");
+}
+
+//------------------------------------------------------------------------------
+//                                      FIND
+//------------------------------------------------------------------------------
+
+ARC_TEST_UNIT_FIXTURE(find, AtomFixture)
+{
+    arc::str::Atom expected(fixture->strings[0]);
+    arc::str::Atom atom;
+    ARC_CHECK_TRUE(arc::str::Atom::find(fixture->strings[0], atom));
+    ARC_CHECK_EQUAL(atom, expected);
+    ARC_CHECK_TRUE(arc::str::Atom::find("", atom));
+    ARC_CHECK_TRUE(atom.is_empty());
+
+    ARC_TEST_MESSAGE("Checking find does not intern new strings");
+    atom = expected;
+    std::size_t pool_size = arc::str::Atom::get_pool_size();
+    ARC_CHECK_FALSE(arc::str::Atom::find("atom.never_interned", atom));
+    ARC_CHECK_EQUAL(atom, expected);
+    ARC_CHECK_EQUAL(arc::str::Atom::get_pool_size(), pool_size);
+}
+
+//------------------------------------------------------------------------------
+//                                    THREADS
+//------------------------------------------------------------------------------
+
+ARC_TEST_UNIT_FIXTURE(threads, AtomFixture)
+{
+    // intern enough new strings from several threads at once that the pool
+    // grows while other threads are reading it
+    std::vector<std::vector<arc::str::Atom> > results(4);
+    std::vector<std::thread> threads;
+    for(std::size_t i = 0; i < results.size(); ++i)
+    {
+        threads.push_back(std::thread([&, i]()
+        {
+            for(std::size_t j = 0; j < 2048; ++j)
+            {
+                arc::str::UTF8String s(
+                    fixture->strings[j % fixture->strings.size()]);
+                s << ".threads_" << j;
+                results[i].push_back(arc::str::Atom(s));
+
+                // look up an atom interned by this thread earlier
+                arc::str::Atom found;
+                if(!arc::str::Atom::find(
+                        results[i][j / 2].get_string(),
+                        found) ||
+                   found != results[i][j / 2])
+                {
+                    results[i].back() = arc::str::Atom();
+                }
+            }
+        }));
+    }
+    ARC_FOR_EACH(thread, threads)
+    {
+        thread->join();
+    }
+
+    for(std::size_t i = 1; i < results.size(); ++i)
+    {
+        ARC_CHECK_ITER_EQUAL(results[i], results[0]);
+    }
+    std::unordered_set<arc::str::Atom> unique(
+        results[0].begin(),
+        results[0].end()
+    );
+    ARC_CHECK_EQUAL(unique.size(), results[0].size());
+}
+
+} // namespace anonymous
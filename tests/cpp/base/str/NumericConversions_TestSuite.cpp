@@ -0,0 +1,400 @@
+#include "arcanecore/test/ArcTest.hpp"
+
+ARC_TEST_MODULE(base.str.NumericConversions)
+
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string>
+
+#include "arcanecore/base/str/NumericConversions.hpp"
+
+namespace
+{
+
+//------------------------------------------------------------------------------
+//                                 FORMAT INTEGER
+//------------------------------------------------------------------------------
+
+class FormatIntegerFixture : public arc::test::Fixture
+{
+public:
+
+    //----------------------------PUBLIC ATTRIBUTES-----------------------------
+
+    std::vector<arc::int64> values;
+    std::vector<std::string> results;
+
+    //-------------------------PUBLIC MEMBER FUNCTIONS--------------------------
+
+    virtual void setup()
+    {
+        values.push_back(0);
+        results.push_back("0");
+
+        values.push_back(7);
+        results.push_back("7");
+
+        values.push_back(10);
+        results.push_back("10");
+
+        values.push_back(99);
+        results.push_back("99");
+
+        values.push_back(100);
+        results.push_back("100");
+
+        values.push_back(-1);
+        results.push_back("-1");
+
+        values.push_back(-4096);
+        results.push_back("-4096");
+
+        values.push_back(1234567890123LL);
+        results.push_back("1234567890123");
+
+        values.push_back(std::numeric_limits<arc::int64>::max());
+        results.push_back("9223372036854775807");
+
+        values.push_back(std::numeric_limits<arc::int64>::min());
+        results.push_back("-9223372036854775808");
+    }
+};
+
+ARC_TEST_UNIT_FIXTURE(format_integer, FormatIntegerFixture)
+{
+    char buffer[32];
+
+    ARC_TEST_MESSAGE("Checking format_int64");
+    for(std::size_t i = 0; i < fixture->values.size(); ++i)
+    {
+        std::size_t length =
+            arc::str::format_int64(fixture->values[i], buffer);
+        ARC_CHECK_TRUE(length <= arc::str::MAX_INTEGER_FORMAT_LENGTH);
+        ARC_CHECK_EQUAL(std::string(buffer, length), fixture->results[i]);
+    }
+
+    ARC_TEST_MESSAGE("Checking format_uint64");
+    std::size_t length = arc::str::format_uint64(
+        std::numeric_limits<arc::uint64>::max(),
+        buffer
+    );
+    ARC_CHECK_EQUAL(length, arc::str::MAX_INTEGER_FORMAT_LENGTH);
+    ARC_CHECK_EQUAL(std::string(buffer, length), "18446744073709551615");
+    length = arc::str::format_uint64(100000, buffer);
+    ARC_CHECK_EQUAL(std::string(buffer, length), "100000");
+}
+
+//------------------------------------------------------------------------------
+//                                  FORMAT FLOAT
+//------------------------------------------------------------------------------
+
+class FormatFloatFixture : public arc::test::Fixture
+{
+public:
+
+    //----------------------------PUBLIC ATTRIBUTES-----------------------------
+
+    std::vector<double> doubles;
+    std::vector<std::string> double_results;
+    std::vector<float> floats;
+    std::vector<std::string> float_results;
+
+    //-------------------------PUBLIC MEMBER FUNCTIONS--------------------------
+
+    virtual void setup()
+    {
+        doubles.push_back(0.0);
+        double_results.push_back("0");
+
+        doubles.push_back(-0.0);
+        double_results.push_back("-0");
+
+        doubles.push_back(1.0);
+        double_results.push_back("1");
+
+        doubles.push_back(-1024.0);
+        double_results.push_back("-1024");
+
+        doubles.push_back(0.1);
+        double_results.push_back("0.1");
+
+        doubles.push_back(0.1 + 0.2);
+        double_results.push_back("0.30000000000000004");
+
+        doubles.push_back(12.3456);
+        double_results.push_back("12.3456");
+
+        doubles.push_back(0.000001);
+        double_results.push_back("0.000001");
+
+        doubles.push_back(0.0000001);
+        double_results.push_back("1e-7");
+
+        doubles.push_back(1.5e-9);
+        double_results.push_back("1.5e-9");
+
+        doubles.push_back(1.0e20);
+        double_results.push_back("100000000000000000000");
+
+        doubles.push_back(1.0e21);
+        double_results.push_back("1e+21");
+
+        doubles.push_back(std::numeric_limits<double>::max());
+        double_results.push_back("1.7976931348623157e+308");
+
+        doubles.push_back(std::numeric_limits<double>::denorm_min());
+        double_results.push_back("5e-324");
+
+        doubles.push_back(std::numeric_limits<double>::infinity());
+        double_results.push_back("inf");
+
+        doubles.push_back(-std::numeric_limits<double>::infinity());
+        double_results.push_back("-inf");
+
+        doubles.push_back(std::numeric_limits<double>::quiet_NaN());
+        double_results.push_back("nan");
+
+        floats.push_back(3.14F);
+        float_results.push_back("3.14");
+
+        floats.push_back(0.1F);
+        float_results.push_back("0.1");
+
+        floats.push_back(16777216.0F);
+        float_results.push_back("16777216");
+
+        floats.push_back(std::numeric_limits<float>::max());
+        float_results.push_back("3.4028235e+38");
+
+        floats.push_back(std::numeric_limits<float>::denorm_min());
+        float_results.push_back("1e-45");
+    }
+};
+
+ARC_TEST_UNIT_FIXTURE(format_float, FormatFloatFixture)
+{
+    char buffer[64];
+
+    ARC_TEST_MESSAGE("Checking format_double");
+    for(std::size_t i = 0; i < fixture->doubles.size(); ++i)
+    {
+        std::size_t length =
+            arc::str::format_double(fixture->doubles[i], buffer);
+        ARC_CHECK_TRUE(length <= arc::str::MAX_FLOAT_FORMAT_LENGTH);
+        ARC_CHECK_EQUAL(
+            std::string(buffer, length),
+            fixture->double_results[i]
+        );
+    }
+
+    ARC_TEST_MESSAGE("Checking format_float");
+    for(std::size_t i = 0; i < fixture->floats.size(); ++i)
+    {
+        std::size_t length =
+            arc::str::format_float(fixture->floats[i], buffer);
+        ARC_CHECK_TRUE(length <= arc::str::MAX_FLOAT_FORMAT_LENGTH);
+        ARC_CHECK_EQUAL(
+            std::string(buffer, length),
+            fixture->float_results[i]
+        );
+    }
+
+    ARC_TEST_MESSAGE("Checking values convert back to the same value");
+    double value = 1.0e-300;
+    for(std::size_t i = 0; i < 2000; ++i)
+    {
+        // step through values with many significant digits and a wide range
+        // of exponents
+        value *= -1.4142135623730951;
+        std::size_t length = arc::str::format_double(value, buffer);
+        buffer[length] = '\0';
+        ARC_CHECK_EQUAL(std::strtod(buffer, nullptr), value);
+
+        float f = static_cast<float>(value);
+        if(f != 0.0F && f - f == 0.0F)
+        {
+            length = arc::str::format_float(f, buffer);
+            buffer[length] = '\0';
+            ARC_CHECK_EQUAL(std::strtof(buffer, nullptr), f);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+//                                   VALIDATION
+//------------------------------------------------------------------------------
+
+ARC_TEST_UNIT(validation)
+{
+    ARC_TEST_MESSAGE("Checking is_uint");
+    ARC_CHECK_TRUE(arc::str::is_uint("0", 1));
+    ARC_CHECK_TRUE(arc::str::is_uint("12345678901234567890123", 23));
+    ARC_CHECK_FALSE(arc::str::is_uint("", 0));
+    ARC_CHECK_FALSE(arc::str::is_uint("-1", 2));
+    // invalid bytes in and after the 8 byte blocks
+    ARC_CHECK_FALSE(arc::str::is_uint("1234:678901", 11));
+    ARC_CHECK_FALSE(arc::str::is_uint("1234/678901", 11));
+    ARC_CHECK_FALSE(arc::str::is_uint("12345678901 ", 12));
+    ARC_CHECK_FALSE(arc::str::is_uint("١٢٣٤٥٦٧٨", 16));
+    ARC_CHECK_TRUE(arc::str::is_uint("12345678x", 8));
+
+    ARC_TEST_MESSAGE("Checking is_int");
+    ARC_CHECK_TRUE(arc::str::is_int("-12345678901", 12));
+    ARC_CHECK_TRUE(arc::str::is_int("-0", 2));
+    ARC_CHECK_FALSE(arc::str::is_int("-", 1));
+    ARC_CHECK_FALSE(arc::str::is_int("--1", 3));
+    ARC_CHECK_FALSE(arc::str::is_int("1-", 2));
+
+    ARC_TEST_MESSAGE("Checking is_float");
+    ARC_CHECK_TRUE(arc::str::is_float("-.5", 3));
+    ARC_CHECK_TRUE(arc::str::is_float("5.", 2));
+    ARC_CHECK_TRUE(arc::str::is_float("12", 2));
+    ARC_CHECK_FALSE(arc::str::is_float(".", 1));
+    ARC_CHECK_FALSE(arc::str::is_float("-", 1));
+    ARC_CHECK_FALSE(arc::str::is_float("1.2.3", 5));
+    ARC_CHECK_FALSE(arc::str::is_float("1e5", 3));
+}
+
+//------------------------------------------------------------------------------
+//                                    PARSING
+//------------------------------------------------------------------------------
+
+class ParseFixture : public arc::test::Fixture
+{
+public:
+
+    //----------------------------PUBLIC ATTRIBUTES-----------------------------
+
+    std::vector<std::string> uint_valid;
+    std::vector<arc::uint64> uint_results;
+    std::vector<std::string> uint_invalid;
+
+    std::vector<std::string> int_valid;
+    std::vector<arc::int64> int_results;
+    std::vector<std::string> int_invalid;
+
+    //-------------------------PUBLIC MEMBER FUNCTIONS--------------------------
+
+    virtual void setup()
+    {
+        uint_valid.push_back("0");
+        uint_results.push_back(0);
+
+        uint_valid.push_back("0000001");
+        uint_results.push_back(1);
+
+        uint_valid.push_back("12345678");
+        uint_results.push_back(12345678);
+
+        uint_valid.push_back("98765432123456789");
+        uint_results.push_back(98765432123456789ULL);
+
+        uint_valid.push_back("18446744073709551615");
+        uint_results.push_back(std::numeric_limits<arc::uint64>::max());
+
+        uint_valid.push_back("00000000000000000000018446744073709551615");
+        uint_results.push_back(std::numeric_limits<arc::uint64>::max());
+
+        uint_invalid.push_back("");
+        uint_invalid.push_back("-1");
+        uint_invalid.push_back("0x10");
+        uint_invalid.push_back("1234567a");
+        uint_invalid.push_back("123456789012345a");
+        uint_invalid.push_back("18446744073709551616");
+        uint_invalid.push_back("99999999999999999999");
+        uint_invalid.push_back("100000000000000000000");
+
+        int_valid.push_back("-0");
+        int_results.push_back(0);
+
+        int_valid.push_back("010");
+        int_results.push_back(10);
+
+        int_valid.push_back("-34589345");
+        int_results.push_back(-34589345);
+
+        int_valid.push_back("9223372036854775807");
+        int_results.push_back(std::numeric_limits<arc::int64>::max());
+
+        int_valid.push_back("-9223372036854775808");
+        int_results.push_back(std::numeric_limits<arc::int64>::min());
+
+        int_invalid.push_back("");
+        int_invalid.push_back("-");
+        int_invalid.push_back("+1");
+        int_invalid.push_back("3.6");
+        int_invalid.push_back(" 1");
+        int_invalid.push_back("9223372036854775808");
+        int_invalid.push_back("-9223372036854775809");
+    }
+};
+
+ARC_TEST_UNIT_FIXTURE(parse_uint64, ParseFixture)
+{
+    ARC_TEST_MESSAGE("Checking valid cases");
+    for(std::size_t i = 0; i < fixture->uint_valid.size(); ++i)
+    {
+        arc::uint64 value = 1;
+        ARC_CHECK_TRUE(arc::str::parse_uint64(
+            fixture->uint_valid[i].c_str(),
+            fixture->uint_valid[i].length(),
+            value
+        ));
+        ARC_CHECK_EQUAL(value, fixture->uint_results[i]);
+    }
+
+    ARC_TEST_MESSAGE("Checking invalid cases");
+    for(std::size_t i = 0; i < fixture->uint_invalid.size(); ++i)
+    {
+        arc::uint64 value = 1;
+        ARC_CHECK_FALSE(arc::str::parse_uint64(
+            fixture->uint_invalid[i].c_str(),
+            fixture->uint_invalid[i].length(),
+            value
+        ));
+        ARC_CHECK_EQUAL(value, 1);
+    }
+}
+
+ARC_TEST_UNIT_FIXTURE(parse_int64, ParseFixture)
+{
+    ARC_TEST_MESSAGE("Checking valid cases");
+    for(std::size_t i = 0; i < fixture->int_valid.size(); ++i)
+    {
+        arc::int64 value = 1;
+        ARC_CHECK_TRUE(arc::str::parse_int64(
+            fixture->int_valid[i].c_str(),
+            fixture->int_valid[i].length(),
+            value
+        ));
+        ARC_CHECK_EQUAL(value, fixture->int_results[i]);
+    }
+
+    ARC_TEST_MESSAGE("Checking invalid cases");
+    for(std::size_t i = 0; i < fixture->int_invalid.size(); ++i)
+    {
+        arc::int64 value = 1;
+        ARC_CHECK_FALSE(arc::str::parse_int64(
+            fixture->int_invalid[i].c_str(),
+            fixture->int_invalid[i].length(),
+            value
+        ));
+        ARC_CHECK_EQUAL(value, 1);
+    }
+
+    ARC_TEST_MESSAGE("Checking formatted values parse to the same value");
+    char buffer[32];
+    arc::int64 value = 1;
+    for(std::size_t i = 0; i < 39; ++i)
+    {
+        value = (value * 3) + 1;
+        arc::int64 signed_value = (i % 2 == 0) ? value : -value;
+        std::size_t length = arc::str::format_int64(signed_value, buffer);
+        arc::int64 parsed = 0;
+        ARC_CHECK_TRUE(arc::str::parse_int64(buffer, length, parsed));
+        ARC_CHECK_EQUAL(parsed, signed_value);
+    }
+}
+
+} // namespace anonymous
@@ -2,7 +2,10 @@
 
 ARC_TEST_MODULE(base.str.StringOperations)
 
+#include <algorithm>
 #include <cstring>
+#include <string>
+#include <vector>
 
 #include "arcanecore/base/str/StringOperations.hpp"
 
@@ -316,6 +319,63 @@ ARC_TEST_UNIT_FIXTURE(utf8_to_utf16, UTF8ToUTF16Fixture)
     }
 }
 
+ARC_TEST_UNIT(utf16_round_trip)
+{
+    // long enough for every symbol width to be encoded in blocks and one at
+    // a time
+    arc::str::UTF8String text;
+    for(std::size_t i = 0; i < 20; ++i)
+    {
+        text << "The quick brown fox jumps over the lazy dog. ";
+        text << "γειάσουΚόσμεγειάσουΚόσμε";
+        text << "敏捷的棕色狐狸 😀 👋 " << i;
+    }
+
+    std::size_t surrogate_pairs = 0;
+    for(std::size_t i = 0; i < text.get_length(); ++i)
+    {
+        if(text.get_code_point(i) > arc::str::UTF16_MAX_2BYTE)
+        {
+            ++surrogate_pairs;
+        }
+    }
+
+    std::size_t little_length = 0;
+    char* little = arc::str::utf8_to_utf16(
+        text, little_length, arc::data::ENDIAN_LITTLE);
+    std::size_t big_length = 0;
+    char* big = arc::str::utf8_to_utf16(
+        text, big_length, arc::data::ENDIAN_BIG, false);
+
+    ARC_TEST_MESSAGE("Checking the encoded length");
+    ARC_CHECK_EQUAL(
+        little_length,
+        (text.get_length() + surrogate_pairs + 1) * 2
+    );
+    ARC_CHECK_EQUAL(big_length, little_length - 2);
+
+    ARC_TEST_MESSAGE("Checking the byte orders match");
+    bool swapped = true;
+    for(std::size_t i = 0; i < big_length; i += 2)
+    {
+        swapped = swapped && little[i] == big[i + 1] && little[i + 1] == big[i];
+    }
+    ARC_CHECK_TRUE(swapped);
+
+    ARC_TEST_MESSAGE("Checking decoding returns the original text");
+    ARC_CHECK_EQUAL(
+        arc::str::utf16_to_utf8(little, arc::str::npos),
+        text
+    );
+    ARC_CHECK_EQUAL(
+        arc::str::utf16_to_utf8(big, big_length, arc::data::ENDIAN_BIG),
+        text
+    );
+
+    delete[] little;
+    delete[] big;
+}
+
 //------------------------------------------------------------------------------
 //                                 UTF16 TO UTF8
 //------------------------------------------------------------------------------
@@ -399,6 +459,9 @@ public:
         valid.push_back("this is a مزيج of text");
         valid.push_back("간");
         valid.push_back("𐂣");
+        // symbols that cross the 16 and 32 byte blocks checked at once
+        valid.push_back("aaaaaaaaaaaaaaaé and aaaaaaaaaa€ and ጸጷጶጵጸጷጶጵጲጱጰጯጮጬᚡጲ");
+        valid.push_back("aaaaaaaaaaaaaa𐂣aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa𐂣");
 
         invalid.push_back("\x80");
         invalid.push_back("\x0A\x80");
@@ -411,6 +474,11 @@ public:
         invalid.push_back("\xFA\xC4");
         invalid.push_back("\xFA\x80\x05");
         invalid.push_back("\xFA\x80\x80\xEE");
+        invalid.push_back("aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa\x80" "aaaaaaaaaa");
+        invalid.push_back("aaaaaaaaaaaaaa\xF0\x9F\x98" "aaaaaaaaaaaaaaaaaaaaaaa");
+        invalid.push_back("aaaaaaaaaaaaaaa\xC3" "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa");
+        invalid.push_back("ጸጷጶጵጸጷጶጵጲጱጰጯጮጬᚡጲ\xE1\x88ጸጷጶጵ");
+        invalid.push_back("aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa\xF8\x80\x80\x80");
     }
 };
 
@@ -456,6 +524,32 @@ ARC_TEST_UNIT_FIXTURE(is_utf8, IsUtf8Fixture)
     }
 }
 
+//------------------------------------------------------------------------------
+//                                 COUNT SYMBOLS
+//------------------------------------------------------------------------------
+
+ARC_TEST_UNIT_FIXTURE(count_symbols, IsUtf8Fixture)
+{
+    ARC_TEST_MESSAGE("Checking against UTF8String lengths");
+    ARC_FOR_EACH(it, fixture->valid)
+    {
+        ARC_CHECK_EQUAL(
+            arc::str::count_symbols(*it, strlen(*it)),
+            arc::str::UTF8String(*it).get_length()
+        );
+    }
+
+    ARC_TEST_MESSAGE("Checking long data");
+    std::string data;
+    for(std::size_t i = 0; i < 1000; ++i)
+    {
+        data += "aγ𐂣€";
+    }
+    ARC_CHECK_EQUAL(arc::str::count_symbols(data.c_str(), data.size()), 4000);
+    ARC_CHECK_EQUAL(arc::str::count_symbols(data.c_str(), 10), 4);
+    ARC_CHECK_EQUAL(arc::str::count_symbols(data.c_str(), 0), 0);
+}
+
 //------------------------------------------------------------------------------
 //                                      JOIN
 //------------------------------------------------------------------------------
@@ -544,4 +638,148 @@ ARC_TEST_UNIT_FIXTURE( join, JoinFixture )
     }
 }
 
+//------------------------------------------------------------------------------
+//                                   FIND BYTES
+//------------------------------------------------------------------------------
+
+class FindBytesFixture : public arc::test::Fixture
+{
+public:
+
+    //----------------------------PUBLIC ATTRIBUTES-----------------------------
+
+    std::vector<std::string> data;
+    std::vector<std::string> patterns;
+
+    //-------------------------PUBLIC MEMBER FUNCTIONS--------------------------
+
+    virtual void setup()
+    {
+        data.push_back("");
+        data.push_back("a");
+        data.push_back("Hello World");
+        data.push_back("γειά σου Κόσμε! γειά σου Κόσμε!");
+        data.push_back("this is a مزيج of text");
+
+        // long data so that matches fall in both the vectorised blocks and
+        // the remaining tail
+        std::string long_data;
+        for(std::size_t i = 0; i < 100; ++i)
+        {
+            long_data += static_cast<char>('a' + (i * 7) % 26);
+        }
+        long_data += "needle";
+        long_data += std::string(37, 'n');
+        long_data += "ጸጷጶጵ needle ጸጷጶጵ";
+        long_data += std::string(5, 'e');
+        data.push_back(long_data);
+
+        patterns.push_back("");
+        patterns.push_back("a");
+        patterns.push_back("e");
+        patterns.push_back("l");
+        patterns.push_back("needle");
+        patterns.push_back("nnn");
+        patterns.push_back("ጸጷ");
+        patterns.push_back("Κόσμε!");
+        patterns.push_back("مزيج");
+        patterns.push_back("eeeee");
+        patterns.push_back("not found");
+        patterns.push_back(long_data);
+    }
+};
+
+ARC_TEST_UNIT_FIXTURE(find_bytes, FindBytesFixture)
+{
+    ARC_FOR_EACH(data, fixture->data)
+    {
+        ARC_FOR_EACH(pattern, fixture->patterns)
+        {
+            std::size_t expected = data->find(*pattern);
+            ARC_CHECK_EQUAL(
+                arc::str::find_bytes(
+                    data->c_str(),
+                    data->length(),
+                    pattern->c_str(),
+                    pattern->length()
+                ),
+                expected == std::string::npos ? arc::str::npos : expected
+            );
+        }
+    }
+}
+
+ARC_TEST_UNIT_FIXTURE(find_last_bytes, FindBytesFixture)
+{
+    ARC_FOR_EACH(data, fixture->data)
+    {
+        ARC_FOR_EACH(pattern, fixture->patterns)
+        {
+            std::size_t expected = data->rfind(*pattern);
+            ARC_CHECK_EQUAL(
+                arc::str::find_last_bytes(
+                    data->c_str(),
+                    data->length(),
+                    pattern->c_str(),
+                    pattern->length()
+                ),
+                expected == std::string::npos ? arc::str::npos : expected
+            );
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+//                                   HASH BYTES
+//------------------------------------------------------------------------------
+
+ARC_TEST_UNIT(hash_bytes)
+{
+    ARC_TEST_MESSAGE("Checking only the given bytes are hashed");
+    ARC_CHECK_EQUAL(
+        arc::str::hash_bytes("foobar", 3),
+        arc::str::hash_bytes("foo", 3)
+    );
+    std::string long_data("Hello world, this is hashed");
+    ARC_CHECK_EQUAL(
+        arc::str::hash_bytes("Hello world, this is hashed", 27),
+        arc::str::hash_bytes(long_data.c_str(), long_data.length())
+    );
+
+    ARC_TEST_MESSAGE("Checking differing data produces differing hashes");
+    ARC_CHECK_NOT_EQUAL(
+        arc::str::hash_bytes("foobar", 3),
+        arc::str::hash_bytes("bar", 3)
+    );
+    // trailing NULL bytes must change the hash even though the final block is
+    // padded with zeros
+    ARC_CHECK_NOT_EQUAL(
+        arc::str::hash_bytes("", 0),
+        arc::str::hash_bytes("\0", 1)
+    );
+    ARC_CHECK_NOT_EQUAL(
+        arc::str::hash_bytes("abcdefgh", 8),
+        arc::str::hash_bytes("abcdefgh\0", 9)
+    );
+
+    ARC_TEST_MESSAGE("Checking the hashes of similar keys are distinct");
+    std::vector<std::size_t> hashes;
+    for(std::size_t i = 0; i < 4096; ++i)
+    {
+        std::string key("config.key.");
+        key += std::to_string(i);
+        hashes.push_back(arc::str::hash_bytes(key.c_str(), key.length()));
+    }
+    std::sort(hashes.begin(), hashes.end());
+    ARC_CHECK_TRUE(std::unique(hashes.begin(), hashes.end()) == hashes.end());
+
+    ARC_TEST_MESSAGE("Checking the hashes fill the buckets of a small table");
+    std::vector<std::size_t> buckets(64, 0);
+    for(std::size_t i = 0; i < hashes.size(); ++i)
+    {
+        ++buckets[hashes[i] % 64];
+    }
+    ARC_CHECK_TRUE(*std::min_element(buckets.begin(), buckets.end()) > 0);
+}
+
 } // namespace unicode_operations_tests
@@ -0,0 +1,157 @@
+#include "arcanecore/test/ArcTest.hpp"
+
+ARC_TEST_MODULE(base.str.UTF16Decoder)
+
+#include <vector>
+
+#include "arcanecore/base/str/StringOperations.hpp"
+#include "arcanecore/base/str/UTF16Decoder.hpp"
+
+namespace
+{
+
+//------------------------------------------------------------------------------
+//                                GENERIC FIXTURE
+//------------------------------------------------------------------------------
+
+class UTF16DecoderFixture : public arc::test::Fixture
+{
+public:
+
+    //----------------------------PUBLIC ATTRIBUTES-----------------------------
+
+    std::vector<arc::str::UTF8String> utf8;
+
+    //-------------------------PUBLIC MEMBER FUNCTIONS--------------------------
+
+    virtual void setup()
+    {
+        utf8.push_back("");
+        utf8.push_back("a");
+        utf8.push_back("Hello World");
+        // long enough for the vectorised path
+        utf8.push_back(
+            "The quick brown fox jumps over the lazy dog, "
+            "The quick brown fox jumps over the lazy dog"
+        );
+        utf8.push_back("ÀÁÂÃÄÅÆÇÈÉÊËÌÍÎÏÐÑÒÓÔÕÖ×ØÙÚÛÜÝÞßàáâãäåæçèéêë");
+        utf8.push_back("γειά σου Κόσμε, Привет мир, 你好世界, こんにちは世界");
+        utf8.push_back("𝔂𝓸𝓾 𝓼𝓱𝓸𝓾𝓵𝓭 𝓫𝓮 𝓪𝓫𝓵𝓮 𝓽𝓸 𝓻𝓮𝓪𝓭 𝓽𝓱𝓲𝓼 ✓ 😀😀😀😀😀😀");
+        utf8.push_back(
+            "abcdefghijklmnop😀abcdefghijklmno😀abcdefghijklmnopqrstuvwxyz"
+        );
+    }
+
+    // decodes the given data using chunks of the given size
+    arc::str::UTF8String decode(
+            const char* data,
+            std::size_t byte_length,
+            arc::data::Endianness endianness,
+            std::size_t chunk_size)
+    {
+        arc::str::UTF16Decoder decoder(endianness);
+        std::vector<char> output;
+        for(std::size_t i = 0; i < byte_length; i += chunk_size)
+        {
+            std::size_t length = std::min(chunk_size, byte_length - i);
+            std::size_t offset = output.size();
+            output.resize(
+                offset +
+                arc::str::UTF16Decoder::get_max_output_length(length)
+            );
+            output.resize(
+                offset + decoder.decode(data + i, length, &output[offset])
+            );
+        }
+        std::size_t offset = output.size();
+        output.resize(offset + arc::str::UTF16Decoder::MAX_FINISH_LENGTH);
+        output.resize(offset + decoder.finish(&output[offset]));
+
+        if(output.empty())
+        {
+            return arc::str::UTF8String();
+        }
+        return arc::str::UTF8String(&output[0], output.size());
+    }
+};
+
+//------------------------------------------------------------------------------
+//                                     DECODE
+//------------------------------------------------------------------------------
+
+ARC_TEST_UNIT_FIXTURE(decode, UTF16DecoderFixture)
+{
+    arc::data::Endianness endiannesses[] =
+        {arc::data::ENDIAN_LITTLE, arc::data::ENDIAN_BIG};
+
+    for(std::size_t e = 0; e < 2; ++e)
+    {
+        ARC_FOR_EACH(it, fixture->utf8)
+        {
+            std::size_t length = 0;
+            const char* utf16 = arc::str::utf8_to_utf16(
+                *it,
+                length,
+                endiannesses[e],
+                false
+            );
+
+            // every chunk size up to past the vectorised block size, which
+            // splits code units and surrogate pairs at every boundary
+            for(std::size_t chunk_size = 1; chunk_size < 40; ++chunk_size)
+            {
+                ARC_CHECK_EQUAL(
+                    fixture->decode(utf16, length, endiannesses[e], chunk_size),
+                    *it
+                );
+            }
+            ARC_CHECK_EQUAL(
+                arc::str::utf16_to_utf8(utf16, length, endiannesses[e]),
+                *it
+            );
+
+            delete[] utf16;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+//                                   MALFORMED
+//------------------------------------------------------------------------------
+
+ARC_TEST_UNIT_FIXTURE(malformed, UTF16DecoderFixture)
+{
+    ARC_TEST_MESSAGE("Checking a trailing odd byte is discarded");
+    const char odd[] = {'a', '\0', 'b', '\0', 'c'};
+    ARC_CHECK_EQUAL(
+        fixture->decode(odd, sizeof(odd), arc::data::ENDIAN_LITTLE, 3),
+        "ab"
+    );
+
+    ARC_TEST_MESSAGE("Checking unpaired surrogates are written as is");
+    // high surrogate followed by a non-surrogate
+    const char unpaired_high[] =
+        {'\x3D', '\xD8', 'a', '\0', '\x3D', '\xD8'};
+    arc::str::UTF8String decoded(fixture->decode(
+        unpaired_high,
+        sizeof(unpaired_high),
+        arc::data::ENDIAN_LITTLE,
+        2
+    ));
+    ARC_CHECK_EQUAL(decoded.get_byte_length(), 8);
+    ARC_CHECK_EQUAL(decoded.get_raw()[3], 'a');
+
+    // low surrogate on its own
+    const char unpaired_low[] = {'\x00', '\xDE'};
+    ARC_CHECK_EQUAL(
+        fixture->decode(
+            unpaired_low,
+            sizeof(unpaired_low),
+            arc::data::ENDIAN_LITTLE,
+            2
+        ).get_byte_length(),
+        4
+    );
+}
+
+} // namespace anonymous
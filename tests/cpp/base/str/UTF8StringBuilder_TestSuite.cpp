@@ -0,0 +1,141 @@
+#include "arcanecore/test/ArcTest.hpp"
+
+ARC_TEST_MODULE(base.str.UTF8StringBuilder)
+
+#include <limits>
+#include <sstream>
+
+#include "arcanecore/base/Exceptions.hpp"
+#include "arcanecore/base/str/UTF8StringBuilder.hpp"
+
+namespace
+{
+
+//------------------------------------------------------------------------------
+//                                     APPEND
+//------------------------------------------------------------------------------
+
+ARC_TEST_UNIT(append)
+{
+    ARC_TEST_MESSAGE("Checking the empty builder");
+    arc::str::UTF8StringBuilder builder;
+    ARC_CHECK_TRUE(builder.is_empty());
+    ARC_CHECK_EQUAL(builder.get_byte_length(), 0);
+    ARC_CHECK_EQUAL(builder.get_capacity(), 0);
+    ARC_CHECK_EQUAL(builder.to_string(), "");
+    ARC_CHECK_TRUE(builder.to_view().is_empty());
+
+    ARC_TEST_MESSAGE("Checking text appends");
+    arc::str::UTF8String s("aל∑");
+    builder << "{" << s << "} - " << std::string("std ")
+            << arc::str::UTF8StringView("view 𝄞").substring(0, 4) << '!';
+    ARC_CHECK_FALSE(builder.is_empty());
+    ARC_CHECK_EQUAL(builder.to_string(), "{aל∑} - std view!");
+    ARC_CHECK_EQUAL(builder.to_string().get_length(), 17);
+    ARC_CHECK_TRUE(builder.to_view() == "{aל∑} - std view!");
+
+    ARC_TEST_MESSAGE("Checking number appends match UTF8String");
+    builder.clear();
+    arc::str::UTF8String expected;
+    builder << true << false;
+    expected << true << false;
+    builder << static_cast<arc::int16>(-32768)
+            << static_cast<arc::uint16>(65535);
+    expected << static_cast<arc::int16>(-32768)
+             << static_cast<arc::uint16>(65535);
+    builder << std::numeric_limits<arc::int32>::min()
+            << std::numeric_limits<arc::uint32>::max();
+    expected << std::numeric_limits<arc::int32>::min()
+             << std::numeric_limits<arc::uint32>::max();
+    builder << std::numeric_limits<arc::int64>::min()
+            << std::numeric_limits<arc::uint64>::max();
+    expected << std::numeric_limits<arc::int64>::min()
+             << std::numeric_limits<arc::uint64>::max();
+    builder << 3.14F << " " << 0.1 << " " << -1.5e-9;
+    expected << 3.14F << " " << 0.1 << " " << -1.5e-9;
+    builder << static_cast<arc::int8>('a') << static_cast<arc::uint8>('b');
+    expected << static_cast<arc::int8>('a') << static_cast<arc::uint8>('b');
+    ARC_CHECK_EQUAL(builder.to_string(), expected);
+
+    ARC_TEST_MESSAGE("Checking raw appends");
+    builder.clear();
+    builder.append("abcdef", 3);
+    builder.append("", 0);
+    ARC_CHECK_EQUAL(builder.get_byte_length(), 3);
+    ARC_CHECK_EQUAL(builder.to_string(), "abc");
+
+    ARC_TEST_MESSAGE("Checking stream output");
+    std::ostringstream stream;
+    stream << builder;
+    ARC_CHECK_EQUAL(stream.str(), "abc");
+}
+
+//------------------------------------------------------------------------------
+//                                   VALIDATION
+//------------------------------------------------------------------------------
+
+ARC_TEST_UNIT(validation)
+{
+    ARC_TEST_MESSAGE("Checking symbols split across appends");
+    // "∑" is 0xE2 0x88 0x91
+    arc::str::UTF8StringBuilder builder;
+    builder << "a" << '\xE2';
+    builder.append("\x88\x91", 2);
+    ARC_CHECK_EQUAL(builder.to_string(), "a∑");
+    ARC_CHECK_EQUAL(builder.to_view().get_length(), 2);
+
+    ARC_TEST_MESSAGE("Checking invalid data is reported");
+    builder << '\xE2' << "x";
+    ARC_CHECK_THROW(builder.to_string(), arc::ex::EncodingError);
+    ARC_CHECK_THROW(builder.to_view(), arc::ex::EncodingError);
+}
+
+//------------------------------------------------------------------------------
+//                                     REUSE
+//------------------------------------------------------------------------------
+
+ARC_TEST_UNIT(reuse)
+{
+    ARC_TEST_MESSAGE("Checking the buffer grows geometrically");
+    arc::str::UTF8StringBuilder builder;
+    arc::str::UTF8String expected;
+    std::size_t reallocations = 0;
+    std::size_t capacity = builder.get_capacity();
+    for(std::size_t i = 0; i < 10000; ++i)
+    {
+        builder << "ጸ" << i;
+        expected << "ጸ" << i;
+        if(builder.get_capacity() != capacity)
+        {
+            capacity = builder.get_capacity();
+            ++reallocations;
+        }
+    }
+    ARC_CHECK_TRUE(reallocations < 16);
+    ARC_CHECK_EQUAL(builder.to_string(), expected);
+
+    ARC_TEST_MESSAGE("Checking clear keeps the buffer");
+    builder.clear();
+    ARC_CHECK_TRUE(builder.is_empty());
+    ARC_CHECK_EQUAL(builder.get_capacity(), capacity);
+    builder << "reused";
+    ARC_CHECK_EQUAL(builder.to_string(), "reused");
+    ARC_CHECK_EQUAL(builder.get_capacity(), capacity);
+
+    ARC_TEST_MESSAGE("Checking reserve");
+    builder.reserve(capacity * 4);
+    ARC_CHECK_EQUAL(builder.get_capacity(), capacity * 4);
+    ARC_CHECK_EQUAL(builder.to_string(), "reused");
+
+    ARC_TEST_MESSAGE("Checking move");
+    arc::str::UTF8StringBuilder moved(std::move(builder));
+    ARC_CHECK_EQUAL(moved.to_string(), "reused");
+    ARC_CHECK_TRUE(builder.is_empty());
+    ARC_CHECK_EQUAL(builder.get_capacity(), 0);
+    builder << "after move";
+    ARC_CHECK_EQUAL(builder.to_string(), "after move");
+    builder = std::move(moved);
+    ARC_CHECK_EQUAL(builder.to_string(), "reused");
+}
+
+} // namespace anonymous
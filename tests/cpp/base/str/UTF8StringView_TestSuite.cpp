@@ -0,0 +1,278 @@
+#include "arcanecore/test/ArcTest.hpp"
+
+ARC_TEST_MODULE(base.str.UTF8StringView)
+
+#include <sstream>
+#include <unordered_map>
+
+#include "arcanecore/base/Exceptions.hpp"
+#include "arcanecore/base/str/UTF8StringView.hpp"
+
+namespace
+{
+
+//------------------------------------------------------------------------------
+//                                  CONSTRUCTORS
+//------------------------------------------------------------------------------
+
+ARC_TEST_UNIT(constructors)
+{
+    ARC_TEST_MESSAGE("Checking default constructor");
+    arc::str::UTF8StringView empty;
+    ARC_CHECK_TRUE(empty.is_empty());
+    ARC_CHECK_EQUAL(empty.get_length(), 0);
+    ARC_CHECK_EQUAL(empty.get_byte_length(), 0);
+
+    ARC_TEST_MESSAGE("Checking UTF8String constructor");
+    arc::str::UTF8String s("γειά σου Κόσμε");
+    arc::str::UTF8StringView view(s);
+    ARC_CHECK_EQUAL(view.get_raw(), s.get_raw());
+    ARC_CHECK_EQUAL(view.get_length(), 14);
+    ARC_CHECK_EQUAL(view.get_byte_length(), s.get_byte_length() - 1);
+    ARC_CHECK_FALSE(view.is_ascii());
+
+    ARC_TEST_MESSAGE("Checking cstring constructors");
+    arc::str::UTF8StringView cstring("this is a مزيج");
+    ARC_CHECK_EQUAL(cstring.get_length(), 14);
+    ARC_CHECK_EQUAL(cstring.get_byte_length(), 18);
+    arc::str::UTF8StringView partial("Hello World", 5);
+    ARC_CHECK_EQUAL(partial.get_length(), 5);
+    ARC_CHECK_TRUE(partial.is_ascii());
+    ARC_CHECK_EQUAL(partial, "Hello");
+
+    ARC_TEST_MESSAGE("Checking EncodingError");
+    const char invalid[] = {'a', static_cast<char>(0xFF), 'b', '\0'};
+    ARC_CHECK_THROW(
+        arc::str::UTF8StringView(invalid).get_length(),
+        arc::ex::EncodingError
+    );
+}
+
+//------------------------------------------------------------------------------
+//                                   COMPARISON
+//------------------------------------------------------------------------------
+
+ARC_TEST_UNIT(comparison)
+{
+    arc::str::UTF8String s("Hello World");
+    arc::str::UTF8StringView view(s);
+
+    ARC_CHECK_TRUE(view == arc::str::UTF8StringView("Hello World"));
+    ARC_CHECK_TRUE(view != arc::str::UTF8StringView("Hello"));
+    ARC_CHECK_TRUE(view.substring(0, 5) == "Hello");
+
+    ARC_CHECK_TRUE(arc::str::UTF8StringView("a") < "b");
+    ARC_CHECK_TRUE(arc::str::UTF8StringView("ab") < "abc");
+    ARC_CHECK_FALSE(arc::str::UTF8StringView("abc") < "ab");
+    ARC_CHECK_TRUE(arc::str::UTF8StringView("z") < "γ");
+    ARC_CHECK_FALSE(arc::str::UTF8StringView("γ") < "γ");
+}
+
+//------------------------------------------------------------------------------
+//                                     SEARCH
+//------------------------------------------------------------------------------
+
+ARC_TEST_UNIT(search)
+{
+    arc::str::UTF8String s("ጸጷጶጵጸጷጶጵጲጱጰጯጮጬᚡጲጱጰጯጮ");
+    arc::str::UTF8StringView view(s);
+
+    ARC_TEST_MESSAGE("Checking starts_with and ends_with");
+    ARC_CHECK_TRUE(view.starts_with("ጸጷ"));
+    ARC_CHECK_FALSE(view.starts_with("ጷ"));
+    ARC_CHECK_TRUE(view.ends_with("ጯጮ"));
+    ARC_CHECK_FALSE(view.ends_with("ጯ"));
+    ARC_CHECK_TRUE(view.starts_with(""));
+    ARC_CHECK_FALSE(arc::str::UTF8StringView("a").starts_with("ab"));
+
+    ARC_TEST_MESSAGE("Checking find_first and find_last");
+    ARC_CHECK_EQUAL(view.find_first("ጲጱጰጯጮ"), 8);
+    ARC_CHECK_EQUAL(view.find_last("ጲጱጰጯጮ"), 15);
+    ARC_CHECK_EQUAL(view.find_first("ᚡ"), 14);
+    ARC_CHECK_EQUAL(view.find_first("a"), arc::str::npos);
+    ARC_CHECK_EQUAL(view.find_last("a"), arc::str::npos);
+
+    ARC_TEST_MESSAGE("Checking the results match UTF8String");
+    arc::str::UTF8String other("**||**||**@@^^");
+    ARC_CHECK_EQUAL(
+        arc::str::UTF8StringView(other).find_first("**"),
+        other.find_first("**")
+    );
+    ARC_CHECK_EQUAL(
+        arc::str::UTF8StringView(other).find_last("**"),
+        other.find_last("**")
+    );
+}
+
+//------------------------------------------------------------------------------
+//                                     SPLIT
+//------------------------------------------------------------------------------
+
+ARC_TEST_UNIT(split)
+{
+    arc::str::UTF8String s("resource.γειά..σου.");
+    std::vector<arc::str::UTF8StringView> elements(
+        arc::str::UTF8StringView(s).split("."));
+
+    ARC_CHECK_EQUAL(elements.size(), 5);
+    ARC_CHECK_EQUAL(elements[0], "resource");
+    ARC_CHECK_EQUAL(elements[1], "γειά");
+    ARC_CHECK_EQUAL(elements[1].get_length(), 4);
+    ARC_CHECK_TRUE(elements[2].is_empty());
+    ARC_CHECK_EQUAL(elements[3], "σου");
+    ARC_CHECK_TRUE(elements[4].is_empty());
+
+    ARC_TEST_MESSAGE("Checking the elements view the original data");
+    ARC_CHECK_EQUAL(elements[0].get_raw(), s.get_raw());
+    ARC_CHECK_EQUAL(elements[1].get_raw(), s.get_raw() + 9);
+
+    ARC_TEST_MESSAGE("Checking the results match UTF8String");
+    std::vector<arc::str::UTF8String> strings(s.split("."));
+    ARC_CHECK_EQUAL(strings.size(), elements.size());
+    for(std::size_t i = 0; i < strings.size(); ++i)
+    {
+        ARC_CHECK_EQUAL(elements[i].to_string(), strings[i]);
+    }
+
+    ARC_TEST_MESSAGE("Checking ValueError");
+    ARC_CHECK_THROW(
+        arc::str::UTF8StringView(s).split(""),
+        arc::ex::ValueError
+    );
+}
+
+//------------------------------------------------------------------------------
+//                                   SUBSTRING
+//------------------------------------------------------------------------------
+
+ARC_TEST_UNIT(substring)
+{
+    arc::str::UTF8String s("this is a مزيج of text");
+    arc::str::UTF8StringView view(s);
+
+    ARC_CHECK_EQUAL(view.substring(0, 4), "this");
+    ARC_CHECK_EQUAL(view.substring(10, 4), "مزيج");
+    ARC_CHECK_EQUAL(view.substring(10, 4).get_length(), 4);
+    ARC_CHECK_EQUAL(view.substring(12, 5), "يج of");
+    ARC_CHECK_EQUAL(view.substring(18, 100), "text");
+    ARC_CHECK_TRUE(view.substring(22, 3).is_empty());
+    ARC_CHECK_EQUAL(view.substring(10, 4).to_string(), s.substring(10, 4));
+
+    ARC_CHECK_EQUAL(view.get_byte_index_for_symbol_index(11), 12);
+    ARC_CHECK_EQUAL(view.get_byte_index_for_symbol_index(22), 26);
+
+    ARC_TEST_MESSAGE("Checking IndexOutOfBoundsError");
+    ARC_CHECK_THROW(
+        view.substring(23, 1),
+        arc::ex::IndexOutOfBoundsError
+    );
+}
+
+//------------------------------------------------------------------------------
+//                                  CONVERSIONS
+//------------------------------------------------------------------------------
+
+ARC_TEST_UNIT(conversions)
+{
+    ARC_TEST_MESSAGE("Checking is_int, is_uint and is_float");
+    ARC_CHECK_TRUE(arc::str::UTF8StringView("-12").is_int());
+    ARC_CHECK_FALSE(arc::str::UTF8StringView("-12").is_uint());
+    ARC_CHECK_TRUE(arc::str::UTF8StringView("12").is_uint());
+    ARC_CHECK_FALSE(arc::str::UTF8StringView("1-2").is_int());
+    ARC_CHECK_FALSE(arc::str::UTF8StringView("١٢").is_int());
+    ARC_CHECK_FALSE(arc::str::UTF8StringView("").is_int());
+    ARC_CHECK_TRUE(arc::str::UTF8StringView("-1.5").is_float());
+    ARC_CHECK_FALSE(arc::str::UTF8StringView("1.5.").is_float());
+
+    ARC_TEST_MESSAGE("Checking integer values");
+    arc::str::UTF8String line("0,-123,4294967295,-9223372036854775807,00");
+    std::vector<arc::str::UTF8StringView> elements(
+        arc::str::UTF8StringView(line).split(","));
+    ARC_CHECK_EQUAL(elements[0].to_int32(), 0);
+    ARC_CHECK_EQUAL(elements[1].to_int32(), -123);
+    ARC_CHECK_EQUAL(elements[2].to_uint32(), 4294967295U);
+    ARC_CHECK_EQUAL(
+        elements[3].to_int64(),
+        static_cast<arc::int64>(-9223372036854775807LL)
+    );
+    ARC_CHECK_EQUAL(elements[2].to_uint64(), 4294967295ULL);
+    ARC_CHECK_FALSE(elements[4].to_bool());
+    ARC_CHECK_TRUE(elements[1].to_bool());
+
+    ARC_TEST_MESSAGE("Checking ConversionDataError");
+    ARC_CHECK_THROW(
+        elements[1].to_uint32(),
+        arc::ex::ConversionDataError
+    );
+    ARC_CHECK_THROW(
+        arc::str::UTF8StringView("12a").to_int64(),
+        arc::ex::ConversionDataError
+    );
+    ARC_CHECK_THROW(
+        elements[3].to_int32(),
+        arc::ex::ConversionDataError
+    );
+
+    ARC_TEST_MESSAGE("Checking try_to");
+    arc::uint32 page_index = 0;
+    ARC_CHECK_TRUE(elements[2].try_to_uint32(page_index));
+    ARC_CHECK_EQUAL(page_index, 4294967295U);
+    arc::int64 offset = 0;
+    ARC_CHECK_TRUE(elements[3].try_to_int64(offset));
+    ARC_CHECK_EQUAL(offset, static_cast<arc::int64>(-9223372036854775807LL));
+    arc::int32 value = 5;
+    ARC_CHECK_FALSE(elements[2].try_to_int32(value));
+    ARC_CHECK_EQUAL(value, 5);
+    arc::uint64 unsigned_value = 5;
+    ARC_CHECK_FALSE(elements[1].try_to_uint64(unsigned_value));
+    ARC_CHECK_EQUAL(unsigned_value, 5);
+
+    ARC_TEST_MESSAGE("Checking string conversion");
+    ARC_CHECK_EQUAL(elements[1].to_std_string(), "-123");
+    arc::str::UTF8String s("value: ");
+    s << elements[1];
+    ARC_CHECK_EQUAL(s, "value: -123");
+    std::ostringstream stream;
+    stream << elements[3];
+    ARC_CHECK_EQUAL(stream.str(), "-9223372036854775807");
+}
+
+//------------------------------------------------------------------------------
+//                                      HASH
+//------------------------------------------------------------------------------
+
+ARC_TEST_UNIT(hash)
+{
+    arc::str::UTF8String s("key.name.ξ");
+    arc::str::UTF8StringView view(s);
+    std::vector<arc::str::UTF8StringView> elements(view.split("."));
+
+    ARC_TEST_MESSAGE("Checking views hash the same as strings");
+    ARC_CHECK_EQUAL(view.get_hash(), s.get_hash());
+    ARC_CHECK_EQUAL(
+        elements[1].get_hash(),
+        arc::str::UTF8String("name").get_hash()
+    );
+    ARC_CHECK_EQUAL(
+        std::hash<arc::str::UTF8StringView>()(elements[0]),
+        std::hash<arc::str::UTF8String>()(arc::str::UTF8String("key"))
+    );
+
+    ARC_TEST_MESSAGE("Checking UTF8StringHash");
+    arc::str::UTF8StringHash hasher;
+    ARC_CHECK_EQUAL(hasher(s), hasher("key.name.ξ"));
+    ARC_CHECK_EQUAL(hasher(elements[2]), hasher("ξ"));
+    ARC_CHECK_EQUAL(hasher(elements[2]), hasher(arc::str::UTF8String("ξ")));
+    ARC_CHECK_NOT_EQUAL(hasher(elements[0]), hasher(elements[1]));
+
+    ARC_TEST_MESSAGE("Checking probing a map with views of other data");
+    std::unordered_map<arc::str::UTF8StringView, int> map;
+    map[elements[0]] = 0;
+    map[elements[1]] = 1;
+    ARC_CHECK_EQUAL(map.at(arc::str::UTF8StringView("name")), 1);
+    const char* line = "key=value";
+    ARC_CHECK_EQUAL(map.at(arc::str::UTF8StringView(line, 3)), 0);
+    ARC_CHECK_TRUE(map.find("value") == map.end());
+}
+
+} // namespace anonymous
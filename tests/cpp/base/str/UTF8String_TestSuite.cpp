@@ -4,6 +4,7 @@ ARC_TEST_MODULE(base.str.UTF8String)
 
 #include <algorithm>
 #include <cstring>
+#include <limits>
 
 #include "arcanecore/base/Exceptions.hpp"
 #include "arcanecore/base/str/UTF8String.hpp"
@@ -287,6 +288,19 @@ public:
         find.push_back   ( "γειά σου Κόσμε!" );
         first_results.push_back( arc::str::npos );
         last_results.push_back( arc::str::npos );
+
+        strings.push_back(
+            "ጸጷጶጵ this is a much longer string so that the search covers "
+            "several blocks, ጸጷጶጵ ጸጷ and has matches near the end ጸጷጶጵ!"
+        );
+        find.push_back("ጸጷጶጵ");
+        first_results.push_back(0);
+        last_results.push_back(113);
+
+        strings.push_back("abc");
+        find.push_back("");
+        first_results.push_back(0);
+        last_results.push_back(3);
     }
 };
 
@@ -1199,6 +1213,11 @@ public:
         comp_1.push_back( "Κόσμε" );
         comp_2.push_back( -23480932849234 );
         results.push_back( "Κόσμε-23480932849234" );
+
+        comp_1.push_back( "0123456789012345678901234567890: " );
+        comp_2.push_back( std::numeric_limits< arc::int64 >::min() );
+        results.push_back(
+                "0123456789012345678901234567890: -9223372036854775808" );
     }
 };
 
@@ -1369,6 +1388,14 @@ public:
         comp_1.push_back("Κόσμε ");
         comp_2.push_back(0.00034);
         results.push_back("Κόσμε 0.00034");
+
+        comp_1.push_back("");
+        comp_2.push_back(0.1 + 0.2);
+        results.push_back("0.30000000000000004");
+
+        comp_1.push_back("ጸጷጶጵ ");
+        comp_2.push_back(-2.5e-30);
+        results.push_back("ጸጷጶጵ -2.5e-30");
     }
 };
 
@@ -2441,6 +2468,111 @@ ARC_TEST_UNIT_FIXTURE( to_uint64, ToUint32Fixture )
     }
 }
 
+//------------------------------------------------------------------------------
+//                                     TRY TO
+//------------------------------------------------------------------------------
+
+ARC_TEST_UNIT_FIXTURE(try_to_int, ToInt32Fixture)
+{
+    ARC_TEST_MESSAGE("Checking valid cases");
+    for(std::size_t i = 0; i < fixture->valid.size(); ++i)
+    {
+        arc::int32 value_32 = 0;
+        ARC_CHECK_TRUE(fixture->valid[i].try_to_int32(value_32));
+        ARC_CHECK_EQUAL(value_32, fixture->results[i]);
+
+        arc::int64 value_64 = 0;
+        ARC_CHECK_TRUE(fixture->valid[i].try_to_int64(value_64));
+        ARC_CHECK_EQUAL(value_64, fixture->results[i]);
+    }
+
+    ARC_TEST_MESSAGE("Checking invalid cases");
+    ARC_FOR_EACH(it, fixture->invalid)
+    {
+        arc::int32 value_32 = 7;
+        ARC_CHECK_FALSE(it->try_to_int32(value_32));
+        ARC_CHECK_EQUAL(value_32, 7);
+
+        arc::int64 value_64 = 7;
+        ARC_CHECK_FALSE(it->try_to_int64(value_64));
+        ARC_CHECK_EQUAL(value_64, 7);
+    }
+
+    ARC_TEST_MESSAGE("Checking range");
+    arc::int32 value_32 = 0;
+    ARC_CHECK_TRUE(arc::str::UTF8String("-2147483648").try_to_int32(value_32));
+    ARC_CHECK_EQUAL(value_32, std::numeric_limits<arc::int32>::min());
+    ARC_CHECK_FALSE(arc::str::UTF8String("2147483648").try_to_int32(value_32));
+    ARC_CHECK_THROW(
+        arc::str::UTF8String("-2147483649").to_int32(),
+        arc::ex::ConversionDataError
+    );
+
+    arc::int64 value_64 = 0;
+    ARC_CHECK_TRUE(
+        arc::str::UTF8String("-9223372036854775808").try_to_int64(value_64));
+    ARC_CHECK_EQUAL(value_64, std::numeric_limits<arc::int64>::min());
+    ARC_CHECK_THROW(
+        arc::str::UTF8String("9223372036854775808").to_int64(),
+        arc::ex::ConversionDataError
+    );
+
+    ARC_TEST_MESSAGE("Checking leading zeros are decimal");
+    ARC_CHECK_EQUAL(arc::str::UTF8String("010").to_int32(), 10);
+    ARC_CHECK_EQUAL(arc::str::UTF8String("-0777").to_int64(), -777);
+    ARC_CHECK_EQUAL(arc::str::UTF8String("0789").to_uint64(), 789U);
+    ARC_CHECK_THROW(
+        arc::str::UTF8String("0x1f").to_int64(),
+        arc::ex::ConversionDataError
+    );
+}
+
+ARC_TEST_UNIT_FIXTURE(try_to_uint, ToUint32Fixture)
+{
+    ARC_TEST_MESSAGE("Checking valid cases");
+    for(std::size_t i = 0; i < fixture->valid.size(); ++i)
+    {
+        arc::uint32 value_32 = 0;
+        ARC_CHECK_TRUE(fixture->valid[i].try_to_uint32(value_32));
+        ARC_CHECK_EQUAL(value_32, fixture->results[i]);
+
+        arc::uint64 value_64 = 0;
+        ARC_CHECK_TRUE(fixture->valid[i].try_to_uint64(value_64));
+        ARC_CHECK_EQUAL(value_64, fixture->results[i]);
+    }
+
+    ARC_TEST_MESSAGE("Checking invalid cases");
+    ARC_FOR_EACH(it, fixture->invalid)
+    {
+        arc::uint32 value_32 = 7;
+        ARC_CHECK_FALSE(it->try_to_uint32(value_32));
+        ARC_CHECK_EQUAL(value_32, 7);
+
+        arc::uint64 value_64 = 7;
+        ARC_CHECK_FALSE(it->try_to_uint64(value_64));
+        ARC_CHECK_EQUAL(value_64, 7);
+    }
+
+    ARC_TEST_MESSAGE("Checking range");
+    arc::uint32 value_32 = 0;
+    ARC_CHECK_TRUE(arc::str::UTF8String("4294967295").try_to_uint32(value_32));
+    ARC_CHECK_EQUAL(value_32, std::numeric_limits<arc::uint32>::max());
+    ARC_CHECK_FALSE(arc::str::UTF8String("4294967296").try_to_uint32(value_32));
+
+    arc::uint64 value_64 = 0;
+    ARC_CHECK_TRUE(
+        arc::str::UTF8String("18446744073709551615").try_to_uint64(value_64));
+    ARC_CHECK_EQUAL(value_64, std::numeric_limits<arc::uint64>::max());
+    ARC_CHECK_EQUAL(
+        arc::str::UTF8String("18446744073709551615").to_uint64(),
+        std::numeric_limits<arc::uint64>::max()
+    );
+    ARC_CHECK_THROW(
+        arc::str::UTF8String("18446744073709551616").to_uint64(),
+        arc::ex::ConversionDataError
+    );
+}
+
 //------------------------------------------------------------------------------
 //                                   GET LENGTH
 //------------------------------------------------------------------------------
@@ -2958,6 +3090,302 @@ ARC_TEST_UNIT_FIXTURE( get_byte_width, GetSymbolWidthFixture )
     );
 }
 
+//------------------------------------------------------------------------------
+//                                    IS ASCII
+//------------------------------------------------------------------------------
+
+ARC_TEST_UNIT_FIXTURE(is_ascii, UTF8StringGenericFixture)
+{
+    ARC_TEST_MESSAGE("Checking values");
+    for(std::size_t i = 0; i < fixture->utf8_strings.size(); ++i)
+    {
+        ARC_CHECK_EQUAL(
+            fixture->utf8_strings[i].is_ascii(),
+            fixture->utf8_strings[i].get_length() ==
+                fixture->utf8_strings[i].get_byte_length() - 1
+        );
+    }
+
+    ARC_TEST_MESSAGE("Checking reassignment");
+    arc::str::UTF8String s("Hello");
+    ARC_CHECK_TRUE(s.is_ascii());
+    s << "γειά";
+    ARC_CHECK_FALSE(s.is_ascii());
+    s = "World";
+    ARC_CHECK_TRUE(s.is_ascii());
+
+    ARC_TEST_MESSAGE("Checking move");
+    arc::str::UTF8String original("σου");
+    arc::str::UTF8String moved(std::move(original));
+    ARC_CHECK_TRUE(original.is_ascii());
+    ARC_CHECK_FALSE(moved.is_ascii());
+    ARC_CHECK_EQUAL(moved.get_byte_index_for_symbol_index(2), 4);
+}
+
+//------------------------------------------------------------------------------
+//                                 LONG INDICES
+//------------------------------------------------------------------------------
+
+ARC_TEST_UNIT_FIXTURE(long_indices, IndexFixture)
+{
+    // build a string long enough to need many checkpoints, starting with a
+    // run of single byte symbols
+    arc::str::UTF8String prefix("0123456789");
+    prefix *= 7;
+    arc::str::UTF8String symbols(prefix);
+    std::vector<std::size_t> byte_indices;
+    for(std::size_t i = 0; i < prefix.get_length(); ++i)
+    {
+        byte_indices.push_back(i);
+    }
+    for(std::size_t i = 0; i < 20; ++i)
+    {
+        std::size_t offset = symbols.get_byte_length() - 1;
+        ARC_FOR_EACH(it, fixture->byte_indices)
+        {
+            byte_indices.push_back(offset + *it);
+        }
+        symbols << fixture->symbols;
+    }
+    ARC_CHECK_FALSE(symbols.is_ascii());
+
+    ARC_TEST_MESSAGE("Checking get_byte_index_for_symbol_index");
+    ARC_CHECK_EQUAL(symbols.get_length(), byte_indices.size());
+    for(std::size_t i = 0; i < symbols.get_length(); ++i)
+    {
+        ARC_CHECK_EQUAL(
+            symbols.get_byte_index_for_symbol_index(i),
+            byte_indices[i]
+        );
+    }
+
+    ARC_TEST_MESSAGE("Checking get_symbol_index_for_byte_index");
+    std::size_t symbol_index = 0;
+    for(std::size_t i = 0; i < symbols.get_byte_length() - 1; ++i)
+    {
+        if(symbol_index < symbols.get_length() - 1 &&
+           i >= byte_indices[symbol_index + 1])
+        {
+            ++symbol_index;
+        }
+        ARC_CHECK_EQUAL(
+            symbols.get_symbol_index_for_byte_index(i),
+            symbol_index
+        );
+    }
+
+    ARC_TEST_MESSAGE("Checking copies");
+    arc::str::UTF8String copy(symbols);
+    ARC_CHECK_EQUAL(
+        copy.get_byte_index_for_symbol_index(symbols.get_length() - 1),
+        byte_indices.back()
+    );
+    ARC_CHECK_EQUAL(copy.get_symbol(symbols.get_length() - 1), "𐃹");
+}
+
+//------------------------------------------------------------------------------
+//                                 SHORT STRINGS
+//------------------------------------------------------------------------------
+
+ARC_TEST_UNIT(short_strings)
+{
+    // 23 bytes is the longest string stored locally
+    const arc::str::UTF8String local("abcdefghijklmnopqrstuvw");
+    const arc::str::UTF8String heap("abcdefghijklmnopqrstuvwx");
+    ARC_CHECK_EQUAL(local.get_byte_length(), 24);
+    ARC_CHECK_EQUAL(heap.get_byte_length(), 25);
+
+    ARC_TEST_MESSAGE("Checking growing from local to heap storage");
+    arc::str::UTF8String s;
+    for(std::size_t i = 0; i < heap.get_length(); ++i)
+    {
+        s << heap.get_symbol(i);
+        ARC_CHECK_EQUAL(s, heap.substring(0, i + 1));
+        ARC_CHECK_EQUAL(s.get_raw()[s.get_byte_length() - 1], '\0');
+    }
+
+    ARC_TEST_MESSAGE("Checking shrinking from heap to local storage");
+    s = heap;
+    s.assign(heap.get_raw(), 5);
+    ARC_CHECK_EQUAL(s, "abcde");
+    s = heap;
+    s = s.substring(1, 3);
+    ARC_CHECK_EQUAL(s, "bcd");
+    ARC_CHECK_EQUAL(s.get_byte_length(), 4);
+
+    ARC_TEST_MESSAGE("Checking concatenating with itself");
+    s = "γειά";
+    s << s;
+    ARC_CHECK_EQUAL(s, "γειάγειά");
+    s << s;
+    ARC_CHECK_EQUAL(s, "γειάγειάγειάγειά");
+    ARC_CHECK_EQUAL(s.get_length(), 16);
+
+    ARC_TEST_MESSAGE("Checking repeat");
+    s = "ab";
+    s *= 3;
+    ARC_CHECK_EQUAL(s, "ababab");
+    s *= 5;
+    ARC_CHECK_EQUAL(s.get_byte_length(), 31);
+    ARC_CHECK_TRUE(s.starts_with("ababab") && s.ends_with("ababab"));
+    s *= 0;
+    ARC_CHECK_TRUE(s.is_empty());
+
+    ARC_TEST_MESSAGE("Checking move");
+    arc::str::UTF8String source(local);
+    arc::str::UTF8String moved(std::move(source));
+    ARC_CHECK_EQUAL(moved, local);
+    ARC_CHECK_TRUE(source.is_empty());
+    ARC_CHECK_EQUAL(source.get_raw()[0], '\0');
+    source = "reused";
+    ARC_CHECK_EQUAL(source, "reused");
+
+    source = heap;
+    moved = std::move(source);
+    ARC_CHECK_EQUAL(moved, heap);
+    ARC_CHECK_TRUE(source.is_empty());
+    moved = std::move(moved);
+    ARC_CHECK_EQUAL(moved, heap);
+
+    std::vector<arc::str::UTF8String> strings;
+    for(std::size_t i = 0; i < 64; ++i)
+    {
+        strings.push_back(i % 2 == 0 ? local : heap);
+    }
+    for(std::size_t i = 0; i < strings.size(); ++i)
+    {
+        ARC_CHECK_EQUAL(strings[i], i % 2 == 0 ? local : heap);
+    }
+}
+
+//------------------------------------------------------------------------------
+//                                    CAPACITY
+//------------------------------------------------------------------------------
+
+ARC_TEST_UNIT(capacity)
+{
+    ARC_TEST_MESSAGE("Checking reserve");
+    arc::str::UTF8String s("Hello");
+    ARC_CHECK_EQUAL(s.get_capacity(), 23);
+    s.reserve(10);
+    ARC_CHECK_EQUAL(s.get_capacity(), 23);
+    s.reserve(100);
+    ARC_CHECK_EQUAL(s.get_capacity(), 100);
+    ARC_CHECK_EQUAL(s, "Hello");
+    const char* reserved = s.get_raw();
+    for(std::size_t i = 0; i < 19; ++i)
+    {
+        s << "abcde";
+    }
+    ARC_CHECK_EQUAL(s.get_byte_length(), 101);
+    ARC_CHECK_TRUE(s.get_raw() == reserved);
+
+    ARC_TEST_MESSAGE("Checking geometric growth");
+    s << "!";
+    ARC_CHECK_EQUAL(s.get_capacity(), 201);
+    std::size_t reallocations = 0;
+    for(std::size_t i = 0; i < 10000; ++i)
+    {
+        const char* data = s.get_raw();
+        s << "x";
+        if(s.get_raw() != data)
+        {
+            ++reallocations;
+        }
+    }
+    ARC_CHECK_EQUAL(s.get_length(), 10101);
+    ARC_CHECK_TRUE(reallocations < 10);
+
+    ARC_TEST_MESSAGE("Checking assignment reuses the buffer");
+    reserved = s.get_raw();
+    s.assign("γειά σου Κόσμε");
+    ARC_CHECK_TRUE(s.get_raw() == reserved);
+    ARC_CHECK_EQUAL(s.get_length(), 14);
+    ARC_CHECK_FALSE(s.is_ascii());
+
+    ARC_TEST_MESSAGE("Checking incremental processing of appended data");
+    arc::str::UTF8String built;
+    std::string expected;
+    for(std::size_t i = 0; i < 50; ++i)
+    {
+        built << "abc";
+        expected += "abc";
+        ARC_CHECK_TRUE(built.is_ascii());
+    }
+    built << "ጸ" << "Κόσμε" << built;
+    expected += "ጸΚόσμε";
+    expected += expected;
+    const arc::str::UTF8String reference(expected.c_str());
+    ARC_CHECK_EQUAL(built, reference);
+    ARC_CHECK_EQUAL(built.get_length(), reference.get_length());
+    ARC_CHECK_EQUAL(built.get_length(), 312);
+    ARC_CHECK_FALSE(built.is_ascii());
+    for(std::size_t i = 0; i < reference.get_length(); i += 7)
+    {
+        ARC_CHECK_EQUAL(
+            built.get_byte_index_for_symbol_index(i),
+            reference.get_byte_index_for_symbol_index(i)
+        );
+        ARC_CHECK_EQUAL(
+            built.get_symbol_index_for_byte_index(
+                reference.get_byte_index_for_symbol_index(i)),
+            i
+        );
+    }
+
+    ARC_TEST_MESSAGE("Checking repeat");
+    built = "ጸa";
+    built.reserve(200);
+    built *= 50;
+    ARC_CHECK_EQUAL(built.get_length(), 100);
+    ARC_CHECK_EQUAL(built.get_symbol(99), "a");
+    ARC_CHECK_EQUAL(built.get_symbol(98), "ጸ");
+    ARC_CHECK_EQUAL(built.get_byte_index_for_symbol_index(64), 128);
+}
+
+//------------------------------------------------------------------------------
+//                                    GET HASH
+//------------------------------------------------------------------------------
+
+ARC_TEST_UNIT(get_hash)
+{
+    ARC_TEST_MESSAGE("Checking equal strings have equal hashes");
+    arc::str::UTF8String s("Hello");
+    arc::str::UTF8String heap("this string is too long for the local buffer");
+    ARC_CHECK_EQUAL(s.get_hash(), arc::str::UTF8String("Hello").get_hash());
+    ARC_CHECK_EQUAL(
+        heap.get_hash(),
+        arc::str::UTF8String(heap.get_raw()).get_hash()
+    );
+    ARC_CHECK_EQUAL(s.get_hash(), std::hash<arc::str::UTF8String>()(s));
+    ARC_CHECK_NOT_EQUAL(s.get_hash(), heap.get_hash());
+
+    ARC_TEST_MESSAGE("Checking the cached hash is invalidated by modification");
+    std::size_t hello_hash = s.get_hash();
+    s << " world";
+    ARC_CHECK_EQUAL(
+        s.get_hash(),
+        arc::str::UTF8String("Hello world").get_hash()
+    );
+    s << 42;
+    ARC_CHECK_EQUAL(
+        s.get_hash(),
+        arc::str::UTF8String("Hello world42").get_hash()
+    );
+    s.assign("Hello");
+    ARC_CHECK_EQUAL(s.get_hash(), hello_hash);
+    s *= 2;
+    ARC_CHECK_EQUAL(s.get_hash(), arc::str::UTF8String("HelloHello").get_hash());
+    s = heap;
+    ARC_CHECK_EQUAL(s.get_hash(), heap.get_hash());
+
+    ARC_TEST_MESSAGE("Checking the hash is moved with the data");
+    std::size_t heap_hash = heap.get_hash();
+    arc::str::UTF8String moved(std::move(heap));
+    ARC_CHECK_EQUAL(moved.get_hash(), heap_hash);
+    ARC_CHECK_EQUAL(heap.get_hash(), arc::str::UTF8String().get_hash());
+}
+
 //------------------------------------------------------------------------------
 //                                 OPTIMISATIONS
 //------------------------------------------------------------------------------
@@ -2,7 +2,13 @@
 
 ARC_TEST_MODULE(config.Document)
 
+#include <chrono>
+#include <thread>
+
 #include <arcanecore/base/Exceptions.hpp>
+#include <arcanecore/io/sys/FileSystemOperations.hpp>
+#include <arcanecore/io/sys/FileWriter.hpp>
+#include <arcanecore/io/sys/Watcher.hpp>
 
 #include <json/json.h>
 
@@ -776,6 +782,61 @@ ARC_TEST_UNIT_FIXTURE(get, GetFixture)
     }
 }
 
+//------------------------------------------------------------------------------
+//                                     WATCH
+//------------------------------------------------------------------------------
+
+ARC_TEST_UNIT(watch)
+{
+    arc::io::sys::Path path;
+    path << "tests" << "data" << "config" << "watched.json";
+    {
+        arc::io::sys::FileWriter writer(path);
+        writer.write("{\"value_1\": \"Hello world!\"}");
+    }
+
+    arc::io::sys::Watcher watcher(20);
+    {
+        arc::config::Document doc(path);
+        doc.watch(watcher);
+        ARC_CHECK_FALSE(doc.reload_if_changed());
+
+        ARC_TEST_MESSAGE("Checking the Document reloads once changed");
+        {
+            arc::io::sys::FileWriter writer(path);
+            writer.write("{\"value_1\": \"Changed\"}");
+        }
+        bool reloaded = false;
+        for(std::size_t i = 0; i < 500 && !reloaded; ++i)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            reloaded = doc.reload_if_changed();
+        }
+        ARC_CHECK_TRUE(reloaded);
+        ARC_CHECK_EQUAL(
+            *doc.get("value_1", TestVisitor::instance()),
+            "Changed"
+        );
+        ARC_CHECK_FALSE(doc.reload_if_changed());
+
+        ARC_TEST_MESSAGE("Checking changes are ignored once unwatched");
+        doc.unwatch();
+        {
+            arc::io::sys::FileWriter writer(path);
+            writer.write("{\"value_1\": \"Unwatched\"}");
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        ARC_CHECK_FALSE(doc.reload_if_changed());
+    }
+
+    ARC_TEST_MESSAGE("Checking a memory only Document can't be watched");
+    arc::str::UTF8String memory("{}");
+    arc::config::Document mem_doc(&memory);
+    ARC_CHECK_THROW(mem_doc.watch(watcher), arc::ex::StateError);
+
+    arc::io::sys::delete_path(path);
+}
+
 // TODO: check null callback functions
 
 } // namespace anonymous
@@ -0,0 +1,172 @@
+#include <arcanecore/test/ArcTest.hpp>
+
+ARC_TEST_MODULE(io.dl.Library)
+
+#include <arcanecore/io/dl/Library.hpp>
+
+// the path to the test plugin is provided by the build
+#ifdef ARC_TEST_PLUGIN_PATH
+
+namespace
+{
+
+//------------------------------------------------------------------------------
+//                                GENERIC FIXTURE
+//------------------------------------------------------------------------------
+
+class LibraryFixture : public arc::test::Fixture
+{
+public:
+
+    //----------------------------PUBLIC ATTRIBUTES-----------------------------
+
+    arc::io::sys::Path path;
+
+    //-------------------------PUBLIC MEMBER FUNCTIONS--------------------------
+
+    virtual void setup()
+    {
+        path = arc::io::sys::Path(arc::str::UTF8String(ARC_TEST_PLUGIN_PATH));
+    }
+};
+
+//------------------------------------------------------------------------------
+//                                    SYMBOLS
+//------------------------------------------------------------------------------
+
+ARC_TEST_UNIT_FIXTURE(symbols, LibraryFixture)
+{
+    arc::io::dl::Library library(fixture->path);
+    ARC_CHECK_TRUE(library.is_open());
+    ARC_CHECK_EQUAL(library.get_path(), fixture->path);
+    ARC_CHECK_TRUE(library.get_handle() != nullptr);
+
+    ARC_TEST_MESSAGE("Checking declared symbols");
+    arc::io::dl::Library::Symbol<int(int, int)> add =
+        library.declare_symbol<int(int, int)>("arc_test_plugin_add");
+    arc::io::dl::Library::Symbol<int(int, int)> multiply =
+        library.declare_symbol<int(int, int)>("arc_test_plugin_multiply");
+    arc::io::dl::Library::Symbol<int> value =
+        library.declare_symbol<int>("arc_test_plugin_value");
+    ARC_CHECK_EQUAL(library.get_symbol(add)(2, 3), 5);
+    ARC_CHECK_EQUAL(library.get_symbol(multiply)(2, 3), 6);
+    ARC_CHECK_EQUAL(*library.get_symbol(value), 42);
+
+    ARC_TEST_MESSAGE("Checking bound symbols match the raw functions");
+    ARC_CHECK_EQUAL(
+        library.bind_symbol<int(int, int)>("arc_test_plugin_add"),
+        library.get_symbol(add)
+    );
+    ARC_CHECK_EQUAL(
+        arc::io::dl::bind_symbol<int(int, int)>(
+            library.get_handle(),
+            "arc_test_plugin_add"
+        ),
+        library.get_symbol(add)
+    );
+
+    ARC_TEST_MESSAGE("Checking missing symbols");
+    ARC_CHECK_THROW(
+        library.declare_symbol<int()>("arc_test_plugin_missing"),
+        arc::ex::DynamicLinkError
+    );
+    ARC_CHECK_EQUAL(library.get_symbol(add)(1, 1), 2);
+    ARC_CHECK_THROW(
+        library.get_symbol(arc::io::dl::Library::Symbol<int>()),
+        arc::ex::IndexOutOfBoundsError
+    );
+
+    ARC_TEST_MESSAGE("Checking declared symbols are bound again on reload");
+    library.reload();
+    ARC_CHECK_TRUE(library.is_open());
+    ARC_CHECK_EQUAL(library.get_symbol(add)(4, 5), 9);
+    ARC_CHECK_EQUAL(*library.get_symbol(value), 42);
+
+    ARC_TEST_MESSAGE("Checking closed libraries");
+    library.close();
+    ARC_CHECK_FALSE(library.is_open());
+    ARC_CHECK_TRUE(library.get_handle() == nullptr);
+    ARC_CHECK_THROW(library.get_symbol(add), arc::ex::StateError);
+    ARC_CHECK_THROW(
+        library.declare_symbol<int>("arc_test_plugin_value"),
+        arc::ex::StateError
+    );
+    library.open(fixture->path);
+    ARC_CHECK_EQUAL(library.get_symbol(multiply)(3, 3), 9);
+    ARC_CHECK_THROW(library.open(fixture->path), arc::ex::StateError);
+
+    ARC_TEST_MESSAGE("Checking missing paths");
+    arc::io::sys::Path missing;
+    missing << "tests" << "data" << "missing_plugin.so";
+    ARC_CHECK_THROW(arc::io::dl::Library(missing), arc::ex::IOError);
+    ARC_CHECK_THROW(arc::io::dl::Library().reload(), arc::ex::StateError);
+}
+
+//------------------------------------------------------------------------------
+//                                    SHARING
+//------------------------------------------------------------------------------
+
+ARC_TEST_UNIT_FIXTURE(sharing, LibraryFixture)
+{
+    arc::io::dl::Library library_1(fixture->path);
+    ARC_CHECK_EQUAL(library_1.get_reference_count(), 1);
+
+    arc::io::dl::Library library_2(fixture->path);
+    ARC_CHECK_EQUAL(library_1.get_handle(), library_2.get_handle());
+    ARC_CHECK_EQUAL(library_1.get_reference_count(), 2);
+
+    ARC_TEST_MESSAGE("Checking copies share the handle and symbol table");
+    arc::io::dl::Library::Symbol<int(int, int)> add =
+        library_1.declare_symbol<int(int, int)>("arc_test_plugin_add");
+    arc::io::dl::Library copy(library_1);
+    ARC_CHECK_EQUAL(copy.get_reference_count(), 3);
+    ARC_CHECK_EQUAL(copy.get_symbol(add)(1, 2), 3);
+
+    ARC_TEST_MESSAGE("Checking moves transfer the handle");
+    arc::io::dl::Library moved(std::move(copy));
+    ARC_CHECK_FALSE(copy.is_open());
+    ARC_CHECK_EQUAL(moved.get_reference_count(), 3);
+
+    ARC_TEST_MESSAGE("Checking closing releases the shared handle");
+    moved.close();
+    library_2.close();
+    ARC_CHECK_EQUAL(library_1.get_reference_count(), 1);
+    ARC_CHECK_EQUAL(library_2.get_reference_count(), 0);
+    ARC_CHECK_EQUAL(library_1.get_symbol(add)(2, 2), 4);
+}
+
+//------------------------------------------------------------------------------
+//                                    PRELINK
+//------------------------------------------------------------------------------
+
+ARC_TEST_UNIT_FIXTURE(prelink, LibraryFixture)
+{
+    arc::io::dl::Library library(fixture->path, arc::io::dl::BIND_NOW, true);
+    arc::io::dl::Library::Symbol<int(int, int)> add =
+        library.declare_symbol<int(int, int)>("arc_test_plugin_add");
+    arc::io::dl::Library::Symbol<int> value =
+        library.declare_symbol<int>("arc_test_plugin_value");
+
+    // unloads the library and binds the symbols from the remembered offsets
+    library.reload();
+    ARC_CHECK_EQUAL(library.get_symbol(add)(20, 22), 42);
+    ARC_CHECK_EQUAL(*library.get_symbol(value), 42);
+    ARC_CHECK_EQUAL(
+        arc::io::dl::bind_symbol<int(int, int)>(
+            library.get_handle(),
+            "arc_test_plugin_add"
+        ),
+        library.get_symbol(add)
+    );
+    ARC_CHECK_EQUAL(
+        arc::io::dl::bind_symbol<int>(
+            library.get_handle(),
+            "arc_test_plugin_value"
+        ),
+        library.get_symbol(value)
+    );
+}
+
+} // namespace anonymous
+
+#endif
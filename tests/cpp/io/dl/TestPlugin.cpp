@@ -0,0 +1,26 @@
+// hide from doxygen
+#ifndef IN_DOXYGEN
+
+// A minimal dynamic library that is loaded by the io.dl tests.
+
+#include <arcanecore/io/dl/DLOperations.hpp>
+
+extern "C"
+{
+
+ARC_IO_DL_EXPORT int arc_test_plugin_value = 42;
+
+ARC_IO_DL_EXPORT int arc_test_plugin_add(int a, int b)
+{
+    return a + b;
+}
+
+ARC_IO_DL_EXPORT int arc_test_plugin_multiply(int a, int b)
+{
+    return a * b;
+}
+
+} // extern "C"
+
+#endif
+// IN_DOXYGEN
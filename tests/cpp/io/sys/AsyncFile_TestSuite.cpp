@@ -0,0 +1,455 @@
+#include <arcanecore/test/ArcTest.hpp>
+
+ARC_TEST_MODULE(io.sys.AsyncFile)
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <thread>
+
+#include <arcanecore/io/sys/AsyncFile.hpp>
+#include <arcanecore/io/sys/FileReader.hpp>
+#include <arcanecore/io/sys/FileSystemOperations.hpp>
+
+namespace
+{
+
+//------------------------------------------------------------------------------
+//                                GENERIC FIXTURE
+//------------------------------------------------------------------------------
+
+class AsyncFileFixture : public arc::test::Fixture
+{
+public:
+
+    //----------------------------PUBLIC ATTRIBUTES-----------------------------
+
+    arc::io::sys::Path path;
+
+    std::size_t block_size;
+    std::size_t block_count;
+    std::vector<char> data;
+
+    //-------------------------PUBLIC MEMBER FUNCTIONS--------------------------
+
+    virtual void setup()
+    {
+        path << "tests" << "data" << "file_system" << "async_file.bin";
+
+        block_size = 512;
+        block_count = 64;
+        data.resize(block_size * block_count);
+        for(std::size_t i = 0; i < data.size(); ++i)
+        {
+            data[i] = static_cast<char>((i * 7) % 251);
+        }
+    }
+
+    virtual void teardown()
+    {
+        if(arc::io::sys::exists(path))
+        {
+            arc::io::sys::delete_path(path);
+        }
+    }
+
+    arc::int64 file_size()
+    {
+        arc::io::sys::FileReader reader(path);
+        return reader.get_size();
+    }
+
+    void write_blocks(arc::io::sys::AsyncFile& file)
+    {
+        std::vector<arc::io::sys::AsyncFile::Request> requests;
+        for(std::size_t i = 0; i < block_count; ++i)
+        {
+            requests.push_back(file.write_at(
+                &data[i * block_size],
+                block_size,
+                static_cast<arc::int64>(i * block_size)
+            ));
+        }
+        ARC_FOR_EACH(request, requests)
+        {
+            request->wait();
+        }
+    }
+};
+
+//------------------------------------------------------------------------------
+//                                   READ WRITE
+//------------------------------------------------------------------------------
+
+ARC_TEST_UNIT_FIXTURE(read_write, AsyncFileFixture)
+{
+    ARC_TEST_MESSAGE("Checking writing blocks asynchronously");
+    {
+        arc::io::sys::AsyncFile file(
+            fixture->path,
+            arc::io::sys::AsyncFile::ACCESS_WRITE,
+            4
+        );
+        fixture->write_blocks(file);
+        ARC_CHECK_EQUAL(
+            file.get_size(),
+            static_cast<arc::int64>(fixture->data.size())
+        );
+
+        ARC_CHECK_THROW(
+            file.read_at(&fixture->data[0], 1, 0),
+            arc::ex::StateError
+        );
+    }
+
+    ARC_TEST_MESSAGE("Checking reading blocks asynchronously");
+    arc::io::sys::AsyncFile file(fixture->path);
+    std::vector<char> read_data(fixture->data.size());
+    std::vector<arc::io::sys::AsyncFile::Request> requests;
+    for(std::size_t i = fixture->block_count; i > 0; --i)
+    {
+        std::size_t offset = (i - 1) * fixture->block_size;
+        requests.push_back(file.read_at(
+            &read_data[offset],
+            static_cast<arc::int64>(fixture->block_size),
+            static_cast<arc::int64>(offset)
+        ));
+    }
+    ARC_FOR_EACH(request, requests)
+    {
+        ARC_CHECK_EQUAL(
+            request->get_future().get(),
+            static_cast<arc::int64>(fixture->block_size)
+        );
+        ARC_CHECK_EQUAL(
+            request->get_status(),
+            arc::io::sys::AsyncFile::Request::STATUS_COMPLETE
+        );
+    }
+    ARC_CHECK_TRUE(
+        memcmp(&read_data[0], &fixture->data[0], fixture->data.size()) == 0);
+
+    ARC_TEST_MESSAGE("Checking reading past the end of the file");
+    arc::io::sys::AsyncFile::Request request = file.read_at(
+        &read_data[0],
+        static_cast<arc::int64>(fixture->block_size),
+        static_cast<arc::int64>(fixture->data.size() - 1)
+    );
+    ARC_CHECK_EQUAL(request.wait(), 1);
+
+    ARC_CHECK_THROW(
+        file.write_at(&fixture->data[0], 1, 0),
+        arc::ex::StateError
+    );
+    ARC_CHECK_THROW(
+        file.read_at(&read_data[0], 1, -1),
+        arc::ex::IndexOutOfBoundsError
+    );
+}
+
+//------------------------------------------------------------------------------
+//                                   CALLBACKS
+//------------------------------------------------------------------------------
+
+ARC_TEST_UNIT_FIXTURE(callbacks, AsyncFileFixture)
+{
+    arc::io::sys::AsyncFile file(
+        fixture->path,
+        arc::io::sys::AsyncFile::ACCESS_READ_WRITE
+    );
+
+    std::atomic<std::size_t> completed(0);
+    std::atomic<arc::int64> bytes(0);
+    for(std::size_t i = 0; i < fixture->block_count; ++i)
+    {
+        file.write_at(
+            &fixture->data[i * fixture->block_size],
+            fixture->block_size,
+            static_cast<arc::int64>(i * fixture->block_size),
+            [&](const arc::io::sys::AsyncFile::Request& request)
+            {
+                bytes += request.wait();
+                ++completed;
+            }
+        );
+    }
+    file.wait_all();
+
+    ARC_CHECK_EQUAL(completed.load(), fixture->block_count);
+    ARC_CHECK_EQUAL(
+        bytes.load(),
+        static_cast<arc::int64>(fixture->data.size())
+    );
+    ARC_CHECK_EQUAL(file.get_queue_depth(), 0);
+}
+
+//------------------------------------------------------------------------------
+//                                  CANCELLATION
+//------------------------------------------------------------------------------
+
+ARC_TEST_UNIT_FIXTURE(cancel, AsyncFileFixture)
+{
+    arc::io::sys::AsyncFile file(
+        fixture->path,
+        arc::io::sys::AsyncFile::ACCESS_READ_WRITE,
+        1
+    );
+
+    // block the only I/O thread until released
+    std::mutex mutex;
+    std::condition_variable condition;
+    bool released = false;
+    arc::io::sys::AsyncFile::Request blocking = file.write_at(
+        &fixture->data[0],
+        fixture->block_size,
+        0,
+        [&](const arc::io::sys::AsyncFile::Request&)
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            while(!released)
+            {
+                condition.wait(lock);
+            }
+        }
+    );
+
+    // wait for the I/O thread to take the blocking request
+    while(blocking.get_status() !=
+          arc::io::sys::AsyncFile::Request::STATUS_COMPLETE)
+    {
+        std::this_thread::yield();
+    }
+
+    // records the status of the requests passed to the callbacks
+    std::atomic<std::size_t> cancelled_callbacks(0);
+    std::atomic<std::size_t> other_callbacks(0);
+    arc::io::sys::AsyncFile::Callback callback =
+        [&](const arc::io::sys::AsyncFile::Request& request)
+        {
+            if(request.get_status() ==
+               arc::io::sys::AsyncFile::Request::STATUS_CANCELLED)
+            {
+                ++cancelled_callbacks;
+            }
+            else
+            {
+                ++other_callbacks;
+            }
+        };
+
+    ARC_TEST_MESSAGE("Checking cancelling a pending request");
+    arc::io::sys::AsyncFile::Request pending = file.write_at(
+        &fixture->data[0],
+        fixture->block_size,
+        static_cast<arc::int64>(fixture->block_size),
+        callback
+    );
+    ARC_CHECK_TRUE(pending.cancel());
+    ARC_CHECK_EQUAL(cancelled_callbacks.load(), 1);
+    ARC_CHECK_FALSE(pending.cancel());
+    ARC_CHECK_EQUAL(cancelled_callbacks.load(), 1);
+    ARC_CHECK_EQUAL(
+        pending.get_status(),
+        arc::io::sys::AsyncFile::Request::STATUS_CANCELLED
+    );
+    ARC_CHECK_THROW(pending.wait(), arc::ex::StateError);
+
+    ARC_TEST_MESSAGE("Checking cancelling all pending requests");
+    for(std::size_t i = 0; i < 3; ++i)
+    {
+        file.write_at(&fixture->data[0], fixture->block_size, 0, callback);
+    }
+    ARC_CHECK_EQUAL(file.cancel_all(), 3);
+    ARC_CHECK_EQUAL(cancelled_callbacks.load(), 4);
+    ARC_CHECK_EQUAL(file.get_queue_depth(), 0);
+
+    // release the I/O thread
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        released = true;
+    }
+    condition.notify_all();
+    ARC_CHECK_EQUAL(
+        blocking.wait(),
+        static_cast<arc::int64>(fixture->block_size)
+    );
+    ARC_CHECK_FALSE(blocking.cancel());
+
+    file.close();
+    ARC_CHECK_EQUAL(cancelled_callbacks.load(), 4);
+    ARC_CHECK_EQUAL(other_callbacks.load(), 0);
+    ARC_CHECK_EQUAL(
+        fixture->file_size(),
+        static_cast<arc::int64>(fixture->block_size)
+    );
+}
+
+//------------------------------------------------------------------------------
+//                                  QUEUE DEPTH
+//------------------------------------------------------------------------------
+
+ARC_TEST_UNIT_FIXTURE(queue_depth, AsyncFileFixture)
+{
+    arc::io::sys::AsyncFile file(arc::io::sys::AsyncFile::ACCESS_WRITE, 1, 2);
+    ARC_CHECK_EQUAL(file.get_max_queue_depth(), 2);
+    ARC_CHECK_THROW(file.set_max_queue_depth(0), arc::ex::ValueError);
+    ARC_CHECK_THROW(file.set_thread_count(0), arc::ex::ValueError);
+    ARC_CHECK_THROW(
+        file.write_at(&fixture->data[0], 1, 0),
+        arc::ex::StateError
+    );
+
+    file.open(fixture->path);
+    ARC_CHECK_THROW(file.set_max_queue_depth(4), arc::ex::StateError);
+
+    ARC_TEST_MESSAGE("Checking submission is bounded by the queue depth");
+    std::atomic<std::size_t> max_depth(0);
+    for(std::size_t i = 0; i < fixture->block_count; ++i)
+    {
+        file.write_at(
+            &fixture->data[i * fixture->block_size],
+            fixture->block_size,
+            static_cast<arc::int64>(i * fixture->block_size)
+        );
+        std::size_t depth = file.get_queue_depth();
+        if(depth > max_depth)
+        {
+            max_depth = depth;
+        }
+    }
+    ARC_CHECK_TRUE(max_depth.load() <= 2);
+
+    ARC_TEST_MESSAGE("Checking closing performs all queued requests");
+    file.close();
+    ARC_CHECK_EQUAL(
+        fixture->file_size(),
+        static_cast<arc::int64>(fixture->data.size())
+    );
+
+    ARC_TEST_MESSAGE("Checking closing releases blocked submitters");
+    file.set_max_queue_depth(1);
+    file.open();
+
+    // block the only I/O thread until released
+    std::mutex mutex;
+    std::condition_variable condition;
+    bool released = false;
+    arc::io::sys::AsyncFile::Request blocking = file.write_at(
+        &fixture->data[0],
+        fixture->block_size,
+        0,
+        [&](const arc::io::sys::AsyncFile::Request&)
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            while(!released)
+            {
+                condition.wait(lock);
+            }
+        }
+    );
+    while(blocking.get_status() !=
+          arc::io::sys::AsyncFile::Request::STATUS_COMPLETE)
+    {
+        std::this_thread::yield();
+    }
+    // fill the queue
+    arc::io::sys::AsyncFile::Request queued =
+        file.write_at(&fixture->data[0], fixture->block_size, 0);
+
+    // this submitter blocks until the file is closed
+    std::atomic<bool> rejected(false);
+    std::thread submitter([&]()
+    {
+        try
+        {
+            file.write_at(&fixture->data[0], fixture->block_size, 0);
+        }
+        catch(const arc::ex::StateError&)
+        {
+            rejected = true;
+        }
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    std::thread closer([&]()
+    {
+        file.close();
+    });
+    submitter.join();
+    ARC_CHECK_TRUE(rejected.load());
+
+    // release the I/O thread so the close can complete
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        released = true;
+    }
+    condition.notify_all();
+    closer.join();
+    ARC_CHECK_FALSE(file.is_open());
+    ARC_CHECK_EQUAL(
+        queued.get_status(),
+        arc::io::sys::AsyncFile::Request::STATUS_COMPLETE
+    );
+}
+
+//------------------------------------------------------------------------------
+//                                 CONCURRENT CLOSE
+//------------------------------------------------------------------------------
+
+ARC_TEST_UNIT_FIXTURE(concurrent_close, AsyncFileFixture)
+{
+    arc::io::sys::AsyncFile file(arc::io::sys::AsyncFile::ACCESS_WRITE, 2, 4);
+
+    ARC_TEST_MESSAGE("Checking submitting requests while the file is closed");
+    for(std::size_t round = 0; round < 20; ++round)
+    {
+        file.open(fixture->path);
+
+        // each submitter keeps submitting until the file is closed
+        std::atomic<std::size_t> accepted(0);
+        std::atomic<std::size_t> completed(0);
+        std::vector<std::thread> submitters;
+        for(std::size_t i = 0; i < 4; ++i)
+        {
+            submitters.push_back(std::thread([&, i]()
+            {
+                try
+                {
+                    while(true)
+                    {
+                        file.write_at(
+                            &fixture->data[i * fixture->block_size],
+                            fixture->block_size,
+                            static_cast<arc::int64>(i * fixture->block_size),
+                            [&](const arc::io::sys::AsyncFile::Request&)
+                            {
+                                ++completed;
+                            }
+                        );
+                        ++accepted;
+                    }
+                }
+                catch(const arc::ex::StateError&)
+                {
+                }
+            }));
+        }
+
+        // let the submitters fill the queue before closing underneath them
+        while(accepted.load() < 8)
+        {
+            std::this_thread::yield();
+        }
+        file.close();
+        ARC_FOR_EACH(submitter, submitters)
+        {
+            submitter->join();
+        }
+
+        // every accepted request was performed before the close completed
+        ARC_CHECK_EQUAL(completed.load(), accepted.load());
+    }
+}
+
+} // namespace anonymous
@@ -0,0 +1,158 @@
+#include <arcanecore/test/ArcTest.hpp>
+
+ARC_TEST_MODULE(io.sys.DirEntry)
+
+#include <algorithm>
+
+#include <arcanecore/base/clock/ClockOperations.hpp>
+#include <arcanecore/io/sys/DirEntry.hpp>
+#include <arcanecore/io/sys/FileSystemOperations.hpp>
+#include <arcanecore/io/sys/FileWriter.hpp>
+
+namespace
+{
+
+//------------------------------------------------------------------------------
+//                                GENERIC FIXTURE
+//------------------------------------------------------------------------------
+
+class DirEntryFixture : public arc::test::Fixture
+{
+public:
+
+    //----------------------------PUBLIC ATTRIBUTES-----------------------------
+
+    arc::io::sys::Path root;
+
+    std::vector<arc::io::sys::Path> files;
+    std::vector<arc::int64> sizes;
+    arc::io::sys::Path sub_directory;
+
+    //-------------------------PUBLIC MEMBER FUNCTIONS--------------------------
+
+    virtual void setup()
+    {
+        root << "tests" << "data" << "file_system" << "dir_entry_dir";
+        arc::io::sys::create_directory(root);
+
+        sub_directory = root;
+        sub_directory << "sub_dir";
+        arc::io::sys::create_directory(sub_directory);
+
+        for(std::size_t i = 0; i < 3; ++i)
+        {
+            arc::io::sys::Path f(root);
+            f << (arc::str::UTF8String("file_") << i << ".txt");
+            files.push_back(f);
+
+            arc::str::UTF8String contents;
+            for(std::size_t j = 0; j < i * 100 + 1; ++j)
+            {
+                contents << "a";
+            }
+            arc::io::sys::FileWriter writer(f);
+            writer.write(contents);
+            sizes.push_back(static_cast<arc::int64>(contents.get_length()));
+        }
+    }
+
+    virtual void teardown()
+    {
+        arc::io::sys::delete_path_rec(root);
+    }
+};
+
+//------------------------------------------------------------------------------
+//                                    METADATA
+//------------------------------------------------------------------------------
+
+ARC_TEST_UNIT_FIXTURE(metadata, DirEntryFixture)
+{
+    // allow for file systems with coarse timestamps
+    arc::uint64 now = arc::clock::get_current_time();
+    arc::uint64 tolerance = 60 * 1000;
+
+    for(int load = 0; load < 2; ++load)
+    {
+        std::vector<arc::io::sys::DirEntry> entries(
+            arc::io::sys::list_entries(fixture->root, false, load != 0));
+        ARC_CHECK_EQUAL(entries.size(), fixture->files.size() + 1);
+        if(entries.size() != fixture->files.size() + 1)
+        {
+            return;
+        }
+
+        for(std::size_t i = 0; i < fixture->files.size(); ++i)
+        {
+            const arc::io::sys::DirEntry& entry = entries[i];
+            ARC_CHECK_EQUAL(entry.get_path(), fixture->files[i]);
+            ARC_CHECK_EQUAL(entry.has_metadata(), load != 0);
+            ARC_CHECK_EQUAL(
+                entry.get_type(),
+                arc::io::sys::DirEntry::TYPE_FILE
+            );
+            ARC_CHECK_FALSE(entry.is_special());
+            ARC_CHECK_EQUAL(entry.get_size(), fixture->sizes[i]);
+            ARC_CHECK_TRUE(entry.has_metadata());
+            ARC_CHECK_TRUE(entry.get_modified_time() + tolerance > now);
+            ARC_CHECK_TRUE(entry.get_modified_time() < now + tolerance);
+#ifdef ARC_OS_UNIX
+            ARC_CHECK_NOT_EQUAL(entry.get_inode(), 0);
+#endif
+        }
+
+        ARC_CHECK_EQUAL(entries.back().get_path(), fixture->sub_directory);
+        ARC_CHECK_EQUAL(
+            entries.back().get_type(),
+            arc::io::sys::DirEntry::TYPE_DIRECTORY
+        );
+    }
+
+    ARC_TEST_MESSAGE("Checking an entry constructed from a path");
+    arc::io::sys::DirEntry entry(fixture->files[2]);
+    ARC_CHECK_FALSE(entry.has_metadata());
+    ARC_CHECK_EQUAL(entry.get_type(), arc::io::sys::DirEntry::TYPE_FILE);
+    ARC_CHECK_TRUE(entry.has_metadata());
+    ARC_CHECK_EQUAL(entry.get_size(), fixture->sizes[2]);
+
+    ARC_TEST_MESSAGE("Checking special entries");
+    std::vector<arc::io::sys::DirEntry> special(
+        arc::io::sys::list_entries(fixture->sub_directory, true));
+    ARC_CHECK_EQUAL(special.size(), 2);
+    ARC_FOR_EACH(it, special)
+    {
+        ARC_CHECK_TRUE(it->is_special());
+        ARC_CHECK_EQUAL(
+            it->get_type(),
+            arc::io::sys::DirEntry::TYPE_DIRECTORY
+        );
+    }
+}
+
+//------------------------------------------------------------------------------
+//                                    MISSING
+//------------------------------------------------------------------------------
+
+ARC_TEST_UNIT_FIXTURE(missing, DirEntryFixture)
+{
+    arc::io::sys::Path path(fixture->root);
+    path << "does_not_exist";
+
+    arc::io::sys::DirEntry entry(path);
+    ARC_CHECK_EQUAL(entry.get_type(), arc::io::sys::DirEntry::TYPE_UNKNOWN);
+    ARC_CHECK_FALSE(arc::io::sys::exists(entry));
+    ARC_CHECK_THROW(entry.get_size(), arc::ex::IOError);
+    ARC_CHECK_THROW(entry.get_modified_time(), arc::ex::IOError);
+    ARC_CHECK_THROW(arc::io::sys::delete_path(entry), arc::ex::IOError);
+    ARC_CHECK_THROW(arc::io::sys::delete_path_rec(entry), arc::ex::IOError);
+
+    ARC_TEST_MESSAGE("Checking entries of a deleted path");
+    std::vector<arc::io::sys::DirEntry> entries(
+        arc::io::sys::list_entries(fixture->root));
+    arc::io::sys::delete_path_rec(entries.back());
+    ARC_CHECK_FALSE(arc::io::sys::exists(fixture->sub_directory));
+    arc::io::sys::delete_path(entries.front());
+    ARC_CHECK_FALSE(arc::io::sys::exists(fixture->files.front()));
+}
+
+} // namespace anonymous
@@ -0,0 +1,263 @@
+#include <arcanecore/test/ArcTest.hpp>
+
+ARC_TEST_MODULE(io.sys.DirectoryWalker)
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <arcanecore/io/sys/DirectoryWalker.hpp>
+#include <arcanecore/io/sys/FileSystemOperations.hpp>
+#include <arcanecore/io/sys/FileWriter.hpp>
+
+namespace
+{
+
+//------------------------------------------------------------------------------
+//                                GENERIC FIXTURE
+//------------------------------------------------------------------------------
+
+class DirectoryWalkerFixture : public arc::test::Fixture
+{
+public:
+
+    //----------------------------PUBLIC ATTRIBUTES-----------------------------
+
+    arc::io::sys::Path root;
+
+    std::vector<arc::io::sys::Path> directories;
+    std::vector<arc::io::sys::Path> files;
+
+    //-------------------------PUBLIC MEMBER FUNCTIONS--------------------------
+
+    virtual void setup()
+    {
+        root << "tests" << "data" << "file_system" << "walker_dir";
+
+        // build a tree of directories each containing a few files
+        for(std::size_t i = 0; i < 4; ++i)
+        {
+            arc::io::sys::Path a(root);
+            a << (arc::str::UTF8String("dir_") << i);
+            directories.push_back(a);
+
+            for(std::size_t j = 0; j < 3; ++j)
+            {
+                arc::io::sys::Path b(a);
+                b << (arc::str::UTF8String("sub_") << j);
+                directories.push_back(b);
+
+                for(std::size_t k = 0; k < 2; ++k)
+                {
+                    arc::io::sys::Path f(b);
+                    f << (arc::str::UTF8String("file_") << k << ".txt");
+                    files.push_back(f);
+                }
+            }
+
+            arc::io::sys::Path f(a);
+            f << "測試.txt";
+            files.push_back(f);
+        }
+
+        arc::io::sys::create_directory(root);
+        ARC_FOR_EACH(directory, directories)
+        {
+            arc::io::sys::create_directory(*directory);
+        }
+        ARC_FOR_EACH(file, files)
+        {
+            arc::io::sys::FileWriter writer(*file);
+            writer.write(file->get_back());
+        }
+    }
+
+    virtual void teardown()
+    {
+        arc::io::sys::delete_path_rec(root);
+    }
+
+    std::vector<arc::io::sys::Path> all_paths()
+    {
+        std::vector<arc::io::sys::Path> ret(directories);
+        ret.insert(ret.end(), files.begin(), files.end());
+        std::sort(ret.begin(), ret.end());
+        return ret;
+    }
+};
+
+//------------------------------------------------------------------------------
+//                                     SERIAL
+//------------------------------------------------------------------------------
+
+ARC_TEST_UNIT_FIXTURE(serial, DirectoryWalkerFixture)
+{
+    arc::io::sys::DirectoryWalker walker(fixture->root);
+    ARC_CHECK_EQUAL(walker.get_root(), fixture->root);
+    ARC_CHECK_EQUAL(walker.get_thread_count(), 1);
+    ARC_CHECK_FALSE(walker.get_sorted());
+    ARC_CHECK_FALSE(walker.get_include_special());
+
+    ARC_TEST_MESSAGE("Checking entry types and depths");
+    std::vector<arc::io::sys::Path> visited;
+    walker.walk([&](const arc::io::sys::DirectoryWalker::Entry& entry)
+    {
+        visited.push_back(entry.get_path());
+        ARC_CHECK_EQUAL(
+            entry.depth + fixture->root.get_length(),
+            entry.get_path().get_length() - 1
+        );
+        if(arc::io::sys::is_directory(entry.get_path()))
+        {
+            ARC_CHECK_EQUAL(
+                entry.get_type(),
+                arc::io::sys::DirEntry::TYPE_DIRECTORY
+            );
+        }
+        else
+        {
+            ARC_CHECK_EQUAL(
+                entry.get_type(),
+                arc::io::sys::DirEntry::TYPE_FILE
+            );
+        }
+    });
+    std::sort(visited.begin(), visited.end());
+    ARC_CHECK_ITER_EQUAL(visited, fixture->all_paths());
+
+    ARC_TEST_MESSAGE("Checking sorted order matches list_rec");
+    walker.set_sorted(true);
+    visited.clear();
+    walker.walk([&](const arc::io::sys::DirectoryWalker::Entry& entry)
+    {
+        visited.push_back(entry.get_path());
+    });
+    ARC_CHECK_ITER_EQUAL(visited, arc::io::sys::list_rec(fixture->root));
+
+    ARC_TEST_MESSAGE("Checking walking a path that is not a directory");
+    arc::io::sys::DirectoryWalker file_walker(fixture->files[0]);
+    std::size_t count = 0;
+    file_walker.walk([&](const arc::io::sys::DirectoryWalker::Entry&)
+    {
+        ++count;
+    });
+    ARC_CHECK_EQUAL(count, 0);
+}
+
+//------------------------------------------------------------------------------
+//                                FILTER AND PRUNE
+//------------------------------------------------------------------------------
+
+ARC_TEST_UNIT_FIXTURE(filter_and_prune, DirectoryWalkerFixture)
+{
+    arc::io::sys::DirectoryWalker walker(fixture->root);
+
+    ARC_TEST_MESSAGE("Checking filtering entries");
+    walker.set_filter([](const arc::io::sys::DirectoryWalker::Entry& entry)
+    {
+        return entry.get_type() == arc::io::sys::DirEntry::TYPE_FILE;
+    });
+    std::vector<arc::io::sys::Path> visited;
+    walker.walk([&](const arc::io::sys::DirectoryWalker::Entry& entry)
+    {
+        visited.push_back(entry.get_path());
+    });
+    std::sort(visited.begin(), visited.end());
+    std::vector<arc::io::sys::Path> expected(fixture->files);
+    std::sort(expected.begin(), expected.end());
+    ARC_CHECK_ITER_EQUAL(visited, expected);
+
+    ARC_TEST_MESSAGE("Checking pruning directories");
+    walker.set_prune([](const arc::io::sys::DirectoryWalker::Entry& entry)
+    {
+        return entry.depth == 1;
+    });
+    visited.clear();
+    walker.walk([&](const arc::io::sys::DirectoryWalker::Entry& entry)
+    {
+        visited.push_back(entry.get_path());
+    });
+    ARC_CHECK_EQUAL(visited.size(), 4);
+    ARC_FOR_EACH(path, visited)
+    {
+        ARC_CHECK_EQUAL(path->get_back(), "測試.txt");
+    }
+}
+
+//------------------------------------------------------------------------------
+//                                INCLUDE SPECIAL
+//------------------------------------------------------------------------------
+
+ARC_TEST_UNIT_FIXTURE(include_special, DirectoryWalkerFixture)
+{
+    arc::io::sys::DirectoryWalker walker(fixture->root);
+    walker.set_include_special(true);
+    walker.set_sorted(true);
+
+    std::vector<arc::io::sys::Path> visited;
+    walker.walk([&](const arc::io::sys::DirectoryWalker::Entry& entry)
+    {
+        visited.push_back(entry.get_path());
+    });
+    ARC_CHECK_ITER_EQUAL(visited, arc::io::sys::list_rec(fixture->root, true));
+
+    // every directory, including the root, contributes two special entries
+    std::size_t special = 0;
+    ARC_FOR_EACH(path, visited)
+    {
+        if(path->get_back() == "." || path->get_back() == "..")
+        {
+            ++special;
+        }
+    }
+    ARC_CHECK_EQUAL(special, (fixture->directories.size() + 1) * 2);
+}
+
+//------------------------------------------------------------------------------
+//                                    PARALLEL
+//------------------------------------------------------------------------------
+
+ARC_TEST_UNIT_FIXTURE(parallel, DirectoryWalkerFixture)
+{
+    arc::io::sys::DirectoryWalker walker(fixture->root);
+    walker.set_thread_count(4);
+    ARC_CHECK_EQUAL(walker.get_thread_count(), 4);
+
+    ARC_TEST_MESSAGE("Checking a parallel walk visits every path");
+    std::vector<arc::io::sys::Path> visited;
+    walker.walk([&](const arc::io::sys::DirectoryWalker::Entry& entry)
+    {
+        visited.push_back(entry.get_path());
+    });
+    std::sort(visited.begin(), visited.end());
+    ARC_CHECK_ITER_EQUAL(visited, fixture->all_paths());
+
+    ARC_TEST_MESSAGE("Checking exceptions are propagated from the visitor");
+    std::size_t count = 0;
+    ARC_CHECK_THROW(
+        walker.walk([&](const arc::io::sys::DirectoryWalker::Entry&)
+        {
+            if(++count == 5)
+            {
+                throw std::runtime_error("visitor failure");
+            }
+        }),
+        std::runtime_error
+    );
+    ARC_CHECK_EQUAL(count, 5);
+
+    walker.set_thread_count(1);
+    count = 0;
+    ARC_CHECK_THROW(
+        walker.walk([&](const arc::io::sys::DirectoryWalker::Entry&)
+        {
+            if(++count == 5)
+            {
+                throw std::runtime_error("visitor failure");
+            }
+        }),
+        std::runtime_error
+    );
+    ARC_CHECK_EQUAL(count, 5);
+}
+
+} // namespace anonymous
@@ -3,9 +3,12 @@
 ARC_TEST_MODULE(io.sys.FileReader)
 
 #include <cstring>
+#include <thread>
 
 #include <arcanecore/base/str/StringOperations.hpp>
 #include <arcanecore/io/sys/FileReader.hpp>
+#include <arcanecore/io/sys/FileSystemOperations.hpp>
+#include <arcanecore/io/sys/FileWriter.hpp>
 
 namespace
 {
@@ -518,6 +521,84 @@ ARC_TEST_UNIT_FIXTURE(read_char, FileReaderFixture)
     }
 }
 
+ARC_TEST_UNIT_FIXTURE(read_at, FileReaderFixture)
+{
+    // create readers
+    std::vector<arc::io::sys::FileReader> file_readers;
+    fixture->build_file_readers(file_readers);
+
+    for(std::size_t i = 0; i < file_readers.size(); ++i)
+    {
+        std::size_t byte_size = static_cast<std::size_t>(fixture->sizes[i]);
+
+        // read the expected data
+        std::vector<char> expected(byte_size + 1);
+        if(byte_size > 0)
+        {
+            file_readers[i].read(&expected[0], fixture->sizes[i]);
+        }
+        file_readers[i].seek(0);
+
+        ARC_TEST_MESSAGE("Checking reading from each half of the file");
+        std::size_t half = byte_size / 2;
+        std::vector<char> read_data(byte_size + 1);
+        std::thread first([&]()
+        {
+            file_readers[i].read_at(
+                &read_data[0],
+                static_cast<arc::int64>(half),
+                0
+            );
+        });
+        std::thread second([&]()
+        {
+            file_readers[i].read_at(
+                &read_data[half],
+                static_cast<arc::int64>(byte_size - half),
+                static_cast<arc::int64>(half)
+            );
+        });
+        first.join();
+        second.join();
+        ARC_CHECK_TRUE(memcmp(&read_data[0], &expected[0], byte_size) == 0);
+
+        ARC_TEST_MESSAGE("Checking the position indicator is not moved");
+        ARC_CHECK_EQUAL(file_readers[i].tell(), 0);
+        ARC_CHECK_FALSE(file_readers[i].eof());
+
+        ARC_TEST_MESSAGE("Checking reading past the end of the file");
+        ARC_CHECK_EQUAL(
+            file_readers[i].read_at(&read_data[0], 1, fixture->sizes[i]),
+            0
+        );
+        if(byte_size > 0)
+        {
+            ARC_CHECK_EQUAL(
+                file_readers[i].read_at(
+                    &read_data[0],
+                    fixture->sizes[i],
+                    fixture->sizes[i] - 1
+                ),
+                1
+            );
+            ARC_CHECK_EQUAL(read_data[0], expected[byte_size - 1]);
+        }
+
+        ARC_CHECK_THROW(
+            file_readers[i].read_at(&read_data[0], 1, -1),
+            arc::ex::IndexOutOfBoundsError
+        );
+    }
+
+    ARC_TEST_MESSAGE("Checking reading from a closed reader");
+    char c;
+    file_readers[0].close();
+    ARC_CHECK_THROW(
+        file_readers[0].read_at(&c, 1, 0),
+        arc::ex::StateError
+    );
+}
+
 ARC_TEST_UNIT_FIXTURE(read_utf8, FileReaderFixture)
 {
     // create readers
@@ -732,4 +813,135 @@ ARC_TEST_UNIT_FIXTURE(read_line_utf8, FileReaderFixture)
     }
 }
 
+//------------------------------------------------------------------------------
+//                                 READ LARGE UTF16
+//------------------------------------------------------------------------------
+
+ARC_TEST_UNIT(read_large_utf16)
+{
+    // build text large enough to be decoded in several chunks, with an odd
+    // number of ASCII characters so surrogate pairs land on chunk boundaries
+    arc::str::UTF8String expected;
+    for(std::size_t i = 0; i < 4000; ++i)
+    {
+        expected << "abc 你好 😀 " << i << "\n";
+    }
+
+    arc::io::sys::Path path;
+    path << "tests" << "data" << "file_system" << "large_utf16.txt";
+
+    arc::data::Endianness endiannesses[] =
+        {arc::data::ENDIAN_LITTLE, arc::data::ENDIAN_BIG};
+    const char* boms[] = {arc::str::UTF16LE_BOM, arc::str::UTF16BE_BOM};
+    for(std::size_t e = 0; e < 2; ++e)
+    {
+        std::size_t length = 0;
+        const char* utf16 = arc::str::utf8_to_utf16(
+            expected,
+            length,
+            endiannesses[e],
+            false
+        );
+        {
+            arc::io::sys::FileWriter writer(path);
+            writer.write(boms[e], arc::str::UTF16_BOM_SIZE);
+            writer.write(utf16, length);
+        }
+        delete[] utf16;
+
+        arc::io::sys::FileReader reader(path);
+        ARC_CHECK_EQUAL(
+            reader.get_encoding(),
+            e == 0
+                ? arc::io::sys::FileHandle::ENCODING_UTF16_LITTLE_ENDIAN
+                : arc::io::sys::FileHandle::ENCODING_UTF16_BIG_ENDIAN
+        );
+        arc::str::UTF8String read_data;
+        reader.read(read_data);
+        ARC_CHECK_EQUAL(read_data, expected);
+        ARC_CHECK_TRUE(reader.eof());
+    }
+
+    arc::io::sys::delete_path(path);
+}
+
+//------------------------------------------------------------------------------
+//                                   READ AHEAD
+//------------------------------------------------------------------------------
+
+ARC_TEST_UNIT(read_ahead)
+{
+    arc::io::sys::Path path;
+    path << "tests" << "data" << "file_system" << "read_ahead.txt";
+
+    std::vector<arc::str::UTF8String> lines;
+    arc::str::UTF8String contents;
+    for(std::size_t i = 0; i < 2000; ++i)
+    {
+        arc::str::UTF8String line;
+        line << "line number " << i;
+        lines.push_back(line);
+        contents << line << "\n";
+    }
+    {
+        arc::io::sys::FileWriter writer(path);
+        writer.write(contents);
+    }
+
+    ARC_TEST_MESSAGE("Checking lines are read from the buffer");
+    arc::io::sys::FileReader reader(
+        path,
+        arc::io::sys::FileHandle::ENCODING_UTF8
+    );
+    std::size_t line_count = 0;
+    bool matched = true;
+    while(!reader.eof())
+    {
+        arc::str::UTF8String line;
+        reader.read_line(line);
+        matched = matched && line_count < lines.size() &&
+                  line == lines[line_count];
+        ++line_count;
+    }
+    ARC_CHECK_EQUAL(line_count, lines.size());
+    ARC_CHECK_TRUE(matched);
+#ifndef ARC_IO_DISABLE_STATS
+    // the file is smaller than the read ahead size
+    ARC_CHECK_EQUAL(reader.get_io_stats().read_calls, 1);
+#endif
+
+    ARC_TEST_MESSAGE("Checking seeking back reads from the buffer");
+    reader.seek(12);
+    char data[8];
+    reader.read(data, 8);
+    ARC_CHECK_EQUAL(arc::str::UTF8String(data, 8), "0\nline n");
+#ifndef ARC_IO_DISABLE_STATS
+    ARC_CHECK_EQUAL(reader.get_io_stats().read_calls, 1);
+#endif
+
+    ARC_TEST_MESSAGE("Checking the file shrinking after it was opened");
+    reader.close();
+    reader.open();
+    {
+        arc::io::sys::FileWriter writer(path);
+        writer.write(lines[0] + "\n" + lines[1]);
+    }
+    arc::str::UTF8String line;
+    reader.read_line(line);
+    ARC_CHECK_EQUAL(line, lines[0]);
+    reader.read_line(line);
+    ARC_CHECK_EQUAL(line, lines[1]);
+    ARC_CHECK_TRUE(reader.eof());
+    ARC_CHECK_THROW(reader.read_line(line), arc::ex::EOFError);
+
+    reader.seek(0);
+    arc::str::UTF8String read_data;
+    reader.read(read_data);
+    ARC_CHECK_EQUAL(read_data, lines[0] + "\n" + lines[1]);
+    ARC_CHECK_TRUE(reader.eof());
+
+    reader.close();
+    arc::io::sys::delete_path(path);
+}
+
 } // namespace anonymous
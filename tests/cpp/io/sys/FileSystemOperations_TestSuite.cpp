@@ -4,9 +4,14 @@ ARC_TEST_MODULE( io.sys.FileSystemOperations )
 
 #include <algorithm>
 
+#include "arcanecore/io/sys/FileReader.hpp"
 #include "arcanecore/io/sys/FileSystemOperations.hpp"
 #include "arcanecore/io/sys/FileWriter.hpp"
 
+#ifdef ARC_OS_UNIX
+    #include <unistd.h>
+#endif
+
 namespace file_system_operations_tests
 {
 
@@ -331,6 +336,63 @@ ARC_TEST_UNIT_FIXTURE( exists, FileSysGenericFixture )
 #endif
 }
 
+//------------------------------------------------------------------------------
+//                             DIRECTORY ENTRY CHECKS
+//------------------------------------------------------------------------------
+
+ARC_TEST_UNIT_FIXTURE(dir_entry_checks, FileSysGenericFixture)
+{
+    std::vector<arc::io::sys::Path> paths;
+    paths.insert(
+        paths.end(), fixture->directories.begin(), fixture->directories.end());
+    paths.insert(
+        paths.end(),
+        fixture->bad_directories.begin(),
+        fixture->bad_directories.end()
+    );
+    paths.insert(paths.end(), fixture->files.begin(), fixture->files.end());
+    paths.insert(
+        paths.end(), fixture->bad_files.begin(), fixture->bad_files.end());
+
+// only test symlinks on Unix
+#ifdef ARC_OS_UNIX
+
+    paths.insert(
+        paths.end(), fixture->symlinks.begin(), fixture->symlinks.end());
+    paths.insert(
+        paths.end(),
+        fixture->broken_symlinks.begin(),
+        fixture->broken_symlinks.end()
+    );
+
+#endif
+
+    ARC_TEST_MESSAGE("Checking entries match the equivalent path checks");
+    ARC_FOR_EACH(it, paths)
+    {
+        arc::io::sys::DirEntry entry(*it);
+        for(int resolve = 0; resolve < 2; ++resolve)
+        {
+            ARC_CHECK_EQUAL(
+                arc::io::sys::exists(entry, resolve != 0),
+                arc::io::sys::exists(*it, resolve != 0)
+            );
+            ARC_CHECK_EQUAL(
+                arc::io::sys::is_file(entry, resolve != 0),
+                arc::io::sys::is_file(*it, resolve != 0)
+            );
+            ARC_CHECK_EQUAL(
+                arc::io::sys::is_directory(entry, resolve != 0),
+                arc::io::sys::is_directory(*it, resolve != 0)
+            );
+        }
+        ARC_CHECK_EQUAL(
+            arc::io::sys::is_symbolic_link(entry),
+            arc::io::sys::is_symbolic_link(*it)
+        );
+    }
+}
+
 //------------------------------------------------------------------------------
 //                                    IS FILE
 //------------------------------------------------------------------------------
@@ -679,6 +741,45 @@ ARC_TEST_UNIT_FIXTURE(list, ListFixture)
     }
 }
 
+ARC_TEST_UNIT_FIXTURE(list_entries, ListFixture)
+{
+    ARC_FOR_EACH(it, fixture->dirs)
+    {
+        for(int special = 0; special < 2; ++special)
+        {
+            std::vector<arc::io::sys::Path> l(
+                arc::io::sys::list(*it, special != 0));
+            std::vector<arc::io::sys::DirEntry> e(
+                arc::io::sys::list_entries(*it, special != 0));
+
+            ARC_CHECK_EQUAL(e.size(), l.size());
+            std::size_t s = std::min(e.size(), l.size());
+            for(std::size_t i = 0; i < s; ++i)
+            {
+                ARC_CHECK_EQUAL(e[i].get_path(), l[i]);
+                ARC_CHECK_FALSE(e[i].has_metadata());
+                ARC_CHECK_TRUE(arc::io::sys::exists(e[i]));
+                ARC_CHECK_EQUAL(
+                    arc::io::sys::is_file(e[i]),
+                    arc::io::sys::is_file(l[i])
+                );
+                ARC_CHECK_EQUAL(
+                    arc::io::sys::is_directory(e[i]),
+                    arc::io::sys::is_directory(l[i])
+                );
+            }
+        }
+    }
+
+    ARC_TEST_MESSAGE("Checking loading metadata while listing");
+    std::vector<arc::io::sys::DirEntry> e(
+        arc::io::sys::list_entries(fixture->dirs[1], false, true));
+    ARC_FOR_EACH(it, e)
+    {
+        ARC_CHECK_TRUE(it->has_metadata());
+    }
+}
+
 //------------------------------------------------------------------------------
 //                                    LIST REC
 //------------------------------------------------------------------------------
@@ -1430,6 +1531,167 @@ ARC_TEST_UNIT_FIXTURE( delete_path_rec, DeletePathRecFixture )
     }
 }
 
+ARC_TEST_UNIT_FIXTURE( delete_path_rec_parallel, DeletePathRecFixture )
+{
+    ARC_FOR_EACH( it_1, fixture->directories )
+    {
+        arc::io::sys::delete_path_rec( *it_1, 4 );
+        ARC_CHECK_FALSE( arc::io::sys::exists( *it_1 ) );
+    }
+    ARC_FOR_EACH( it_2, fixture->files )
+    {
+        arc::io::sys::delete_path_rec( *it_2, 4 );
+        ARC_CHECK_FALSE( arc::io::sys::exists( *it_2 ) );
+    }
+    ARC_FOR_EACH( it_3, fixture->invalid )
+    {
+        ARC_CHECK_THROW(
+                arc::io::sys::delete_path_rec( *it_3, 4 ),
+                arc::ex::IOError
+        );
+    }
+}
+
+//------------------------------------------------------------------------------
+//                                 COPY PATH REC
+//------------------------------------------------------------------------------
+
+class CopyPathRecFixture : public DeletePathRecFixture
+{
+public:
+
+    //----------------------------PUBLIC ATTRIBUTES-----------------------------
+
+    std::vector<arc::io::sys::Path> copies;
+
+    //-------------------------PUBLIC MEMBER FUNCTIONS--------------------------
+
+    virtual void setup()
+    {
+        // super call
+        DeletePathRecFixture::setup();
+
+#ifdef ARC_OS_UNIX
+
+        // add a symbolic link which should be recreated rather than followed
+        arc::io::sys::Path link(directories.back());
+        link << "link";
+        symlink("sub_file_1.txt", link.to_unix().get_raw());
+
+#endif
+    }
+
+    virtual void teardown()
+    {
+        std::vector<arc::io::sys::Path> paths(copies);
+        paths.insert(paths.end(), directories.begin(), directories.end());
+        paths.insert(paths.end(), files.begin(), files.end());
+        ARC_FOR_EACH(it, paths)
+        {
+            if(arc::io::sys::exists(*it))
+            {
+                arc::io::sys::delete_path_rec(*it);
+            }
+        }
+    }
+
+    arc::io::sys::Path copy_path(const arc::io::sys::Path& path)
+    {
+        arc::io::sys::Path ret(path);
+        ret[ret.get_length() - 1] += "_copy";
+        copies.push_back(ret);
+        return ret;
+    }
+
+    // checks the contents of the source and copied hierarchies match
+    void check_copy(
+            const arc::io::sys::Path& source,
+            const arc::io::sys::Path& destination)
+    {
+        std::vector<arc::io::sys::Path> src_paths(
+            arc::io::sys::list_rec(source));
+        std::vector<arc::io::sys::Path> dst_paths(
+            arc::io::sys::list_rec(destination));
+        ARC_CHECK_EQUAL(src_paths.size(), dst_paths.size());
+        if(src_paths.size() != dst_paths.size())
+        {
+            return;
+        }
+
+        for(std::size_t i = 0; i < src_paths.size(); ++i)
+        {
+            ARC_CHECK_EQUAL(
+                src_paths[i].get_back(),
+                dst_paths[i].get_back()
+            );
+            ARC_CHECK_EQUAL(
+                arc::io::sys::is_symbolic_link(src_paths[i]),
+                arc::io::sys::is_symbolic_link(dst_paths[i])
+            );
+            ARC_CHECK_EQUAL(
+                arc::io::sys::is_directory(src_paths[i], false),
+                arc::io::sys::is_directory(dst_paths[i], false)
+            );
+            if(arc::io::sys::is_file(src_paths[i]))
+            {
+                arc::io::sys::FileReader src_reader(src_paths[i]);
+                arc::io::sys::FileReader dst_reader(dst_paths[i]);
+                arc::str::UTF8String src_data;
+                arc::str::UTF8String dst_data;
+                src_reader.read(src_data);
+                dst_reader.read(dst_data);
+                ARC_CHECK_EQUAL(src_data, dst_data);
+            }
+        }
+    }
+};
+
+ARC_TEST_UNIT_FIXTURE(copy_path_rec, CopyPathRecFixture)
+{
+    ARC_TEST_MESSAGE("Checking copying directories");
+    for(std::size_t i = 0; i < fixture->directories.size(); ++i)
+    {
+        const arc::io::sys::Path& source = fixture->directories[i];
+        arc::io::sys::Path destination(fixture->copy_path(source));
+
+        // alternate between serial and parallel copies
+        arc::io::sys::copy_path_rec(source, destination, (i % 2) * 3 + 1);
+        ARC_CHECK_TRUE(arc::io::sys::is_directory(destination));
+        fixture->check_copy(source, destination);
+    }
+
+    ARC_TEST_MESSAGE("Checking copying files");
+    ARC_FOR_EACH(it, fixture->files)
+    {
+        arc::io::sys::Path destination(fixture->copy_path(*it));
+        arc::io::sys::copy_path_rec(*it, destination);
+
+        arc::io::sys::FileReader src_reader(*it);
+        arc::io::sys::FileReader dst_reader(destination);
+        arc::str::UTF8String src_data;
+        arc::str::UTF8String dst_data;
+        src_reader.read(src_data);
+        dst_reader.read(dst_data);
+        ARC_CHECK_EQUAL(src_data, dst_data);
+    }
+
+    ARC_TEST_MESSAGE("Checking IOError");
+    ARC_FOR_EACH(it, fixture->invalid)
+    {
+        ARC_CHECK_THROW(
+            arc::io::sys::copy_path_rec(*it, fixture->copy_path(*it)),
+            arc::ex::IOError
+        );
+    }
+    ARC_CHECK_THROW(
+        arc::io::sys::copy_path_rec(
+            fixture->directories.front(),
+            fixture->directories.back()
+        ),
+        arc::ex::IOError
+    );
+}
+
 //------------------------------------------------------------------------------
 //                                    VALIDATE
 //------------------------------------------------------------------------------
@@ -0,0 +1,366 @@
+#include <arcanecore/test/ArcTest.hpp>
+
+ARC_TEST_MODULE(io.sys.FileWriter)
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+#include <arcanecore/io/sys/FileReader.hpp>
+#include <arcanecore/io/sys/FileSystemOperations.hpp>
+#include <arcanecore/io/sys/FileWriter.hpp>
+
+namespace
+{
+
+//------------------------------------------------------------------------------
+//                                GENERIC FIXTURE
+//------------------------------------------------------------------------------
+
+class FileWriterFixture : public arc::test::Fixture
+{
+public:
+
+    //----------------------------PUBLIC ATTRIBUTES-----------------------------
+
+    arc::io::sys::Path path;
+
+    std::vector<arc::str::UTF8String> lines;
+    arc::str::UTF8String contents;
+
+    std::vector<arc::io::sys::FileWriter::Durability> durabilities;
+
+    //-------------------------PUBLIC MEMBER FUNCTIONS--------------------------
+
+    virtual void setup()
+    {
+        path << "tests" << "data" << "file_system" << "file_writer.txt";
+
+        lines.push_back("Hello World!");
+        lines.push_back("γειά σου Κόσμε");
+        lines.push_back("");
+        lines.push_back("this is a مزيج of text");
+        lines.push_back("this line is longer than the smallest buffer size");
+        lines.push_back("𐂣");
+
+        ARC_FOR_EACH(it, lines)
+        {
+            contents << *it << "\n";
+        }
+
+        durabilities.push_back(arc::io::sys::FileWriter::DURABILITY_NONE);
+        durabilities.push_back(arc::io::sys::FileWriter::DURABILITY_CLOSE);
+        durabilities.push_back(arc::io::sys::FileWriter::DURABILITY_PERIODIC);
+        durabilities.push_back(arc::io::sys::FileWriter::DURABILITY_WRITE);
+    }
+
+    virtual void teardown()
+    {
+        if(arc::io::sys::exists(path))
+        {
+            arc::io::sys::delete_path(path);
+        }
+    }
+
+    arc::str::UTF8String read_back()
+    {
+        arc::io::sys::FileReader reader(path);
+        arc::str::UTF8String data;
+        if(reader.get_size() > 0)
+        {
+            reader.read(data);
+        }
+        return data;
+    }
+};
+
+//------------------------------------------------------------------------------
+//                                  BUFFER SIZE
+//------------------------------------------------------------------------------
+
+ARC_TEST_UNIT_FIXTURE(buffer_size, FileWriterFixture)
+{
+    std::vector<std::size_t> buffer_sizes;
+    buffer_sizes.push_back(0);
+    buffer_sizes.push_back(1);
+    buffer_sizes.push_back(16);
+    buffer_sizes.push_back(4096);
+
+    ARC_FOR_EACH(buffer_size, buffer_sizes)
+    {
+        arc::io::sys::FileWriter writer;
+        writer.set_buffer_size(*buffer_size);
+        ARC_CHECK_EQUAL(writer.get_buffer_size(), *buffer_size);
+        writer.open(fixture->path);
+
+        ARC_CHECK_THROW(writer.set_buffer_size(0), arc::ex::StateError);
+
+        arc::int64 position = 0;
+        ARC_FOR_EACH(line, fixture->lines)
+        {
+            writer.write_line(*line);
+            position += static_cast<arc::int64>(line->get_byte_length());
+        }
+        ARC_CHECK_EQUAL(writer.tell(), position);
+        ARC_CHECK_EQUAL(writer.get_size(), position);
+
+        writer.close();
+        ARC_CHECK_EQUAL(fixture->read_back(), fixture->contents);
+    }
+}
+
+ARC_TEST_UNIT_FIXTURE(flush, FileWriterFixture)
+{
+    arc::io::sys::FileWriter writer;
+    writer.set_buffer_size(4096);
+    writer.open(fixture->path);
+
+    ARC_TEST_MESSAGE("Checking buffered data is held until flushed");
+    ARC_FOR_EACH(line, fixture->lines)
+    {
+        writer.write_line(*line, true);
+    }
+    ARC_CHECK_EQUAL(fixture->read_back(), "");
+
+    ARC_TEST_MESSAGE("Checking data is written once flushed");
+    writer.flush();
+    ARC_CHECK_EQUAL(fixture->read_back(), fixture->contents);
+}
+
+ARC_TEST_UNIT_FIXTURE(writev, FileWriterFixture)
+{
+    std::vector<std::size_t> buffer_sizes;
+    buffer_sizes.push_back(0);
+    buffer_sizes.push_back(16);
+    buffer_sizes.push_back(4096);
+
+    ARC_FOR_EACH(buffer_size, buffer_sizes)
+    {
+        arc::io::sys::FileWriter writer;
+        writer.set_buffer_size(*buffer_size);
+        writer.open(fixture->path);
+
+        ARC_TEST_MESSAGE("Checking writing a list of segments");
+        writer.writev({fixture->lines[0], "\n", "", fixture->lines[1], "\n"});
+        writer.flush();
+        arc::str::UTF8String expected;
+        expected << fixture->lines[0] << "\n" << fixture->lines[1] << "\n";
+        ARC_CHECK_EQUAL(fixture->read_back(), expected);
+
+        ARC_TEST_MESSAGE("Checking writing more segments than a single write");
+        std::vector<arc::io::sys::FileWriter::Segment> segments;
+        for(std::size_t i = 0; i < 50; ++i)
+        {
+            ARC_FOR_EACH(line, fixture->lines)
+            {
+                segments.push_back(*line);
+                segments.push_back("\n");
+                expected << *line << "\n";
+            }
+        }
+        writer.writev(&segments[0], segments.size());
+        ARC_CHECK_EQUAL(
+            writer.tell(),
+            static_cast<arc::int64>(expected.get_byte_length() - 1)
+        );
+
+        writer.close();
+        ARC_CHECK_EQUAL(fixture->read_back(), expected);
+    }
+}
+
+//------------------------------------------------------------------------------
+//                                   DURABILITY
+//------------------------------------------------------------------------------
+
+ARC_TEST_UNIT_FIXTURE(durability, FileWriterFixture)
+{
+    ARC_FOR_EACH(durability, fixture->durabilities)
+    {
+        arc::io::sys::FileWriter writer;
+        writer.set_buffer_size(16);
+        writer.set_durability(*durability);
+        ARC_CHECK_EQUAL(writer.get_durability(), *durability);
+        writer.open(fixture->path);
+
+        ARC_CHECK_THROW(
+            writer.set_durability(arc::io::sys::FileWriter::DURABILITY_NONE),
+            arc::ex::StateError
+        );
+
+        ARC_FOR_EACH(line, fixture->lines)
+        {
+            writer.write_line(*line);
+        }
+        writer.sync();
+        ARC_CHECK_EQUAL(fixture->read_back(), fixture->contents);
+
+        writer.write("end");
+        writer.close();
+        ARC_CHECK_EQUAL(fixture->read_back(), fixture->contents + "end");
+    }
+}
+
+ARC_TEST_UNIT_FIXTURE(sync_period, FileWriterFixture)
+{
+    arc::io::sys::FileWriter writer;
+    writer.set_buffer_size(4096);
+    writer.set_durability(arc::io::sys::FileWriter::DURABILITY_PERIODIC);
+    writer.set_sync_period(5);
+    ARC_CHECK_EQUAL(writer.get_sync_period(), 5);
+    writer.open(fixture->path);
+
+    ARC_CHECK_THROW(writer.set_sync_period(10), arc::ex::StateError);
+
+    ARC_FOR_EACH(line, fixture->lines)
+    {
+        writer.write_line(*line);
+    }
+
+    // wait for the background synchronisation
+    for(std::size_t i = 0; i < 200; ++i)
+    {
+        if(fixture->read_back() == fixture->contents)
+        {
+            break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    ARC_CHECK_EQUAL(fixture->read_back(), fixture->contents);
+
+    ARC_TEST_MESSAGE("Checking moving a writer with a running sync worker");
+    arc::io::sys::FileWriter moved(std::move(writer));
+    moved.write("end");
+    moved.close();
+    ARC_CHECK_EQUAL(fixture->read_back(), fixture->contents + "end");
+}
+
+#ifdef ARC_OS_LINUX
+
+ARC_TEST_UNIT(sync_period_error)
+{
+    // every write to /dev/full fails since the device has no space
+    arc::io::sys::Path full(arc::io::sys::Path::from_unix_string("/dev/full"));
+    if(!arc::io::sys::exists(full))
+    {
+        return;
+    }
+
+    arc::io::sys::FileWriter writer;
+    writer.set_buffer_size(4096);
+    writer.set_durability(arc::io::sys::FileWriter::DURABILITY_PERIODIC);
+    writer.set_sync_period(1);
+    writer.open(full);
+    writer.write("buffered", 8, false);
+
+    // the failed write of the background synchronisation is reported by a
+    // following call on this thread
+    bool thrown = false;
+    for(std::size_t i = 0; i < 400 && !thrown; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        try
+        {
+            writer.write("", 0, false);
+        }
+        catch(const arc::ex::IOError&)
+        {
+            thrown = true;
+        }
+    }
+    ARC_CHECK_TRUE(thrown);
+}
+
+#endif
+
+//------------------------------------------------------------------------------
+//                                      SEEK
+//------------------------------------------------------------------------------
+
+ARC_TEST_UNIT_FIXTURE(seek, FileWriterFixture)
+{
+    arc::io::sys::FileWriter writer;
+    writer.set_buffer_size(4096);
+    writer.open(fixture->path);
+    writer.write(fixture->contents, false);
+
+    ARC_TEST_MESSAGE("Checking seeking within buffered data");
+    arc::int64 size = static_cast<arc::int64>(
+        fixture->contents.get_byte_length() - 1);
+    writer.seek(size);
+    ARC_CHECK_EQUAL(writer.tell(), size);
+    writer.seek(0);
+    ARC_CHECK_EQUAL(writer.tell(), 0);
+    writer.write("J", 1);
+    ARC_CHECK_EQUAL(writer.get_size(), size);
+
+    ARC_TEST_MESSAGE("Checking seeking out of bounds");
+    ARC_CHECK_THROW(writer.seek(-1), arc::ex::IndexOutOfBoundsError);
+    ARC_CHECK_THROW(writer.seek(size + 1), arc::ex::IndexOutOfBoundsError);
+    ARC_CHECK_EQUAL(writer.tell(), 1);
+
+    writer.close();
+    ARC_CHECK_THROW(writer.seek(0), arc::ex::StateError);
+}
+
+//------------------------------------------------------------------------------
+//                                    WRITE AT
+//------------------------------------------------------------------------------
+
+ARC_TEST_UNIT_FIXTURE(write_at, FileWriterFixture)
+{
+    arc::io::sys::FileWriter writer(fixture->path);
+
+    ARC_TEST_MESSAGE("Checking concurrent writes to separate regions");
+    const char* data = fixture->contents.get_raw();
+    std::size_t length = fixture->contents.get_byte_length() - 1;
+    std::size_t thread_count = 4;
+    std::size_t region = (length + thread_count - 1) / thread_count;
+    std::vector<std::thread> threads;
+    for(std::size_t i = 0; i < thread_count; ++i)
+    {
+        threads.push_back(std::thread([&, i]()
+        {
+            std::size_t begin = std::min(i * region, length);
+            std::size_t end = std::min(begin + region, length);
+            writer.write_at(
+                data + begin,
+                end - begin,
+                static_cast<arc::int64>(begin)
+            );
+        }));
+    }
+    ARC_FOR_EACH(thread, threads)
+    {
+        thread->join();
+    }
+    ARC_CHECK_EQUAL(fixture->read_back(), fixture->contents);
+
+    ARC_TEST_MESSAGE("Checking the position indicator is not moved");
+    ARC_CHECK_EQUAL(writer.tell(), 0);
+    ARC_CHECK_EQUAL(writer.get_size(), static_cast<arc::int64>(length));
+
+    ARC_TEST_MESSAGE("Checking overwriting data");
+    writer.write_at("J", 1, 0);
+    ARC_CHECK_THROW(
+        writer.write_at("J", 1, -1),
+        arc::ex::IndexOutOfBoundsError
+    );
+    writer.close();
+    arc::str::UTF8String expected("J");
+    expected << fixture->contents.substring(
+        1,
+        fixture->contents.get_length() - 1
+    );
+    ARC_CHECK_EQUAL(fixture->read_back(), expected);
+
+    ARC_CHECK_THROW(writer.write_at("J", 1, 0), arc::ex::StateError);
+
+    ARC_TEST_MESSAGE("Checking writers opened for appending");
+    writer.set_open_mode(arc::io::sys::FileWriter::OPEN_APPEND);
+    writer.open();
+    ARC_CHECK_EQUAL(writer.tell(), static_cast<arc::int64>(length));
+    ARC_CHECK_THROW(writer.write_at("J", 1, 0), arc::ex::StateError);
+}
+
+} // namespace anonymous
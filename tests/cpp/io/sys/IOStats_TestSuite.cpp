@@ -0,0 +1,143 @@
+#include <arcanecore/test/ArcTest.hpp>
+
+ARC_TEST_MODULE(io.sys.IOStats)
+
+#include <sstream>
+
+#include <arcanecore/io/sys/FileReader.hpp>
+#include <arcanecore/io/sys/FileSystemOperations.hpp>
+#include <arcanecore/io/sys/FileWriter.hpp>
+#include <arcanecore/io/sys/IOStats.hpp>
+
+namespace
+{
+
+//------------------------------------------------------------------------------
+//                                GENERIC FIXTURE
+//------------------------------------------------------------------------------
+
+class IOStatsFixture : public arc::test::Fixture
+{
+public:
+
+    //----------------------------PUBLIC ATTRIBUTES-----------------------------
+
+    arc::io::sys::Path path;
+
+    //-------------------------PUBLIC MEMBER FUNCTIONS--------------------------
+
+    virtual void setup()
+    {
+        path << "tests" << "data" << "file_system" << "io_stats.txt";
+    }
+
+    virtual void teardown()
+    {
+        arc::io::sys::delete_path(path);
+    }
+};
+
+//------------------------------------------------------------------------------
+//                                  FILE HANDLE
+//------------------------------------------------------------------------------
+
+ARC_TEST_UNIT_FIXTURE(file_handle, IOStatsFixture)
+{
+    arc::io::sys::reset_global_io_stats();
+
+    ARC_TEST_MESSAGE("Checking writes are counted");
+    arc::io::sys::FileWriter writer(
+        fixture->path,
+        arc::io::sys::FileWriter::OPEN_TRUNCATE,
+        arc::io::sys::FileHandle::ENCODING_RAW
+    );
+    writer.write(arc::str::UTF8String("Hello World"), false);
+    writer.flush();
+    writer.sync();
+
+    arc::io::sys::IOStats stats = writer.get_io_stats();
+#ifndef ARC_IO_DISABLE_STATS
+    ARC_CHECK_EQUAL(stats.bytes_written, 11);
+    ARC_CHECK_EQUAL(stats.write_calls, 1);
+    ARC_CHECK_EQUAL(stats.flush_calls, 1);
+    ARC_CHECK_EQUAL(stats.bytes_read, 0);
+    ARC_CHECK_EQUAL(stats.read_calls, 0);
+#endif
+
+    ARC_TEST_MESSAGE("Checking moving transfers the counts");
+    arc::io::sys::FileWriter moved(std::move(writer));
+    ARC_CHECK_EQUAL(writer.get_io_stats().bytes_written, 0);
+#ifndef ARC_IO_DISABLE_STATS
+    ARC_CHECK_EQUAL(moved.get_io_stats().bytes_written, 11);
+#endif
+    moved.close();
+
+    ARC_TEST_MESSAGE("Checking reads are counted");
+    arc::io::sys::FileReader reader(
+        fixture->path,
+        arc::io::sys::FileHandle::ENCODING_RAW
+    );
+    char data[11];
+    reader.read(data, 11);
+    reader.seek(0);
+    reader.read_at(data, 5, 6);
+
+    stats = reader.get_io_stats();
+#ifndef ARC_IO_DISABLE_STATS
+    ARC_CHECK_EQUAL(stats.bytes_read, 16);
+    ARC_CHECK_EQUAL(stats.read_calls, 2);
+    // the reader tracks its own position so seeking does not reach the OS
+    ARC_CHECK_EQUAL(stats.seek_calls, 0);
+    ARC_CHECK_EQUAL(stats.bytes_written, 0);
+#endif
+
+    ARC_TEST_MESSAGE("Checking the global counts include both handles");
+    arc::io::sys::IOStats global = arc::io::sys::get_global_io_stats();
+#ifndef ARC_IO_DISABLE_STATS
+    ARC_CHECK_TRUE(global.bytes_written >= 11);
+    ARC_CHECK_TRUE(global.bytes_read >= 16);
+    ARC_CHECK_TRUE(global.flush_calls >= 1);
+#endif
+
+    ARC_TEST_MESSAGE("Checking reset");
+    reader.reset_io_stats();
+    ARC_CHECK_EQUAL(reader.get_io_stats().bytes_read, 0);
+    ARC_CHECK_EQUAL(reader.get_io_stats().read_calls, 0);
+    ARC_CHECK_EQUAL(reader.get_io_stats().blocked_time, 0);
+    // resetting a handle leaves the global counts alone
+    ARC_CHECK_EQUAL(
+        arc::io::sys::get_global_io_stats().bytes_read,
+        global.bytes_read
+    );
+}
+
+//------------------------------------------------------------------------------
+//                                     FORMAT
+//------------------------------------------------------------------------------
+
+ARC_TEST_UNIT(format)
+{
+    arc::io::sys::IOStats stats;
+    stats.bytes_read = 1024;
+    stats.read_calls = 2;
+    stats.bytes_written = 12;
+    stats.write_calls = 1;
+    stats.seek_calls = 3;
+    stats.flush_calls = 4;
+    stats.blocked_time = 56000;
+
+    const arc::str::UTF8String expected(
+        "read: 1024 bytes in 2 calls, written: 12 bytes in 1 calls, seeks: 3, "
+        "flushes: 4, blocked: 56us"
+    );
+
+    arc::str::UTF8String s;
+    s << stats;
+    ARC_CHECK_EQUAL(s, expected);
+
+    std::ostringstream stream;
+    stream << stats;
+    ARC_CHECK_EQUAL(arc::str::UTF8String(stream.str().c_str()), expected);
+}
+
+} // namespace anonymous
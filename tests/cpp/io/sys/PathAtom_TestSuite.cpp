@@ -0,0 +1,138 @@
+#include <arcanecore/test/ArcTest.hpp>
+
+ARC_TEST_MODULE(io.sys.PathAtom)
+
+#include <thread>
+#include <unordered_set>
+
+#include <arcanecore/io/sys/PathAtom.hpp>
+
+namespace
+{
+
+//------------------------------------------------------------------------------
+//                                GENERIC FIXTURE
+//------------------------------------------------------------------------------
+
+class PathAtomFixture : public arc::test::Fixture
+{
+public:
+
+    //----------------------------PUBLIC ATTRIBUTES-----------------------------
+
+    std::vector<arc::io::sys::Path> paths;
+
+    //-------------------------PUBLIC MEMBER FUNCTIONS--------------------------
+
+    virtual void setup()
+    {
+        for(std::size_t i = 0; i < 16; ++i)
+        {
+            arc::io::sys::Path p;
+            p << "path_atom" << "res" << (arc::str::UTF8String("file_") << i);
+            paths.push_back(p);
+        }
+
+        arc::io::sys::Path p;
+        p << "path_atom" << "ｕｎｉｃｏｄｅ" << "測試.txt";
+        paths.push_back(p);
+    }
+};
+
+//------------------------------------------------------------------------------
+//                                   INTERNING
+//------------------------------------------------------------------------------
+
+ARC_TEST_UNIT_FIXTURE(interning, PathAtomFixture)
+{
+    ARC_TEST_MESSAGE("Checking the empty path");
+    arc::io::sys::PathAtom empty;
+    ARC_CHECK_EQUAL(empty.get_id(), 0);
+    ARC_CHECK_TRUE(empty.get_path().is_empty());
+    ARC_CHECK_EQUAL(arc::io::sys::PathAtom(arc::io::sys::Path()), empty);
+
+    ARC_TEST_MESSAGE("Checking equal paths share an id");
+    std::vector<arc::io::sys::PathAtom> atoms;
+    std::unordered_set<arc::uint32> ids;
+    ARC_FOR_EACH(path, fixture->paths)
+    {
+        arc::io::sys::PathAtom atom(*path);
+        atoms.push_back(atom);
+        ids.insert(atom.get_id());
+
+        ARC_CHECK_NOT_EQUAL(atom, empty);
+        ARC_CHECK_EQUAL(atom.get_path(), *path);
+
+        arc::io::sys::PathAtom copy(
+            arc::io::sys::Path::from_unix_string(path->to_unix()));
+        ARC_CHECK_EQUAL(copy, atom);
+        ARC_CHECK_EQUAL(copy.get_id(), atom.get_id());
+        ARC_CHECK_EQUAL(
+            std::hash<arc::io::sys::PathAtom>()(copy),
+            std::hash<arc::io::sys::PathAtom>()(atom)
+        );
+    }
+    ARC_CHECK_EQUAL(ids.size(), fixture->paths.size());
+
+    ARC_TEST_MESSAGE("Checking interning again does not grow the table");
+    std::size_t table_size = arc::io::sys::PathAtom::get_table_size();
+    ARC_FOR_EACH(path, fixture->paths)
+    {
+        arc::io::sys::PathAtom atom(*path);
+    }
+    ARC_CHECK_EQUAL(arc::io::sys::PathAtom::get_table_size(), table_size);
+}
+
+//------------------------------------------------------------------------------
+//                                      FIND
+//------------------------------------------------------------------------------
+
+ARC_TEST_UNIT_FIXTURE(find, PathAtomFixture)
+{
+    arc::io::sys::PathAtom expected(fixture->paths[0]);
+    arc::io::sys::PathAtom atom;
+    ARC_CHECK_TRUE(arc::io::sys::PathAtom::find(fixture->paths[0], atom));
+    ARC_CHECK_EQUAL(atom, expected);
+
+    ARC_TEST_MESSAGE("Checking find does not intern new paths");
+    arc::io::sys::Path missing(fixture->paths[0]);
+    missing << "never_interned";
+    std::size_t table_size = arc::io::sys::PathAtom::get_table_size();
+    ARC_CHECK_FALSE(arc::io::sys::PathAtom::find(missing, atom));
+    ARC_CHECK_EQUAL(atom, expected);
+    ARC_CHECK_EQUAL(arc::io::sys::PathAtom::get_table_size(), table_size);
+}
+
+//------------------------------------------------------------------------------
+//                                    THREADS
+//------------------------------------------------------------------------------
+
+ARC_TEST_UNIT_FIXTURE(threads, PathAtomFixture)
+{
+    // intern the same paths from several threads at once
+    std::vector<std::vector<arc::uint32> > results(4);
+    std::vector<std::thread> threads;
+    for(std::size_t i = 0; i < results.size(); ++i)
+    {
+        threads.push_back(std::thread([&, i]()
+        {
+            for(std::size_t j = 0; j < fixture->paths.size(); ++j)
+            {
+                arc::io::sys::Path p(fixture->paths[j]);
+                p << "threads";
+                results[i].push_back(arc::io::sys::PathAtom(p).get_id());
+            }
+        }));
+    }
+    ARC_FOR_EACH(thread, threads)
+    {
+        thread->join();
+    }
+
+    for(std::size_t i = 1; i < results.size(); ++i)
+    {
+        ARC_CHECK_ITER_EQUAL(results[i], results[0]);
+    }
+}
+
+} // namespace anonymous
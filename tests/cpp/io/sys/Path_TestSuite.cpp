@@ -1144,6 +1144,38 @@ ARC_TEST_UNIT_FIXTURE( get_components, PathGenericFixture )
     }
 }
 
+//------------------------------------------------------------------------------
+//                               GET COMPONENT VIEW
+//------------------------------------------------------------------------------
+
+ARC_TEST_UNIT_FIXTURE( get_component_view, PathGenericFixture )
+{
+    for( std::size_t i = 0; i < fixture->as_paths.size(); ++i )
+    {
+        const arc::io::sys::Path& path = fixture->as_paths[ i ];
+        for( std::size_t j = 0; j < path.get_length(); ++j )
+        {
+            ARC_CHECK_EQUAL(
+                    path.get_component_view( j ).to_string(),
+                    fixture->all[ i ][ j ]
+            );
+            // the const subscript returns a NULL terminated string
+            ARC_CHECK_EQUAL(
+                    strcmp(
+                        path[ j ].get_raw(),
+                        fixture->all[ i ][ j ].get_raw()
+                    ),
+                    0
+            );
+        }
+
+        ARC_CHECK_THROW(
+                path.get_component_view( path.get_length() ),
+                arc::ex::IndexOutOfBoundsError
+        );
+    }
+}
+
 //------------------------------------------------------------------------------
 //                                   GET FRONT
 //------------------------------------------------------------------------------
@@ -1162,11 +1194,16 @@ ARC_TEST_UNIT_FIXTURE( get_front, PathGenericFixture )
                 fixture->as_paths[ i ].get_front(),
                 fixture->all[ i ].front()
         );
+        ARC_CHECK_EQUAL(
+                fixture->as_paths[ i ].get_front_view().to_string(),
+                fixture->all[ i ].front()
+        );
     }
 
     ARC_TEST_MESSAGE( "Checking IndexOutOfBoundsError" );
     arc::io::sys::Path p;
     ARC_CHECK_THROW( p.get_front(), arc::ex::IndexOutOfBoundsError );
+    ARC_CHECK_THROW( p.get_front_view(), arc::ex::IndexOutOfBoundsError );
 }
 
 //------------------------------------------------------------------------------
@@ -1187,11 +1224,16 @@ ARC_TEST_UNIT_FIXTURE( get_back, PathGenericFixture )
                 fixture->as_paths[ i ].get_back(),
                 fixture->all[ i ].back()
         );
+        ARC_CHECK_EQUAL(
+                fixture->as_paths[ i ].get_back_view().to_string(),
+                fixture->all[ i ].back()
+        );
     }
 
     ARC_TEST_MESSAGE( "Checking IndexOutOfBoundsError" );
     arc::io::sys::Path p;
     ARC_CHECK_THROW( p.get_back(), arc::ex::IndexOutOfBoundsError );
+    ARC_CHECK_THROW( p.get_back_view(), arc::ex::IndexOutOfBoundsError );
 }
 
 //------------------------------------------------------------------------------
@@ -1209,4 +1251,141 @@ ARC_TEST_UNIT_FIXTURE( get_extension, PathGenericFixture )
     }
 }
 
+//------------------------------------------------------------------------------
+//                                   NATIVE RAW
+//------------------------------------------------------------------------------
+
+ARC_TEST_UNIT_FIXTURE( get_native_raw, PathGenericFixture )
+{
+    for ( std::size_t i = 0; i < fixture->all.size(); ++i )
+    {
+        ARC_CHECK_EQUAL(
+                arc::str::UTF8String(
+                        fixture->as_paths[ i ].get_native_raw() ),
+                fixture->as_paths[ i ].to_native()
+        );
+    }
+}
+
+//------------------------------------------------------------------------------
+//                                    GET HASH
+//------------------------------------------------------------------------------
+
+ARC_TEST_UNIT_FIXTURE( get_hash, PathGenericFixture )
+{
+    for ( std::size_t i = 0; i < fixture->all.size(); ++i )
+    {
+        arc::io::sys::Path copy( fixture->all[ i ] );
+        ARC_CHECK_EQUAL( copy.get_hash(), fixture->as_paths[ i ].get_hash() );
+        ARC_CHECK_EQUAL(
+                std::hash< arc::io::sys::Path >()( copy ),
+                fixture->as_paths[ i ].get_hash()
+        );
+
+        // the cached hash must be reset by modification
+        std::size_t before = copy.get_hash();
+        copy << "extra";
+        arc::io::sys::Path expected( fixture->all[ i ] );
+        expected << "extra";
+        ARC_CHECK_EQUAL( copy.get_hash(), expected.get_hash() );
+        ARC_CHECK_NOT_EQUAL( copy.get_hash(), before );
+    }
+}
+
+//------------------------------------------------------------------------------
+//                                 SET COMPONENT
+//------------------------------------------------------------------------------
+
+ARC_TEST_UNIT_FIXTURE( set_component, PathGenericFixture )
+{
+    for ( std::size_t i = 0; i < fixture->all.size(); ++i )
+    {
+        for ( std::size_t j = 0; j < fixture->all[ i ].size(); ++j )
+        {
+            std::vector< arc::str::UTF8String > components(
+                    fixture->all[ i ] );
+            components[ j ] = "replaced";
+            arc::io::sys::Path p( fixture->as_paths[ i ] );
+            p.set_component( j, "replaced" );
+            arc::io::sys::Path expected( components );
+            ARC_CHECK_EQUAL( p, expected );
+            ARC_CHECK_EQUAL( p.get_hash(), expected.get_hash() );
+        }
+    }
+
+    ARC_TEST_MESSAGE( "Checking IndexOutOfBoundsError" );
+    arc::io::sys::Path p;
+    ARC_CHECK_THROW(
+            p.set_component( 0, "replaced" ),
+            arc::ex::IndexOutOfBoundsError
+    );
+}
+
+//------------------------------------------------------------------------------
+//                                  SPLICE NATIVE
+//------------------------------------------------------------------------------
+
+ARC_TEST_UNIT_FIXTURE( splice_native, PathGenericFixture )
+{
+    // the root component is used since it is not followed by a separator
+    std::vector< arc::str::UTF8String > values;
+    values.push_back( "spliced" );
+    values.push_back( "/" );
+
+    ARC_TEST_MESSAGE( "Checking insert" );
+    for ( std::size_t i = 0; i < fixture->all.size(); ++i )
+    {
+        for ( std::size_t j = 0; j <= fixture->all[ i ].size(); ++j )
+        {
+            ARC_FOR_EACH( value, values )
+            {
+                std::vector< arc::str::UTF8String > components(
+                        fixture->all[ i ] );
+                components.insert( components.begin() + j, *value );
+                arc::io::sys::Path p( fixture->as_paths[ i ] );
+                p.insert( j, *value );
+                ARC_CHECK_EQUAL( p.to_native(),
+                        arc::io::sys::Path( components ).to_native() );
+            }
+        }
+    }
+
+    ARC_TEST_MESSAGE( "Checking remove" );
+    for ( std::size_t i = 0; i < fixture->all.size(); ++i )
+    {
+        for ( std::size_t j = 0; j < fixture->all[ i ].size(); ++j )
+        {
+            std::vector< arc::str::UTF8String > components(
+                    fixture->all[ i ] );
+            components.erase( components.begin() + j );
+            arc::io::sys::Path p( fixture->as_paths[ i ] );
+            p.remove( j );
+            ARC_CHECK_EQUAL( p, arc::io::sys::Path( components ) );
+            ARC_CHECK_EQUAL( p.to_native(),
+                    arc::io::sys::Path( components ).to_native() );
+        }
+    }
+
+    ARC_TEST_MESSAGE( "Checking subscript assignment" );
+    for ( std::size_t i = 0; i < fixture->all.size(); ++i )
+    {
+        for ( std::size_t j = 0; j < fixture->all[ i ].size(); ++j )
+        {
+            ARC_FOR_EACH( value, values )
+            {
+                std::vector< arc::str::UTF8String > components(
+                        fixture->all[ i ] );
+                components[ j ] = *value;
+                components[ j ] += "_more";
+                arc::io::sys::Path p( fixture->as_paths[ i ] );
+                p[ j ] = *value;
+                p[ j ] += "_more";
+                ARC_CHECK_EQUAL( p, arc::io::sys::Path( components ) );
+                ARC_CHECK_EQUAL( p.to_native(),
+                        arc::io::sys::Path( components ).to_native() );
+            }
+        }
+    }
+}
+
 } // namespace path_tests
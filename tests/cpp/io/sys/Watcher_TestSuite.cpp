@@ -0,0 +1,199 @@
+#include <arcanecore/test/ArcTest.hpp>
+
+ARC_TEST_MODULE(io.sys.Watcher)
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+#include <arcanecore/io/sys/FileSystemOperations.hpp>
+#include <arcanecore/io/sys/FileWriter.hpp>
+#include <arcanecore/io/sys/Watcher.hpp>
+
+namespace
+{
+
+//------------------------------------------------------------------------------
+//                                GENERIC FIXTURE
+//------------------------------------------------------------------------------
+
+class WatcherFixture : public arc::test::Fixture
+{
+public:
+
+    //----------------------------PUBLIC ATTRIBUTES-----------------------------
+
+    arc::io::sys::Path root;
+    arc::io::sys::Path file;
+    arc::io::sys::Path sub_directory;
+
+    //-------------------------PUBLIC MEMBER FUNCTIONS--------------------------
+
+    virtual void setup()
+    {
+        root << "tests" << "data" << "file_system" << "watcher_dir";
+        arc::io::sys::create_directory(root);
+
+        file = root;
+        file << "watched.txt";
+        write(file, "initial");
+
+        sub_directory = root;
+        sub_directory << "sub_dir";
+        arc::io::sys::create_directory(sub_directory);
+    }
+
+    virtual void teardown()
+    {
+        arc::io::sys::delete_path_rec(root);
+    }
+
+    void write(const arc::io::sys::Path& path, const char* contents)
+    {
+        arc::io::sys::FileWriter writer(path);
+        writer.write(contents);
+    }
+
+    // polls the watcher until the given number of events have been queued or
+    // a generous timeout passes
+    std::vector<arc::io::sys::Watcher::Event> wait_for_events(
+            arc::io::sys::Watcher& watcher,
+            std::size_t count)
+    {
+        std::vector<arc::io::sys::Watcher::Event> events;
+        for(std::size_t i = 0; i < 500 && events.size() < count; ++i)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            watcher.poll_events(events);
+        }
+        return events;
+    }
+};
+
+//------------------------------------------------------------------------------
+//                                   WATCH FILE
+//------------------------------------------------------------------------------
+
+ARC_TEST_UNIT_FIXTURE(watch_file, WatcherFixture)
+{
+    arc::io::sys::Watcher watcher(50);
+    ARC_CHECK_EQUAL(watcher.get_debounce_time(), 50);
+
+    arc::uint64 id = watcher.watch_file(fixture->file);
+
+    ARC_TEST_MESSAGE("Checking repeated writes are coalesced");
+    for(std::size_t i = 0; i < 5; ++i)
+    {
+        fixture->write(fixture->file, "changed");
+    }
+    // changes to other files in the directory are not reported
+    arc::io::sys::Path other(fixture->root);
+    other << "other.txt";
+    fixture->write(other, "other");
+
+    std::vector<arc::io::sys::Watcher::Event> events(
+        fixture->wait_for_events(watcher, 1));
+    // allow time for any further events to be reported
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    watcher.poll_events(events);
+    ARC_CHECK_EQUAL(events.size(), 1);
+    if(events.size() != 1)
+    {
+        return;
+    }
+    ARC_CHECK_EQUAL(events[0].watch_id, id);
+    ARC_CHECK_EQUAL(events[0].path, fixture->file);
+    ARC_CHECK_TRUE(events[0].flags & arc::io::sys::Watcher::EVENT_MODIFIED);
+
+    ARC_TEST_MESSAGE("Checking deleting the file");
+    arc::io::sys::delete_path(fixture->file);
+    events = fixture->wait_for_events(watcher, 1);
+    ARC_CHECK_EQUAL(events.size(), 1);
+    if(events.size() == 1)
+    {
+        ARC_CHECK_TRUE(events[0].flags & arc::io::sys::Watcher::EVENT_DELETED);
+    }
+
+    ARC_TEST_MESSAGE("Checking unwatch");
+    ARC_CHECK_TRUE(watcher.unwatch(id));
+    ARC_CHECK_FALSE(watcher.unwatch(id));
+    fixture->write(fixture->file, "recreated");
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    events.clear();
+    ARC_CHECK_EQUAL(watcher.poll_events(events), 0);
+
+    ARC_TEST_MESSAGE("Checking watching a file in a missing directory");
+    arc::io::sys::Path missing(fixture->root);
+    missing << "missing" << "file.txt";
+    ARC_CHECK_THROW(watcher.watch_file(missing), arc::ex::IOError);
+}
+
+//------------------------------------------------------------------------------
+//                                WATCH DIRECTORY
+//------------------------------------------------------------------------------
+
+ARC_TEST_UNIT_FIXTURE(watch_directory, WatcherFixture)
+{
+    arc::io::sys::Watcher watcher(50);
+
+    std::mutex mutex;
+    std::vector<arc::io::sys::Watcher::Event> events;
+    watcher.watch_directory(
+        fixture->root,
+        true,
+        [&](const arc::io::sys::Watcher::Event& event)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            events.push_back(event);
+        }
+    );
+
+    ARC_TEST_MESSAGE("Checking changes in subdirectories are reported");
+    arc::io::sys::Path created(fixture->sub_directory);
+    created << "created.txt";
+    fixture->write(created, "created");
+
+    // new subdirectories are watched as well
+    arc::io::sys::Path new_directory(fixture->root);
+    new_directory << "new_dir";
+    arc::io::sys::create_directory(new_directory);
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    arc::io::sys::Path nested(new_directory);
+    nested << "nested.txt";
+    fixture->write(nested, "nested");
+
+    bool found_created = false;
+    bool found_nested = false;
+    for(std::size_t i = 0; i < 500 && !(found_created && found_nested); ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        std::lock_guard<std::mutex> lock(mutex);
+        ARC_FOR_EACH(event, events)
+        {
+            if(event->path == created)
+            {
+                found_created = true;
+                ARC_CHECK_TRUE(
+                    event->flags & arc::io::sys::Watcher::EVENT_CREATED);
+            }
+            if(event->path == nested)
+            {
+                found_nested = true;
+            }
+        }
+    }
+    ARC_CHECK_TRUE(found_created);
+    ARC_CHECK_TRUE(found_nested);
+
+    ARC_TEST_MESSAGE("Checking callback events are not queued");
+    std::vector<arc::io::sys::Watcher::Event> queued;
+    ARC_CHECK_EQUAL(watcher.poll_events(queued), 0);
+
+    ARC_TEST_MESSAGE("Checking watching a missing directory");
+    arc::io::sys::Path missing(fixture->root);
+    missing << "missing";
+    ARC_CHECK_THROW(watcher.watch_directory(missing), arc::ex::IOError);
+}
+
+} // namespace anonymous
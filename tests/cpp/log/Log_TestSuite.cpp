@@ -2,6 +2,11 @@
 
 ARC_TEST_MODULE(log)
 
+#include <iostream>
+#include <sstream>
+
+#include <arcanecore/io/sys/FileReader.hpp>
+#include <arcanecore/io/sys/FileSystemOperations.hpp>
 #include <arcanecore/log/LogHandler.hpp>
 #include <arcanecore/log/Input.hpp>
 #include <arcanecore/log/outputs/FileOutput.hpp>
@@ -56,4 +61,92 @@ ARC_TEST_UNIT(logging)
     ARC_CHECK_TRUE(true);
 }
 
+ARC_TEST_UNIT(file_output)
+{
+    arc::io::sys::Path log_path;
+    log_path << "logs" << "file_output.txt";
+
+    // reads back what has reached the file so far
+    auto read_back = [&]()
+    {
+        arc::io::sys::FileReader reader(log_path);
+        arc::str::UTF8String data;
+        if(reader.get_size() > 0)
+        {
+            reader.read(data);
+        }
+        return data;
+    };
+
+    arc::log::FileOutput output(log_path, true, arc::log::VERBOSITY_DEBUG);
+
+    ARC_TEST_MESSAGE("Checking messages above the flush verbosity are buffered");
+    output.write(arc::log::VERBOSITY_INFO, log_profile, "info\n");
+    ARC_CHECK_EQUAL(read_back(), "");
+
+    ARC_TEST_MESSAGE("Checking severe messages flush the buffer");
+    output.write(arc::log::VERBOSITY_WARNING, log_profile, "warning\n");
+    ARC_CHECK_EQUAL(
+        read_back(),
+        "{ArcaneLog-0.0.1} - [INFO]: info\n"
+        "{ArcaneLog-0.0.1} - [WARNING]: warning\n"
+    );
+
+    ARC_TEST_MESSAGE("Checking the buffer is flushed on close");
+    output.set_flush_verbosity(arc::log::VERBOSITY_CRITICAL);
+    ARC_CHECK_EQUAL(output.get_flush_verbosity(), arc::log::VERBOSITY_CRITICAL);
+    output.write(arc::log::VERBOSITY_ERROR, arc::log::Profile(), "error\n");
+    ARC_CHECK_EQUAL(
+        read_back(),
+        "{ArcaneLog-0.0.1} - [INFO]: info\n"
+        "{ArcaneLog-0.0.1} - [WARNING]: warning\n"
+    );
+    output.set_enabled(false);
+    ARC_CHECK_EQUAL(
+        read_back(),
+        "{ArcaneLog-0.0.1} - [INFO]: info\n"
+        "{ArcaneLog-0.0.1} - [WARNING]: warning\n"
+        "[ERROR]: error\n"
+    );
+
+    arc::io::sys::delete_path(log_path);
+}
+
+ARC_TEST_UNIT(std_output)
+{
+    // capture the output streams
+    std::ostringstream out;
+    std::ostringstream err;
+    std::streambuf* out_buffer = std::cout.rdbuf(out.rdbuf());
+    std::streambuf* err_buffer = std::cerr.rdbuf(err.rdbuf());
+
+    arc::log::StdOutput output(
+        arc::log::VERBOSITY_DEBUG,
+        arc::log::StdOutput::USEANSI_NEVER
+    );
+    output.write(arc::log::VERBOSITY_INFO, log_profile, "aל∑\n");
+    output.write(
+        arc::log::VERBOSITY_DEBUG,
+        arc::log::Profile("", "2.0"),
+        "version\n"
+    );
+    output.write(arc::log::VERBOSITY_NOTICE, arc::log::Profile(), "none\n");
+    output.write(arc::log::VERBOSITY_ERROR, log_profile2, "error\n");
+
+    output.set_use_ansi(arc::log::StdOutput::USEANSI_ALWAYS);
+    output.write(arc::log::VERBOSITY_INFO, arc::log::Profile("App"), "ansi");
+
+    std::cout.rdbuf(out_buffer);
+    std::cerr.rdbuf(err_buffer);
+
+    ARC_CHECK_EQUAL(
+        out.str(),
+        "{ArcaneLog-0.0.1} - [INFO]: aל∑\n"
+        "{2.0} - [DEBUG]: version\n"
+        "[NOTICE]: none\n"
+        "\033[00;32m{App} - [INFO]: ansi\033[00m"
+    );
+    ARC_CHECK_EQUAL(err.str(), "{ValgrindPlugin-1.4.27} - [ERROR]: error\n");
+}
+
 } // namespace